@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../lib/libittnotify.a"
+  "../lib/libittnotify.pdb"
+  "CMakeFiles/ittnotify.dir/src/ittnotify/ittnotify_static.c.o"
+  "CMakeFiles/ittnotify.dir/src/ittnotify/ittnotify_static.c.o.d"
+  "CMakeFiles/ittnotify.dir/src/ittnotify/jitprofiling.c.o"
+  "CMakeFiles/ittnotify.dir/src/ittnotify/jitprofiling.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ittnotify.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
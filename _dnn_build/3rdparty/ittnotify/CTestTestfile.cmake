@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/3rdparty/ittnotify
+# Build directory: /root/repo/_dnn_build/3rdparty/ittnotify
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,61 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/libtiff/tif_aux.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_aux.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_aux.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_close.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_close.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_close.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_codec.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_codec.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_codec.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_color.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_color.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_color.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_compress.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_compress.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_compress.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_dir.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_dir.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_dir.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_dirinfo.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_dirinfo.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_dirinfo.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_dirread.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_dirread.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_dirread.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_dirwrite.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_dirwrite.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_dirwrite.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_dumpmode.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_dumpmode.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_dumpmode.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_error.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_error.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_error.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_extension.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_extension.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_extension.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_fax3.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_fax3.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_fax3.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_fax3sm.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_fax3sm.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_fax3sm.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_flush.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_flush.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_flush.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_getimage.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_getimage.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_getimage.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_hash_set.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_hash_set.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_hash_set.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_jbig.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_jbig.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_jbig.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_jpeg.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_jpeg.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_jpeg.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_jpeg_12.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_jpeg_12.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_jpeg_12.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_luv.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_luv.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_luv.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_lzma.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_lzma.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_lzma.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_lzw.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_lzw.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_lzw.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_next.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_next.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_next.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_ojpeg.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_ojpeg.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_ojpeg.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_open.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_open.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_open.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_packbits.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_packbits.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_packbits.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_pixarlog.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_pixarlog.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_pixarlog.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_predict.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_predict.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_predict.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_print.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_print.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_print.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_read.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_read.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_read.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_strip.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_strip.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_strip.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_swab.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_swab.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_swab.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_thunder.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_thunder.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_thunder.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_tile.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_tile.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_tile.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_unix.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_unix.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_unix.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_version.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_version.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_version.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_warning.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_warning.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_warning.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_webp.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_webp.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_webp.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_write.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_write.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_write.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_zip.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_zip.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_zip.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_zstd.c" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_zstd.c.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_zstd.c.o.d"
+  "/root/repo/3rdparty/libtiff/tif_stream.cxx" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_stream.cxx.o" "gcc" "3rdparty/libtiff/CMakeFiles/libtiff.dir/tif_stream.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
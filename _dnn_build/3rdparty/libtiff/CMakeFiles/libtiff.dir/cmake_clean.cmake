@@ -0,0 +1,95 @@
+file(REMOVE_RECURSE
+  "../lib/liblibtiff.a"
+  "../lib/liblibtiff.pdb"
+  "CMakeFiles/libtiff.dir/tif_aux.c.o"
+  "CMakeFiles/libtiff.dir/tif_aux.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_close.c.o"
+  "CMakeFiles/libtiff.dir/tif_close.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_codec.c.o"
+  "CMakeFiles/libtiff.dir/tif_codec.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_color.c.o"
+  "CMakeFiles/libtiff.dir/tif_color.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_compress.c.o"
+  "CMakeFiles/libtiff.dir/tif_compress.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_dir.c.o"
+  "CMakeFiles/libtiff.dir/tif_dir.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_dirinfo.c.o"
+  "CMakeFiles/libtiff.dir/tif_dirinfo.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_dirread.c.o"
+  "CMakeFiles/libtiff.dir/tif_dirread.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_dirwrite.c.o"
+  "CMakeFiles/libtiff.dir/tif_dirwrite.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_dumpmode.c.o"
+  "CMakeFiles/libtiff.dir/tif_dumpmode.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_error.c.o"
+  "CMakeFiles/libtiff.dir/tif_error.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_extension.c.o"
+  "CMakeFiles/libtiff.dir/tif_extension.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_fax3.c.o"
+  "CMakeFiles/libtiff.dir/tif_fax3.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_fax3sm.c.o"
+  "CMakeFiles/libtiff.dir/tif_fax3sm.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_flush.c.o"
+  "CMakeFiles/libtiff.dir/tif_flush.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_getimage.c.o"
+  "CMakeFiles/libtiff.dir/tif_getimage.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_hash_set.c.o"
+  "CMakeFiles/libtiff.dir/tif_hash_set.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_jbig.c.o"
+  "CMakeFiles/libtiff.dir/tif_jbig.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_jpeg.c.o"
+  "CMakeFiles/libtiff.dir/tif_jpeg.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_jpeg_12.c.o"
+  "CMakeFiles/libtiff.dir/tif_jpeg_12.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_luv.c.o"
+  "CMakeFiles/libtiff.dir/tif_luv.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_lzma.c.o"
+  "CMakeFiles/libtiff.dir/tif_lzma.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_lzw.c.o"
+  "CMakeFiles/libtiff.dir/tif_lzw.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_next.c.o"
+  "CMakeFiles/libtiff.dir/tif_next.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_ojpeg.c.o"
+  "CMakeFiles/libtiff.dir/tif_ojpeg.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_open.c.o"
+  "CMakeFiles/libtiff.dir/tif_open.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_packbits.c.o"
+  "CMakeFiles/libtiff.dir/tif_packbits.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_pixarlog.c.o"
+  "CMakeFiles/libtiff.dir/tif_pixarlog.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_predict.c.o"
+  "CMakeFiles/libtiff.dir/tif_predict.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_print.c.o"
+  "CMakeFiles/libtiff.dir/tif_print.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_read.c.o"
+  "CMakeFiles/libtiff.dir/tif_read.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_stream.cxx.o"
+  "CMakeFiles/libtiff.dir/tif_stream.cxx.o.d"
+  "CMakeFiles/libtiff.dir/tif_strip.c.o"
+  "CMakeFiles/libtiff.dir/tif_strip.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_swab.c.o"
+  "CMakeFiles/libtiff.dir/tif_swab.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_thunder.c.o"
+  "CMakeFiles/libtiff.dir/tif_thunder.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_tile.c.o"
+  "CMakeFiles/libtiff.dir/tif_tile.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_unix.c.o"
+  "CMakeFiles/libtiff.dir/tif_unix.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_version.c.o"
+  "CMakeFiles/libtiff.dir/tif_version.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_warning.c.o"
+  "CMakeFiles/libtiff.dir/tif_warning.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_webp.c.o"
+  "CMakeFiles/libtiff.dir/tif_webp.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_write.c.o"
+  "CMakeFiles/libtiff.dir/tif_write.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_zip.c.o"
+  "CMakeFiles/libtiff.dir/tif_zip.c.o.d"
+  "CMakeFiles/libtiff.dir/tif_zstd.c.o"
+  "CMakeFiles/libtiff.dir/tif_zstd.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/libtiff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,141 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/libwebp/sharpyuv/sharpyuv.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv.c.o.d"
+  "/root/repo/3rdparty/libwebp/sharpyuv/sharpyuv_cpu.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_cpu.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_cpu.c.o.d"
+  "/root/repo/3rdparty/libwebp/sharpyuv/sharpyuv_csp.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_csp.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_csp.c.o.d"
+  "/root/repo/3rdparty/libwebp/sharpyuv/sharpyuv_dsp.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_dsp.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_dsp.c.o.d"
+  "/root/repo/3rdparty/libwebp/sharpyuv/sharpyuv_gamma.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_gamma.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_gamma.c.o.d"
+  "/root/repo/3rdparty/libwebp/sharpyuv/sharpyuv_neon.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_neon.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_neon.c.o.d"
+  "/root/repo/3rdparty/libwebp/sharpyuv/sharpyuv_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dec/alpha_dec.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/alpha_dec.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/alpha_dec.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dec/buffer_dec.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/buffer_dec.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/buffer_dec.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dec/frame_dec.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/frame_dec.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/frame_dec.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dec/idec_dec.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/idec_dec.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/idec_dec.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dec/io_dec.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/io_dec.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/io_dec.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dec/quant_dec.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/quant_dec.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/quant_dec.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dec/tree_dec.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/tree_dec.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/tree_dec.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dec/vp8_dec.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/vp8_dec.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/vp8_dec.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dec/vp8l_dec.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/vp8l_dec.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/vp8l_dec.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dec/webp_dec.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/webp_dec.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dec/webp_dec.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/demux/anim_decode.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/demux/anim_decode.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/demux/anim_decode.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/demux/demux.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/demux/demux.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/demux/demux.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/alpha_processing.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/alpha_processing.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/alpha_processing.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/alpha_processing_mips_dsp_r2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/alpha_processing_mips_dsp_r2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/alpha_processing_mips_dsp_r2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/alpha_processing_neon.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/alpha_processing_neon.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/alpha_processing_neon.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/alpha_processing_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/alpha_processing_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/alpha_processing_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/alpha_processing_sse41.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/alpha_processing_sse41.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/alpha_processing_sse41.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/cost.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cost.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cost.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/cost_mips32.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cost_mips32.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cost_mips32.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/cost_mips_dsp_r2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cost_mips_dsp_r2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cost_mips_dsp_r2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/cost_neon.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cost_neon.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cost_neon.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/cost_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cost_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cost_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/cpu.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cpu.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/cpu.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/dec.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/dec_clip_tables.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_clip_tables.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_clip_tables.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/dec_mips32.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_mips32.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_mips32.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/dec_mips_dsp_r2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_mips_dsp_r2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_mips_dsp_r2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/dec_msa.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_msa.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_msa.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/dec_neon.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_neon.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_neon.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/dec_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/dec_sse41.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_sse41.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/dec_sse41.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/enc_mips32.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_mips32.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_mips32.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/enc_mips_dsp_r2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_mips_dsp_r2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_mips_dsp_r2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/enc_msa.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_msa.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_msa.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/enc_neon.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_neon.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_neon.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/enc_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/enc_sse41.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_sse41.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/enc_sse41.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/filters.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/filters.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/filters.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/filters_mips_dsp_r2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/filters_mips_dsp_r2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/filters_mips_dsp_r2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/filters_msa.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/filters_msa.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/filters_msa.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/filters_neon.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/filters_neon.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/filters_neon.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/filters_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/filters_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/filters_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_enc_mips32.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_mips32.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_mips32.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_enc_mips_dsp_r2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_mips_dsp_r2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_mips_dsp_r2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_enc_msa.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_msa.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_msa.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_enc_neon.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_neon.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_neon.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_enc_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_enc_sse41.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_sse41.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_enc_sse41.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_mips_dsp_r2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_mips_dsp_r2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_mips_dsp_r2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_msa.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_msa.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_msa.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_neon.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_neon.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_neon.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/lossless_sse41.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_sse41.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/lossless_sse41.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/rescaler.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/rescaler_mips32.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler_mips32.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler_mips32.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/rescaler_mips_dsp_r2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler_mips_dsp_r2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler_mips_dsp_r2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/rescaler_msa.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler_msa.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler_msa.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/rescaler_neon.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler_neon.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler_neon.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/rescaler_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/rescaler_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/ssim.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/ssim.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/ssim.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/ssim_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/ssim_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/ssim_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/upsampling.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/upsampling_mips_dsp_r2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling_mips_dsp_r2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling_mips_dsp_r2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/upsampling_msa.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling_msa.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling_msa.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/upsampling_neon.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling_neon.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling_neon.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/upsampling_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/upsampling_sse41.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling_sse41.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/upsampling_sse41.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/yuv.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/yuv_mips32.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv_mips32.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv_mips32.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/yuv_mips_dsp_r2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv_mips_dsp_r2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv_mips_dsp_r2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/yuv_neon.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv_neon.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv_neon.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/yuv_sse2.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv_sse2.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv_sse2.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/dsp/yuv_sse41.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv_sse41.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/dsp/yuv_sse41.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/alpha_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/alpha_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/alpha_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/analysis_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/analysis_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/analysis_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/backward_references_cost_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/backward_references_cost_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/backward_references_cost_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/backward_references_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/backward_references_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/backward_references_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/config_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/config_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/config_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/cost_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/cost_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/cost_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/filter_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/filter_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/filter_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/frame_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/frame_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/frame_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/histogram_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/histogram_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/histogram_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/iterator_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/iterator_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/iterator_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/near_lossless_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/near_lossless_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/near_lossless_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/picture_csp_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/picture_csp_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/picture_csp_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/picture_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/picture_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/picture_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/picture_psnr_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/picture_psnr_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/picture_psnr_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/picture_rescale_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/picture_rescale_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/picture_rescale_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/picture_tools_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/picture_tools_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/picture_tools_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/predictor_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/predictor_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/predictor_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/quant_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/quant_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/quant_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/syntax_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/syntax_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/syntax_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/token_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/token_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/token_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/tree_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/tree_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/tree_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/vp8l_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/vp8l_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/vp8l_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/enc/webp_enc.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/webp_enc.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/enc/webp_enc.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/mux/anim_encode.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/mux/anim_encode.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/mux/anim_encode.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/mux/muxedit.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/mux/muxedit.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/mux/muxedit.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/mux/muxinternal.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/mux/muxinternal.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/mux/muxinternal.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/mux/muxread.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/mux/muxread.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/mux/muxread.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/bit_reader_utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/bit_reader_utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/bit_reader_utils.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/bit_writer_utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/bit_writer_utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/bit_writer_utils.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/color_cache_utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/color_cache_utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/color_cache_utils.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/filters_utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/filters_utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/filters_utils.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/huffman_encode_utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/huffman_encode_utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/huffman_encode_utils.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/huffman_utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/huffman_utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/huffman_utils.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/palette.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/palette.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/palette.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/quant_levels_dec_utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/quant_levels_dec_utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/quant_levels_dec_utils.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/quant_levels_utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/quant_levels_utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/quant_levels_utils.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/random_utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/random_utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/random_utils.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/rescaler_utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/rescaler_utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/rescaler_utils.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/thread_utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/thread_utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/thread_utils.c.o.d"
+  "/root/repo/3rdparty/libwebp/src/utils/utils.c" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/utils.c.o" "gcc" "3rdparty/libwebp/CMakeFiles/libwebp.dir/src/utils/utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,255 @@
+file(REMOVE_RECURSE
+  "../lib/liblibwebp.a"
+  "../lib/liblibwebp.pdb"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv.c.o"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv.c.o.d"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_cpu.c.o"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_cpu.c.o.d"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_csp.c.o"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_csp.c.o.d"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_dsp.c.o"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_dsp.c.o.d"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_gamma.c.o"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_gamma.c.o.d"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_neon.c.o"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_neon.c.o.d"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_sse2.c.o"
+  "CMakeFiles/libwebp.dir/sharpyuv/sharpyuv_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dec/alpha_dec.c.o"
+  "CMakeFiles/libwebp.dir/src/dec/alpha_dec.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dec/buffer_dec.c.o"
+  "CMakeFiles/libwebp.dir/src/dec/buffer_dec.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dec/frame_dec.c.o"
+  "CMakeFiles/libwebp.dir/src/dec/frame_dec.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dec/idec_dec.c.o"
+  "CMakeFiles/libwebp.dir/src/dec/idec_dec.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dec/io_dec.c.o"
+  "CMakeFiles/libwebp.dir/src/dec/io_dec.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dec/quant_dec.c.o"
+  "CMakeFiles/libwebp.dir/src/dec/quant_dec.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dec/tree_dec.c.o"
+  "CMakeFiles/libwebp.dir/src/dec/tree_dec.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dec/vp8_dec.c.o"
+  "CMakeFiles/libwebp.dir/src/dec/vp8_dec.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dec/vp8l_dec.c.o"
+  "CMakeFiles/libwebp.dir/src/dec/vp8l_dec.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dec/webp_dec.c.o"
+  "CMakeFiles/libwebp.dir/src/dec/webp_dec.c.o.d"
+  "CMakeFiles/libwebp.dir/src/demux/anim_decode.c.o"
+  "CMakeFiles/libwebp.dir/src/demux/anim_decode.c.o.d"
+  "CMakeFiles/libwebp.dir/src/demux/demux.c.o"
+  "CMakeFiles/libwebp.dir/src/demux/demux.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/alpha_processing.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/alpha_processing.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/alpha_processing_mips_dsp_r2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/alpha_processing_mips_dsp_r2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/alpha_processing_neon.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/alpha_processing_neon.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/alpha_processing_sse2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/alpha_processing_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/alpha_processing_sse41.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/alpha_processing_sse41.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/cost.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/cost.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/cost_mips32.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/cost_mips32.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/cost_mips_dsp_r2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/cost_mips_dsp_r2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/cost_neon.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/cost_neon.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/cost_sse2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/cost_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/cpu.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/cpu.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/dec.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/dec.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_clip_tables.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_clip_tables.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_mips32.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_mips32.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_mips_dsp_r2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_mips_dsp_r2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_msa.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_msa.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_neon.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_neon.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_sse2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_sse41.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/dec_sse41.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/enc.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_mips32.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_mips32.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_mips_dsp_r2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_mips_dsp_r2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_msa.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_msa.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_neon.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_neon.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_sse2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_sse41.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/enc_sse41.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/filters.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/filters.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/filters_mips_dsp_r2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/filters_mips_dsp_r2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/filters_msa.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/filters_msa.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/filters_neon.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/filters_neon.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/filters_sse2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/filters_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_mips32.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_mips32.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_mips_dsp_r2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_mips_dsp_r2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_msa.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_msa.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_neon.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_neon.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_sse2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_sse41.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_enc_sse41.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_mips_dsp_r2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_mips_dsp_r2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_msa.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_msa.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_neon.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_neon.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_sse2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_sse41.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/lossless_sse41.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler_mips32.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler_mips32.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler_mips_dsp_r2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler_mips_dsp_r2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler_msa.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler_msa.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler_neon.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler_neon.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler_sse2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/rescaler_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/ssim.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/ssim.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/ssim_sse2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/ssim_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling_mips_dsp_r2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling_mips_dsp_r2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling_msa.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling_msa.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling_neon.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling_neon.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling_sse2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling_sse41.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/upsampling_sse41.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv_mips32.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv_mips32.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv_mips_dsp_r2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv_mips_dsp_r2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv_neon.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv_neon.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv_sse2.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv_sse2.c.o.d"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv_sse41.c.o"
+  "CMakeFiles/libwebp.dir/src/dsp/yuv_sse41.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/alpha_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/alpha_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/analysis_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/analysis_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/backward_references_cost_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/backward_references_cost_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/backward_references_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/backward_references_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/config_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/config_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/cost_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/cost_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/filter_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/filter_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/frame_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/frame_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/histogram_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/histogram_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/iterator_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/iterator_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/near_lossless_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/near_lossless_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/picture_csp_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/picture_csp_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/picture_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/picture_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/picture_psnr_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/picture_psnr_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/picture_rescale_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/picture_rescale_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/picture_tools_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/picture_tools_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/predictor_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/predictor_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/quant_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/quant_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/syntax_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/syntax_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/token_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/token_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/tree_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/tree_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/vp8l_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/vp8l_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/enc/webp_enc.c.o"
+  "CMakeFiles/libwebp.dir/src/enc/webp_enc.c.o.d"
+  "CMakeFiles/libwebp.dir/src/mux/anim_encode.c.o"
+  "CMakeFiles/libwebp.dir/src/mux/anim_encode.c.o.d"
+  "CMakeFiles/libwebp.dir/src/mux/muxedit.c.o"
+  "CMakeFiles/libwebp.dir/src/mux/muxedit.c.o.d"
+  "CMakeFiles/libwebp.dir/src/mux/muxinternal.c.o"
+  "CMakeFiles/libwebp.dir/src/mux/muxinternal.c.o.d"
+  "CMakeFiles/libwebp.dir/src/mux/muxread.c.o"
+  "CMakeFiles/libwebp.dir/src/mux/muxread.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/bit_reader_utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/bit_reader_utils.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/bit_writer_utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/bit_writer_utils.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/color_cache_utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/color_cache_utils.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/filters_utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/filters_utils.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/huffman_encode_utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/huffman_encode_utils.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/huffman_utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/huffman_utils.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/palette.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/palette.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/quant_levels_dec_utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/quant_levels_dec_utils.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/quant_levels_utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/quant_levels_utils.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/random_utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/random_utils.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/rescaler_utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/rescaler_utils.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/thread_utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/thread_utils.c.o.d"
+  "CMakeFiles/libwebp.dir/src/utils/utils.c.o"
+  "CMakeFiles/libwebp.dir/src/utils/utils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libwebp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,126 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/openexr/Half/half.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Half/half.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Half/half.cpp.o.d"
+  "/root/repo/3rdparty/openexr/Iex/IexBaseExc.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Iex/IexBaseExc.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Iex/IexBaseExc.cpp.o.d"
+  "/root/repo/3rdparty/openexr/Iex/IexThrowErrnoExc.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Iex/IexThrowErrnoExc.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Iex/IexThrowErrnoExc.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfAcesFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfAcesFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfAcesFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfB44Compressor.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfB44Compressor.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfB44Compressor.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfBoxAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfBoxAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfBoxAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfCRgbaFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfCRgbaFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfCRgbaFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfChannelList.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfChannelList.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfChannelList.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfChannelListAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfChannelListAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfChannelListAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfChromaticities.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfChromaticities.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfChromaticities.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfChromaticitiesAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfChromaticitiesAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfChromaticitiesAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfCompositeDeepScanLine.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfCompositeDeepScanLine.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfCompositeDeepScanLine.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfCompressionAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfCompressionAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfCompressionAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfCompressor.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfCompressor.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfCompressor.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfConvert.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfConvert.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfConvert.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDeepCompositing.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepCompositing.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepCompositing.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDeepFrameBuffer.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepFrameBuffer.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepFrameBuffer.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDeepImageStateAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepImageStateAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepImageStateAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDeepScanLineInputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineInputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineInputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDeepScanLineInputPart.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineInputPart.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineInputPart.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDeepScanLineOutputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineOutputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineOutputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDeepScanLineOutputPart.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineOutputPart.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineOutputPart.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDeepTiledInputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledInputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledInputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDeepTiledInputPart.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledInputPart.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledInputPart.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDeepTiledOutputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledOutputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledOutputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDeepTiledOutputPart.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledOutputPart.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledOutputPart.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDoubleAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDoubleAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDoubleAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfDwaCompressor.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDwaCompressor.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfDwaCompressor.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfEnvmap.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfEnvmap.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfEnvmap.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfEnvmapAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfEnvmapAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfEnvmapAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfFastHuf.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfFastHuf.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfFastHuf.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfFloatAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfFloatAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfFloatAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfFloatVectorAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfFloatVectorAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfFloatVectorAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfFrameBuffer.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfFrameBuffer.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfFrameBuffer.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfFramesPerSecond.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfFramesPerSecond.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfFramesPerSecond.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfGenericInputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfGenericInputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfGenericInputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfGenericOutputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfGenericOutputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfGenericOutputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfHeader.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfHeader.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfHeader.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfHuf.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfHuf.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfHuf.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfIO.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfIO.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfIO.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfInputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfInputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfInputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfInputPart.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfInputPart.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfInputPart.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfInputPartData.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfInputPartData.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfInputPartData.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfIntAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfIntAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfIntAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfKeyCode.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfKeyCode.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfKeyCode.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfKeyCodeAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfKeyCodeAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfKeyCodeAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfLineOrderAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfLineOrderAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfLineOrderAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfLut.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfLut.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfLut.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfMatrixAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfMatrixAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfMatrixAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfMisc.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfMisc.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfMisc.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfMultiPartInputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfMultiPartInputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfMultiPartInputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfMultiPartOutputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfMultiPartOutputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfMultiPartOutputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfMultiView.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfMultiView.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfMultiView.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfOpaqueAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfOpaqueAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfOpaqueAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfOutputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfOutputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfOutputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfOutputPart.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfOutputPart.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfOutputPart.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfOutputPartData.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfOutputPartData.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfOutputPartData.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfPartType.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfPartType.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfPartType.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfPizCompressor.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfPizCompressor.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfPizCompressor.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfPreviewImage.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfPreviewImage.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfPreviewImage.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfPreviewImageAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfPreviewImageAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfPreviewImageAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfPxr24Compressor.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfPxr24Compressor.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfPxr24Compressor.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfRational.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRational.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRational.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfRationalAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRationalAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRationalAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfRgbaFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRgbaFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRgbaFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfRgbaYca.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRgbaYca.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRgbaYca.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfRle.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRle.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRle.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfRleCompressor.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRleCompressor.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfRleCompressor.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfScanLineInputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfScanLineInputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfScanLineInputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfStandardAttributes.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfStandardAttributes.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfStandardAttributes.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfStdIO.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfStdIO.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfStdIO.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfStringAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfStringAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfStringAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfStringVectorAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfStringVectorAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfStringVectorAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfSystemSpecific.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfSystemSpecific.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfSystemSpecific.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfTestFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTestFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTestFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfThreading.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfThreading.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfThreading.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfTileDescriptionAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTileDescriptionAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTileDescriptionAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfTileOffsets.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTileOffsets.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTileOffsets.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfTiledInputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledInputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledInputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfTiledInputPart.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledInputPart.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledInputPart.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfTiledMisc.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledMisc.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledMisc.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfTiledOutputFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledOutputFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledOutputFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfTiledOutputPart.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledOutputPart.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledOutputPart.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfTiledRgbaFile.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledRgbaFile.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTiledRgbaFile.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfTimeCode.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTimeCode.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTimeCode.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfTimeCodeAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTimeCodeAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfTimeCodeAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfVecAttribute.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfVecAttribute.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfVecAttribute.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfVersion.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfVersion.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfVersion.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfWav.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfWav.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfWav.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfZip.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfZip.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfZip.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/ImfZipCompressor.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfZipCompressor.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/ImfZipCompressor.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmImf/dwaLookups.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/dwaLookups.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmImf/dwaLookups.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmThread/IlmThread.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThread.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThread.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmThread/IlmThreadMutex.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadMutex.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadMutex.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmThread/IlmThreadMutexPosix.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadMutexPosix.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadMutexPosix.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmThread/IlmThreadPool.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadPool.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadPool.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmThread/IlmThreadPosix.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadPosix.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadPosix.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmThread/IlmThreadSemaphore.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphore.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphore.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmThread/IlmThreadSemaphorePosix.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphorePosix.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphorePosix.cpp.o.d"
+  "/root/repo/3rdparty/openexr/IlmThread/IlmThreadSemaphorePosixCompat.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphorePosixCompat.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphorePosixCompat.cpp.o.d"
+  "/root/repo/3rdparty/openexr/Imath/ImathBox.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathBox.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathBox.cpp.o.d"
+  "/root/repo/3rdparty/openexr/Imath/ImathColorAlgo.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathColorAlgo.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathColorAlgo.cpp.o.d"
+  "/root/repo/3rdparty/openexr/Imath/ImathFun.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathFun.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathFun.cpp.o.d"
+  "/root/repo/3rdparty/openexr/Imath/ImathMatrixAlgo.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathMatrixAlgo.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathMatrixAlgo.cpp.o.d"
+  "/root/repo/3rdparty/openexr/Imath/ImathRandom.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathRandom.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathRandom.cpp.o.d"
+  "/root/repo/3rdparty/openexr/Imath/ImathShear.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathShear.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathShear.cpp.o.d"
+  "/root/repo/3rdparty/openexr/Imath/ImathVec.cpp" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathVec.cpp.o" "gcc" "3rdparty/openexr/CMakeFiles/IlmImf.dir/Imath/ImathVec.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
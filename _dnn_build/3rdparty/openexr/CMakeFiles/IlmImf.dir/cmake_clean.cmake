@@ -0,0 +1,225 @@
+file(REMOVE_RECURSE
+  "../lib/libIlmImf.a"
+  "../lib/libIlmImf.pdb"
+  "CMakeFiles/IlmImf.dir/Half/half.cpp.o"
+  "CMakeFiles/IlmImf.dir/Half/half.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/Iex/IexBaseExc.cpp.o"
+  "CMakeFiles/IlmImf.dir/Iex/IexBaseExc.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/Iex/IexThrowErrnoExc.cpp.o"
+  "CMakeFiles/IlmImf.dir/Iex/IexThrowErrnoExc.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfAcesFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfAcesFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfB44Compressor.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfB44Compressor.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfBoxAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfBoxAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfCRgbaFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfCRgbaFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfChannelList.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfChannelList.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfChannelListAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfChannelListAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfChromaticities.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfChromaticities.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfChromaticitiesAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfChromaticitiesAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfCompositeDeepScanLine.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfCompositeDeepScanLine.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfCompressionAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfCompressionAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfCompressor.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfCompressor.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfConvert.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfConvert.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepCompositing.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepCompositing.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepFrameBuffer.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepFrameBuffer.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepImageStateAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepImageStateAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineInputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineInputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineInputPart.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineInputPart.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineOutputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineOutputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineOutputPart.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepScanLineOutputPart.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledInputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledInputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledInputPart.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledInputPart.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledOutputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledOutputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledOutputPart.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDeepTiledOutputPart.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDoubleAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDoubleAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDwaCompressor.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfDwaCompressor.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfEnvmap.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfEnvmap.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfEnvmapAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfEnvmapAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfFastHuf.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfFastHuf.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfFloatAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfFloatAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfFloatVectorAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfFloatVectorAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfFrameBuffer.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfFrameBuffer.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfFramesPerSecond.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfFramesPerSecond.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfGenericInputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfGenericInputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfGenericOutputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfGenericOutputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfHeader.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfHeader.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfHuf.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfHuf.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfIO.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfIO.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfInputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfInputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfInputPart.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfInputPart.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfInputPartData.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfInputPartData.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfIntAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfIntAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfKeyCode.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfKeyCode.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfKeyCodeAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfKeyCodeAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfLineOrderAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfLineOrderAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfLut.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfLut.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfMatrixAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfMatrixAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfMisc.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfMisc.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfMultiPartInputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfMultiPartInputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfMultiPartOutputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfMultiPartOutputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfMultiView.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfMultiView.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfOpaqueAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfOpaqueAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfOutputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfOutputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfOutputPart.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfOutputPart.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfOutputPartData.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfOutputPartData.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfPartType.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfPartType.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfPizCompressor.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfPizCompressor.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfPreviewImage.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfPreviewImage.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfPreviewImageAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfPreviewImageAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfPxr24Compressor.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfPxr24Compressor.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRational.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRational.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRationalAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRationalAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRgbaFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRgbaFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRgbaYca.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRgbaYca.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRle.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRle.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRleCompressor.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfRleCompressor.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfScanLineInputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfScanLineInputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfStandardAttributes.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfStandardAttributes.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfStdIO.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfStdIO.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfStringAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfStringAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfStringVectorAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfStringVectorAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfSystemSpecific.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfSystemSpecific.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTestFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTestFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfThreading.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfThreading.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTileDescriptionAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTileDescriptionAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTileOffsets.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTileOffsets.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledInputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledInputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledInputPart.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledInputPart.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledMisc.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledMisc.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledOutputFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledOutputFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledOutputPart.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledOutputPart.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledRgbaFile.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTiledRgbaFile.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTimeCode.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTimeCode.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTimeCodeAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfTimeCodeAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfVecAttribute.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfVecAttribute.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfVersion.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfVersion.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfWav.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfWav.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfZip.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfZip.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfZipCompressor.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/ImfZipCompressor.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmImf/dwaLookups.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmImf/dwaLookups.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThread.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThread.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadMutex.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadMutex.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadMutexPosix.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadMutexPosix.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadPool.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadPool.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadPosix.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadPosix.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphore.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphore.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphorePosix.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphorePosix.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphorePosixCompat.cpp.o"
+  "CMakeFiles/IlmImf.dir/IlmThread/IlmThreadSemaphorePosixCompat.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/Imath/ImathBox.cpp.o"
+  "CMakeFiles/IlmImf.dir/Imath/ImathBox.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/Imath/ImathColorAlgo.cpp.o"
+  "CMakeFiles/IlmImf.dir/Imath/ImathColorAlgo.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/Imath/ImathFun.cpp.o"
+  "CMakeFiles/IlmImf.dir/Imath/ImathFun.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/Imath/ImathMatrixAlgo.cpp.o"
+  "CMakeFiles/IlmImf.dir/Imath/ImathMatrixAlgo.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/Imath/ImathRandom.cpp.o"
+  "CMakeFiles/IlmImf.dir/Imath/ImathRandom.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/Imath/ImathShear.cpp.o"
+  "CMakeFiles/IlmImf.dir/Imath/ImathShear.cpp.o.d"
+  "CMakeFiles/IlmImf.dir/Imath/ImathVec.cpp.o"
+  "CMakeFiles/IlmImf.dir/Imath/ImathVec.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IlmImf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/3rdparty/openjpeg
+# Build directory: /root/repo/_dnn_build/3rdparty/openjpeg
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("openjp2")
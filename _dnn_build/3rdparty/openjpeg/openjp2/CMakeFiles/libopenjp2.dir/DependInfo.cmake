@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/openjpeg/openjp2/bio.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/bio.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/bio.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/cio.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/cio.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/cio.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/dwt.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/dwt.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/dwt.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/event.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/event.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/event.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/function_list.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/function_list.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/function_list.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/ht_dec.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/ht_dec.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/ht_dec.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/image.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/image.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/image.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/invert.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/invert.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/invert.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/j2k.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/j2k.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/j2k.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/jp2.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/jp2.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/jp2.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/mct.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/mct.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/mct.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/mqc.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/mqc.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/mqc.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/openjpeg.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/openjpeg.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/openjpeg.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/opj_clock.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/opj_clock.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/opj_clock.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/opj_malloc.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/opj_malloc.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/opj_malloc.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/pi.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/pi.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/pi.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/sparse_array.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/sparse_array.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/sparse_array.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/t1.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/t1.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/t1.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/t2.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/t2.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/t2.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/tcd.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/tcd.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/tcd.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/tgt.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/tgt.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/tgt.c.o.d"
+  "/root/repo/3rdparty/openjpeg/openjp2/thread.c" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/thread.c.o" "gcc" "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/thread.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "../../lib/liblibopenjp2.a"
+  "../../lib/liblibopenjp2.pdb"
+  "CMakeFiles/libopenjp2.dir/bio.c.o"
+  "CMakeFiles/libopenjp2.dir/bio.c.o.d"
+  "CMakeFiles/libopenjp2.dir/cio.c.o"
+  "CMakeFiles/libopenjp2.dir/cio.c.o.d"
+  "CMakeFiles/libopenjp2.dir/dwt.c.o"
+  "CMakeFiles/libopenjp2.dir/dwt.c.o.d"
+  "CMakeFiles/libopenjp2.dir/event.c.o"
+  "CMakeFiles/libopenjp2.dir/event.c.o.d"
+  "CMakeFiles/libopenjp2.dir/function_list.c.o"
+  "CMakeFiles/libopenjp2.dir/function_list.c.o.d"
+  "CMakeFiles/libopenjp2.dir/ht_dec.c.o"
+  "CMakeFiles/libopenjp2.dir/ht_dec.c.o.d"
+  "CMakeFiles/libopenjp2.dir/image.c.o"
+  "CMakeFiles/libopenjp2.dir/image.c.o.d"
+  "CMakeFiles/libopenjp2.dir/invert.c.o"
+  "CMakeFiles/libopenjp2.dir/invert.c.o.d"
+  "CMakeFiles/libopenjp2.dir/j2k.c.o"
+  "CMakeFiles/libopenjp2.dir/j2k.c.o.d"
+  "CMakeFiles/libopenjp2.dir/jp2.c.o"
+  "CMakeFiles/libopenjp2.dir/jp2.c.o.d"
+  "CMakeFiles/libopenjp2.dir/mct.c.o"
+  "CMakeFiles/libopenjp2.dir/mct.c.o.d"
+  "CMakeFiles/libopenjp2.dir/mqc.c.o"
+  "CMakeFiles/libopenjp2.dir/mqc.c.o.d"
+  "CMakeFiles/libopenjp2.dir/openjpeg.c.o"
+  "CMakeFiles/libopenjp2.dir/openjpeg.c.o.d"
+  "CMakeFiles/libopenjp2.dir/opj_clock.c.o"
+  "CMakeFiles/libopenjp2.dir/opj_clock.c.o.d"
+  "CMakeFiles/libopenjp2.dir/opj_malloc.c.o"
+  "CMakeFiles/libopenjp2.dir/opj_malloc.c.o.d"
+  "CMakeFiles/libopenjp2.dir/pi.c.o"
+  "CMakeFiles/libopenjp2.dir/pi.c.o.d"
+  "CMakeFiles/libopenjp2.dir/sparse_array.c.o"
+  "CMakeFiles/libopenjp2.dir/sparse_array.c.o.d"
+  "CMakeFiles/libopenjp2.dir/t1.c.o"
+  "CMakeFiles/libopenjp2.dir/t1.c.o.d"
+  "CMakeFiles/libopenjp2.dir/t2.c.o"
+  "CMakeFiles/libopenjp2.dir/t2.c.o.d"
+  "CMakeFiles/libopenjp2.dir/tcd.c.o"
+  "CMakeFiles/libopenjp2.dir/tcd.c.o.d"
+  "CMakeFiles/libopenjp2.dir/tgt.c.o"
+  "CMakeFiles/libopenjp2.dir/tgt.c.o.d"
+  "CMakeFiles/libopenjp2.dir/thread.c.o"
+  "CMakeFiles/libopenjp2.dir/thread.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/libopenjp2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,59 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/any.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/any.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/any.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/any_lite.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/any_lite.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/any_lite.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/arena.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/arena.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/arena.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/arenastring.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/arenastring.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/arenastring.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/descriptor.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/descriptor.pb.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor.pb.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor.pb.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/descriptor_database.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor_database.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor_database.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/dynamic_message.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/dynamic_message.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/dynamic_message.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/extension_set.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/extension_set.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/extension_set.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/extension_set_heavy.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/extension_set_heavy.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/extension_set_heavy.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/generated_message_reflection.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/generated_message_reflection.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/generated_message_reflection.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/generated_message_util.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/generated_message_util.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/generated_message_util.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/implicit_weak_message.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/implicit_weak_message.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/implicit_weak_message.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/io/coded_stream.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/coded_stream.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/coded_stream.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/io/io_win32.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/io_win32.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/io_win32.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/io/strtod.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/strtod.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/strtod.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/io/tokenizer.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/tokenizer.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/tokenizer.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/io/zero_copy_stream.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/io/zero_copy_stream_impl.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream_impl.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream_impl.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/io/zero_copy_stream_impl_lite.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream_impl_lite.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream_impl_lite.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/map.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/map.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/map.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/map_field.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/map_field.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/map_field.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/message.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/message.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/message.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/message_lite.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/message_lite.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/message_lite.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/parse_context.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/parse_context.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/parse_context.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/reflection_ops.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/reflection_ops.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/reflection_ops.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/repeated_field.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/repeated_field.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/repeated_field.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/repeated_ptr_field.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/repeated_ptr_field.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/repeated_ptr_field.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/stubs/bytestream.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/bytestream.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/bytestream.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/stubs/common.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/common.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/common.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/stubs/int128.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/int128.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/int128.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/stubs/status.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/status.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/status.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/stubs/stringpiece.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/stringpiece.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/stringpiece.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/stubs/stringprintf.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/stringprintf.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/stringprintf.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/stubs/structurally_valid.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/structurally_valid.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/structurally_valid.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/stubs/strutil.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/strutil.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/strutil.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/stubs/substitute.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/substitute.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/substitute.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/text_format.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/text_format.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/text_format.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/unknown_field_set.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/unknown_field_set.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/unknown_field_set.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/wire_format.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/wire_format.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/wire_format.cc.o.d"
+  "/root/repo/3rdparty/protobuf/src/google/protobuf/wire_format_lite.cc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/wire_format_lite.cc.o" "gcc" "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/src/google/protobuf/wire_format_lite.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
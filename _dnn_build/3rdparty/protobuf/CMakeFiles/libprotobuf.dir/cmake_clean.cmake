@@ -0,0 +1,91 @@
+file(REMOVE_RECURSE
+  "../lib/liblibprotobuf.a"
+  "../lib/liblibprotobuf.pdb"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/any.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/any.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/any_lite.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/any_lite.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/arena.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/arena.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/arenastring.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/arenastring.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor.pb.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor.pb.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor_database.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/descriptor_database.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/dynamic_message.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/dynamic_message.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/extension_set.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/extension_set.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/extension_set_heavy.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/extension_set_heavy.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/generated_message_reflection.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/generated_message_reflection.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/generated_message_util.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/generated_message_util.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/implicit_weak_message.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/implicit_weak_message.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/coded_stream.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/coded_stream.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/io_win32.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/io_win32.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/strtod.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/strtod.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/tokenizer.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/tokenizer.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream_impl.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream_impl.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream_impl_lite.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/io/zero_copy_stream_impl_lite.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/map.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/map.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/map_field.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/map_field.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/message.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/message.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/message_lite.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/message_lite.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/parse_context.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/parse_context.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/reflection_ops.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/reflection_ops.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/repeated_field.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/repeated_field.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/repeated_ptr_field.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/repeated_ptr_field.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/bytestream.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/bytestream.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/common.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/common.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/int128.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/int128.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/status.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/status.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/stringpiece.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/stringpiece.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/stringprintf.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/stringprintf.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/structurally_valid.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/structurally_valid.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/strutil.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/strutil.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/substitute.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/stubs/substitute.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/text_format.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/text_format.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/unknown_field_set.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/unknown_field_set.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/wire_format.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/wire_format.cc.o.d"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/wire_format_lite.cc.o"
+  "CMakeFiles/libprotobuf.dir/src/google/protobuf/wire_format_lite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libprotobuf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,287 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/3rdparty/ittnotify/CMakeLists.txt"
+  "/root/repo/3rdparty/libtiff/CMakeLists.txt"
+  "/root/repo/3rdparty/libtiff/tif_config.h.cmake.in"
+  "/root/repo/3rdparty/libtiff/tiffconf.h.cmake.in"
+  "/root/repo/3rdparty/libtiff/tiffvers.h.cmake.in"
+  "/root/repo/3rdparty/libwebp/CMakeLists.txt"
+  "/root/repo/3rdparty/openexr/CMakeLists.txt"
+  "/root/repo/3rdparty/openexr/IlmBaseConfig.h.cmakein"
+  "/root/repo/3rdparty/openexr/OpenEXRConfig.h.cmakein"
+  "/root/repo/3rdparty/openjpeg/CMakeLists.txt"
+  "/root/repo/3rdparty/openjpeg/openjp2/CMakeLists.txt"
+  "/root/repo/3rdparty/openjpeg/openjp2/opj_config.h.cmake.in"
+  "/root/repo/3rdparty/openjpeg/openjp2/opj_config_private.h.cmake.in"
+  "/root/repo/3rdparty/protobuf/CMakeLists.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/apps/CMakeLists.txt"
+  "/root/repo/apps/annotation/CMakeLists.txt"
+  "/root/repo/apps/interactive-calibration/CMakeLists.txt"
+  "/root/repo/apps/model-diagnostics/CMakeLists.txt"
+  "/root/repo/apps/version/CMakeLists.txt"
+  "/root/repo/apps/visualisation/CMakeLists.txt"
+  "/root/repo/cmake/OpenCVCompilerOptimizations.cmake"
+  "/root/repo/cmake/OpenCVCompilerOptions.cmake"
+  "/root/repo/cmake/OpenCVDetectApacheAnt.cmake"
+  "/root/repo/cmake/OpenCVDetectCXXCompiler.cmake"
+  "/root/repo/cmake/OpenCVDetectFlatbuffers.cmake"
+  "/root/repo/cmake/OpenCVDetectPython.cmake"
+  "/root/repo/cmake/OpenCVDetectTrace.cmake"
+  "/root/repo/cmake/OpenCVDetectVTK.cmake"
+  "/root/repo/cmake/OpenCVDownload.cmake"
+  "/root/repo/cmake/OpenCVExtraTargets.cmake"
+  "/root/repo/cmake/OpenCVFindAVIF.cmake"
+  "/root/repo/cmake/OpenCVFindFrameworks.cmake"
+  "/root/repo/cmake/OpenCVFindLAPACK.cmake"
+  "/root/repo/cmake/OpenCVFindLibsGUI.cmake"
+  "/root/repo/cmake/OpenCVFindLibsGrfmt.cmake"
+  "/root/repo/cmake/OpenCVFindLibsPerf.cmake"
+  "/root/repo/cmake/OpenCVFindLibsVideo.cmake"
+  "/root/repo/cmake/OpenCVFindOpenEXR.cmake"
+  "/root/repo/cmake/OpenCVFindProtobuf.cmake"
+  "/root/repo/cmake/OpenCVFindVA.cmake"
+  "/root/repo/cmake/OpenCVFindWebP.cmake"
+  "/root/repo/cmake/OpenCVGenABI.cmake"
+  "/root/repo/cmake/OpenCVGenAndroidMK.cmake"
+  "/root/repo/cmake/OpenCVGenConfig.cmake"
+  "/root/repo/cmake/OpenCVGenHeaders.cmake"
+  "/root/repo/cmake/OpenCVGenSetupVars.cmake"
+  "/root/repo/cmake/OpenCVInstallLayout.cmake"
+  "/root/repo/cmake/OpenCVMinDepVersions.cmake"
+  "/root/repo/cmake/OpenCVModule.cmake"
+  "/root/repo/cmake/OpenCVPCHSupport.cmake"
+  "/root/repo/cmake/OpenCVPackaging.cmake"
+  "/root/repo/cmake/OpenCVUtils.cmake"
+  "/root/repo/cmake/OpenCVVersion.cmake"
+  "/root/repo/cmake/platforms/OpenCV-Linux.cmake"
+  "/root/repo/cmake/templates/OpenCVConfig-version.cmake.in"
+  "/root/repo/cmake/templates/OpenCVConfig.cmake.in"
+  "/root/repo/cmake/templates/cmake_uninstall.cmake.in"
+  "/root/repo/cmake/templates/custom_hal.hpp.in"
+  "/root/repo/cmake/templates/cv_cpu_config.h.in"
+  "/root/repo/cmake/templates/cvconfig.h.in"
+  "/root/repo/cmake/templates/opencv_modules.hpp.in"
+  "/root/repo/cmake/templates/setup_vars_linux.sh.in"
+  "/root/repo/cmake/vars/EnableModeVars.cmake"
+  "/root/repo/data/CMakeLists.txt"
+  "/root/repo/doc/CMakeLists.txt"
+  "/root/repo/include/CMakeLists.txt"
+  "/root/repo/modules/calib3d/CMakeLists.txt"
+  "/root/repo/modules/core/CMakeLists.txt"
+  "/root/repo/modules/core/include/opencv2/core/version.hpp"
+  "/root/repo/modules/dnn/CMakeLists.txt"
+  "/root/repo/modules/dnn/cmake/hooks/INIT_MODULE_SOURCES_opencv_dnn.cmake"
+  "/root/repo/modules/dnn/cmake/init.cmake"
+  "/root/repo/modules/dnn/cmake/plugin.cmake"
+  "/root/repo/modules/features2d/CMakeLists.txt"
+  "/root/repo/modules/flann/CMakeLists.txt"
+  "/root/repo/modules/gapi/CMakeLists.txt"
+  "/root/repo/modules/gapi/cmake/DownloadADE.cmake"
+  "/root/repo/modules/gapi/cmake/init.cmake"
+  "/root/repo/modules/highgui/CMakeLists.txt"
+  "/root/repo/modules/highgui/cmake/detect_gtk.cmake"
+  "/root/repo/modules/highgui/cmake/init.cmake"
+  "/root/repo/modules/highgui/cmake/plugin.cmake"
+  "/root/repo/modules/imgcodecs/CMakeLists.txt"
+  "/root/repo/modules/imgproc/CMakeLists.txt"
+  "/root/repo/modules/java/CMakeLists.txt"
+  "/root/repo/modules/java/generator/CMakeLists.txt"
+  "/root/repo/modules/js/CMakeLists.txt"
+  "/root/repo/modules/js/generator/CMakeLists.txt"
+  "/root/repo/modules/ml/CMakeLists.txt"
+  "/root/repo/modules/objc/CMakeLists.txt"
+  "/root/repo/modules/objc/generator/CMakeLists.txt"
+  "/root/repo/modules/objdetect/CMakeLists.txt"
+  "/root/repo/modules/photo/CMakeLists.txt"
+  "/root/repo/modules/python/CMakeLists.txt"
+  "/root/repo/modules/python/bindings/CMakeLists.txt"
+  "/root/repo/modules/python/python2/CMakeLists.txt"
+  "/root/repo/modules/python/python3/CMakeLists.txt"
+  "/root/repo/modules/python/test/CMakeLists.txt"
+  "/root/repo/modules/stitching/CMakeLists.txt"
+  "/root/repo/modules/ts/CMakeLists.txt"
+  "/root/repo/modules/video/CMakeLists.txt"
+  "/root/repo/modules/videoio/CMakeLists.txt"
+  "/root/repo/modules/videoio/cmake/detect_ffmpeg.cmake"
+  "/root/repo/modules/videoio/cmake/detect_gstreamer.cmake"
+  "/root/repo/modules/videoio/cmake/detect_obsensor.cmake"
+  "/root/repo/modules/videoio/cmake/detect_v4l.cmake"
+  "/root/repo/modules/videoio/cmake/init.cmake"
+  "/root/repo/modules/videoio/cmake/plugin.cmake"
+  "/root/repo/modules/world/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindJavaCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindJNI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindJPEG.cmake"
+  "/usr/share/cmake-3.25/Modules/FindJava.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPNG.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindTIFF.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/opencv_junk/version.junk"
+  "custom_hal.hpp"
+  "cmake_uninstall.cmake"
+  "cvconfig.h"
+  "opencv2/cvconfig.h"
+  "cv_cpu_config.h"
+  "opencv2/opencv_modules.hpp"
+  "OpenCVConfig.cmake"
+  "OpenCVConfig-version.cmake"
+  "unix-install/OpenCVConfig-version.cmake"
+  "unix-install/OpenCVConfig.cmake"
+  "tmp/setup_vars.sh"
+  "CMakeFiles/install/setup_vars_opencv4.sh"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/libtiff/tif_config.h"
+  "3rdparty/libtiff/tiffconf.h"
+  "3rdparty/libtiff/tiffvers.h"
+  "3rdparty/libtiff/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/libwebp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/openjpeg/openjp2/opj_config.h"
+  "3rdparty/openjpeg/openjp2/opj_config_private.h"
+  "3rdparty/openjpeg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/openjpeg/openjp2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/openexr/IlmBaseConfig.h"
+  "3rdparty/openexr/OpenEXRConfig.h"
+  "3rdparty/openexr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/protobuf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/ittnotify/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/calib3d/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/dnn/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/features2d/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/flann/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/gapi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/highgui/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/imgcodecs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/imgproc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/java/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/java/generator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/js/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/js/generator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/ml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/objc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/objc/generator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/objdetect/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/photo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/python/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/python/bindings/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/python/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/python/python2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/python/python3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/stitching/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/ts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/video/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/videoio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/.firstpass/world/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/imgproc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/dnn/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/imgcodecs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/videoio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/highgui/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "modules/ts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "doc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "data/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/annotation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/visualisation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/interactive-calibration/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/version/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "apps/model-diagnostics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "CMakeFiles/opencv_modules.dir/DependInfo.cmake"
+  "CMakeFiles/opencv_tests.dir/DependInfo.cmake"
+  "CMakeFiles/opencv_dnn_plugins.dir/DependInfo.cmake"
+  "CMakeFiles/opencv_highgui_plugins.dir/DependInfo.cmake"
+  "3rdparty/libtiff/CMakeFiles/libtiff.dir/DependInfo.cmake"
+  "3rdparty/libwebp/CMakeFiles/libwebp.dir/DependInfo.cmake"
+  "3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/DependInfo.cmake"
+  "3rdparty/openexr/CMakeFiles/IlmImf.dir/DependInfo.cmake"
+  "3rdparty/protobuf/CMakeFiles/libprotobuf.dir/DependInfo.cmake"
+  "3rdparty/ittnotify/CMakeFiles/ittnotify.dir/DependInfo.cmake"
+  "modules/.firstpass/videoio/CMakeFiles/opencv_videoio_plugins.dir/DependInfo.cmake"
+  "modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  "modules/core/CMakeFiles/opencv_test_core.dir/DependInfo.cmake"
+  "modules/imgproc/CMakeFiles/opencv_imgproc.dir/DependInfo.cmake"
+  "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/DependInfo.cmake"
+  "modules/dnn/CMakeFiles/opencv_dnn.dir/DependInfo.cmake"
+  "modules/dnn/CMakeFiles/opencv_test_dnn.dir/DependInfo.cmake"
+  "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/DependInfo.cmake"
+  "modules/imgcodecs/CMakeFiles/opencv_test_imgcodecs.dir/DependInfo.cmake"
+  "modules/videoio/CMakeFiles/opencv_videoio.dir/DependInfo.cmake"
+  "modules/videoio/CMakeFiles/opencv_test_videoio.dir/DependInfo.cmake"
+  "modules/highgui/CMakeFiles/opencv_highgui.dir/DependInfo.cmake"
+  "modules/highgui/CMakeFiles/opencv_test_highgui.dir/DependInfo.cmake"
+  "modules/ts/CMakeFiles/opencv_ts.dir/DependInfo.cmake"
+  "apps/annotation/CMakeFiles/opencv_annotation.dir/DependInfo.cmake"
+  "apps/visualisation/CMakeFiles/opencv_visualisation.dir/DependInfo.cmake"
+  "apps/version/CMakeFiles/opencv_version.dir/DependInfo.cmake"
+  "apps/model-diagnostics/CMakeFiles/opencv_model_diagnostics.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/apps
+# Build directory: /root/repo/_dnn_build/apps
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("annotation")
+subdirs("visualisation")
+subdirs("interactive-calibration")
+subdirs("version")
+subdirs("model-diagnostics")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/opencv_annotation"
+  "../../bin/opencv_annotation.pdb"
+  "CMakeFiles/opencv_annotation.dir/opencv_annotation.cpp.o"
+  "CMakeFiles/opencv_annotation.dir/opencv_annotation.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_annotation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
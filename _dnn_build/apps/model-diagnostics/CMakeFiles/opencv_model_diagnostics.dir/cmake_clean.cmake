@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/opencv_model_diagnostics"
+  "../../bin/opencv_model_diagnostics.pdb"
+  "CMakeFiles/opencv_model_diagnostics.dir/model_diagnostics.cpp.o"
+  "CMakeFiles/opencv_model_diagnostics.dir/model_diagnostics.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_model_diagnostics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
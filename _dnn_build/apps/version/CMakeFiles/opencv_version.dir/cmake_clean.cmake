@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/opencv_version"
+  "../../bin/opencv_version.pdb"
+  "CMakeFiles/opencv_version.dir/opencv_version.cpp.o"
+  "CMakeFiles/opencv_version.dir/opencv_version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
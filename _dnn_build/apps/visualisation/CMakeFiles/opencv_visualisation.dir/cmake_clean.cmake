@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/opencv_visualisation"
+  "../../bin/opencv_visualisation.pdb"
+  "CMakeFiles/opencv_visualisation.dir/opencv_visualisation.cpp.o"
+  "CMakeFiles/opencv_visualisation.dir/opencv_visualisation.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_visualisation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+#ifndef _CUSTOM_HAL_INCLUDED_
+#define _CUSTOM_HAL_INCLUDED_
+
+
+
+#endif
@@ -0,0 +1 @@
+mkdir -p $(dirname /root/repo/.cache/ade/962ce79e0b95591f226431f7b5f152cd-v0.1.2e.zip) && wget -O "/root/repo/.cache/ade/962ce79e0b95591f226431f7b5f152cd-v0.1.2e.zip" "https://github.com/opencv/ade/archive/v0.1.2e.zip"
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/modules/calib3d
+# Build directory: /root/repo/_dnn_build/modules/.firstpass/calib3d
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/modules/imgcodecs
+# Build directory: /root/repo/_dnn_build/modules/.firstpass/imgcodecs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
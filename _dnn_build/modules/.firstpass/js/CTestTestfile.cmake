@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/modules/js
+# Build directory: /root/repo/_dnn_build/modules/.firstpass/js
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("generator")
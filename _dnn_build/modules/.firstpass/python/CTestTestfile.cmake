@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/modules/python
+# Build directory: /root/repo/_dnn_build/modules/.firstpass/python
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("bindings")
+subdirs("test")
+subdirs("python2")
+subdirs("python3")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/modules/python/bindings
+# Build directory: /root/repo/_dnn_build/modules/.firstpass/python/bindings
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,151 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_dnn_build/modules/core/arithm.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/arithm.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/arithm.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/arithm.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_core.dir/arithm.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/arithm.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/arithm.sse4_1.cpp" "modules/core/CMakeFiles/opencv_core.dir/arithm.sse4_1.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/arithm.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/convert.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/convert.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/convert.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/convert.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_core.dir/convert.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/convert.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/convert_scale.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/convert_scale.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/convert_scale.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/convert_scale.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_core.dir/convert_scale.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/convert_scale.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/count_non_zero.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/count_non_zero.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/count_non_zero.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/count_non_zero.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_core.dir/count_non_zero.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/count_non_zero.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/has_non_zero.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/has_non_zero.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/has_non_zero.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/has_non_zero.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_core.dir/has_non_zero.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/has_non_zero.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/mathfuncs_core.avx.cpp" "modules/core/CMakeFiles/opencv_core.dir/mathfuncs_core.avx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/mathfuncs_core.avx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/mathfuncs_core.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/mathfuncs_core.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/mathfuncs_core.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/matmul.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/matmul.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/matmul.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/matmul.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_core.dir/matmul.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/matmul.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/matmul.sse4_1.cpp" "modules/core/CMakeFiles/opencv_core.dir/matmul.sse4_1.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/matmul.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/mean.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/mean.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/mean.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/mean.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_core.dir/mean.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/mean.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/merge.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/merge.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/merge.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/merge.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_core.dir/merge.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/merge.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/opencl_kernels_core.cpp" "modules/core/CMakeFiles/opencv_core.dir/opencl_kernels_core.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/opencl_kernels_core.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/split.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/split.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/split.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/split.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_core.dir/split.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/split.avx512_skx.cpp.o.d"
+  "/root/repo/modules/core/src/algorithm.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/algorithm.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/algorithm.cpp.o.d"
+  "/root/repo/modules/core/src/alloc.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/alloc.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/alloc.cpp.o.d"
+  "/root/repo/modules/core/src/arithm.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/arithm.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/arithm.cpp.o.d"
+  "/root/repo/modules/core/src/arithm.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/arithm.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/arithm.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/array.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/array.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/array.cpp.o.d"
+  "/root/repo/modules/core/src/async.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/async.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/async.cpp.o.d"
+  "/root/repo/modules/core/src/batch_distance.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/batch_distance.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/batch_distance.cpp.o.d"
+  "/root/repo/modules/core/src/bindings_utils.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/bindings_utils.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/bindings_utils.cpp.o.d"
+  "/root/repo/modules/core/src/buffer_area.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/buffer_area.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/buffer_area.cpp.o.d"
+  "/root/repo/modules/core/src/channels.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/channels.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/channels.cpp.o.d"
+  "/root/repo/modules/core/src/check.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/check.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/check.cpp.o.d"
+  "/root/repo/modules/core/src/command_line_parser.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/command_line_parser.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/command_line_parser.cpp.o.d"
+  "/root/repo/modules/core/src/conjugate_gradient.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/conjugate_gradient.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/conjugate_gradient.cpp.o.d"
+  "/root/repo/modules/core/src/convert.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/convert.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/convert.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/convert_c.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/convert_c.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/convert_c.cpp.o.d"
+  "/root/repo/modules/core/src/convert_scale.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/convert_scale.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/convert_scale.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/copy.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/copy.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/copy.cpp.o.d"
+  "/root/repo/modules/core/src/count_non_zero.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/count_non_zero.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/count_non_zero.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/cuda_gpu_mat.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/cuda_gpu_mat.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/cuda_gpu_mat.cpp.o.d"
+  "/root/repo/modules/core/src/cuda_gpu_mat_nd.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/cuda_gpu_mat_nd.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/cuda_gpu_mat_nd.cpp.o.d"
+  "/root/repo/modules/core/src/cuda_host_mem.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/cuda_host_mem.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/cuda_host_mem.cpp.o.d"
+  "/root/repo/modules/core/src/cuda_info.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/cuda_info.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/cuda_info.cpp.o.d"
+  "/root/repo/modules/core/src/cuda_stream.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/cuda_stream.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/cuda_stream.cpp.o.d"
+  "/root/repo/modules/core/src/datastructs.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/datastructs.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/datastructs.cpp.o.d"
+  "/root/repo/modules/core/src/directx.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/directx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/directx.cpp.o.d"
+  "/root/repo/modules/core/src/downhill_simplex.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/downhill_simplex.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/downhill_simplex.cpp.o.d"
+  "/root/repo/modules/core/src/dxt.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/dxt.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/dxt.cpp.o.d"
+  "/root/repo/modules/core/src/gl_core_3_1.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/gl_core_3_1.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/gl_core_3_1.cpp.o.d"
+  "/root/repo/modules/core/src/glob.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/glob.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/glob.cpp.o.d"
+  "/root/repo/modules/core/src/hal_internal.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/hal_internal.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/hal_internal.cpp.o.d"
+  "/root/repo/modules/core/src/has_non_zero.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/has_non_zero.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/has_non_zero.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/kmeans.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/kmeans.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/kmeans.cpp.o.d"
+  "/root/repo/modules/core/src/lapack.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/lapack.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/lapack.cpp.o.d"
+  "/root/repo/modules/core/src/lda.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/lda.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/lda.cpp.o.d"
+  "/root/repo/modules/core/src/logger.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/logger.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/logger.cpp.o.d"
+  "/root/repo/modules/core/src/lpsolver.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/lpsolver.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/lpsolver.cpp.o.d"
+  "/root/repo/modules/core/src/lut.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/lut.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/lut.cpp.o.d"
+  "/root/repo/modules/core/src/mathfuncs.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/mathfuncs.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/mathfuncs.cpp.o.d"
+  "/root/repo/modules/core/src/mathfuncs_core.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/mathfuncs_core.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/mathfuncs_core.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/matmul.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matmul.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matmul.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/matrix.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matrix.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matrix.cpp.o.d"
+  "/root/repo/modules/core/src/matrix_c.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_c.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_c.cpp.o.d"
+  "/root/repo/modules/core/src/matrix_decomp.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_decomp.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_decomp.cpp.o.d"
+  "/root/repo/modules/core/src/matrix_expressions.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_expressions.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_expressions.cpp.o.d"
+  "/root/repo/modules/core/src/matrix_iterator.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_iterator.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_iterator.cpp.o.d"
+  "/root/repo/modules/core/src/matrix_map_file.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_map_file.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_map_file.cpp.o.d"
+  "/root/repo/modules/core/src/matrix_operations.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_operations.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_operations.cpp.o.d"
+  "/root/repo/modules/core/src/matrix_pool_allocator.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_pool_allocator.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_pool_allocator.cpp.o.d"
+  "/root/repo/modules/core/src/matrix_sparse.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_sparse.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_sparse.cpp.o.d"
+  "/root/repo/modules/core/src/matrix_transform.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_transform.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_transform.cpp.o.d"
+  "/root/repo/modules/core/src/matrix_wrap.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_wrap.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/matrix_wrap.cpp.o.d"
+  "/root/repo/modules/core/src/mean.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/mean.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/mean.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/merge.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/merge.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/merge.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/minmax.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/minmax.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/minmax.cpp.o.d"
+  "/root/repo/modules/core/src/norm.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/norm.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/norm.cpp.o.d"
+  "/root/repo/modules/core/src/numa.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/numa.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/numa.cpp.o.d"
+  "/root/repo/modules/core/src/ocl.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/ocl.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/ocl.cpp.o.d"
+  "/root/repo/modules/core/src/opencl/runtime/opencl_clblas.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_clblas.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_clblas.cpp.o.d"
+  "/root/repo/modules/core/src/opencl/runtime/opencl_clfft.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_clfft.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_clfft.cpp.o.d"
+  "/root/repo/modules/core/src/opencl/runtime/opencl_core.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_core.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_core.cpp.o.d"
+  "/root/repo/modules/core/src/opengl.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/opengl.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/opengl.cpp.o.d"
+  "/root/repo/modules/core/src/out.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/out.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/out.cpp.o.d"
+  "/root/repo/modules/core/src/ovx.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/ovx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/ovx.cpp.o.d"
+  "/root/repo/modules/core/src/parallel.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/parallel.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/parallel.cpp.o.d"
+  "/root/repo/modules/core/src/parallel/parallel.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel.cpp.o.d"
+  "/root/repo/modules/core/src/parallel/parallel_metrics.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel_metrics.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel_metrics.cpp.o.d"
+  "/root/repo/modules/core/src/parallel/parallel_openmp.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel_openmp.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel_openmp.cpp.o.d"
+  "/root/repo/modules/core/src/parallel/parallel_task.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel_task.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel_task.cpp.o.d"
+  "/root/repo/modules/core/src/parallel/parallel_tbb.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel_tbb.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel_tbb.cpp.o.d"
+  "/root/repo/modules/core/src/parallel/parallel_worksteal.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel_worksteal.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/parallel/parallel_worksteal.cpp.o.d"
+  "/root/repo/modules/core/src/parallel_impl.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/parallel_impl.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/parallel_impl.cpp.o.d"
+  "/root/repo/modules/core/src/pca.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/pca.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/pca.cpp.o.d"
+  "/root/repo/modules/core/src/persistence.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/persistence.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/persistence.cpp.o.d"
+  "/root/repo/modules/core/src/persistence_base64_encoding.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_base64_encoding.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_base64_encoding.cpp.o.d"
+  "/root/repo/modules/core/src/persistence_binary.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_binary.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_binary.cpp.o.d"
+  "/root/repo/modules/core/src/persistence_json.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_json.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_json.cpp.o.d"
+  "/root/repo/modules/core/src/persistence_types.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_types.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_types.cpp.o.d"
+  "/root/repo/modules/core/src/persistence_xml.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_xml.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_xml.cpp.o.d"
+  "/root/repo/modules/core/src/persistence_yml.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_yml.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/persistence_yml.cpp.o.d"
+  "/root/repo/modules/core/src/rand.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/rand.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/rand.cpp.o.d"
+  "/root/repo/modules/core/src/softfloat.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/softfloat.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/softfloat.cpp.o.d"
+  "/root/repo/modules/core/src/split.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/split.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/split.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/stat.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/stat.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/stat.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/stat_c.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/stat_c.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/stat_c.cpp.o.d"
+  "/root/repo/modules/core/src/stl.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/stl.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/stl.cpp.o.d"
+  "/root/repo/modules/core/src/sum.dispatch.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/sum.dispatch.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/sum.dispatch.cpp.o.d"
+  "/root/repo/modules/core/src/system.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/system.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/system.cpp.o.d"
+  "/root/repo/modules/core/src/tables.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/tables.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/tables.cpp.o.d"
+  "/root/repo/modules/core/src/trace.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/trace.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/trace.cpp.o.d"
+  "/root/repo/modules/core/src/types.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/types.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/types.cpp.o.d"
+  "/root/repo/modules/core/src/umatrix.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/umatrix.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/umatrix.cpp.o.d"
+  "/root/repo/modules/core/src/utils/datafile.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/utils/datafile.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/utils/datafile.cpp.o.d"
+  "/root/repo/modules/core/src/utils/filesystem.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/utils/filesystem.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/utils/filesystem.cpp.o.d"
+  "/root/repo/modules/core/src/utils/logtagconfigparser.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/utils/logtagconfigparser.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/utils/logtagconfigparser.cpp.o.d"
+  "/root/repo/modules/core/src/utils/logtagmanager.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/utils/logtagmanager.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/utils/logtagmanager.cpp.o.d"
+  "/root/repo/modules/core/src/utils/samples.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/utils/samples.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/utils/samples.cpp.o.d"
+  "/root/repo/modules/core/src/va_intel.cpp" "modules/core/CMakeFiles/opencv_core.dir/src/va_intel.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/src/va_intel.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/stat.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/stat.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/stat.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/stat.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_core.dir/stat.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/stat.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/stat.sse4_2.cpp" "modules/core/CMakeFiles/opencv_core.dir/stat.sse4_2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/stat.sse4_2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/sum.avx2.cpp" "modules/core/CMakeFiles/opencv_core.dir/sum.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/sum.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/sum.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_core.dir/sum.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_core.dir/sum.avx512_skx.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_dnn_build/lib/libopencv_core.so" "/root/repo/_dnn_build/lib/libopencv_core.so.4.10.0"
+  "/root/repo/_dnn_build/lib/libopencv_core.so.410" "/root/repo/_dnn_build/lib/libopencv_core.so.4.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/3rdparty/ittnotify/CMakeFiles/ittnotify.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
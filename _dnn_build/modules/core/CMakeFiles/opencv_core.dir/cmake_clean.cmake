@@ -0,0 +1,262 @@
+file(REMOVE_RECURSE
+  "../../lib/libopencv_core.pdb"
+  "../../lib/libopencv_core.so"
+  "../../lib/libopencv_core.so.4.10.0"
+  "../../lib/libopencv_core.so.410"
+  "CMakeFiles/opencv_core.dir/arithm.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/arithm.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/arithm.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_core.dir/arithm.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/arithm.sse4_1.cpp.o"
+  "CMakeFiles/opencv_core.dir/arithm.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/convert.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/convert.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/convert.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_core.dir/convert.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/convert_scale.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/convert_scale.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/convert_scale.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_core.dir/convert_scale.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/count_non_zero.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/count_non_zero.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/count_non_zero.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_core.dir/count_non_zero.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/has_non_zero.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/has_non_zero.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/has_non_zero.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_core.dir/has_non_zero.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/mathfuncs_core.avx.cpp.o"
+  "CMakeFiles/opencv_core.dir/mathfuncs_core.avx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/mathfuncs_core.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/mathfuncs_core.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/matmul.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/matmul.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/matmul.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_core.dir/matmul.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/matmul.sse4_1.cpp.o"
+  "CMakeFiles/opencv_core.dir/matmul.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/mean.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/mean.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/mean.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_core.dir/mean.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/merge.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/merge.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/merge.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_core.dir/merge.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/opencl_kernels_core.cpp.o"
+  "CMakeFiles/opencv_core.dir/opencl_kernels_core.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/split.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/split.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/split.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_core.dir/split.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/algorithm.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/algorithm.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/alloc.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/alloc.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/arithm.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/arithm.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/arithm.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/arithm.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/array.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/array.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/async.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/async.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/batch_distance.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/batch_distance.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/bindings_utils.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/bindings_utils.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/buffer_area.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/buffer_area.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/channels.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/channels.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/check.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/check.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/command_line_parser.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/command_line_parser.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/conjugate_gradient.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/conjugate_gradient.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/convert.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/convert.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/convert_c.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/convert_c.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/convert_scale.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/convert_scale.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/copy.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/copy.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/count_non_zero.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/count_non_zero.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/cuda_gpu_mat.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/cuda_gpu_mat.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/cuda_gpu_mat_nd.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/cuda_gpu_mat_nd.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/cuda_host_mem.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/cuda_host_mem.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/cuda_info.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/cuda_info.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/cuda_stream.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/cuda_stream.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/datastructs.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/datastructs.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/directx.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/directx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/downhill_simplex.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/downhill_simplex.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/dxt.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/dxt.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/gl_core_3_1.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/gl_core_3_1.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/glob.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/glob.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/hal_internal.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/hal_internal.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/has_non_zero.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/has_non_zero.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/kmeans.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/kmeans.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/lapack.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/lapack.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/lda.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/lda.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/logger.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/logger.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/lpsolver.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/lpsolver.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/lut.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/lut.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/mathfuncs.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/mathfuncs.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/mathfuncs_core.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/mathfuncs_core.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matmul.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matmul.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matrix.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matrix.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matrix_c.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matrix_c.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matrix_decomp.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matrix_decomp.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matrix_expressions.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matrix_expressions.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matrix_iterator.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matrix_iterator.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matrix_map_file.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matrix_map_file.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matrix_operations.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matrix_operations.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matrix_pool_allocator.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matrix_pool_allocator.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matrix_sparse.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matrix_sparse.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matrix_transform.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matrix_transform.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/matrix_wrap.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/matrix_wrap.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/mean.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/mean.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/merge.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/merge.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/minmax.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/minmax.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/norm.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/norm.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/numa.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/numa.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/ocl.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/ocl.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_clblas.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_clblas.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_clfft.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_clfft.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_core.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/opencl/runtime/opencl_core.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/opengl.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/opengl.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/out.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/out.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/ovx.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/ovx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/parallel.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/parallel.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel_metrics.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel_metrics.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel_openmp.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel_openmp.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel_task.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel_task.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel_tbb.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel_tbb.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel_worksteal.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/parallel/parallel_worksteal.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/parallel_impl.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/parallel_impl.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/pca.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/pca.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/persistence.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/persistence.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/persistence_base64_encoding.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/persistence_base64_encoding.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/persistence_binary.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/persistence_binary.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/persistence_json.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/persistence_json.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/persistence_types.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/persistence_types.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/persistence_xml.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/persistence_xml.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/persistence_yml.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/persistence_yml.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/rand.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/rand.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/softfloat.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/softfloat.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/split.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/split.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/stat.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/stat.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/stat_c.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/stat_c.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/stl.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/stl.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/sum.dispatch.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/sum.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/system.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/system.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/tables.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/tables.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/trace.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/trace.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/types.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/types.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/umatrix.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/umatrix.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/utils/datafile.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/utils/datafile.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/utils/filesystem.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/utils/filesystem.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/utils/logtagconfigparser.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/utils/logtagconfigparser.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/utils/logtagmanager.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/utils/logtagmanager.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/utils/samples.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/utils/samples.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/src/va_intel.cpp.o"
+  "CMakeFiles/opencv_core.dir/src/va_intel.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/stat.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/stat.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/stat.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_core.dir/stat.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/stat.sse4_2.cpp.o"
+  "CMakeFiles/opencv_core.dir/stat.sse4_2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/sum.avx2.cpp.o"
+  "CMakeFiles/opencv_core.dir/sum.avx2.cpp.o.d"
+  "CMakeFiles/opencv_core.dir/sum.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_core.dir/sum.avx512_skx.cpp.o.d"
+  "opencl_kernels_core.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,75 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/core/test/ocl/test_arithm.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_arithm.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_arithm.cpp.o.d"
+  "/root/repo/modules/core/test/ocl/test_channels.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_channels.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_channels.cpp.o.d"
+  "/root/repo/modules/core/test/ocl/test_dft.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_dft.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_dft.cpp.o.d"
+  "/root/repo/modules/core/test/ocl/test_gemm.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_gemm.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_gemm.cpp.o.d"
+  "/root/repo/modules/core/test/ocl/test_image2d.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_image2d.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_image2d.cpp.o.d"
+  "/root/repo/modules/core/test/ocl/test_matrix_expr.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_matrix_expr.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_matrix_expr.cpp.o.d"
+  "/root/repo/modules/core/test/ocl/test_matrix_operation.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_matrix_operation.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_matrix_operation.cpp.o.d"
+  "/root/repo/modules/core/test/ocl/test_opencl.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_opencl.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/ocl/test_opencl.cpp.o.d"
+  "/root/repo/modules/core/test/test_allocator.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_allocator.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_allocator.cpp.o.d"
+  "/root/repo/modules/core/test/test_arithm.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_arithm.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_arithm.cpp.o.d"
+  "/root/repo/modules/core/test/test_async.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_async.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_async.cpp.o.d"
+  "/root/repo/modules/core/test/test_concatenation.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_concatenation.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_concatenation.cpp.o.d"
+  "/root/repo/modules/core/test/test_conjugate_gradient.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_conjugate_gradient.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_conjugate_gradient.cpp.o.d"
+  "/root/repo/modules/core/test/test_countnonzero.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_countnonzero.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_countnonzero.cpp.o.d"
+  "/root/repo/modules/core/test/test_cuda.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_cuda.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_cuda.cpp.o.d"
+  "/root/repo/modules/core/test/test_downhill_simplex.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_downhill_simplex.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_downhill_simplex.cpp.o.d"
+  "/root/repo/modules/core/test/test_ds.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_ds.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_ds.cpp.o.d"
+  "/root/repo/modules/core/test/test_dxt.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_dxt.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_dxt.cpp.o.d"
+  "/root/repo/modules/core/test/test_eigen.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_eigen.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_eigen.cpp.o.d"
+  "/root/repo/modules/core/test/test_hal_core.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_hal_core.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_hal_core.cpp.o.d"
+  "/root/repo/modules/core/test/test_hasnonzero.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_hasnonzero.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_hasnonzero.cpp.o.d"
+  "/root/repo/modules/core/test/test_intrin.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin128.avx.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin128.avx2.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin128.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin128.fp16.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.fp16.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.fp16.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin128.sse2.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin128.sse3.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse3.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse3.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin128.sse4_1.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse4_1.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin128.sse4_2.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse4_2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse4_2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin128.ssse3.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.ssse3.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin128.ssse3.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin256.avx2.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin256.avx2.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin256.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin256.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin256.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin256.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/core/test/test_intrin512.avx512_skx.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin512.avx512_skx.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin512.avx512_skx.cpp.o.d"
+  "/root/repo/modules/core/test/test_intrin_emulator.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin_emulator.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_intrin_emulator.cpp.o.d"
+  "/root/repo/modules/core/test/test_io.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_io.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_io.cpp.o.d"
+  "/root/repo/modules/core/test/test_logtagconfigparser.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_logtagconfigparser.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_logtagconfigparser.cpp.o.d"
+  "/root/repo/modules/core/test/test_logtagmanager.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_logtagmanager.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_logtagmanager.cpp.o.d"
+  "/root/repo/modules/core/test/test_lpsolver.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_lpsolver.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_lpsolver.cpp.o.d"
+  "/root/repo/modules/core/test/test_main.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_main.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_main.cpp.o.d"
+  "/root/repo/modules/core/test/test_mat.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_mat.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_mat.cpp.o.d"
+  "/root/repo/modules/core/test/test_math.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_math.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_math.cpp.o.d"
+  "/root/repo/modules/core/test/test_misc.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_misc.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_misc.cpp.o.d"
+  "/root/repo/modules/core/test/test_opencl.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_opencl.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_opencl.cpp.o.d"
+  "/root/repo/modules/core/test/test_operations.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_operations.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_operations.cpp.o.d"
+  "/root/repo/modules/core/test/test_ptr.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_ptr.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_ptr.cpp.o.d"
+  "/root/repo/modules/core/test/test_quaternion.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_quaternion.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_quaternion.cpp.o.d"
+  "/root/repo/modules/core/test/test_rand.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_rand.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_rand.cpp.o.d"
+  "/root/repo/modules/core/test/test_rotatedrect.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_rotatedrect.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_rotatedrect.cpp.o.d"
+  "/root/repo/modules/core/test/test_umat.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_umat.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_umat.cpp.o.d"
+  "/root/repo/modules/core/test/test_utils.cpp" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_utils.cpp.o" "gcc" "modules/core/CMakeFiles/opencv_test_core.dir/test/test_utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/modules/ts/CMakeFiles/opencv_ts.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/highgui/CMakeFiles/opencv_highgui.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/videoio/CMakeFiles/opencv_videoio.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgproc/CMakeFiles/opencv_imgproc.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,111 @@
+file(REMOVE_RECURSE
+  "../../bin/opencv_test_core"
+  "../../bin/opencv_test_core.pdb"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_arithm.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_arithm.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_channels.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_channels.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_dft.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_dft.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_gemm.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_gemm.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_image2d.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_image2d.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_matrix_expr.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_matrix_expr.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_matrix_operation.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_matrix_operation.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_opencl.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/ocl/test_opencl.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_allocator.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_allocator.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_arithm.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_arithm.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_async.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_async.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_concatenation.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_concatenation.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_conjugate_gradient.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_conjugate_gradient.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_countnonzero.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_countnonzero.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_cuda.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_cuda.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_downhill_simplex.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_downhill_simplex.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_ds.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_ds.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_dxt.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_dxt.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_eigen.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_eigen.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_hal_core.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_hal_core.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_hasnonzero.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_hasnonzero.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx2.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx2.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.fp16.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.fp16.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse2.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse2.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse3.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse3.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse4_1.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse4_2.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.sse4_2.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.ssse3.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin128.ssse3.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin256.avx2.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin256.avx2.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin256.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin256.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin512.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin512.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin_emulator.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_intrin_emulator.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_io.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_io.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_logtagconfigparser.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_logtagconfigparser.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_logtagmanager.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_logtagmanager.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_lpsolver.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_lpsolver.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_main.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_main.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_mat.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_mat.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_math.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_math.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_misc.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_misc.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_opencl.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_opencl.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_operations.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_operations.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_ptr.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_ptr.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_quaternion.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_quaternion.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_rand.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_rand.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_rotatedrect.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_rotatedrect.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_umat.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_umat.cpp.o.d"
+  "CMakeFiles/opencv_test_core.dir/test/test_utils.cpp.o"
+  "CMakeFiles/opencv_test_core.dir/test/test_utils.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_test_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
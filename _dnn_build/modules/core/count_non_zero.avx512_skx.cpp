@@ -0,0 +1,3 @@
+
+#include "/root/repo/modules/core/src/precomp.hpp"
+#include "/root/repo/modules/core/src/count_non_zero.simd.hpp"
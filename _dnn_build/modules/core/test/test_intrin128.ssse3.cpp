@@ -0,0 +1,3 @@
+
+#include "/root/repo/modules/core/test/test_precomp.hpp"
+#include "/root/repo/modules/core/test/test_intrin128.simd.hpp"
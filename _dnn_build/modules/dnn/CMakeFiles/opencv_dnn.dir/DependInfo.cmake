@@ -0,0 +1,187 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_dnn_build/modules/dnn/int8layers/layers_common.avx2.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx2.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/int8layers/layers_common.avx512_clx.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx512_clx.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx512_clx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/int8layers/layers_common.avx512_skx.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx512_skx.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx512_skx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/layers/cpu_kernels/conv_block.avx.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_block.avx.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_block.avx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/layers/cpu_kernels/conv_block.avx2.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_block.avx2.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_block.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/layers/cpu_kernels/conv_depthwise.avx.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_depthwise.avx.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_depthwise.avx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/layers/cpu_kernels/conv_depthwise.avx2.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_depthwise.avx2.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_depthwise.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/layers/cpu_kernels/conv_winograd_f63.avx.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_winograd_f63.avx.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_winograd_f63.avx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/layers/cpu_kernels/conv_winograd_f63.avx2.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_winograd_f63.avx2.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_winograd_f63.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/layers/cpu_kernels/fast_gemm_kernels.avx.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/fast_gemm_kernels.avx.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/fast_gemm_kernels.avx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/layers/cpu_kernels/fast_gemm_kernels.avx2.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/fast_gemm_kernels.avx2.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/fast_gemm_kernels.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/layers/layers_common.avx.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/layers_common.avx.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/layers_common.avx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/layers/layers_common.avx2.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/layers_common.avx2.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/layers_common.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/dnn/layers/layers_common.avx512_skx.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/layers_common.avx512_skx.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/layers/layers_common.avx512_skx.cpp.o.d"
+  "/root/repo/modules/dnn/misc/caffe/opencv-caffe.pb.cc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/caffe/opencv-caffe.pb.cc.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/caffe/opencv-caffe.pb.cc.o.d"
+  "/root/repo/modules/dnn/misc/onnx/opencv-onnx.pb.cc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/onnx/opencv-onnx.pb.cc.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/onnx/opencv-onnx.pb.cc.o.d"
+  "/root/repo/modules/dnn/misc/tensorflow/attr_value.pb.cc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/attr_value.pb.cc.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/attr_value.pb.cc.o.d"
+  "/root/repo/modules/dnn/misc/tensorflow/function.pb.cc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/function.pb.cc.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/function.pb.cc.o.d"
+  "/root/repo/modules/dnn/misc/tensorflow/graph.pb.cc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/graph.pb.cc.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/graph.pb.cc.o.d"
+  "/root/repo/modules/dnn/misc/tensorflow/op_def.pb.cc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/op_def.pb.cc.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/op_def.pb.cc.o.d"
+  "/root/repo/modules/dnn/misc/tensorflow/tensor.pb.cc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/tensor.pb.cc.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/tensor.pb.cc.o.d"
+  "/root/repo/modules/dnn/misc/tensorflow/tensor_shape.pb.cc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/tensor_shape.pb.cc.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/tensor_shape.pb.cc.o.d"
+  "/root/repo/modules/dnn/misc/tensorflow/types.pb.cc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/types.pb.cc.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/types.pb.cc.o.d"
+  "/root/repo/modules/dnn/misc/tensorflow/versions.pb.cc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/versions.pb.cc.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/misc/tensorflow/versions.pb.cc.o.d"
+  "/root/repo/modules/dnn/src/backend.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/backend.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/backend.cpp.o.d"
+  "/root/repo/modules/dnn/src/caffe/caffe_importer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/caffe/caffe_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/caffe/caffe_importer.cpp.o.d"
+  "/root/repo/modules/dnn/src/caffe/caffe_io.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/caffe/caffe_io.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/caffe/caffe_io.cpp.o.d"
+  "/root/repo/modules/dnn/src/caffe/caffe_shrinker.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/caffe/caffe_shrinker.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/caffe/caffe_shrinker.cpp.o.d"
+  "/root/repo/modules/dnn/src/darknet/darknet_importer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/darknet/darknet_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/darknet/darknet_importer.cpp.o.d"
+  "/root/repo/modules/dnn/src/darknet/darknet_io.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/darknet/darknet_io.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/darknet/darknet_io.cpp.o.d"
+  "/root/repo/modules/dnn/src/debug_utils.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/debug_utils.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/debug_utils.cpp.o.d"
+  "/root/repo/modules/dnn/src/dnn.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/dnn.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/dnn.cpp.o.d"
+  "/root/repo/modules/dnn/src/dnn_params.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/dnn_params.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/dnn_params.cpp.o.d"
+  "/root/repo/modules/dnn/src/dnn_read.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/dnn_read.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/dnn_read.cpp.o.d"
+  "/root/repo/modules/dnn/src/dnn_utils.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/dnn_utils.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/dnn_utils.cpp.o.d"
+  "/root/repo/modules/dnn/src/graph_simplifier.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/graph_simplifier.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/graph_simplifier.cpp.o.d"
+  "/root/repo/modules/dnn/src/halide_scheduler.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/halide_scheduler.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/halide_scheduler.cpp.o.d"
+  "/root/repo/modules/dnn/src/ie_ngraph.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/ie_ngraph.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/ie_ngraph.cpp.o.d"
+  "/root/repo/modules/dnn/src/init.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/init.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/init.cpp.o.d"
+  "/root/repo/modules/dnn/src/int8layers/batch_norm_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/batch_norm_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/batch_norm_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/int8layers/convolution_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/convolution_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/convolution_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/int8layers/elementwise_layers.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/elementwise_layers.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/elementwise_layers.cpp.o.d"
+  "/root/repo/modules/dnn/src/int8layers/eltwise_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/eltwise_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/eltwise_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/int8layers/fully_connected_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/fully_connected_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/fully_connected_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/int8layers/layers_rvp052.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/layers_rvp052.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/layers_rvp052.cpp.o.d"
+  "/root/repo/modules/dnn/src/int8layers/pooling_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/pooling_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/pooling_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/int8layers/quantization_utils.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/quantization_utils.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/quantization_utils.cpp.o.d"
+  "/root/repo/modules/dnn/src/int8layers/scale_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/scale_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/scale_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/int8layers/softmax_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/softmax_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/int8layers/softmax_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layer_factory.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layer_factory.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layer_factory.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/accum_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/accum_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/accum_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/arg_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/arg_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/arg_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/attention_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/attention_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/attention_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/batch_norm_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/batch_norm_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/batch_norm_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/blank_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/blank_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/blank_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/concat_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/concat_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/concat_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/const_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/const_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/const_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/convolution_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/convolution_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/convolution_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/correlation_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/correlation_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/correlation_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/cpu_kernels/conv_depthwise.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/conv_depthwise.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/conv_depthwise.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/cpu_kernels/conv_winograd_f63.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/conv_winograd_f63.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/conv_winograd_f63.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/cpu_kernels/convolution.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/convolution.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/convolution.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/cpu_kernels/fast_gemm.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/fast_gemm.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/fast_gemm.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/cpu_kernels/fast_norm.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/fast_norm.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/fast_norm.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/cpu_kernels/softmax.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/softmax.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/softmax.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/crop_and_resize_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/crop_and_resize_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/crop_and_resize_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/cumsum_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cumsum_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/cumsum_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/depth_space_ops_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/depth_space_ops_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/depth_space_ops_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/detection_output_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/detection_output_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/detection_output_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/einsum_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/einsum_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/einsum_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/elementwise_layers.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/elementwise_layers.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/elementwise_layers.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/eltwise_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/eltwise_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/eltwise_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/expand_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/expand_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/expand_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/flatten_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/flatten_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/flatten_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/flow_warp_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/flow_warp_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/flow_warp_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/fully_connected_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/fully_connected_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/fully_connected_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/gather_elements_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/gather_elements_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/gather_elements_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/gather_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/gather_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/gather_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/gemm_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/gemm_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/gemm_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/group_norm_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/group_norm_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/group_norm_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/instance_norm_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/instance_norm_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/instance_norm_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/layer_norm.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/layer_norm.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/layer_norm.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/layers_common.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/layers_common.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/layers_common.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/lrn_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/lrn_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/lrn_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/matmul_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/matmul_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/matmul_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/max_unpooling_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/max_unpooling_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/max_unpooling_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/mvn_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/mvn_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/mvn_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/nary_eltwise_layers.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/nary_eltwise_layers.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/nary_eltwise_layers.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/normalize_bbox_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/normalize_bbox_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/normalize_bbox_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/not_implemented_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/not_implemented_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/not_implemented_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/padding_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/padding_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/padding_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/permute_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/permute_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/permute_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/pooling_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/pooling_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/pooling_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/prior_box_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/prior_box_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/prior_box_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/proposal_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/proposal_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/proposal_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/recurrent_layers.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/recurrent_layers.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/recurrent_layers.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/reduce_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/reduce_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/reduce_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/region_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/region_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/region_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/reorg_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/reorg_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/reorg_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/reshape_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/reshape_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/reshape_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/resize_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/resize_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/resize_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/scale_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/scale_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/scale_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/scatterND_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/scatterND_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/scatterND_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/scatter_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/scatter_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/scatter_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/shuffle_channel_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/shuffle_channel_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/shuffle_channel_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/slice_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/slice_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/slice_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/softmax_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/softmax_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/softmax_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/split_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/split_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/split_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/tile_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/tile_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/tile_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/layers/topk_layer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/topk_layer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/layers/topk_layer.cpp.o.d"
+  "/root/repo/modules/dnn/src/legacy_backend.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/legacy_backend.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/legacy_backend.cpp.o.d"
+  "/root/repo/modules/dnn/src/model.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/model.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/model.cpp.o.d"
+  "/root/repo/modules/dnn/src/net.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net.cpp.o.d"
+  "/root/repo/modules/dnn/src/net_cann.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_cann.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_cann.cpp.o.d"
+  "/root/repo/modules/dnn/src/net_impl.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_impl.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_impl.cpp.o.d"
+  "/root/repo/modules/dnn/src/net_impl_backend.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_impl_backend.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_impl_backend.cpp.o.d"
+  "/root/repo/modules/dnn/src/net_impl_fuse.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_impl_fuse.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_impl_fuse.cpp.o.d"
+  "/root/repo/modules/dnn/src/net_openvino.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_openvino.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_openvino.cpp.o.d"
+  "/root/repo/modules/dnn/src/net_quantization.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_quantization.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/net_quantization.cpp.o.d"
+  "/root/repo/modules/dnn/src/nms.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/nms.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/nms.cpp.o.d"
+  "/root/repo/modules/dnn/src/onnx/onnx_graph_simplifier.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/onnx/onnx_graph_simplifier.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/onnx/onnx_graph_simplifier.cpp.o.d"
+  "/root/repo/modules/dnn/src/onnx/onnx_importer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/onnx/onnx_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/onnx/onnx_importer.cpp.o.d"
+  "/root/repo/modules/dnn/src/op_cann.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_cann.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_cann.cpp.o.d"
+  "/root/repo/modules/dnn/src/op_cuda.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_cuda.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_cuda.cpp.o.d"
+  "/root/repo/modules/dnn/src/op_halide.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_halide.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_halide.cpp.o.d"
+  "/root/repo/modules/dnn/src/op_inf_engine.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_inf_engine.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_inf_engine.cpp.o.d"
+  "/root/repo/modules/dnn/src/op_timvx.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_timvx.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_timvx.cpp.o.d"
+  "/root/repo/modules/dnn/src/op_vkcom.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_vkcom.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_vkcom.cpp.o.d"
+  "/root/repo/modules/dnn/src/op_webnn.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_webnn.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/op_webnn.cpp.o.d"
+  "/root/repo/modules/dnn/src/registry.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/registry.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/registry.cpp.o.d"
+  "/root/repo/modules/dnn/src/tensorflow/tf_graph_simplifier.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_graph_simplifier.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_graph_simplifier.cpp.o.d"
+  "/root/repo/modules/dnn/src/tensorflow/tf_importer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_importer.cpp.o.d"
+  "/root/repo/modules/dnn/src/tensorflow/tf_io.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_io.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_io.cpp.o.d"
+  "/root/repo/modules/dnn/src/tflite/tflite_importer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/tflite/tflite_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/tflite/tflite_importer.cpp.o.d"
+  "/root/repo/modules/dnn/src/torch/THDiskFile.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/torch/THDiskFile.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/torch/THDiskFile.cpp.o.d"
+  "/root/repo/modules/dnn/src/torch/THFile.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/torch/THFile.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/torch/THFile.cpp.o.d"
+  "/root/repo/modules/dnn/src/torch/THGeneral.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/torch/THGeneral.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/torch/THGeneral.cpp.o.d"
+  "/root/repo/modules/dnn/src/torch/torch_importer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/torch/torch_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/torch/torch_importer.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/shader/conv_1x1_fast_spv.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_1x1_fast_spv.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_1x1_fast_spv.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/shader/conv_depthwise_3x3_spv.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_depthwise_3x3_spv.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_depthwise_3x3_spv.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/shader/conv_depthwise_spv.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_depthwise_spv.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_depthwise_spv.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/shader/conv_implicit_gemm_spv.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_implicit_gemm_spv.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_implicit_gemm_spv.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/shader/gemm_spv.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/gemm_spv.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/gemm_spv.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/shader/nary_eltwise_binary_forward_spv.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/nary_eltwise_binary_forward_spv.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/nary_eltwise_binary_forward_spv.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/shader/spv_shader.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/spv_shader.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/shader/spv_shader.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/src/buffer.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/buffer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/buffer.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/src/command.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/command.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/command.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/src/context.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/context.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/context.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/src/fence.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/fence.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/fence.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/src/internal.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/internal.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/internal.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/src/op_base.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_base.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_base.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/src/op_conv.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_conv.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_conv.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/src/op_matmul.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_matmul.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_matmul.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/src/op_naryEltwise.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_naryEltwise.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_naryEltwise.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/src/pipeline.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/pipeline.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/pipeline.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/src/tensor.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/tensor.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/src/tensor.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/vulkan/vk_functions.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/vulkan/vk_functions.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/vulkan/vk_functions.cpp.o.d"
+  "/root/repo/modules/dnn/src/vkcom/vulkan/vk_loader.cpp" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/vulkan/vk_loader.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_dnn.dir/src/vkcom/vulkan/vk_loader.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_dnn_build/lib/libopencv_dnn.so" "/root/repo/_dnn_build/lib/libopencv_dnn.so.4.10.0"
+  "/root/repo/_dnn_build/lib/libopencv_dnn.so.410" "/root/repo/_dnn_build/lib/libopencv_dnn.so.4.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/modules/imgproc/CMakeFiles/opencv_imgproc.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/3rdparty/protobuf/CMakeFiles/libprotobuf.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,329 @@
+file(REMOVE_RECURSE
+  "../../lib/libopencv_dnn.pdb"
+  "../../lib/libopencv_dnn.so"
+  "../../lib/libopencv_dnn.so.4.10.0"
+  "../../lib/libopencv_dnn.so.410"
+  "CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx2.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx2.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx512_clx.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx512_clx.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/int8layers/layers_common.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_block.avx.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_block.avx.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_block.avx2.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_block.avx2.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_depthwise.avx.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_depthwise.avx.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_depthwise.avx2.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_depthwise.avx2.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_winograd_f63.avx.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_winograd_f63.avx.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_winograd_f63.avx2.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/conv_winograd_f63.avx2.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/fast_gemm_kernels.avx.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/fast_gemm_kernels.avx.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/fast_gemm_kernels.avx2.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/layers/cpu_kernels/fast_gemm_kernels.avx2.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/layers/layers_common.avx.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/layers/layers_common.avx.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/layers/layers_common.avx2.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/layers/layers_common.avx2.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/layers/layers_common.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/layers/layers_common.avx512_skx.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/misc/caffe/opencv-caffe.pb.cc.o"
+  "CMakeFiles/opencv_dnn.dir/misc/caffe/opencv-caffe.pb.cc.o.d"
+  "CMakeFiles/opencv_dnn.dir/misc/onnx/opencv-onnx.pb.cc.o"
+  "CMakeFiles/opencv_dnn.dir/misc/onnx/opencv-onnx.pb.cc.o.d"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/attr_value.pb.cc.o"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/attr_value.pb.cc.o.d"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/function.pb.cc.o"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/function.pb.cc.o.d"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/graph.pb.cc.o"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/graph.pb.cc.o.d"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/op_def.pb.cc.o"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/op_def.pb.cc.o.d"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/tensor.pb.cc.o"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/tensor.pb.cc.o.d"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/tensor_shape.pb.cc.o"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/tensor_shape.pb.cc.o.d"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/types.pb.cc.o"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/types.pb.cc.o.d"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/versions.pb.cc.o"
+  "CMakeFiles/opencv_dnn.dir/misc/tensorflow/versions.pb.cc.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/backend.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/backend.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/caffe/caffe_importer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/caffe/caffe_importer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/caffe/caffe_io.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/caffe/caffe_io.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/caffe/caffe_shrinker.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/caffe/caffe_shrinker.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/darknet/darknet_importer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/darknet/darknet_importer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/darknet/darknet_io.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/darknet/darknet_io.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/debug_utils.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/debug_utils.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/dnn.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/dnn.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/dnn_params.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/dnn_params.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/dnn_read.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/dnn_read.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/dnn_utils.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/dnn_utils.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/graph_simplifier.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/graph_simplifier.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/halide_scheduler.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/halide_scheduler.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/ie_ngraph.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/ie_ngraph.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/init.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/init.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/batch_norm_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/batch_norm_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/convolution_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/convolution_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/elementwise_layers.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/elementwise_layers.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/eltwise_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/eltwise_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/fully_connected_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/fully_connected_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/layers_rvp052.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/layers_rvp052.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/pooling_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/pooling_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/quantization_utils.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/quantization_utils.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/scale_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/scale_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/softmax_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/int8layers/softmax_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layer_factory.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layer_factory.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/accum_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/accum_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/arg_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/arg_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/attention_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/attention_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/batch_norm_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/batch_norm_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/blank_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/blank_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/concat_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/concat_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/const_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/const_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/convolution_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/convolution_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/correlation_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/correlation_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/conv_depthwise.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/conv_depthwise.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/conv_winograd_f63.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/conv_winograd_f63.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/convolution.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/convolution.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/fast_gemm.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/fast_gemm.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/fast_norm.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/fast_norm.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/softmax.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cpu_kernels/softmax.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/crop_and_resize_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/crop_and_resize_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cumsum_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/cumsum_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/depth_space_ops_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/depth_space_ops_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/detection_output_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/detection_output_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/einsum_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/einsum_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/elementwise_layers.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/elementwise_layers.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/eltwise_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/eltwise_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/expand_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/expand_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/flatten_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/flatten_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/flow_warp_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/flow_warp_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/fully_connected_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/fully_connected_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/gather_elements_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/gather_elements_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/gather_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/gather_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/gemm_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/gemm_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/group_norm_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/group_norm_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/instance_norm_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/instance_norm_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/layer_norm.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/layer_norm.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/layers_common.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/layers_common.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/lrn_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/lrn_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/matmul_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/matmul_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/max_unpooling_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/max_unpooling_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/mvn_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/mvn_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/nary_eltwise_layers.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/nary_eltwise_layers.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/normalize_bbox_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/normalize_bbox_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/not_implemented_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/not_implemented_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/padding_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/padding_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/permute_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/permute_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/pooling_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/pooling_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/prior_box_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/prior_box_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/proposal_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/proposal_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/recurrent_layers.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/recurrent_layers.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/reduce_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/reduce_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/region_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/region_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/reorg_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/reorg_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/reshape_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/reshape_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/resize_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/resize_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/scale_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/scale_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/scatterND_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/scatterND_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/scatter_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/scatter_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/shuffle_channel_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/shuffle_channel_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/slice_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/slice_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/softmax_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/softmax_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/split_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/split_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/tile_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/tile_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/layers/topk_layer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/layers/topk_layer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/legacy_backend.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/legacy_backend.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/model.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/model.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/net.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/net.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/net_cann.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/net_cann.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/net_impl.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/net_impl.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/net_impl_backend.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/net_impl_backend.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/net_impl_fuse.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/net_impl_fuse.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/net_openvino.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/net_openvino.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/net_quantization.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/net_quantization.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/nms.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/nms.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/onnx/onnx_graph_simplifier.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/onnx/onnx_graph_simplifier.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/onnx/onnx_importer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/onnx/onnx_importer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/op_cann.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/op_cann.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/op_cuda.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/op_cuda.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/op_halide.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/op_halide.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/op_inf_engine.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/op_inf_engine.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/op_timvx.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/op_timvx.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/op_vkcom.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/op_vkcom.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/op_webnn.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/op_webnn.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/registry.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/registry.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_graph_simplifier.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_graph_simplifier.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_importer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_importer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_io.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/tensorflow/tf_io.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/tflite/tflite_importer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/tflite/tflite_importer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/torch/THDiskFile.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/torch/THDiskFile.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/torch/THFile.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/torch/THFile.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/torch/THGeneral.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/torch/THGeneral.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/torch/torch_importer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/torch/torch_importer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_1x1_fast_spv.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_1x1_fast_spv.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_depthwise_3x3_spv.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_depthwise_3x3_spv.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_depthwise_spv.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_depthwise_spv.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_implicit_gemm_spv.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/conv_implicit_gemm_spv.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/gemm_spv.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/gemm_spv.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/nary_eltwise_binary_forward_spv.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/nary_eltwise_binary_forward_spv.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/spv_shader.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/shader/spv_shader.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/buffer.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/buffer.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/command.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/command.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/context.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/context.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/fence.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/fence.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/internal.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/internal.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_base.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_base.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_conv.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_conv.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_matmul.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_matmul.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_naryEltwise.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/op_naryEltwise.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/pipeline.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/pipeline.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/tensor.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/src/tensor.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/vulkan/vk_functions.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/vulkan/vk_functions.cpp.o.d"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/vulkan/vk_loader.cpp.o"
+  "CMakeFiles/opencv_dnn.dir/src/vkcom/vulkan/vk_loader.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_dnn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/dnn/test/npy_blob.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/npy_blob.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/npy_blob.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_backends.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_backends.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_backends.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_caffe_importer.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_caffe_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_caffe_importer.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_common.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_common.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_common.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_darknet_importer.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_darknet_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_darknet_importer.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_googlenet.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_googlenet.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_googlenet.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_graph_simplifier.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_graph_simplifier.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_graph_simplifier.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_ie_models.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_ie_models.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_ie_models.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_int8_layers.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_int8_layers.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_int8_layers.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_layers.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_layers.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_layers.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_main.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_main.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_main.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_misc.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_misc.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_misc.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_model.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_model.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_model.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_nms.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_nms.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_nms.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_onnx_conformance.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_onnx_conformance.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_onnx_conformance.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_onnx_importer.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_onnx_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_onnx_importer.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_tf_importer.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_tf_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_tf_importer.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_tflite_importer.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_tflite_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_tflite_importer.cpp.o.d"
+  "/root/repo/modules/dnn/test/test_torch_importer.cpp" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_torch_importer.cpp.o" "gcc" "modules/dnn/CMakeFiles/opencv_test_dnn.dir/test/test_torch_importer.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/modules/ts/CMakeFiles/opencv_ts.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/dnn/CMakeFiles/opencv_dnn.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/highgui/CMakeFiles/opencv_highgui.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/videoio/CMakeFiles/opencv_videoio.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgproc/CMakeFiles/opencv_imgproc.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
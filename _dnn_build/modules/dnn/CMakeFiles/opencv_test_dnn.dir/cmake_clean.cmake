@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "../../bin/opencv_test_dnn"
+  "../../bin/opencv_test_dnn.pdb"
+  "CMakeFiles/opencv_test_dnn.dir/test/npy_blob.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/npy_blob.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_backends.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_backends.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_caffe_importer.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_caffe_importer.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_common.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_common.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_darknet_importer.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_darknet_importer.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_googlenet.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_googlenet.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_graph_simplifier.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_graph_simplifier.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_ie_models.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_ie_models.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_int8_layers.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_int8_layers.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_layers.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_layers.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_main.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_main.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_misc.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_misc.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_model.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_model.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_nms.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_nms.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_onnx_conformance.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_onnx_conformance.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_onnx_importer.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_onnx_importer.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_tf_importer.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_tf_importer.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_tflite_importer.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_tflite_importer.cpp.o.d"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_torch_importer.cpp.o"
+  "CMakeFiles/opencv_test_dnn.dir/test/test_torch_importer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_test_dnn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
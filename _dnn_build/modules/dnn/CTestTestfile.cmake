@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/modules/dnn
+# Build directory: /root/repo/_dnn_build/modules/dnn
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(opencv_test_dnn "/root/repo/_dnn_build/bin/opencv_test_dnn" "--gtest_output=xml:opencv_test_dnn.xml")
+set_tests_properties(opencv_test_dnn PROPERTIES  LABELS "Main;opencv_dnn;Accuracy" WORKING_DIRECTORY "/root/repo/_dnn_build/test-reports/accuracy" _BACKTRACE_TRIPLES "/root/repo/cmake/OpenCVUtils.cmake;1799;add_test;/root/repo/cmake/OpenCVModule.cmake;1365;ocv_add_test_from_target;/root/repo/modules/dnn/CMakeLists.txt;247;ocv_add_accuracy_tests;/root/repo/modules/dnn/CMakeLists.txt;0;")
@@ -0,0 +1,3 @@
+
+#include "/root/repo/modules/dnn/src/precomp.hpp"
+#include "/root/repo/modules/dnn/src/int8layers/layers_common.simd.hpp"
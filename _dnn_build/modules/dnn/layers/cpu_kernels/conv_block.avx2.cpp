@@ -0,0 +1,3 @@
+
+#include "/root/repo/modules/dnn/src/precomp.hpp"
+#include "/root/repo/modules/dnn/src/layers/cpu_kernels/conv_block.simd.hpp"
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/highgui/src/backend.cpp" "modules/highgui/CMakeFiles/opencv_highgui.dir/src/backend.cpp.o" "gcc" "modules/highgui/CMakeFiles/opencv_highgui.dir/src/backend.cpp.o.d"
+  "/root/repo/modules/highgui/src/roiSelector.cpp" "modules/highgui/CMakeFiles/opencv_highgui.dir/src/roiSelector.cpp.o" "gcc" "modules/highgui/CMakeFiles/opencv_highgui.dir/src/roiSelector.cpp.o.d"
+  "/root/repo/modules/highgui/src/window.cpp" "modules/highgui/CMakeFiles/opencv_highgui.dir/src/window.cpp.o" "gcc" "modules/highgui/CMakeFiles/opencv_highgui.dir/src/window.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_dnn_build/lib/libopencv_highgui.so" "/root/repo/_dnn_build/lib/libopencv_highgui.so.4.10.0"
+  "/root/repo/_dnn_build/lib/libopencv_highgui.so.410" "/root/repo/_dnn_build/lib/libopencv_highgui.so.4.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/modules/videoio/CMakeFiles/opencv_videoio.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgproc/CMakeFiles/opencv_imgproc.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
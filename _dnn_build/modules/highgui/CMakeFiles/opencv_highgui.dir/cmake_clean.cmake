@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../lib/libopencv_highgui.pdb"
+  "../../lib/libopencv_highgui.so"
+  "../../lib/libopencv_highgui.so.4.10.0"
+  "../../lib/libopencv_highgui.so.410"
+  "CMakeFiles/opencv_highgui.dir/src/backend.cpp.o"
+  "CMakeFiles/opencv_highgui.dir/src/backend.cpp.o.d"
+  "CMakeFiles/opencv_highgui.dir/src/roiSelector.cpp.o"
+  "CMakeFiles/opencv_highgui.dir/src/roiSelector.cpp.o.d"
+  "CMakeFiles/opencv_highgui.dir/src/window.cpp.o"
+  "CMakeFiles/opencv_highgui.dir/src/window.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_highgui.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
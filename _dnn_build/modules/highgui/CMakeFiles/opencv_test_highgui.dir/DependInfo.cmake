@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/highgui/test/test_gui.cpp" "modules/highgui/CMakeFiles/opencv_test_highgui.dir/test/test_gui.cpp.o" "gcc" "modules/highgui/CMakeFiles/opencv_test_highgui.dir/test/test_gui.cpp.o.d"
+  "/root/repo/modules/highgui/test/test_main.cpp" "modules/highgui/CMakeFiles/opencv_test_highgui.dir/test/test_main.cpp.o" "gcc" "modules/highgui/CMakeFiles/opencv_test_highgui.dir/test/test_main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/modules/ts/CMakeFiles/opencv_ts.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/highgui/CMakeFiles/opencv_highgui.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/videoio/CMakeFiles/opencv_videoio.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgproc/CMakeFiles/opencv_imgproc.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
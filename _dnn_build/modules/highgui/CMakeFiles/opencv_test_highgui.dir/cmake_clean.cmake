@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/opencv_test_highgui"
+  "../../bin/opencv_test_highgui.pdb"
+  "CMakeFiles/opencv_test_highgui.dir/test/test_gui.cpp.o"
+  "CMakeFiles/opencv_test_highgui.dir/test/test_gui.cpp.o.d"
+  "CMakeFiles/opencv_test_highgui.dir/test/test_main.cpp.o"
+  "CMakeFiles/opencv_test_highgui.dir/test/test_main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_test_highgui.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,4 @@
+// Auto-generated file
+#define OPENCV_HIGHGUI_BUILTIN_BACKEND_STR "NONE"
+
+#define OPENCV_HIGHGUI_WITHOUT_BUILTIN_BACKEND 1
@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/imgcodecs/src/bitstrm.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/bitstrm.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/bitstrm.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/exif.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/exif.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/exif.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_avif.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_avif.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_avif.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_base.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_base.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_base.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_bmp.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_bmp.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_bmp.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_exr.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_exr.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_exr.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_gdal.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_gdal.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_gdal.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_gdcm.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_gdcm.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_gdcm.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_hdr.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_hdr.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_hdr.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_jpeg.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_jpeg2000.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg2000.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg2000.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_jpeg2000_openjpeg.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg2000_openjpeg.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg2000_openjpeg.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_pam.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pam.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pam.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_pfm.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pfm.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pfm.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_png.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_png.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_png.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_pxm.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pxm.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pxm.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_spng.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_spng.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_spng.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_sunras.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_sunras.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_sunras.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_tiff.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_tiff.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_tiff.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/grfmt_webp.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_webp.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/grfmt_webp.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/loadsave.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/loadsave.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/loadsave.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/rgbe.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/rgbe.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/rgbe.cpp.o.d"
+  "/root/repo/modules/imgcodecs/src/utils.cpp" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/utils.cpp.o" "gcc" "modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/src/utils.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_dnn_build/lib/libopencv_imgcodecs.so" "/root/repo/_dnn_build/lib/libopencv_imgcodecs.so.4.10.0"
+  "/root/repo/_dnn_build/lib/libopencv_imgcodecs.so.410" "/root/repo/_dnn_build/lib/libopencv_imgcodecs.so.4.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/modules/imgproc/CMakeFiles/opencv_imgproc.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/3rdparty/libwebp/CMakeFiles/libwebp.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/3rdparty/libtiff/CMakeFiles/libtiff.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/3rdparty/openjpeg/openjp2/CMakeFiles/libopenjp2.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/3rdparty/openexr/CMakeFiles/IlmImf.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,57 @@
+file(REMOVE_RECURSE
+  "../../lib/libopencv_imgcodecs.pdb"
+  "../../lib/libopencv_imgcodecs.so"
+  "../../lib/libopencv_imgcodecs.so.4.10.0"
+  "../../lib/libopencv_imgcodecs.so.410"
+  "CMakeFiles/opencv_imgcodecs.dir/src/bitstrm.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/bitstrm.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/exif.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/exif.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_avif.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_avif.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_base.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_base.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_bmp.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_bmp.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_exr.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_exr.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_gdal.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_gdal.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_gdcm.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_gdcm.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_hdr.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_hdr.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg2000.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg2000.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg2000_openjpeg.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_jpeg2000_openjpeg.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pam.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pam.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pfm.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pfm.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_png.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_png.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pxm.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_pxm.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_spng.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_spng.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_sunras.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_sunras.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_tiff.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_tiff.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_webp.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/grfmt_webp.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/loadsave.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/loadsave.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/rgbe.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/rgbe.cpp.o.d"
+  "CMakeFiles/opencv_imgcodecs.dir/src/utils.cpp.o"
+  "CMakeFiles/opencv_imgcodecs.dir/src/utils.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_imgcodecs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
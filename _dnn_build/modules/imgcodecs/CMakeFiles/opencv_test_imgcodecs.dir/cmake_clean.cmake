@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../bin/opencv_test_imgcodecs"
+  "../../bin/opencv_test_imgcodecs.pdb"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_avif.cpp.o"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_avif.cpp.o.d"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_common.cpp.o"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_common.cpp.o.d"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_grfmt.cpp.o"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_grfmt.cpp.o.d"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_jpeg.cpp.o"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_jpeg.cpp.o.d"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_main.cpp.o"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_main.cpp.o.d"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_png.cpp.o"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_png.cpp.o.d"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_read_write.cpp.o"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_read_write.cpp.o.d"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_tiff.cpp.o"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_tiff.cpp.o.d"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_webp.cpp.o"
+  "CMakeFiles/opencv_test_imgcodecs.dir/test/test_webp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_test_imgcodecs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,124 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_dnn_build/modules/imgproc/accum.avx.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/accum.avx.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/accum.avx.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/accum.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/accum.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/accum.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/accum.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/accum.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/accum.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/bilateral_filter.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/bilateral_filter.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/bilateral_filter.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/box_filter.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/box_filter.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/box_filter.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/box_filter.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/box_filter.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/box_filter.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/color_hsv.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_hsv.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_hsv.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/color_hsv.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_hsv.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_hsv.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/color_lab.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_lab.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_lab.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/color_lab.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_lab.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_lab.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/color_rgb.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_rgb.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_rgb.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/color_rgb.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_rgb.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_rgb.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/color_yuv.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_yuv.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_yuv.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/color_yuv.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_yuv.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/color_yuv.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/filter.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/filter.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/filter.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/filter.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/filter.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/filter.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/median_blur.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/median_blur.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/median_blur.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/median_blur.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/median_blur.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/median_blur.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/morph.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/morph.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/morph.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/morph.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/morph.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/morph.sse4_1.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/opencl_kernels_imgproc.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/opencl_kernels_imgproc.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/opencl_kernels_imgproc.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/smooth.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/smooth.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/smooth.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/smooth.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/smooth.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/smooth.sse4_1.cpp.o.d"
+  "/root/repo/modules/imgproc/src/accum.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/accum.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/accum.cpp.o.d"
+  "/root/repo/modules/imgproc/src/accum.dispatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/accum.dispatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/accum.dispatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/approx.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/approx.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/approx.cpp.o.d"
+  "/root/repo/modules/imgproc/src/bilateral_filter.dispatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/bilateral_filter.dispatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/bilateral_filter.dispatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/blend.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/blend.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/blend.cpp.o.d"
+  "/root/repo/modules/imgproc/src/box_filter.dispatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/box_filter.dispatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/box_filter.dispatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/canny.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/canny.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/canny.cpp.o.d"
+  "/root/repo/modules/imgproc/src/clahe.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/clahe.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/clahe.cpp.o.d"
+  "/root/repo/modules/imgproc/src/color.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/color.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/color.cpp.o.d"
+  "/root/repo/modules/imgproc/src/color_hsv.dispatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/color_hsv.dispatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/color_hsv.dispatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/color_lab.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/color_lab.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/color_lab.cpp.o.d"
+  "/root/repo/modules/imgproc/src/color_rgb.dispatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/color_rgb.dispatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/color_rgb.dispatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/color_yuv.dispatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/color_yuv.dispatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/color_yuv.dispatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/colormap.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/colormap.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/colormap.cpp.o.d"
+  "/root/repo/modules/imgproc/src/connectedcomponents.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/connectedcomponents.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/connectedcomponents.cpp.o.d"
+  "/root/repo/modules/imgproc/src/contours.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/contours.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/contours.cpp.o.d"
+  "/root/repo/modules/imgproc/src/contours_approx.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/contours_approx.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/contours_approx.cpp.o.d"
+  "/root/repo/modules/imgproc/src/contours_common.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/contours_common.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/contours_common.cpp.o.d"
+  "/root/repo/modules/imgproc/src/contours_link.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/contours_link.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/contours_link.cpp.o.d"
+  "/root/repo/modules/imgproc/src/contours_new.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/contours_new.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/contours_new.cpp.o.d"
+  "/root/repo/modules/imgproc/src/convhull.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/convhull.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/convhull.cpp.o.d"
+  "/root/repo/modules/imgproc/src/corner.avx.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/corner.avx.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/corner.avx.cpp.o.d"
+  "/root/repo/modules/imgproc/src/corner.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/corner.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/corner.cpp.o.d"
+  "/root/repo/modules/imgproc/src/cornersubpix.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/cornersubpix.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/cornersubpix.cpp.o.d"
+  "/root/repo/modules/imgproc/src/demosaicing.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/demosaicing.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/demosaicing.cpp.o.d"
+  "/root/repo/modules/imgproc/src/deriv.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/deriv.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/deriv.cpp.o.d"
+  "/root/repo/modules/imgproc/src/distransform.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/distransform.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/distransform.cpp.o.d"
+  "/root/repo/modules/imgproc/src/drawing.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/drawing.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/drawing.cpp.o.d"
+  "/root/repo/modules/imgproc/src/emd.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/emd.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/emd.cpp.o.d"
+  "/root/repo/modules/imgproc/src/emd_new.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/emd_new.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/emd_new.cpp.o.d"
+  "/root/repo/modules/imgproc/src/featureselect.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/featureselect.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/featureselect.cpp.o.d"
+  "/root/repo/modules/imgproc/src/filter.dispatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/filter.dispatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/filter.dispatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/floodfill.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/floodfill.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/floodfill.cpp.o.d"
+  "/root/repo/modules/imgproc/src/gabor.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/gabor.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/gabor.cpp.o.d"
+  "/root/repo/modules/imgproc/src/generalized_hough.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/generalized_hough.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/generalized_hough.cpp.o.d"
+  "/root/repo/modules/imgproc/src/geometry.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/geometry.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/geometry.cpp.o.d"
+  "/root/repo/modules/imgproc/src/grabcut.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/grabcut.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/grabcut.cpp.o.d"
+  "/root/repo/modules/imgproc/src/hershey_fonts.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/hershey_fonts.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/hershey_fonts.cpp.o.d"
+  "/root/repo/modules/imgproc/src/histogram.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/histogram.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/histogram.cpp.o.d"
+  "/root/repo/modules/imgproc/src/hough.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/hough.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/hough.cpp.o.d"
+  "/root/repo/modules/imgproc/src/imgwarp.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/imgwarp.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/imgwarp.avx2.cpp.o.d"
+  "/root/repo/modules/imgproc/src/imgwarp.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/imgwarp.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/imgwarp.cpp.o.d"
+  "/root/repo/modules/imgproc/src/imgwarp.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/imgwarp.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/imgwarp.sse4_1.cpp.o.d"
+  "/root/repo/modules/imgproc/src/intelligent_scissors.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/intelligent_scissors.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/intelligent_scissors.cpp.o.d"
+  "/root/repo/modules/imgproc/src/intersection.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/intersection.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/intersection.cpp.o.d"
+  "/root/repo/modules/imgproc/src/linefit.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/linefit.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/linefit.cpp.o.d"
+  "/root/repo/modules/imgproc/src/lsd.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/lsd.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/lsd.cpp.o.d"
+  "/root/repo/modules/imgproc/src/main.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/main.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/main.cpp.o.d"
+  "/root/repo/modules/imgproc/src/matchcontours.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/matchcontours.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/matchcontours.cpp.o.d"
+  "/root/repo/modules/imgproc/src/median_blur.dispatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/median_blur.dispatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/median_blur.dispatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/min_enclosing_triangle.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/min_enclosing_triangle.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/min_enclosing_triangle.cpp.o.d"
+  "/root/repo/modules/imgproc/src/moments.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/moments.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/moments.cpp.o.d"
+  "/root/repo/modules/imgproc/src/morph.dispatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/morph.dispatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/morph.dispatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/phasecorr.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/phasecorr.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/phasecorr.cpp.o.d"
+  "/root/repo/modules/imgproc/src/preprocess.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/preprocess.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/preprocess.cpp.o.d"
+  "/root/repo/modules/imgproc/src/pyramids.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/pyramids.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/pyramids.cpp.o.d"
+  "/root/repo/modules/imgproc/src/resize.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/resize.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/resize.avx2.cpp.o.d"
+  "/root/repo/modules/imgproc/src/resize.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/resize.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/resize.cpp.o.d"
+  "/root/repo/modules/imgproc/src/resize.sse4_1.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/resize.sse4_1.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/resize.sse4_1.cpp.o.d"
+  "/root/repo/modules/imgproc/src/rotcalipers.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/rotcalipers.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/rotcalipers.cpp.o.d"
+  "/root/repo/modules/imgproc/src/samplers.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/samplers.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/samplers.cpp.o.d"
+  "/root/repo/modules/imgproc/src/segmentation.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/segmentation.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/segmentation.cpp.o.d"
+  "/root/repo/modules/imgproc/src/shapedescr.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/shapedescr.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/shapedescr.cpp.o.d"
+  "/root/repo/modules/imgproc/src/smooth.dispatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/smooth.dispatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/smooth.dispatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/spatialgradient.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/spatialgradient.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/spatialgradient.cpp.o.d"
+  "/root/repo/modules/imgproc/src/stackblur.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/stackblur.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/stackblur.cpp.o.d"
+  "/root/repo/modules/imgproc/src/streaming_filter.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/streaming_filter.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/streaming_filter.cpp.o.d"
+  "/root/repo/modules/imgproc/src/subdivision2d.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/subdivision2d.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/subdivision2d.cpp.o.d"
+  "/root/repo/modules/imgproc/src/sumpixels.dispatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/sumpixels.dispatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/sumpixels.dispatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/tables.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/tables.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/tables.cpp.o.d"
+  "/root/repo/modules/imgproc/src/templmatch.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/templmatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/templmatch.cpp.o.d"
+  "/root/repo/modules/imgproc/src/thresh.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/thresh.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/thresh.cpp.o.d"
+  "/root/repo/modules/imgproc/src/utils.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/utils.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/src/utils.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/sumpixels.avx2.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/sumpixels.avx2.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/sumpixels.avx2.cpp.o.d"
+  "/root/repo/_dnn_build/modules/imgproc/sumpixels.avx512_skx.cpp" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/sumpixels.avx512_skx.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_imgproc.dir/sumpixels.avx512_skx.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_dnn_build/lib/libopencv_imgproc.so" "/root/repo/_dnn_build/lib/libopencv_imgproc.so.4.10.0"
+  "/root/repo/_dnn_build/lib/libopencv_imgproc.so.410" "/root/repo/_dnn_build/lib/libopencv_imgproc.so.4.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,208 @@
+file(REMOVE_RECURSE
+  "../../lib/libopencv_imgproc.pdb"
+  "../../lib/libopencv_imgproc.so"
+  "../../lib/libopencv_imgproc.so.4.10.0"
+  "../../lib/libopencv_imgproc.so.410"
+  "CMakeFiles/opencv_imgproc.dir/accum.avx.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/accum.avx.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/accum.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/accum.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/accum.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/accum.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/bilateral_filter.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/bilateral_filter.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/box_filter.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/box_filter.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/box_filter.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/box_filter.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/color_hsv.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/color_hsv.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/color_hsv.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/color_hsv.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/color_lab.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/color_lab.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/color_lab.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/color_lab.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/color_rgb.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/color_rgb.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/color_rgb.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/color_rgb.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/color_yuv.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/color_yuv.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/color_yuv.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/color_yuv.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/filter.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/filter.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/filter.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/filter.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/median_blur.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/median_blur.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/median_blur.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/median_blur.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/morph.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/morph.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/morph.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/morph.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/opencl_kernels_imgproc.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/opencl_kernels_imgproc.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/smooth.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/smooth.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/smooth.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/smooth.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/accum.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/accum.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/accum.dispatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/accum.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/approx.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/approx.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/bilateral_filter.dispatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/bilateral_filter.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/blend.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/blend.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/box_filter.dispatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/box_filter.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/canny.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/canny.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/clahe.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/clahe.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/color.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/color.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/color_hsv.dispatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/color_hsv.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/color_lab.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/color_lab.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/color_rgb.dispatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/color_rgb.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/color_yuv.dispatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/color_yuv.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/colormap.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/colormap.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/connectedcomponents.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/connectedcomponents.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/contours.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/contours.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/contours_approx.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/contours_approx.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/contours_common.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/contours_common.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/contours_link.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/contours_link.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/contours_new.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/contours_new.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/convhull.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/convhull.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/corner.avx.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/corner.avx.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/corner.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/corner.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/cornersubpix.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/cornersubpix.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/demosaicing.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/demosaicing.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/deriv.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/deriv.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/distransform.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/distransform.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/drawing.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/drawing.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/emd.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/emd.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/emd_new.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/emd_new.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/featureselect.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/featureselect.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/filter.dispatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/filter.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/floodfill.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/floodfill.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/gabor.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/gabor.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/generalized_hough.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/generalized_hough.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/geometry.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/geometry.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/grabcut.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/grabcut.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/hershey_fonts.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/hershey_fonts.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/histogram.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/histogram.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/hough.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/hough.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/imgwarp.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/imgwarp.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/imgwarp.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/imgwarp.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/imgwarp.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/imgwarp.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/intelligent_scissors.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/intelligent_scissors.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/intersection.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/intersection.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/linefit.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/linefit.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/lsd.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/lsd.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/main.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/main.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/matchcontours.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/matchcontours.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/median_blur.dispatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/median_blur.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/min_enclosing_triangle.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/min_enclosing_triangle.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/moments.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/moments.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/morph.dispatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/morph.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/phasecorr.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/phasecorr.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/preprocess.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/preprocess.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/pyramids.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/pyramids.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/resize.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/resize.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/resize.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/resize.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/resize.sse4_1.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/resize.sse4_1.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/rotcalipers.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/rotcalipers.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/samplers.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/samplers.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/segmentation.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/segmentation.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/shapedescr.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/shapedescr.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/smooth.dispatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/smooth.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/spatialgradient.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/spatialgradient.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/stackblur.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/stackblur.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/streaming_filter.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/streaming_filter.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/subdivision2d.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/subdivision2d.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/sumpixels.dispatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/sumpixels.dispatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/tables.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/tables.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/templmatch.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/templmatch.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/thresh.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/thresh.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/src/utils.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/src/utils.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/sumpixels.avx2.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/sumpixels.avx2.cpp.o.d"
+  "CMakeFiles/opencv_imgproc.dir/sumpixels.avx512_skx.cpp.o"
+  "CMakeFiles/opencv_imgproc.dir/sumpixels.avx512_skx.cpp.o.d"
+  "opencl_kernels_imgproc.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_imgproc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
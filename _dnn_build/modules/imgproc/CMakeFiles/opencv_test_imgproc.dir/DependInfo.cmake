@@ -0,0 +1,83 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/imgproc/test/ocl/test_accumulate.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_accumulate.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_accumulate.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_blend.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_blend.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_blend.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_boxfilter.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_boxfilter.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_boxfilter.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_canny.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_canny.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_canny.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_color.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_color.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_color.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_filter2d.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_filter2d.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_filter2d.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_filters.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_filters.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_filters.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_gftt.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_gftt.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_gftt.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_histogram.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_histogram.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_histogram.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_houghlines.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_houghlines.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_houghlines.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_imgproc.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_imgproc.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_imgproc.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_match_template.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_match_template.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_match_template.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_medianfilter.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_medianfilter.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_medianfilter.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_pyramids.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_pyramids.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_pyramids.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_sepfilter2d.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_sepfilter2d.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_sepfilter2d.cpp.o.d"
+  "/root/repo/modules/imgproc/test/ocl/test_warp.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_warp.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_warp.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_approxpoly.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_approxpoly.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_approxpoly.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_bilateral_filter.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_bilateral_filter.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_bilateral_filter.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_boundingrect.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_boundingrect.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_boundingrect.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_canny.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_canny.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_canny.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_color.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_color.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_color.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_connectedcomponents.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_connectedcomponents.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_connectedcomponents.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_contours.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_contours.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_contours.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_contours_new.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_contours_new.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_contours_new.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_convhull.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_convhull.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_convhull.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_cornersubpix.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_cornersubpix.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_cornersubpix.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_cvtyuv.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_cvtyuv.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_cvtyuv.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_distancetransform.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_distancetransform.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_distancetransform.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_drawing.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_drawing.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_drawing.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_emd.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_emd.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_emd.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_filter.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_filter.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_filter.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_fitellipse.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_fitellipse_ams.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse_ams.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse_ams.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_fitellipse_direct.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse_direct.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse_direct.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_floodfill.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_floodfill.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_floodfill.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_goodfeaturetotrack.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_goodfeaturetotrack.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_goodfeaturetotrack.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_grabcut.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_grabcut.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_grabcut.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_histograms.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_histograms.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_histograms.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_houghcircles.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_houghcircles.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_houghcircles.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_houghlines.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_houghlines.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_houghlines.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_imgproc_umat.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_imgproc_umat.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_imgproc_umat.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_imgwarp.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_imgwarp.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_imgwarp.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_imgwarp_strict.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_imgwarp_strict.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_imgwarp_strict.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_intelligent_scissors.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_intelligent_scissors.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_intelligent_scissors.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_intersectconvexconvex.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_intersectconvexconvex.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_intersectconvexconvex.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_intersection.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_intersection.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_intersection.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_lsd.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_lsd.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_lsd.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_main.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_main.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_main.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_moments.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_moments.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_moments.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_pc.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_pc.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_pc.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_pyramid.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_pyramid.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_pyramid.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_resize_bitexact.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_resize_bitexact.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_resize_bitexact.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_smooth_bitexact.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_smooth_bitexact.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_smooth_bitexact.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_stackblur.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_stackblur.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_stackblur.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_subdivision2d.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_subdivision2d.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_subdivision2d.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_templmatch.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_templmatch.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_templmatch.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_templmatchmask.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_templmatchmask.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_templmatchmask.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_thresh.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_thresh.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_thresh.cpp.o.d"
+  "/root/repo/modules/imgproc/test/test_watershed.cpp" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_watershed.cpp.o" "gcc" "modules/imgproc/CMakeFiles/opencv_test_imgproc.dir/test/test_watershed.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/modules/ts/CMakeFiles/opencv_ts.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/highgui/CMakeFiles/opencv_highgui.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/videoio/CMakeFiles/opencv_videoio.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgproc/CMakeFiles/opencv_imgproc.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
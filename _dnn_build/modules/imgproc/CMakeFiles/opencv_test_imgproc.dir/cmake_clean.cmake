@@ -0,0 +1,127 @@
+file(REMOVE_RECURSE
+  "../../bin/opencv_test_imgproc"
+  "../../bin/opencv_test_imgproc.pdb"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_accumulate.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_accumulate.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_blend.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_blend.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_boxfilter.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_boxfilter.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_canny.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_canny.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_color.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_color.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_filter2d.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_filter2d.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_filters.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_filters.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_gftt.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_gftt.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_histogram.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_histogram.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_houghlines.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_houghlines.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_imgproc.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_imgproc.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_match_template.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_match_template.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_medianfilter.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_medianfilter.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_pyramids.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_pyramids.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_sepfilter2d.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_sepfilter2d.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_warp.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/ocl/test_warp.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_approxpoly.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_approxpoly.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_bilateral_filter.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_bilateral_filter.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_boundingrect.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_boundingrect.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_canny.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_canny.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_color.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_color.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_connectedcomponents.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_connectedcomponents.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_contours.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_contours.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_contours_new.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_contours_new.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_convhull.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_convhull.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_cornersubpix.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_cornersubpix.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_cvtyuv.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_cvtyuv.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_distancetransform.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_distancetransform.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_drawing.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_drawing.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_emd.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_emd.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_filter.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_filter.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse_ams.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse_ams.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse_direct.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_fitellipse_direct.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_floodfill.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_floodfill.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_goodfeaturetotrack.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_goodfeaturetotrack.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_grabcut.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_grabcut.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_histograms.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_histograms.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_houghcircles.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_houghcircles.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_houghlines.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_houghlines.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_imgproc_umat.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_imgproc_umat.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_imgwarp.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_imgwarp.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_imgwarp_strict.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_imgwarp_strict.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_intelligent_scissors.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_intelligent_scissors.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_intersectconvexconvex.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_intersectconvexconvex.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_intersection.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_intersection.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_lsd.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_lsd.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_main.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_main.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_moments.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_moments.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_pc.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_pc.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_pyramid.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_pyramid.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_resize_bitexact.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_resize_bitexact.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_smooth_bitexact.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_smooth_bitexact.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_stackblur.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_stackblur.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_subdivision2d.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_subdivision2d.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_templmatch.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_templmatch.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_templmatchmask.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_templmatchmask.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_thresh.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_thresh.cpp.o.d"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_watershed.cpp.o"
+  "CMakeFiles/opencv_test_imgproc.dir/test/test_watershed.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_test_imgproc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
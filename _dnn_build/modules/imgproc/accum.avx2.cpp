@@ -0,0 +1,3 @@
+
+#include "/root/repo/modules/imgproc/src/precomp.hpp"
+#include "/root/repo/modules/imgproc/src/accum.simd.hpp"
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/ts/src/cuda_perf.cpp" "modules/ts/CMakeFiles/opencv_ts.dir/src/cuda_perf.cpp.o" "gcc" "modules/ts/CMakeFiles/opencv_ts.dir/src/cuda_perf.cpp.o.d"
+  "/root/repo/modules/ts/src/cuda_test.cpp" "modules/ts/CMakeFiles/opencv_ts.dir/src/cuda_test.cpp.o" "gcc" "modules/ts/CMakeFiles/opencv_ts.dir/src/cuda_test.cpp.o.d"
+  "/root/repo/modules/ts/src/ocl_perf.cpp" "modules/ts/CMakeFiles/opencv_ts.dir/src/ocl_perf.cpp.o" "gcc" "modules/ts/CMakeFiles/opencv_ts.dir/src/ocl_perf.cpp.o.d"
+  "/root/repo/modules/ts/src/ocl_test.cpp" "modules/ts/CMakeFiles/opencv_ts.dir/src/ocl_test.cpp.o" "gcc" "modules/ts/CMakeFiles/opencv_ts.dir/src/ocl_test.cpp.o.d"
+  "/root/repo/modules/ts/src/ts.cpp" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts.cpp.o" "gcc" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts.cpp.o.d"
+  "/root/repo/modules/ts/src/ts_arrtest.cpp" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts_arrtest.cpp.o" "gcc" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts_arrtest.cpp.o.d"
+  "/root/repo/modules/ts/src/ts_func.cpp" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts_func.cpp.o" "gcc" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts_func.cpp.o.d"
+  "/root/repo/modules/ts/src/ts_gtest.cpp" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts_gtest.cpp.o" "gcc" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts_gtest.cpp.o.d"
+  "/root/repo/modules/ts/src/ts_perf.cpp" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts_perf.cpp.o" "gcc" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts_perf.cpp.o.d"
+  "/root/repo/modules/ts/src/ts_tags.cpp" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts_tags.cpp.o" "gcc" "modules/ts/CMakeFiles/opencv_ts.dir/src/ts_tags.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/modules/highgui/CMakeFiles/opencv_highgui.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/videoio/CMakeFiles/opencv_videoio.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgproc/CMakeFiles/opencv_imgproc.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../../lib/libopencv_ts.a"
+  "../../lib/libopencv_ts.pdb"
+  "CMakeFiles/opencv_ts.dir/src/cuda_perf.cpp.o"
+  "CMakeFiles/opencv_ts.dir/src/cuda_perf.cpp.o.d"
+  "CMakeFiles/opencv_ts.dir/src/cuda_test.cpp.o"
+  "CMakeFiles/opencv_ts.dir/src/cuda_test.cpp.o.d"
+  "CMakeFiles/opencv_ts.dir/src/ocl_perf.cpp.o"
+  "CMakeFiles/opencv_ts.dir/src/ocl_perf.cpp.o.d"
+  "CMakeFiles/opencv_ts.dir/src/ocl_test.cpp.o"
+  "CMakeFiles/opencv_ts.dir/src/ocl_test.cpp.o.d"
+  "CMakeFiles/opencv_ts.dir/src/ts.cpp.o"
+  "CMakeFiles/opencv_ts.dir/src/ts.cpp.o.d"
+  "CMakeFiles/opencv_ts.dir/src/ts_arrtest.cpp.o"
+  "CMakeFiles/opencv_ts.dir/src/ts_arrtest.cpp.o.d"
+  "CMakeFiles/opencv_ts.dir/src/ts_func.cpp.o"
+  "CMakeFiles/opencv_ts.dir/src/ts_func.cpp.o.d"
+  "CMakeFiles/opencv_ts.dir/src/ts_gtest.cpp.o"
+  "CMakeFiles/opencv_ts.dir/src/ts_gtest.cpp.o.d"
+  "CMakeFiles/opencv_ts.dir/src/ts_perf.cpp.o"
+  "CMakeFiles/opencv_ts.dir/src/ts_perf.cpp.o.d"
+  "CMakeFiles/opencv_ts.dir/src/ts_tags.cpp.o"
+  "CMakeFiles/opencv_ts.dir/src/ts_tags.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_ts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/videoio/test/test_audio.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_audio.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_audio.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_camera.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_camera.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_camera.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_container_avi.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_container_avi.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_container_avi.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_dynamic.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_dynamic.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_dynamic.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_ffmpeg.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_ffmpeg.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_ffmpeg.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_gstreamer.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_gstreamer.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_gstreamer.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_images.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_images.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_images.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_main.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_main.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_main.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_mfx.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_mfx.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_mfx.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_microphone.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_microphone.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_microphone.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_orientation.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_orientation.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_orientation.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_plugins.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_plugins.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_plugins.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_v4l2.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_v4l2.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_v4l2.cpp.o.d"
+  "/root/repo/modules/videoio/test/test_video_io.cpp" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_video_io.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_test_videoio.dir/test/test_video_io.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/modules/ts/CMakeFiles/opencv_ts.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/highgui/CMakeFiles/opencv_highgui.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/videoio/CMakeFiles/opencv_videoio.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgproc/CMakeFiles/opencv_imgproc.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
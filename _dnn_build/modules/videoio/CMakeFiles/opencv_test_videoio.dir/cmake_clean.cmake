@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "../../bin/opencv_test_videoio"
+  "../../bin/opencv_test_videoio.pdb"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_audio.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_audio.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_camera.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_camera.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_container_avi.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_container_avi.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_dynamic.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_dynamic.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_ffmpeg.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_ffmpeg.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_gstreamer.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_gstreamer.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_images.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_images.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_main.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_main.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_mfx.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_mfx.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_microphone.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_microphone.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_orientation.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_orientation.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_plugins.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_plugins.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_v4l2.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_v4l2.cpp.o.d"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_video_io.cpp.o"
+  "CMakeFiles/opencv_test_videoio.dir/test/test_video_io.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_test_videoio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/modules/videoio/src/backend_plugin.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/backend_plugin.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/backend_plugin.cpp.o.d"
+  "/root/repo/modules/videoio/src/backend_static.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/backend_static.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/backend_static.cpp.o.d"
+  "/root/repo/modules/videoio/src/cap.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap.cpp.o.d"
+  "/root/repo/modules/videoio/src/cap_images.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_images.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_images.cpp.o.d"
+  "/root/repo/modules/videoio/src/cap_mjpeg_decoder.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_mjpeg_decoder.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_mjpeg_decoder.cpp.o.d"
+  "/root/repo/modules/videoio/src/cap_mjpeg_encoder.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_mjpeg_encoder.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_mjpeg_encoder.cpp.o.d"
+  "/root/repo/modules/videoio/src/cap_obsensor/obsensor_stream_channel_v4l2.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_obsensor/obsensor_stream_channel_v4l2.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_obsensor/obsensor_stream_channel_v4l2.cpp.o.d"
+  "/root/repo/modules/videoio/src/cap_obsensor/obsensor_uvc_stream_channel.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_obsensor/obsensor_uvc_stream_channel.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_obsensor/obsensor_uvc_stream_channel.cpp.o.d"
+  "/root/repo/modules/videoio/src/cap_obsensor_capture.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_obsensor_capture.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_obsensor_capture.cpp.o.d"
+  "/root/repo/modules/videoio/src/cap_v4l.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_v4l.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/cap_v4l.cpp.o.d"
+  "/root/repo/modules/videoio/src/container_avi.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/container_avi.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/container_avi.cpp.o.d"
+  "/root/repo/modules/videoio/src/videoio_c.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/videoio_c.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/videoio_c.cpp.o.d"
+  "/root/repo/modules/videoio/src/videoio_registry.cpp" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/videoio_registry.cpp.o" "gcc" "modules/videoio/CMakeFiles/opencv_videoio.dir/src/videoio_registry.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_dnn_build/lib/libopencv_videoio.so" "/root/repo/_dnn_build/lib/libopencv_videoio.so.4.10.0"
+  "/root/repo/_dnn_build/lib/libopencv_videoio.so.410" "/root/repo/_dnn_build/lib/libopencv_videoio.so.4.10.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dnn_build/modules/imgcodecs/CMakeFiles/opencv_imgcodecs.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/imgproc/CMakeFiles/opencv_imgproc.dir/DependInfo.cmake"
+  "/root/repo/_dnn_build/modules/core/CMakeFiles/opencv_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
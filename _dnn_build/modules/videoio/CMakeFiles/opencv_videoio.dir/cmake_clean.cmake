@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "../../lib/libopencv_videoio.pdb"
+  "../../lib/libopencv_videoio.so"
+  "../../lib/libopencv_videoio.so.4.10.0"
+  "../../lib/libopencv_videoio.so.410"
+  "CMakeFiles/opencv_videoio.dir/src/backend_plugin.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/backend_plugin.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/backend_static.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/backend_static.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/cap.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/cap.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/cap_images.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/cap_images.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/cap_mjpeg_decoder.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/cap_mjpeg_decoder.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/cap_mjpeg_encoder.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/cap_mjpeg_encoder.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/cap_obsensor/obsensor_stream_channel_v4l2.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/cap_obsensor/obsensor_stream_channel_v4l2.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/cap_obsensor/obsensor_uvc_stream_channel.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/cap_obsensor/obsensor_uvc_stream_channel.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/cap_obsensor_capture.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/cap_obsensor_capture.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/cap_v4l.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/cap_v4l.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/container_avi.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/container_avi.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/videoio_c.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/videoio_c.cpp.o.d"
+  "CMakeFiles/opencv_videoio.dir/src/videoio_registry.cpp.o"
+  "CMakeFiles/opencv_videoio.dir/src/videoio_registry.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opencv_videoio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
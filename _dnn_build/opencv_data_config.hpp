@@ -0,0 +1,11 @@
+
+#define OPENCV_INSTALL_PREFIX "/usr/local"
+
+#define OPENCV_DATA_INSTALL_PATH "share/opencv4"
+
+#define OPENCV_BUILD_DIR "/root/repo/_dnn_build"
+
+#define OPENCV_DATA_BUILD_DIR_SEARCH_PATHS \
+    "..//"
+
+#define OPENCV_INSTALL_DATA_DIR_RELATIVE "../share/opencv4"
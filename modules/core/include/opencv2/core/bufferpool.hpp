@@ -7,6 +7,8 @@
 #ifndef OPENCV_CORE_BUFFER_POOL_HPP
 #define OPENCV_CORE_BUFFER_POOL_HPP
 
+#include "opencv2/core/cvdef.h"
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable: 4265)
@@ -31,6 +33,64 @@ public:
 
 //! @}
 
+//! @addtogroup core_basic
+//! @{
+
+class MatAllocator;
+
+/** @brief Statistics of the pooling allocator
+@sa getPoolMatAllocator
+*/
+struct BufferPoolStatistics
+{
+    uint64_t allocations;  //!< number of allocation requests of pooled sizes
+    uint64_t hits;         //!< number of allocation requests served from reserved buffers
+    size_t reservedSize;   //!< memory retained by free lists (global and per-thread caches)
+    size_t releasedSize;   //!< memory of reserved buffers released back to the system by trim policy
+
+    double hitRate() const { return allocations ? (double)hits / (double)allocations : 0.0; }
+};
+
+/** @brief Returns size-class pooling allocator for CPU buffers of Mat/UMat
+
+This is CPU counterpart of OpenCL buffer pools. Buffer sizes are rounded up to size classes (4 classes per power of 2).
+Released buffers are kept in thread-local caches (a few buffers per size class) and in the global free lists,
+so repeated allocations of the same shapes don't reach the system allocator.
+
+Reserved memory is limited by the global trim policy, it can be controlled through
+`getPoolMatAllocator()->getBufferPoolController()` interface.
+
+Runtime parameters:
+- `OPENCV_POOL_ALLOCATOR_LIMIT` - maximal reserved memory (bytes, default 256Mb)
+- `OPENCV_POOL_ALLOCATOR_MAX_BLOCK_SIZE` - larger buffers are not pooled (bytes, default 64Mb)
+- `OPENCV_POOL_ALLOCATOR_THREAD_CACHE_SIZE` - number of cached buffers per size class in each thread (default 4, 0 disables thread caches)
+
+Usage: `Mat::setDefaultAllocator(getPoolMatAllocator())` or `MatAllocatorThreadScope scope(getPoolMatAllocator())`.
+*/
+CV_EXPORTS MatAllocator* getPoolMatAllocator();
+
+/** @brief Returns usage statistics of getPoolMatAllocator() */
+CV_EXPORTS BufferPoolStatistics getPoolMatAllocatorStatistics();
+
+/** @brief Replaces default Mat allocator for the current thread until the end of the scope
+
+Other threads continue to use global default allocator (Mat::setDefaultAllocator()).
+Scopes can be nested.
+*/
+class CV_EXPORTS MatAllocatorThreadScope
+{
+public:
+    explicit MatAllocatorThreadScope(MatAllocator* allocator);
+    ~MatAllocatorThreadScope();
+private:
+    MatAllocator* prevAllocator_;
+
+    MatAllocatorThreadScope(const MatAllocatorThreadScope&); // disabled
+    MatAllocatorThreadScope& operator=(const MatAllocatorThreadScope&); // disabled
+};
+
+//! @}
+
 }
 
 #ifdef _MSC_VER
@@ -1474,6 +1474,41 @@ public:
     */
     CV_NODISCARD_STD static MatExpr eye(Size size, int type);
 
+    //! Flags of Mat::mapFile()
+    enum MapFileFlags {
+        MAPFILE_READ_ONLY = 0,          //!< shared read-only mapping. Writing into the matrix data causes access violation
+        MAPFILE_COPY_ON_WRITE = 1,      //!< private mapping: modified pages are copied, changes are not written into the file
+        MAPFILE_READ_WRITE = 2,         //!< shared mapping: changes are written into the file
+        MAPFILE_CREATE = 4 | MAPFILE_READ_WRITE,  //!< create file or extend it to the required size, implies MAPFILE_READ_WRITE
+        MAPFILE_ACCESS_MASK = 7,
+        MAPFILE_ADVISE_SEQUENTIAL = 16, //!< hint: data is accessed sequentially (aggressive read-ahead)
+        MAPFILE_ADVISE_RANDOM = 32,     //!< hint: data is accessed randomly (no read-ahead)
+        MAPFILE_ADVISE_WILLNEED = 64    //!< hint: data will be accessed soon (asynchronous prefetch of the whole mapping)
+    };
+
+    /** @brief Creates matrix header over memory-mapped file data (zero-copy)
+
+    File data is not read in advance: pages are loaded on demand by the OS and shared between
+    processes which map the same file (except modified pages of MAPFILE_COPY_ON_WRITE mappings).
+    The mapping is reference-counted through the matrix data (UMatData): it is unmapped when the last
+    matrix which refers to the data is released.
+
+    @code
+        // 10000x128 float descriptors, stored as raw data after 64-byte header
+        Mat descriptors = Mat::mapFile("descriptors.bin", CV_32FC1, {10000, 128}, Mat::MAPFILE_READ_ONLY, 64);
+    @endcode
+
+    @param path file path
+    @param type matrix type
+    @param shape matrix shape (at least 1 dimension). Empty shape means single-row matrix over the rest of the file.
+    @param flags combination of access mode and optional access hints, see Mat::MapFileFlags
+    @param offset offset of matrix data in the file (bytes). Any offset is supported.
+
+    @note Read-only mappings must not be used as output arrays of OpenCV functions.
+    @note Raises exception if file is too small (except MAPFILE_CREATE mode) or memory mapping is not supported by the platform.
+     */
+    static Mat mapFile(const String& path, int type, const std::vector<int>& shape, int flags = MAPFILE_READ_ONLY, size_t offset = 0);
+
     /** @brief Allocates new array data if needed.
 
     This is one of the key Mat methods. Most new-style OpenCV functions and methods that produce arrays
@@ -3597,6 +3632,17 @@ Here are examples of matrix expressions:
     Mat sharpened = img*(1+amount) + blurred*(-amount);
     img.copyTo(sharpened, lowContrastMask);
 @endcode
+
+The nested operations of an expression are evaluated when the expression is built, only the
+operations of the outermost level read their operands when the result is assigned.
+
+If the fusion is enabled by MatExpr::setUseFusion() or `OPENCV_MATEXPR_FUSION=1` environment variable,
+chains of per-element operations (addition, subtraction, scaling, per-element multiplication, `abs`,
+`min`, `max`, comparisons and the final type conversion), like `a*alpha + b*beta - c`, are evaluated
+in a single pass over the operands without temporary matrices. Intermediate results are saturated
+the same way as if each operation is evaluated separately. Floating-point results may differ in the
+last bits because of the different order of rounding. All the operands of a fused chain are read when
+the result is assigned, so they must not be modified between building and assigning the expression.
 */
 class CV_EXPORTS MatExpr
 {
@@ -3629,6 +3675,12 @@ public:
 
     void swap(MatExpr& b);
 
+    /** @brief Enables or disables the single pass evaluation of per-element chains (see MatExpr).
+    The fusion is disabled by default unless `OPENCV_MATEXPR_FUSION=1` environment variable is set.
+    */
+    static void setUseFusion(bool flag);
+    static bool useFusion();
+
     const MatOp* op;
     int flags;
 
@@ -47,6 +47,18 @@ namespace cv { namespace parallel {
  * - disable backend: `OPENCV_PARALLEL_PRIORITY_<backend>=0`
  * - specify list of backends with high priority (>100000): `OPENCV_PARALLEL_PRIORITY_LIST=TBB,OPENMP`. Unknown backends are registered as new plugins.
  *
+ *
+ * ### Builtin work-stealing backend
+ *
+ * `WORKSTEAL` backend uses per-worker task deques with work stealing. Nested and concurrent `parallel_for_()` calls
+ * (from several application threads) are scheduled on the same thread pool instead of serial execution.
+ * This backend is not selected automatically, request it explicitly:
+ * - `OPENCV_PARALLEL_BACKEND=WORKSTEAL` or `setParallelForBackend("WORKSTEAL")`
+ * - through priority settings: `OPENCV_PARALLEL_PRIORITY_LIST=WORKSTEAL` or `OPENCV_PARALLEL_PRIORITY_WORKSTEAL=<value>`
+ *
+ * Tuning options: `OPENCV_PARALLEL_WORKSTEAL_ACTIVE_WAIT` (spin iterations before sleep),
+ * `OPENCV_PARALLEL_WORKSTEAL_CHUNKS_PER_THREAD` (split granularity).
+ *
  */
 
 /** Interface for parallel_for backends implementations
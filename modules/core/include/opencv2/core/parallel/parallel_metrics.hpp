@@ -0,0 +1,96 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#ifndef OPENCV_CORE_PARALLEL_METRICS_HPP
+#define OPENCV_CORE_PARALLEL_METRICS_HPP
+
+#include "opencv2/core/cvdef.h"
+
+#include <string>
+#include <vector>
+
+namespace cv { namespace parallel {
+
+/** @addtogroup core_parallel
+ * @{
+ */
+
+/** @brief Scheduling metrics of a single `parallel_for_()` invocation
+ *
+ * Metrics are collected by the builtin (pthreads) thread pool only.
+ * Times are measured in seconds.
+ */
+struct CV_EXPORTS ParallelForMetrics
+{
+    ParallelForMetrics();
+
+    int64 rangeSize;          //!< size of the processed range (parallel_for_() argument)
+    int stripes;              //!< number of stripes chosen for the range (scheduling units)
+    int threads;              //!< number of threads which have processed stripes (including the calling thread)
+    double wallTime;          //!< time from the job submission to its completion
+    std::vector<double> busyTime;  //!< per-thread time of stripes processing: [0] - calling thread, [1..N] - workers
+    std::vector<double> idleTime;  //!< per-thread time without work during the job (wake-up latency, waiting for stragglers)
+    double activeWaitTime;    //!< time spent by the calling thread in active (spin) wait for completion of workers
+    double sleepTime;         //!< time spent by the calling thread in passive (sleep) wait for completion of workers
+    int workersWokenActive;   //!< workers which have picked up the job while spinning (`OPENCV_THREAD_POOL_ACTIVE_WAIT_WORKER`)
+    int workersWokenSleeping; //!< workers which have been woken up from sleep
+    double stragglerRatio;    //!< max(busyTime) / mean(busyTime) over participated threads (1.0 - perfect balance)
+};
+
+/** @brief Aggregated `parallel_for_()` metrics of one call site
+ *
+ * Call sites are distinguished by the type of the parallel loop body. For the lambda version of
+ * `parallel_for_()` the type of the lambda is used; all the calls passing plain functions or
+ * std::function objects of the same type share one entry.
+ */
+struct CV_EXPORTS ParallelForStatistics
+{
+    ParallelForStatistics();
+
+    std::string name;         //!< type name of the parallel loop body or the lambda
+    int64 calls;              //!< number of parallel invocations
+    int64 stripes;            //!< total number of processed stripes
+    int maxThreads;           //!< maximal number of participated threads
+    double wallTime;          //!< total time of invocations
+    double busyTime;          //!< total time of stripes processing (all threads)
+    double idleTime;          //!< total idle time of participated threads
+    double activeWaitTime;    //!< total active wait time of calling threads
+    double sleepTime;         //!< total sleep time of calling threads
+    int64 workersWokenActive;
+    int64 workersWokenSleeping;
+    double meanStragglerRatio;
+    double maxStragglerRatio;
+};
+
+/** @brief Enables collection of `parallel_for_()` scheduling metrics
+ *
+ * Initial state is controlled by `OPENCV_PARALLEL_METRICS` runtime parameter (disabled by default).
+ * Metrics are reported by the builtin (pthreads) thread pool only, other parallel backends
+ * (including the ones set by setParallelForBackend()) don't report them.
+ *
+ * Metrics of each invocation are aggregated by the call site (see ParallelForStatistics).
+ * If OpenCV is built with tracing support, metrics are also attached to the `parallel_for` trace region
+ * as arguments (visible in ITT).
+ */
+CV_EXPORTS void setParallelForMetricsEnabled(bool enabled);
+
+/** @brief Checks if collection of `parallel_for_()` scheduling metrics is enabled */
+CV_EXPORTS bool isParallelForMetricsEnabled();
+
+/** @brief Returns metrics of the last parallel `parallel_for_()` invocation from the calling thread
+ *
+ * @returns false if there is no collected metrics (loop has been executed serially or metrics are disabled)
+ */
+CV_EXPORTS bool getLastParallelForMetrics(ParallelForMetrics& metrics);
+
+/** @brief Returns aggregated metrics collected since the last resetParallelForStatistics() call */
+CV_EXPORTS std::vector<ParallelForStatistics> getParallelForStatistics();
+
+/** @brief Drops aggregated metrics */
+CV_EXPORTS void resetParallelForStatistics();
+
+//! @}
+}}  // namespace
+
+#endif  // OPENCV_CORE_PARALLEL_METRICS_HPP
@@ -0,0 +1,103 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#ifndef OPENCV_CORE_PARALLEL_TASK_HPP
+#define OPENCV_CORE_PARALLEL_TASK_HPP
+
+#include "opencv2/core/async.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace cv { namespace parallel {
+
+/** @addtogroup core_parallel
+ * @{
+ */
+
+/** @brief Handle of task submitted via cv::parallel::submit()
+ *
+ * Object has attached shared state of the task. Copies refer to the same task.
+ * Unlike AsyncArray, result can be fetched multiple times (returned result is shared, not cloned).
+ */
+class CV_EXPORTS AsyncTask
+{
+public:
+    AsyncTask() CV_NOEXCEPT;
+    ~AsyncTask() CV_NOEXCEPT;
+
+    /** Returns true if object refers to a submitted task */
+    bool valid() const CV_NOEXCEPT;
+
+    /** Returns true if task is completed (successfully, with exception or cancelled due to failed dependency) */
+    bool isReady() const;
+
+    /** Waits for task completion.
+     *
+     * If the task is not started yet, it may be executed in the calling thread.
+     * Doesn't throw exceptions stored in the task.
+     */
+    void wait() const;
+
+    /** Waits for task completion with timeout
+     * @param[in] timeoutNs timeout in nanoseconds, -1 for infinite wait
+     * @returns true if task is completed, false if the timeout has expired
+     */
+    bool wait_for(int64 timeoutNs) const;
+
+    template<typename _Rep, typename _Period>
+    inline bool wait_for(const std::chrono::duration<_Rep, _Period>& timeout) const
+    {
+        return wait_for((int64)(std::chrono::nanoseconds(timeout).count()));
+    }
+
+    /** Fetch the result.
+     *
+     * Waits for task completion. Throws exception if exception was stored as a result
+     * (or one of task dependencies has failed).
+     */
+    void get(OutputArray dst) const;
+
+    /** Returns AsyncArray which is fulfilled on task completion */
+    AsyncArray getArrayResult() const;
+
+    // PImpl
+    struct Impl;
+    inline const std::shared_ptr<Impl>& _getImpl() const CV_NOEXCEPT { return p; }
+    explicit AsyncTask(const std::shared_ptr<Impl>& impl) CV_NOEXCEPT;
+
+protected:
+    std::shared_ptr<Impl> p;
+};
+
+/** Task body. `result` is optional output which is available through AsyncTask::get() */
+typedef std::function<void(OutputArray result)> TaskFunction;
+
+/** @brief Submits asynchronous task
+ *
+ * Task is started after completion of all `dependencies`. If any dependency fails,
+ * the task is not executed and its exception is propagated to the task result.
+ *
+ * Tasks are executed by dedicated task threads (`OPENCV_PARALLEL_TASK_THREADS`, default 2).
+ * Data-parallel work inside of the task body should use `parallel_for_()`: it is scheduled on the active
+ * `parallel_for_()` backend, so independent tasks (stages of pipeline) overlap on the same thread pool.
+ * `WORKSTEAL` backend is recommended: it executes concurrent `parallel_for_()` calls on all workers
+ * (other builtin backends may process concurrent calls serially).
+ *
+ * Tasks may wait for other tasks (waiting thread executes the awaited task if it has not been started yet).
+ *
+ * @param body task function
+ * @param dependencies tasks which should be completed before start of this task
+ *
+ * @note If OpenCV is built without threading support, task is executed immediately in the calling thread.
+ */
+CV_EXPORTS AsyncTask submit(const TaskFunction& body, const std::vector<AsyncTask>& dependencies = std::vector<AsyncTask>());
+
+/** @brief Waits for completion of all tasks from the list */
+CV_EXPORTS void waitAll(const std::vector<AsyncTask>& tasks);
+
+//! @}
+}}  // namespace
+
+#endif  // OPENCV_CORE_PARALLEL_TASK_HPP
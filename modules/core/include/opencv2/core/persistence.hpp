@@ -221,6 +221,22 @@ Here is how to read the file created by the code sample above:
     fs2.release();
 @endcode
 
+Binary file storage.     {#binary_storage}
+--------------------
+Large numerical data (e.g. weights of trained models) can be stored in the binary format
+(FileStorage::FORMAT_BINARY, file extension ".cvbin"). The format supports the same hierarchy of
+file nodes, but raw data arrays (matrices, vectors of numbers, see FileStorage::writeRaw) are
+stored as is in 64-byte aligned blobs:
+-   The file index (names and tree of file nodes) is loaded without parsing.
+-   Matrices are not copied on reading: FileNode >> Mat returns matrix which refers to the memory mapped
+    file (see Mat::mapFile, modified pages are not written back into the file). Such matrices remain valid
+    after release of the storage. Small arrays (less than 256 bytes) are stored in the index.
+-   Raw data arrays can be read by FileNode::readRaw() / FileNodeIterator::readRaw() only, element-wise
+    access to them (iteration, FileNode::operator[](int)) is not supported.
+
+Binary storage works with regular files only: FileStorage::MEMORY, FileStorage::APPEND modes and compression
+are not supported. Data is stored in the native (little-endian) byte order.
+
 Format specification    {#format_spec}
 --------------------
 `([count]{u|c|w|s|i|f|d})`... where the characters correspond to fundamental C++ types:
@@ -273,6 +289,7 @@ public:
         FORMAT_XML  = (1<<3), //!< flag, XML format
         FORMAT_YAML = (2<<3), //!< flag, YAML format
         FORMAT_JSON = (3<<3), //!< flag, JSON format
+        FORMAT_BINARY = (4<<3), //!< flag, binary format, see @ref binary_storage
 
         BASE64      = 64,     //!< flag, write rawdata in Base64 by default. (consider using WRITE_BASE64)
         WRITE_BASE64 = BASE64 | WRITE, //!< flag, enable both WRITE and BASE64
@@ -305,8 +322,8 @@ public:
      See description of parameters in FileStorage::FileStorage. The method calls FileStorage::release
      before opening the file.
      @param filename Name of the file to open or the text string to read the data from.
-     Extension of the file (.xml, .yml/.yaml or .json) determines its format (XML, YAML or JSON
-     respectively). Also you can append .gz to work with compressed files, for example myHugeMatrix.xml.gz. If both
+     Extension of the file (.xml, .yml/.yaml, .json or .cvbin) determines its format (XML, YAML, JSON or
+     binary respectively). Also you can append .gz to work with compressed files, for example myHugeMatrix.xml.gz. If both
      FileStorage::WRITE and FileStorage::MEMORY flags are specified, source is used just to specify
      the output file format (e.g. mydata.xml, .yml etc.). A file name can also contain parameters.
      You can use this format, "*?base64" (e.g. "file.json?base64" (case sensitive)), as an alternative to
@@ -57,6 +57,7 @@
 #include <ostream>
 
 #include <functional>
+#include <typeinfo>
 
 #if !defined(_M_CEE)
 #include <mutex>  // std::mutex, std::lock_guard
@@ -673,6 +674,12 @@ public:
     {
         m_functor(range);
     }
+
+    //! type of the wrapped function object, identifies the lambda
+    inline const std::type_info& functorType() const
+    {
+        return m_functor.target_type();
+    }
 };
 
 //! @ingroup core_parallel
@@ -0,0 +1,55 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#ifndef OPENCV_CORE_UTILS_NUMA_HPP
+#define OPENCV_CORE_UTILS_NUMA_HPP
+
+#include "../cvdef.h"
+
+namespace cv {
+
+class MatAllocator;
+
+namespace utils { namespace numa {
+
+//! @addtogroup core_utils
+//! @{
+
+/** @brief Checks if NUMA-aware mode of the builtin thread pool is active
+
+NUMA mode is opt-in: it is enabled by `OPENCV_THREAD_POOL_NUMA=1` runtime parameter
+and requires at least 2 NUMA nodes with available CPUs (Linux only).
+
+In this mode the builtin (pthreads) `parallel_for_()` thread pool:
+- binds worker threads to NUMA nodes (proportionally to the number of available CPUs of each node)
+- partitions the processed range in contiguous per-node parts, so the same part of the range is processed on the same node
+  in subsequent calls (idle threads help other nodes after completion of own part)
+*/
+CV_EXPORTS bool isEnabled();
+
+/** @brief Returns number of NUMA nodes used by the thread pool (1 if NUMA mode is not active) */
+CV_EXPORTS int getNumberOfNodes();
+
+/** @brief Returns NUMA node of the CPU which executes the calling thread (0 if NUMA mode is not active) */
+CV_EXPORTS int getCurrentNode();
+
+/** @brief Returns allocator with first touch of the allocated memory from the thread pool
+
+Large buffers are allocated without touching of memory pages, then pages are touched through `parallel_for_()`
+over the first dimension of array. In NUMA mode the physical memory of each row stripe is allocated
+on the node which processes this stripe.
+
+Allocator falls back on the default (`Mat::getStdAllocator()`) behavior for small buffers, user-provided data
+or if NUMA mode is not active.
+
+Usage: `Mat::setDefaultAllocator(cv::utils::numa::getFirstTouchAllocator())` or `mat.allocator = cv::utils::numa::getFirstTouchAllocator()`.
+Minimal buffer size is controlled by `OPENCV_NUMA_FIRST_TOUCH_MIN_SIZE` runtime parameter (bytes, default 1Mb).
+*/
+CV_EXPORTS MatAllocator* getFirstTouchAllocator();
+
+//! @}
+
+}}}  // namespace
+
+#endif  // OPENCV_CORE_UTILS_NUMA_HPP
@@ -423,6 +423,19 @@ PERF_TEST_P_(BinaryOpTest, reciprocal)
 }
 
 
+PERF_TEST_P_(BinaryOpTest, matExprChain)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    cv::Mat a(sz, type), b(sz, type), c(sz, type), d(sz, type);
+
+    declare.in(a, b, c, WARMUP_RNG).out(d);
+
+    TEST_CYCLE() d = a*0.5 + b*0.25 - c;
+
+    SANITY_CHECK_NOTHING();
+}
+
 PERF_TEST_P_(BinaryOpTest, transposeND)
 {
     Size sz = get<0>(GetParam());
@@ -452,6 +465,44 @@ INSTANTIATE_TEST_CASE_P(/*nothing*/ , BinaryOpTest,
     )
 );
 
+///////////// Short rows ////////
+
+typedef Size_MatType ArithmShortRowsTest;
+
+PERF_TEST_P_(ArithmShortRowsTest, add)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    cv::Mat a(sz, type), b(sz, type), c(sz, type);
+
+    declare.in(a, b, WARMUP_RNG).out(c);
+
+    // non-continuous rows, each one has the incomplete vector at the end
+    TEST_CYCLE() cv::add(a.colRange(0, sz.width - 1), b.colRange(0, sz.width - 1), c.colRange(0, sz.width - 1));
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ArithmShortRowsTest, absdiff)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    cv::Mat a(sz, type), b(sz, type), c(sz, type);
+
+    declare.in(a, b, WARMUP_RNG).out(c);
+
+    TEST_CYCLE() cv::absdiff(a.colRange(0, sz.width - 1), b.colRange(0, sz.width - 1), c.colRange(0, sz.width - 1));
+
+    SANITY_CHECK_NOTHING();
+}
+
+INSTANTIATE_TEST_CASE_P(/*nothing*/ , ArithmShortRowsTest,
+    testing::Combine(
+        testing::Values(Size(24, 16384), Size(100, 8192)),
+        testing::Values(CV_8UC1, CV_16SC1, CV_32FC1)
+    )
+);
+
 ///////////// Mixed type arithmetics ////////
 
 typedef perf::TestBaseWithParam<std::tuple<cv::Size, std::tuple<perf::MatType, perf::MatType>>> ArithmMixedTest;
@@ -733,6 +784,42 @@ INSTANTIATE_TEST_CASE_P(/*nothing*/ , RotateTest,
 );
 
 
+///////////// Transpose ////////////////////////
+
+typedef perf::TestBaseWithParam<std::tuple<cv::Size, perf::MatType, bool>> TransposeTest;
+
+PERF_TEST_P_(TransposeTest, transpose)
+{
+    Size sz      = get<0>(GetParam());
+    int type     = get<1>(GetParam());
+    bool inplace = get<2>(GetParam());
+    if (inplace && sz.width != sz.height)
+        throw SkipTestException("In-place transposition requires a square matrix");
+    cv::Mat a(sz, type), b;
+
+    declare.in(a, WARMUP_RNG);
+
+    if (inplace)
+    {
+        TEST_CYCLE() cv::transpose(a, a);
+    }
+    else
+    {
+        declare.out(b);
+        TEST_CYCLE() cv::transpose(a, b);
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+INSTANTIATE_TEST_CASE_P(/*nothing*/ , TransposeTest,
+    testing::Combine(
+        testing::Values(Size(1024, 1024), Size(2048, 2048), Size(4000, 3000)),
+        testing::Values(CV_8UC1, CV_8UC3, CV_16UC1, CV_32FC1, CV_32FC3),
+        testing::Bool()
+    )
+);
+
 ///////////// PatchNaNs ////////////////////////
 
 template<typename _Tp>
@@ -0,0 +1,116 @@
+#include "perf_precomp.hpp"
+
+namespace opencv_test
+{
+using namespace perf;
+
+CV_ENUM(FileStorageFormat, FileStorage::FORMAT_XML, FileStorage::FORMAT_YAML, FileStorage::FORMAT_JSON, FileStorage::FORMAT_BINARY)
+
+typedef tuple<FileStorageFormat, bool> Format_Base64_t;
+typedef TestBaseWithParam<Format_Base64_t> Format_Base64;
+
+#define FS_FORMATS   testing::Values(FileStorageFormat(FileStorage::FORMAT_XML), FileStorageFormat(FileStorage::FORMAT_YAML), \
+                                     FileStorageFormat(FileStorage::FORMAT_JSON), FileStorageFormat(FileStorage::FORMAT_BINARY))
+
+static const int LAYERS = 32;
+
+// tree of nodes which looks like weights of a trained model
+static void writeModel(FileStorage& fs, const std::vector<Mat>& weights, const std::vector<Mat>& biases)
+{
+    fs << "layers" << "[";
+    for (size_t i = 0; i < weights.size(); i++)
+    {
+        fs << "{";
+        fs << "name" << cv::format("conv%d", (int)i);
+        fs << "stride" << 1;
+        fs << "weights" << weights[i];
+        fs << "bias" << biases[i];
+        fs << "}";
+    }
+    fs << "]";
+}
+
+static String getFileName(int format)
+{
+    return cv::tempfile(format == FileStorage::FORMAT_XML ? ".xml" :
+                        format == FileStorage::FORMAT_YAML ? ".yml" :
+                        format == FileStorage::FORMAT_JSON ? ".json" : ".cvbin");
+}
+
+static void initModel(std::vector<Mat>& weights, std::vector<Mat>& biases)
+{
+    RNG& rng = theRNG();
+    weights.resize(LAYERS);
+    biases.resize(LAYERS);
+    for (int i = 0; i < LAYERS; i++)
+    {
+        weights[i].create(128, 128, CV_32FC1);
+        rng.fill(weights[i], RNG::UNIFORM, -1, 1);
+        biases[i].create(1, 128, CV_32FC1);
+        rng.fill(biases[i], RNG::UNIFORM, -1, 1);
+    }
+}
+
+PERF_TEST_P(Format_Base64, fs_write_tree, testing::Combine(FS_FORMATS, testing::Bool()))
+{
+    const int format = get<0>(GetParam());
+    const bool base64 = get<1>(GetParam());
+    if (base64 && format == FileStorage::FORMAT_BINARY)
+        throw SkipTestException("Base64 is not applicable to binary format");
+
+    std::vector<Mat> weights, biases;
+    initModel(weights, biases);
+    String file_name = getFileName(format);
+    const int flags = FileStorage::WRITE | (base64 ? FileStorage::BASE64 : 0);
+
+    TEST_CYCLE_MULTIRUN(2)
+    {
+        FileStorage fs(file_name, flags);
+        writeModel(fs, weights, biases);
+        fs.release();
+    }
+
+    remove(file_name.c_str());
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(Format_Base64, fs_read_tree, testing::Combine(FS_FORMATS, testing::Bool()))
+{
+    const int format = get<0>(GetParam());
+    const bool base64 = get<1>(GetParam());
+    if (base64 && format == FileStorage::FORMAT_BINARY)
+        throw SkipTestException("Base64 is not applicable to binary format");
+
+    std::vector<Mat> weights, biases;
+    initModel(weights, biases);
+    String file_name = getFileName(format);
+    {
+        FileStorage fs(file_name, FileStorage::WRITE | (base64 ? FileStorage::BASE64 : 0));
+        writeModel(fs, weights, biases);
+    }
+
+    std::vector<Mat> result(LAYERS * 2);
+    TEST_CYCLE_MULTIRUN(2)
+    {
+        FileStorage fs(file_name, FileStorage::READ);
+        FileNode layers = fs["layers"];
+        int i = 0;
+        for (FileNodeIterator it = layers.begin(); it != layers.end(); ++it, i += 2)
+        {
+            (*it)["weights"] >> result[i];
+            (*it)["bias"] >> result[i + 1];
+        }
+        fs.release();
+    }
+
+    for (int i = 0; i < LAYERS; i++)
+    {
+        ASSERT_LE(cvtest::norm(weights[i], result[i * 2], NORM_INF), 1e-6);
+        ASSERT_LE(cvtest::norm(biases[i], result[i * 2 + 1], NORM_INF), 1e-6);
+    }
+    result.clear();
+    remove(file_name.c_str());
+    SANITY_CHECK_NOTHING();
+}
+
+} // namespace
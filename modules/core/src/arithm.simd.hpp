@@ -331,6 +331,32 @@ struct op_not
 
 //////////////////////////// Loaders /////////////////////////////////
 
+#if CV_AVX512_SKX
+// masked access to the last incomplete vector of the row,
+// with 512-bit vectors the scalar remainder is up to 63 elements long
+#define OPENCV_HAL_AVX512_TAIL(_Tpvec, _Tp, suffix, _Tpmask)                         \
+static inline _Tpvec avx512_load_tail(const _Tp* ptr, int n)                         \
+{                                                                                    \
+    _Tpmask mask = (_Tpmask)((((uint64)1) << n) - 1);                                \
+    return _Tpvec(_mm512_maskz_loadu_##suffix(mask, ptr));                           \
+}                                                                                    \
+static inline void avx512_store_tail(_Tp* ptr, const _Tpvec& v, int n)               \
+{                                                                                    \
+    _Tpmask mask = (_Tpmask)((((uint64)1) << n) - 1);                                \
+    _mm512_mask_storeu_##suffix(ptr, mask, v.val);                                   \
+}
+
+OPENCV_HAL_AVX512_TAIL(v_uint8,   uchar,    epi8,  __mmask64)
+OPENCV_HAL_AVX512_TAIL(v_int8,    schar,    epi8,  __mmask64)
+OPENCV_HAL_AVX512_TAIL(v_uint16,  ushort,   epi16, __mmask32)
+OPENCV_HAL_AVX512_TAIL(v_int16,   short,    epi16, __mmask32)
+OPENCV_HAL_AVX512_TAIL(v_uint32,  unsigned, epi32, __mmask16)
+OPENCV_HAL_AVX512_TAIL(v_int32,   int,      epi32, __mmask16)
+OPENCV_HAL_AVX512_TAIL(v_float32, float,    ps,    __mmask16)
+OPENCV_HAL_AVX512_TAIL(v_float64, double,   pd,    __mmask8)
+#undef OPENCV_HAL_AVX512_TAIL
+#endif // CV_AVX512_SKX
+
 #if (CV_SIMD || CV_SIMD_SCALABLE)
 
 template< template<typename T1, typename Tvec> class OP, typename T1, typename Tvec>
@@ -357,6 +383,14 @@ struct bin_loader
         Tvec a = vx_load_low(src1), b = vx_load_low(src2);
         v_store_low(dst, op::r(a, b));
     }
+
+#if CV_AVX512_SKX
+    static inline void lt(const T1* src1, const T1* src2, T1* dst, int n)
+    {
+        Tvec a = avx512_load_tail(src1, n), b = avx512_load_tail(src2, n);
+        avx512_store_tail(dst, op::r(a, b), n);
+    }
+#endif
 };
 
 // void src2 for operation "not"
@@ -382,6 +416,13 @@ struct bin_loader<op_not, T1, Tvec>
         Tvec a = vx_load_low(src1);
         v_store_low(dst, op::r(a));
     }
+
+#if CV_AVX512_SKX
+    static inline void lt(const T1* src1, const T1*, T1* dst, int n)
+    {
+        avx512_store_tail(dst, op::r(avx512_load_tail(src1, n)), n);
+    }
+#endif
 };
 
 #endif // CV_SIMD
@@ -442,6 +483,13 @@ static void bin_loop(const T1* src1, size_t step1, const T1* src2, size_t step2,
             ldr::l64(src1 + x, src2 + x, dst + x);
         }
         #endif
+        #if CV_AVX512_SKX
+        if (x < width)
+        {
+            ldr::lt(src1 + x, src2 + x, dst + x, width - x);
+            x = width;
+        }
+        #endif
     #endif // CV_SIMD
 
     #if CV_ENABLE_UNROLLED || CV_SIMD_WIDTH > 16
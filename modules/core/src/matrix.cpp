@@ -183,9 +183,27 @@ MatAllocator*& getDefaultAllocatorMatRef()
     return g_matAllocator;
 }
 
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+static thread_local MatAllocator* g_threadMatAllocator = NULL;  // MatAllocatorThreadScope
+#else
+static MatAllocator* g_threadMatAllocator = NULL;
+#endif
+
 MatAllocator* Mat::getDefaultAllocator()
 {
-    return getDefaultAllocatorMatRef();
+    MatAllocator* threadAllocator = g_threadMatAllocator;
+    return threadAllocator ? threadAllocator : getDefaultAllocatorMatRef();
+}
+
+MatAllocatorThreadScope::MatAllocatorThreadScope(MatAllocator* allocator)
+    : prevAllocator_(g_threadMatAllocator)
+{
+    g_threadMatAllocator = allocator;
+}
+
+MatAllocatorThreadScope::~MatAllocatorThreadScope()
+{
+    g_threadMatAllocator = prevAllocator_;
 }
 
 void Mat::setDefaultAllocator(MatAllocator* allocator)
@@ -11,6 +11,7 @@
 
 #include "precomp.hpp"
 #include <opencv2/core/utils/logger.hpp>
+#include <opencv2/core/utils/configuration.private.hpp>
 
 namespace cv
 {
@@ -200,6 +201,32 @@ static MatOp_Initializer* getGlobalMatOpInitializer()
     CV_SINGLETON_LAZY_INIT(MatOp_Initializer, new MatOp_Initializer())
 }
 
+enum { FUSED_LOAD = 0, FUSED_CONST, FUSED_ADDW, FUSED_MUL, FUSED_MIN, FUSED_MAX, FUSED_ABSDIFF, FUSED_CMP };
+
+// Chain of element-wise operations evaluated in a single pass over the memory.
+// The program is kept in 'c' member of the expression, 'a' is the first input.
+class MatOp_Fused CV_FINAL : public MatOp
+{
+public:
+    MatOp_Fused() {}
+    virtual ~MatOp_Fused() {}
+
+    bool elementWise(const MatExpr& /*expr*/) const CV_OVERRIDE { return true; }
+    void assign(const MatExpr& expr, Mat& m, int type=-1) const CV_OVERRIDE;
+
+    void roi(const MatExpr& expr, const Range& rowRange, const Range& colRange, MatExpr& res) const CV_OVERRIDE;
+    void diag(const MatExpr& expr, int d, MatExpr& res) const CV_OVERRIDE;
+
+    Size size(const MatExpr& expr) const CV_OVERRIDE;
+    int type(const MatExpr& expr) const CV_OVERRIDE;
+
+    // returns false if the operands can't be fused, 'res' is not modified in this case
+    static bool makeExpr(MatExpr& res, int op, const MatExpr& e1, const MatExpr* e2,
+                         double alpha=1, double beta=1, double gamma=0);
+};
+
+static MatOp_Fused g_MatOp_Fused;
+
 static inline bool isIdentity(const MatExpr& e) { return e.op == &g_MatOp_Identity; }
 static inline bool isAddEx(const MatExpr& e) { return e.op == &g_MatOp_AddEx; }
 static inline bool isScaled(const MatExpr& e) { return isAddEx(e) && (!e.b.data || e.beta == 0) && e.s == Scalar(); }
@@ -212,6 +239,10 @@ static inline bool isSolve(const MatExpr& e) { return e.op == &g_MatOp_Solve; }
 //static inline bool isGEMM(const MatExpr& e) { return e.op == &g_MatOp_GEMM; }
 static inline bool isMatProd(const MatExpr& e) { return e.op == &g_MatOp_GEMM && (!e.c.data || e.beta == 0); }
 static inline bool isInitializer(const MatExpr& e) { return e.op == getGlobalMatOpInitializer(); }
+static inline bool isFused(const MatExpr& e) { return e.op == &g_MatOp_Fused; }
+// operands which are combined into AddEx/Bin expressions without evaluation
+static inline bool isPlainAddOperand(const MatExpr& e) { return isIdentity(e) || (isAddEx(e) && (!e.b.data || e.beta == 0)); }
+static inline bool isPlainMulOperand(const MatExpr& e) { return isIdentity(e) || isScaled(e) || isReciprocal(e); }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -329,6 +360,10 @@ void MatOp::add(const MatExpr& e1, const MatExpr& e2, MatExpr& res) const
 
     if( this == e2.op )
     {
+        if( (!isPlainAddOperand(e1) || !isPlainAddOperand(e2)) &&
+            MatOp_Fused::makeExpr(res, FUSED_ADDW, e1, &e2, 1, 1) )
+            return;
+
         double alpha = 1, beta = 1;
         Scalar s;
         Mat m1, m2;
@@ -360,6 +395,9 @@ void MatOp::add(const MatExpr& expr1, const Scalar& s, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( s.isReal() && MatOp_Fused::makeExpr(res, FUSED_ADDW, expr1, 0, 1, 0, s[0]) )
+        return;
+
     Mat m1;
     expr1.op->assign(expr1, m1);
     MatOp_AddEx::makeExpr(res, m1, Mat(), 1, 0, s);
@@ -372,6 +410,10 @@ void MatOp::subtract(const MatExpr& e1, const MatExpr& e2, MatExpr& res) const
 
     if( this == e2.op )
     {
+        if( (!isPlainAddOperand(e1) || !isPlainAddOperand(e2)) &&
+            MatOp_Fused::makeExpr(res, FUSED_ADDW, e1, &e2, 1, -1) )
+            return;
+
         double alpha = 1, beta = -1;
         Scalar s;
         Mat m1, m2;
@@ -403,6 +445,9 @@ void MatOp::subtract(const Scalar& s, const MatExpr& expr, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( s.isReal() && MatOp_Fused::makeExpr(res, FUSED_ADDW, expr, 0, -1, 0, s[0]) )
+        return;
+
     Mat m;
     expr.op->assign(expr, m);
     MatOp_AddEx::makeExpr(res, m, Mat(), -1, 0, s);
@@ -417,6 +462,10 @@ void MatOp::multiply(const MatExpr& e1, const MatExpr& e2, MatExpr& res, double
     {
         Mat m1, m2;
 
+        if( (!isPlainMulOperand(e1) || !isPlainMulOperand(e2)) && !isReciprocal(e1) && !isReciprocal(e2) &&
+            MatOp_Fused::makeExpr(res, FUSED_MUL, e1, &e2, scale) )
+            return;
+
         if( isReciprocal(e1) )
         {
             if( isScaled(e2) )
@@ -466,6 +515,9 @@ void MatOp::multiply(const MatExpr& expr, double s, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( MatOp_Fused::makeExpr(res, FUSED_ADDW, expr, 0, s, 0) )
+        return;
+
     Mat m;
     expr.op->assign(expr, m);
     MatOp_AddEx::makeExpr(res, m, Mat(), s, 0);
@@ -528,6 +580,9 @@ void MatOp::abs(const MatExpr& expr, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( MatOp_Fused::makeExpr(res, FUSED_ABSDIFF, expr, 0) )
+        return;
+
     Mat m;
     expr.op->assign(expr, m);
     MatOp_Bin::makeExpr(res, 'a', m, Mat());
@@ -1714,6 +1769,766 @@ inline void MatOp_Initializer::makeExpr(MatExpr& res, int method, int ndims, con
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+enum { FUSED_TILE = 256, FUSED_BLOCK = 1 << 14, FUSED_MAX_INSTR = 64 };
+
+struct FusedInstr
+{
+    int op;
+    int src1, src2;  // registers of the operands, src2 < 0 means "no second operand"
+    int arg;         // input index for FUSED_LOAD, comparison operation for FUSED_CMP
+    int depth;       // the result is saturated to this depth, as if the operation is evaluated separately
+    double alpha, beta, gamma;
+};
+
+// every instruction writes its own register, the result is in the last one
+struct FusedProgram
+{
+    std::vector<Mat> inputs;
+    std::vector<FusedInstr> code;
+    Size size;
+    int cn;
+};
+
+class FusedProgramAllocator CV_FINAL : public MatAllocator
+{
+public:
+    UMatData* allocate(int dims, const int* sizes, int type,
+                       void* data0, size_t* step, AccessFlag flags, UMatUsageFlags usageFlags) const CV_OVERRIDE
+    {
+        return Mat::getStdAllocator()->allocate(dims, sizes, type, data0, step, flags, usageFlags);
+    }
+
+    bool allocate(UMatData* u, AccessFlag /*accessFlags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        return u != NULL;
+    }
+
+    void deallocate(UMatData* u) const CV_OVERRIDE
+    {
+        if (!u)
+            return;
+
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        delete (FusedProgram*)u->userdata;
+        delete u;
+    }
+};
+
+static MatAllocator* getFusedProgramAllocator()
+{
+    CV_SINGLETON_LAZY_INIT(MatAllocator, new FusedProgramAllocator())
+}
+
+// the program is shared between copies of the expression through the reference counter of 'c' matrix
+static Mat wrapFusedProgram(FusedProgram* p)
+{
+    UMatData* u = new UMatData(getFusedProgramAllocator());
+    u->data = u->origdata = (uchar*)p;
+    u->size = sizeof(*p);
+    u->userdata = p;
+
+    Mat m(1, 1, CV_8U, u->data);
+    m.u = u;
+    u->refcount = 1;
+    return m;
+}
+
+static const FusedProgram& getFusedProgram(const MatExpr& e)
+{
+    CV_DbgAssert(e.c.u && e.c.u->userdata);
+    return *(const FusedProgram*)e.c.u->userdata;
+}
+
+static bool& getMatExprFusionFlag()
+{
+    static bool enabled = utils::getConfigurationParameterBool("OPENCV_MATEXPR_FUSION", false);
+    return enabled;
+}
+
+static bool isFusableExpr(const MatExpr& e)
+{
+    if( isAddEx(e) || isCmp(e) || isFused(e) )
+        return true;
+    if( e.op != &g_MatOp_Bin )
+        return false;
+    switch( e.flags )
+    {
+    case '*': case 'm': case 'M': case 'n': case 'N': case 'a':
+        return true;
+    }
+    return false;
+}
+
+class FusedProgramBuilder
+{
+public:
+    FusedProgramBuilder(FusedProgram& _prog) : prog(_prog) {}
+
+    int depth(int reg) const { return prog.code[reg].depth; }
+
+    int addInstr(int op, int src1, int src2, int depth, double alpha=1, double beta=1, double gamma=0, int arg=0)
+    {
+        FusedInstr ins;
+        ins.op = op;
+        ins.src1 = src1;
+        ins.src2 = src2;
+        ins.arg = arg;
+        ins.depth = depth;
+        ins.alpha = alpha;
+        ins.beta = beta;
+        ins.gamma = gamma;
+        prog.code.push_back(ins);
+        return (int)prog.code.size() - 1;
+    }
+
+    int addLoad(const Mat& m)
+    {
+        if( m.dims > 2 || m.size() != prog.size || m.channels() != prog.cn || m.depth() > CV_64F )
+            return -1;
+        size_t i = 0, ninputs = prog.inputs.size();
+        for( ; i < ninputs; i++ )
+        {
+            const Mat& m1 = prog.inputs[i];
+            if( m1.data == m.data && m1.type() == m.type() && m1.step == m.step )
+                break;
+        }
+        if( i == ninputs )
+            prog.inputs.push_back(m);
+        for( size_t k = 0; k < prog.code.size(); k++ )
+        {
+            if( prog.code[k].op == FUSED_LOAD && prog.code[k].arg == (int)i )
+                return (int)k;
+        }
+        return addInstr(FUSED_LOAD, -1, -1, m.depth(), 1, 1, 0, (int)i);
+    }
+
+    int addConst(double v)
+    {
+        return addInstr(FUSED_CONST, -1, -1, CV_64F, 1, 1, v);
+    }
+
+    // a*alpha + gamma evaluated by MatOp_AddEx: cv::add/cv::subtract round the scalar,
+    // convertTo() doesn't
+    int addScaled(int src, double alpha, double gamma)
+    {
+        int d = depth(src);
+        if( d < CV_32F && fabs(alpha) == 1 )
+            gamma = saturate_cast<int>(gamma);
+        return addInstr(FUSED_ADDW, src, -1, d, alpha, 0, gamma);
+    }
+
+    // scalar operand of min()/max() (binary_op) and absdiff() (arithm_op)
+    int addScalarOperand(int src, double v, bool saturate)
+    {
+        switch( depth(src) )
+        {
+        case CV_8U: v = saturate ? saturate_cast<uchar>(v) : saturate_cast<int>(v); break;
+        case CV_8S: v = saturate ? saturate_cast<schar>(v) : saturate_cast<int>(v); break;
+        case CV_16U: v = saturate ? saturate_cast<ushort>(v) : saturate_cast<int>(v); break;
+        case CV_16S: v = saturate ? saturate_cast<short>(v) : saturate_cast<int>(v); break;
+        case CV_32S: v = saturate_cast<int>(v); break;
+        case CV_32F: v = (float)v; break;
+        }
+        return addConst(v);
+    }
+
+    int addCmpScalar(int src, double v, int cmpop)
+    {
+        int d = depth(src);
+        if( d == CV_32F )
+            v = (float)v;
+        else if( d < CV_32F && v != std::floor(v) )
+        {
+            // integer values: a > 2.5 <=> a > 2, a >= 2.5 <=> a >= 3, a == 2.5 is never true
+            if( cmpop == CMP_GT || cmpop == CMP_LE )
+                v = std::floor(v);
+            else if( cmpop == CMP_GE || cmpop == CMP_LT )
+                v = std::ceil(v);
+            else
+                v = 0.5;
+        }
+        return addConst(v);
+    }
+
+    int addMaterialized(const MatExpr& e)
+    {
+        Mat m;
+        e.op->assign(e, m);
+        return addLoad(m);
+    }
+
+    int add(const MatExpr& e)
+    {
+        const bool haveScalar = prog.cn == 1 || e.s == Scalar();
+        if( isIdentity(e) )
+            return addLoad(e.a);
+        if( isFused(e) )
+        {
+            const FusedProgram& sub = getFusedProgram(e);
+            if( prog.code.size() + sub.code.size() > FUSED_MAX_INSTR )
+                return addMaterialized(e);
+            std::vector<int> regs(sub.code.size());
+            for( size_t k = 0; k < sub.code.size(); k++ )
+            {
+                FusedInstr ins = sub.code[k];
+                if( ins.op == FUSED_LOAD )
+                    regs[k] = addLoad(sub.inputs[ins.arg]);
+                else if( ins.op == FUSED_CONST )
+                    regs[k] = addConst(ins.gamma);
+                else
+                {
+                    ins.src1 = regs[ins.src1];
+                    if( ins.src2 >= 0 )
+                        ins.src2 = regs[ins.src2];
+                    prog.code.push_back(ins);
+                    regs[k] = (int)prog.code.size() - 1;
+                }
+                if( regs[k] < 0 )
+                    return -1;
+            }
+            return regs.back();
+        }
+        if( isAddEx(e) && e.s.isReal() && haveScalar )
+        {
+            int a = addLoad(e.a);
+            if( a < 0 )
+                return -1;
+            if( !e.b.data || e.beta == 0 )
+                return addScaled(a, e.alpha, e.s[0]);
+            if( e.a.type() == e.b.type() )
+            {
+                int b = addLoad(e.b);
+                return b < 0 ? -1 : addInstr(FUSED_ADDW, a, b, e.a.depth(), e.alpha, e.beta, e.s[0]);
+            }
+        }
+        else if( e.op == &g_MatOp_Bin && (e.flags == '*' || e.flags == 'm' || e.flags == 'M' || e.flags == 'a') &&
+                 e.b.data && e.a.type() == e.b.type() )
+        {
+            int a = addLoad(e.a), b = a < 0 ? -1 : addLoad(e.b);
+            if( b < 0 )
+                return -1;
+            int op = e.flags == '*' ? FUSED_MUL : e.flags == 'm' ? FUSED_MIN : e.flags == 'M' ? FUSED_MAX : FUSED_ABSDIFF;
+            return addInstr(op, a, b, e.a.depth(), e.alpha);
+        }
+        else if( e.op == &g_MatOp_Bin && (e.flags == 'n' || e.flags == 'N' || e.flags == 'a') &&
+                 !e.b.data && e.s.isReal() && haveScalar )
+        {
+            int a = addLoad(e.a);
+            if( a < 0 )
+                return -1;
+            int s = addScalarOperand(a, e.s[0], e.flags != 'a');
+            int op = e.flags == 'n' ? FUSED_MIN : e.flags == 'N' ? FUSED_MAX : FUSED_ABSDIFF;
+            return addInstr(op, a, s, e.a.depth());
+        }
+        else if( isCmp(e) && (e.b.data ? e.a.type() == e.b.type() : prog.cn == 1) )
+        {
+            int a = addLoad(e.a), b = a < 0 ? -1 : e.b.data ? addLoad(e.b) : addCmpScalar(a, e.alpha, e.flags);
+            return b < 0 ? -1 : addInstr(FUSED_CMP, a, b, CV_8U, 1, 1, 0, e.flags);
+        }
+        return addMaterialized(e);
+    }
+
+protected:
+    FusedProgram& prog;
+};
+
+static int getFusedWorkDepth(const FusedProgram& p)
+{
+    for( size_t k = 0; k < p.code.size(); k++ )
+    {
+        const FusedInstr& ins = p.code[k];
+        if( ins.depth == CV_32S || ins.depth == CV_64F ||
+            (ins.op == FUSED_MUL && (ins.depth == CV_16U || ins.depth == CV_16S)) )
+            return CV_64F;
+    }
+    return CV_32F;
+}
+
+template<typename WT> struct FusedKernel
+{
+    static int vlanes() { return 0; }
+    static int addw(const WT*, const WT*, WT*, int, WT, WT, WT) { return 0; }
+    static int mul(const WT*, const WT*, WT*, int, WT) { return 0; }
+    static int min(const WT*, const WT*, WT*, int) { return 0; }
+    static int max(const WT*, const WT*, WT*, int) { return 0; }
+    static int absdiff(const WT*, const WT*, WT*, int) { return 0; }
+    static int cmp(const WT*, const WT*, WT*, int, int) { return 0; }
+    static int saturate(WT*, int, WT, WT) { return 0; }
+};
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+static inline v_float32 fusedSetAll(float v) { return vx_setall_f32(v); }
+static inline v_float32 fusedRound(const v_float32& v) { return v_cvt_f32(v_round(v)); }
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+static inline v_float64 fusedSetAll(double v) { return vx_setall_f64(v); }
+static inline v_float64 fusedRound(const v_float64& v) { return v_cvt_f64(v_round(v)); }
+#endif
+
+template<typename WT, typename VT> struct FusedKernelSIMD
+{
+    static int vlanes() { return VTraits<VT>::vlanes(); }
+
+    static int addw(const WT* a, const WT* b, WT* d, int n, WT alpha, WT beta, WT gamma)
+    {
+        const int VECSZ = VTraits<VT>::vlanes();
+        VT valpha = fusedSetAll(alpha), vbeta = fusedSetAll(beta), vgamma = fusedSetAll(gamma);
+        int i = 0;
+        if( b )
+            for( ; i <= n - VECSZ; i += VECSZ )
+                v_store(d + i, v_fma(vx_load(a + i), valpha, v_fma(vx_load(b + i), vbeta, vgamma)));
+        else
+            for( ; i <= n - VECSZ; i += VECSZ )
+                v_store(d + i, v_fma(vx_load(a + i), valpha, vgamma));
+        return i;
+    }
+
+    static int mul(const WT* a, const WT* b, WT* d, int n, WT alpha)
+    {
+        const int VECSZ = VTraits<VT>::vlanes();
+        VT valpha = fusedSetAll(alpha);
+        int i = 0;
+        for( ; i <= n - VECSZ; i += VECSZ )
+            v_store(d + i, v_mul(v_mul(vx_load(a + i), vx_load(b + i)), valpha));
+        return i;
+    }
+
+    static int min(const WT* a, const WT* b, WT* d, int n)
+    {
+        const int VECSZ = VTraits<VT>::vlanes();
+        int i = 0;
+        for( ; i <= n - VECSZ; i += VECSZ )
+            v_store(d + i, v_min(vx_load(a + i), vx_load(b + i)));
+        return i;
+    }
+
+    static int max(const WT* a, const WT* b, WT* d, int n)
+    {
+        const int VECSZ = VTraits<VT>::vlanes();
+        int i = 0;
+        for( ; i <= n - VECSZ; i += VECSZ )
+            v_store(d + i, v_max(vx_load(a + i), vx_load(b + i)));
+        return i;
+    }
+
+    static int absdiff(const WT* a, const WT* b, WT* d, int n)
+    {
+        const int VECSZ = VTraits<VT>::vlanes();
+        int i = 0;
+        for( ; i <= n - VECSZ; i += VECSZ )
+            v_store(d + i, v_absdiff(vx_load(a + i), vx_load(b + i)));
+        return i;
+    }
+
+    static int cmp(const WT* a, const WT* b, WT* d, int n, int cmpop)
+    {
+        const int VECSZ = VTraits<VT>::vlanes();
+        VT v255 = fusedSetAll((WT)255);
+        int i = 0;
+        switch( cmpop )
+        {
+        case CMP_EQ:
+            for( ; i <= n - VECSZ; i += VECSZ )
+                v_store(d + i, v_and(v_eq(vx_load(a + i), vx_load(b + i)), v255));
+            break;
+        case CMP_GT:
+            for( ; i <= n - VECSZ; i += VECSZ )
+                v_store(d + i, v_and(v_gt(vx_load(a + i), vx_load(b + i)), v255));
+            break;
+        case CMP_GE:
+            for( ; i <= n - VECSZ; i += VECSZ )
+                v_store(d + i, v_and(v_ge(vx_load(a + i), vx_load(b + i)), v255));
+            break;
+        case CMP_LT:
+            for( ; i <= n - VECSZ; i += VECSZ )
+                v_store(d + i, v_and(v_lt(vx_load(a + i), vx_load(b + i)), v255));
+            break;
+        case CMP_LE:
+            for( ; i <= n - VECSZ; i += VECSZ )
+                v_store(d + i, v_and(v_le(vx_load(a + i), vx_load(b + i)), v255));
+            break;
+        case CMP_NE:
+            for( ; i <= n - VECSZ; i += VECSZ )
+                v_store(d + i, v_and(v_ne(vx_load(a + i), vx_load(b + i)), v255));
+            break;
+        }
+        return i;
+    }
+
+    static int saturate(WT* d, int n, WT lo, WT hi)
+    {
+        const int VECSZ = VTraits<VT>::vlanes();
+        VT vlo = fusedSetAll(lo), vhi = fusedSetAll(hi);
+        int i = 0;
+        for( ; i <= n - VECSZ; i += VECSZ )
+            v_store(d + i, fusedRound(v_min(v_max(vx_load(d + i), vlo), vhi)));
+        return i;
+    }
+};
+
+template<> struct FusedKernel<float> : public FusedKernelSIMD<float, v_float32> {};
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+template<> struct FusedKernel<double> : public FusedKernelSIMD<double, v_float64> {};
+#endif
+#endif  // CV_SIMD
+
+// vector part of the operation, returns the number of processed elements
+template<typename WT>
+static int executeFusedInstrSIMD(const FusedInstr& ins, const WT* a, const WT* b, WT* d, int n)
+{
+    typedef FusedKernel<WT> K;
+    switch( ins.op )
+    {
+    case FUSED_ADDW:
+        return K::addw(a, b, d, n, (WT)ins.alpha, (WT)ins.beta, (WT)ins.gamma);
+    case FUSED_MUL:
+        return K::mul(a, b, d, n, (WT)ins.alpha);
+    case FUSED_MIN:
+        return K::min(a, b, d, n);
+    case FUSED_MAX:
+        return K::max(a, b, d, n);
+    case FUSED_ABSDIFF:
+        return K::absdiff(a, b, d, n);
+    case FUSED_CMP:
+        return K::cmp(a, b, d, n, ins.arg);
+    default:
+        CV_Error(cv::Error::StsError, "Unknown operation");
+    }
+}
+
+template<typename WT>
+static void executeFusedInstr(const FusedInstr& ins, const WT* a, const WT* b, WT* d, int n)
+{
+    typedef FusedKernel<WT> K;
+    const int vlanes = K::vlanes();
+    int i = executeFusedInstrSIMD<WT>(ins, a, b, d, n);
+    if( i < n && vlanes > 0 )
+    {
+        // the tail is computed by the same vector code as the rest of the row,
+        // so the result of an element doesn't depend on its position
+        AutoBuffer<WT> _buf(3*vlanes);
+        WT *ta = _buf.data(), *tb = ta + vlanes, *td = tb + vlanes;
+        std::fill(ta, ta + 3*vlanes, (WT)0);
+        std::copy(a + i, a + n, ta);
+        if( b )
+            std::copy(b + i, b + n, tb);
+        executeFusedInstrSIMD<WT>(ins, ta, b ? tb : 0, td, vlanes);
+        std::copy(td, td + (n - i), d + i);
+        i = n;
+    }
+
+    switch( ins.op )
+    {
+    case FUSED_ADDW:
+    {
+        WT alpha = (WT)ins.alpha, beta = (WT)ins.beta, gamma = (WT)ins.gamma;
+        if( b )
+            for( ; i < n; i++ )
+                d[i] = a[i]*alpha + (b[i]*beta + gamma);
+        else
+            for( ; i < n; i++ )
+                d[i] = a[i]*alpha + gamma;
+        break;
+    }
+    case FUSED_MUL:
+    {
+        WT alpha = (WT)ins.alpha;
+        for( ; i < n; i++ )
+            d[i] = a[i]*b[i]*alpha;
+        break;
+    }
+    case FUSED_MIN:
+        for( ; i < n; i++ )
+            d[i] = std::min(a[i], b[i]);
+        break;
+    case FUSED_MAX:
+        for( ; i < n; i++ )
+            d[i] = std::max(a[i], b[i]);
+        break;
+    case FUSED_ABSDIFF:
+        for( ; i < n; i++ )
+            d[i] = std::abs(a[i] - b[i]);
+        break;
+    case FUSED_CMP:
+        for( ; i < n; i++ )
+        {
+            bool r = ins.arg == CMP_EQ ? a[i] == b[i] : ins.arg == CMP_GT ? a[i] > b[i] :
+                     ins.arg == CMP_GE ? a[i] >= b[i] : ins.arg == CMP_LT ? a[i] < b[i] :
+                     ins.arg == CMP_LE ? a[i] <= b[i] : a[i] != b[i];
+            d[i] = r ? (WT)255 : (WT)0;
+        }
+        break;
+    }
+
+    if( ins.depth < CV_32F && ins.op != FUSED_CMP )
+    {
+        WT lo = (WT)(ins.depth == CV_8U ? 0 : ins.depth == CV_8S ? SCHAR_MIN : ins.depth == CV_16U ? 0 :
+                     ins.depth == CV_16S ? SHRT_MIN : INT_MIN);
+        WT hi = (WT)(ins.depth == CV_8U ? UCHAR_MAX : ins.depth == CV_8S ? SCHAR_MAX : ins.depth == CV_16U ? USHRT_MAX :
+                     ins.depth == CV_16S ? SHRT_MAX : INT_MAX);
+        i = K::saturate(d, n, lo, hi);
+        if( i < n && vlanes > 0 )
+        {
+            AutoBuffer<WT> _buf(vlanes);
+            WT* td = _buf.data();
+            std::fill(td, td + vlanes, (WT)0);
+            std::copy(d + i, d + n, td);
+            K::saturate(td, vlanes, lo, hi);
+            std::copy(td, td + (n - i), d + i);
+            i = n;
+        }
+        for( ; i < n; i++ )
+            d[i] = (WT)cvRound(std::min(std::max(d[i], lo), hi));
+    }
+}
+
+template<typename WT>
+class FusedProgramInvoker CV_FINAL : public ParallelLoopBody
+{
+public:
+    FusedProgramInvoker(const FusedProgram& _prog, Mat& _dst, int _blockSize)
+        : prog(_prog), dst(_dst), blockSize(_blockSize)
+    {
+        const int wdepth = DataType<WT>::depth;
+        cvtIn.resize(prog.inputs.size());
+        for( size_t i = 0; i < prog.inputs.size(); i++ )
+            cvtIn[i] = prog.inputs[i].depth() == wdepth ? 0 : getConvertFunc(prog.inputs[i].depth(), wdepth);
+        cvtOut = getConvertFunc(wdepth, dst.depth());
+        CV_Assert(cvtOut);
+    }
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        const int ninstr = (int)prog.code.size(), ninputs = (int)prog.inputs.size();
+        const size_t total = dst.total()*prog.cn, desz = dst.elemSize1();
+        AutoBuffer<WT> _regs(ninstr*FUSED_TILE);
+        AutoBuffer<const WT*> _rptr(ninstr);
+        AutoBuffer<const uchar*> _src(ninputs);
+        WT* regs = _regs.data();
+        const WT** rptr = _rptr.data();
+        const uchar** src = _src.data();
+
+        for( int k = 0; k < ninstr; k++ )
+        {
+            rptr[k] = regs + k*FUSED_TILE;
+            if( prog.code[k].op == FUSED_CONST )
+                std::fill(regs + k*FUSED_TILE, regs + (k + 1)*FUSED_TILE, (WT)prog.code[k].gamma);
+        }
+
+        for( int r = range.start; r < range.end; r++ )
+        {
+            uchar* dptr;
+            int len;
+            if( blockSize > 0 )
+            {
+                size_t ofs = (size_t)r*blockSize;
+                len = (int)std::min((size_t)blockSize, total - ofs);
+                for( int i = 0; i < ninputs; i++ )
+                    src[i] = prog.inputs[i].data + ofs*prog.inputs[i].elemSize1();
+                dptr = dst.data + ofs*desz;
+            }
+            else
+            {
+                len = dst.cols*prog.cn;
+                for( int i = 0; i < ninputs; i++ )
+                    src[i] = prog.inputs[i].ptr(r);
+                dptr = dst.ptr(r);
+            }
+
+            for( int j = 0; j < len; j += FUSED_TILE )
+            {
+                int n = std::min((int)FUSED_TILE, len - j);
+                for( int k = 0; k < ninstr; k++ )
+                {
+                    const FusedInstr& ins = prog.code[k];
+                    WT* d = regs + k*FUSED_TILE;
+                    if( ins.op == FUSED_CONST )
+                        continue;
+                    if( ins.op == FUSED_LOAD )
+                    {
+                        const uchar* sptr = src[ins.arg] + (size_t)j*prog.inputs[ins.arg].elemSize1();
+                        if( !cvtIn[ins.arg] )
+                        {
+                            rptr[k] = (const WT*)sptr;
+                            continue;
+                        }
+                        cvtIn[ins.arg](sptr, 0, 0, 0, (uchar*)d, 0, Size(n, 1), 0);
+                    }
+                    else
+                        executeFusedInstr<WT>(ins, rptr[ins.src1], ins.src2 >= 0 ? rptr[ins.src2] : 0, d, n);
+                    rptr[k] = d;
+                }
+                cvtOut((const uchar*)rptr[ninstr - 1], 0, 0, 0, dptr + (size_t)j*desz, 0, Size(n, 1), 0);
+            }
+        }
+    }
+
+protected:
+    const FusedProgram& prog;
+    Mat& dst;
+    int blockSize;
+    std::vector<BinaryFunc> cvtIn;
+    BinaryFunc cvtOut;
+};
+
+}  // namespace
+
+void MatOp_Fused::assign(const MatExpr& e, Mat& m, int _type) const
+{
+    CV_INSTRUMENT_REGION();
+
+    const FusedProgram& p = getFusedProgram(e);
+    int ddepth = _type < 0 ? p.code.back().depth : CV_MAT_DEPTH(_type);
+    CV_Assert( _type < 0 || CV_MAT_CN(_type) == p.cn );
+    if( ddepth > CV_64F )
+    {
+        Mat temp;
+        assign(e, temp);
+        temp.convertTo(m, _type);
+        return;
+    }
+
+    Mat holder = e.c;  // 'm' may be the expression itself
+    m.create(p.size, CV_MAKETYPE(ddepth, p.cn));
+    if( m.empty() )
+        return;
+
+    bool continuous = m.isContinuous();
+    for( size_t i = 0; i < p.inputs.size(); i++ )
+        continuous = continuous && p.inputs[i].isContinuous();
+    const size_t total = m.total()*p.cn;
+    int blockSize = continuous ? (int)FUSED_BLOCK : 0;
+    int nrows = continuous ? (int)((total + FUSED_BLOCK - 1)/FUSED_BLOCK) : m.rows;
+    double nstripes = (double)total/(1 << 16);
+
+    if( getFusedWorkDepth(p) == CV_32F )
+        parallel_for_(Range(0, nrows), FusedProgramInvoker<float>(p, m, blockSize), nstripes);
+    else
+        parallel_for_(Range(0, nrows), FusedProgramInvoker<double>(p, m, blockSize), nstripes);
+}
+
+void MatOp_Fused::roi(const MatExpr& e, const Range& rowRange, const Range& colRange, MatExpr& res) const
+{
+    FusedProgram* p = new FusedProgram(getFusedProgram(e));
+    for( size_t i = 0; i < p->inputs.size(); i++ )
+        p->inputs[i] = p->inputs[i](rowRange, colRange);
+    p->size = p->inputs[0].size();
+    Mat holder = wrapFusedProgram(p);
+    res = MatExpr(&g_MatOp_Fused, 0, p->inputs[0], Mat(), holder);
+}
+
+void MatOp_Fused::diag(const MatExpr& e, int d, MatExpr& res) const
+{
+    FusedProgram* p = new FusedProgram(getFusedProgram(e));
+    for( size_t i = 0; i < p->inputs.size(); i++ )
+        p->inputs[i] = p->inputs[i].diag(d);
+    p->size = p->inputs[0].size();
+    Mat holder = wrapFusedProgram(p);
+    res = MatExpr(&g_MatOp_Fused, 0, p->inputs[0], Mat(), holder);
+}
+
+Size MatOp_Fused::size(const MatExpr& e) const
+{
+    return getFusedProgram(e).size;
+}
+
+int MatOp_Fused::type(const MatExpr& e) const
+{
+    const FusedProgram& p = getFusedProgram(e);
+    return CV_MAKETYPE(p.code.back().depth, p.cn);
+}
+
+bool MatOp_Fused::makeExpr(MatExpr& res, int op, const MatExpr& e1, const MatExpr* e2,
+                           double alpha, double beta, double gamma)
+{
+    if( !getMatExprFusionFlag() || !(isFusableExpr(e1) || (e2 && isFusableExpr(*e2))) )
+        return false;
+
+    const Size sz = e1.size();
+    const int type1 = e1.type(), cn = CV_MAT_CN(type1);
+    if( (e2 && (e2->size() != sz || e2->type() != type1)) || (gamma != 0 && cn > 1) ||
+        e1.a.dims > 2 || (e2 && e2->a.dims > 2) )
+        return false;
+
+    std::unique_ptr<FusedProgram> p(new FusedProgram);
+    p->size = sz;
+    p->cn = cn;
+    FusedProgramBuilder builder(*p);
+    int r = -1;
+
+    if( op == FUSED_ADDW && e2 )
+    {
+        // the same folding of scaled operands as in MatOp::add()
+        Scalar s;
+        int r1, r2;
+        if( isPlainAddOperand(e1) && isAddEx(e1) )
+        {
+            r1 = builder.addLoad(e1.a);
+            alpha *= e1.alpha;
+            s += e1.s;
+        }
+        else
+            r1 = builder.add(e1);
+        if( isPlainAddOperand(*e2) && isAddEx(*e2) )
+        {
+            r2 = r1 < 0 ? -1 : builder.addLoad(e2->a);
+            s += e2->s*beta;
+            beta *= e2->alpha;
+        }
+        else
+            r2 = r1 < 0 ? -1 : builder.add(*e2);
+        if( r2 < 0 || !s.isReal() || (s[0] != 0 && cn > 1) )
+            return false;
+        r = builder.addInstr(FUSED_ADDW, r1, r2, builder.depth(r1), alpha, beta, s[0] + gamma);
+    }
+    else if( op == FUSED_ADDW )
+    {
+        r = builder.add(e1);
+        if( r >= 0 )
+            r = builder.addScaled(r, alpha, gamma);
+    }
+    else if( op == FUSED_MUL && e2 )
+    {
+        // the same folding of scaled operands as in MatOp::multiply()
+        int r1, r2;
+        if( isScaled(e1) )
+        {
+            r1 = builder.addLoad(e1.a);
+            alpha *= e1.alpha;
+        }
+        else
+            r1 = builder.add(e1);
+        if( isScaled(*e2) )
+        {
+            r2 = r1 < 0 ? -1 : builder.addLoad(e2->a);
+            alpha *= e2->alpha;
+        }
+        else
+            r2 = r1 < 0 ? -1 : builder.add(*e2);
+        if( r2 < 0 )
+            return false;
+        r = builder.addInstr(FUSED_MUL, r1, r2, builder.depth(r1), alpha);
+    }
+    else if( op == FUSED_ABSDIFF && !e2 )
+    {
+        r = builder.add(e1);
+        if( r >= 0 )
+            r = builder.addInstr(FUSED_ABSDIFF, r, builder.addScalarOperand(r, gamma, false), builder.depth(r));
+    }
+
+    if( r < 0 || p->inputs.empty() )
+        return false;
+
+    Mat holder = wrapFusedProgram(p.get());
+    FusedProgram* prog = p.release();
+    res = MatExpr(&g_MatOp_Fused, 0, prog->inputs[0], Mat(), holder);
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 MatExpr Mat::t() const
 {
     CV_INSTRUMENT_REGION();
@@ -1832,6 +2647,16 @@ void MatExpr::swap(MatExpr& other)
     swap(s, other.s);
 }
 
+void MatExpr::setUseFusion(bool flag)
+{
+    getMatExprFusionFlag() = flag;
+}
+
+bool MatExpr::useFusion()
+{
+    return getMatExprFusionFlag();
+}
+
 _InputArray::_InputArray(const MatExpr& expr)
 {
     if (!isIdentity(expr))
@@ -0,0 +1,284 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include "opencv2/core/utils/filesystem.private.hpp"
+#include "opencv2/core/utils/logger.hpp"
+
+#if OPENCV_HAVE_FILESYSTEM_SUPPORT
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#undef NOMINMAX
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+#endif  // OPENCV_HAVE_FILESYSTEM_SUPPORT
+
+//
+// Memory-mapped files as Mat data
+//
+// UMatData of mapped matrix:
+// - data, origdata: the first byte of the matrix data in the mapping
+// - size: size of mapped data (starting from data)
+// - allocatorFlags_: offset of matrix data from the mapping start (mappings start on page/granularity boundary)
+//
+
+namespace cv {
+
+#if OPENCV_HAVE_FILESYSTEM_SUPPORT
+
+namespace {
+
+#ifdef _WIN32
+
+static size_t getMappingGranularity()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (size_t)info.dwAllocationGranularity;
+}
+
+static uchar* mapRegion(const String& path, int flags, size_t offset, size_t& dataSize, size_t& delta)
+{
+    const int access = flags & Mat::MAPFILE_ACCESS_MASK;
+    const bool writable = access == Mat::MAPFILE_READ_WRITE || access == Mat::MAPFILE_CREATE;
+    HANDLE hFile = CreateFileA(path.c_str(), GENERIC_READ | (writable ? GENERIC_WRITE : 0),
+                               FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                               access == Mat::MAPFILE_CREATE ? OPEN_ALWAYS : OPEN_EXISTING,
+                               FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+        CV_Error_(Error::StsError, ("Can't open file '%s' (error=%d)", path.c_str(), (int)GetLastError()));
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(hFile, &fileSize))
+    {
+        CloseHandle(hFile);
+        CV_Error_(Error::StsError, ("Can't get size of file '%s'", path.c_str()));
+    }
+    if (dataSize == 0)
+    {
+        if ((uint64)fileSize.QuadPart <= offset)
+        {
+            CloseHandle(hFile);
+            CV_Error_(Error::StsOutOfRange, ("No data in file '%s' after offset %lld", path.c_str(), (long long)offset));
+        }
+        dataSize = (size_t)(fileSize.QuadPart - offset);
+    }
+    const uint64 required = (uint64)offset + dataSize;
+    if ((uint64)fileSize.QuadPart < required)
+    {
+        LARGE_INTEGER newSize; newSize.QuadPart = (LONGLONG)required;
+        if (access != Mat::MAPFILE_CREATE || !SetFilePointerEx(hFile, newSize, NULL, FILE_BEGIN) || !SetEndOfFile(hFile))
+        {
+            CloseHandle(hFile);
+            CV_Error_(Error::StsOutOfRange, ("File '%s' is too small: %lld bytes, required %lld bytes",
+                                             path.c_str(), (long long)fileSize.QuadPart, (long long)required));
+        }
+    }
+    const DWORD protect = access == Mat::MAPFILE_READ_ONLY ? PAGE_READONLY : (access == Mat::MAPFILE_COPY_ON_WRITE ? PAGE_WRITECOPY : PAGE_READWRITE);
+    HANDLE hMapping = CreateFileMappingA(hFile, NULL, protect, 0, 0, NULL);
+    CloseHandle(hFile);  // mapping keeps reference to the file
+    if (hMapping == NULL)
+        CV_Error_(Error::StsError, ("Can't create mapping of file '%s' (error=%d)", path.c_str(), (int)GetLastError()));
+    const DWORD viewAccess = access == Mat::MAPFILE_READ_ONLY ? FILE_MAP_READ : (access == Mat::MAPFILE_COPY_ON_WRITE ? FILE_MAP_COPY : FILE_MAP_WRITE);
+    const uint64 alignedOffset = offset / getMappingGranularity() * getMappingGranularity();
+    delta = (size_t)(offset - alignedOffset);
+    void* base = MapViewOfFile(hMapping, viewAccess, (DWORD)(alignedOffset >> 32), (DWORD)(alignedOffset & 0xffffffff), dataSize + delta);
+    CloseHandle(hMapping);  // view keeps reference to the mapping
+    if (base == NULL)
+        CV_Error_(Error::StsNoMem, ("Can't map file '%s' (error=%d)", path.c_str(), (int)GetLastError()));
+    // access hints are not supported
+    return (uchar*)base + delta;
+}
+
+static void unmapRegion(uchar* data, size_t /*dataSize*/, size_t delta)
+{
+    UnmapViewOfFile(data - delta);
+}
+
+#else  // _WIN32
+
+static uchar* mapRegion(const String& path, int flags, size_t offset, size_t& dataSize, size_t& delta)
+{
+    const int access = flags & Mat::MAPFILE_ACCESS_MASK;
+    const bool writable = access == Mat::MAPFILE_READ_WRITE || access == Mat::MAPFILE_CREATE;
+    int fd = open(path.c_str(), writable ? (O_RDWR | (access == Mat::MAPFILE_CREATE ? O_CREAT : 0)) : O_RDONLY, 0666);
+    if (fd < 0)
+        CV_Error_(Error::StsError, ("Can't open file '%s' (errno=%d)", path.c_str(), errno));
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        CV_Error_(Error::StsError, ("Can't get size of file '%s' (errno=%d)", path.c_str(), errno));
+    }
+    const uint64 fileSize = (uint64)st.st_size;
+    if (dataSize == 0)
+    {
+        if (fileSize <= offset)
+        {
+            close(fd);
+            CV_Error_(Error::StsOutOfRange, ("No data in file '%s' after offset %lld", path.c_str(), (long long)offset));
+        }
+        dataSize = (size_t)(fileSize - offset);
+    }
+    const uint64 required = (uint64)offset + dataSize;
+    if (fileSize < required)
+    {
+        if (access != Mat::MAPFILE_CREATE || ftruncate(fd, (off_t)required) != 0)
+        {
+            close(fd);
+            CV_Error_(Error::StsOutOfRange, ("File '%s' is too small: %lld bytes, required %lld bytes",
+                                             path.c_str(), (long long)fileSize, (long long)required));
+        }
+    }
+    static const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t alignedOffset = offset / pageSize * pageSize;
+    delta = offset - alignedOffset;
+    const int prot = access == Mat::MAPFILE_READ_ONLY ? PROT_READ : (PROT_READ | PROT_WRITE);
+    void* base = mmap(NULL, dataSize + delta, prot, access == Mat::MAPFILE_COPY_ON_WRITE ? MAP_PRIVATE : MAP_SHARED, fd, (off_t)alignedOffset);
+    int mmap_errno = errno;
+    close(fd);  // mapping keeps reference to the file
+    if (base == MAP_FAILED)
+        CV_Error_(Error::StsNoMem, ("Can't map file '%s' (errno=%d)", path.c_str(), mmap_errno));
+
+    int advice = -1;
+#ifdef MADV_SEQUENTIAL
+    if (flags & Mat::MAPFILE_ADVISE_SEQUENTIAL)
+        advice = MADV_SEQUENTIAL;
+#endif
+#ifdef MADV_RANDOM
+    if (flags & Mat::MAPFILE_ADVISE_RANDOM)
+        advice = MADV_RANDOM;
+#endif
+    if (advice >= 0 && madvise(base, dataSize + delta, advice) != 0)
+    {
+        CV_LOG_DEBUG(NULL, "Mat::mapFile(): madvise() failed (errno=" << errno << ")");
+    }
+#ifdef MADV_WILLNEED
+    if ((flags & Mat::MAPFILE_ADVISE_WILLNEED) && madvise(base, dataSize + delta, MADV_WILLNEED) != 0)
+    {
+        CV_LOG_DEBUG(NULL, "Mat::mapFile(): madvise(MADV_WILLNEED) failed (errno=" << errno << ")");
+    }
+#endif
+    return (uchar*)base + delta;
+}
+
+static void unmapRegion(uchar* data, size_t dataSize, size_t delta)
+{
+    if (munmap(data - delta, dataSize + delta) != 0)
+        CV_LOG_ERROR(NULL, "Mat::mapFile(): munmap() failed (errno=" << errno << ")");
+}
+
+#endif  // _WIN32
+
+class MappedFileMatAllocator CV_FINAL : public MatAllocator
+{
+public:
+    UMatData* allocate(int dims, const int* sizes, int type,
+                       void* data0, size_t* step, AccessFlag flags, UMatUsageFlags usageFlags) const CV_OVERRIDE
+    {
+        // mappings are created by Mat::mapFile() only, regular buffers are allocated by the standard allocator
+        return Mat::getStdAllocator()->allocate(dims, sizes, type, data0, step, flags, usageFlags);
+    }
+
+    bool allocate(UMatData* u, AccessFlag /*accessFlags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        if (!u) return false;
+        return true;
+    }
+
+    void deallocate(UMatData* u) const CV_OVERRIDE
+    {
+        if (!u)
+            return;
+
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        unmapRegion(u->origdata, u->size, (size_t)u->allocatorFlags_);
+        u->origdata = 0;
+        delete u;
+    }
+};
+
+static MatAllocator* getMappedFileAllocator()
+{
+    CV_SINGLETON_LAZY_INIT(MatAllocator, new MappedFileMatAllocator())
+}
+
+}  // namespace
+
+Mat Mat::mapFile(const String& path, int type, const std::vector<int>& shape, int flags, size_t offset)
+{
+    CV_TRACE_FUNCTION();
+
+    const int access = flags & MAPFILE_ACCESS_MASK;
+    CV_Check(flags, access == MAPFILE_READ_ONLY || access == MAPFILE_COPY_ON_WRITE ||
+                    access == MAPFILE_READ_WRITE || access == MAPFILE_CREATE, "Invalid access mode");
+    CV_Check(flags, (flags & ~(MAPFILE_ACCESS_MASK | MAPFILE_ADVISE_SEQUENTIAL | MAPFILE_ADVISE_RANDOM | MAPFILE_ADVISE_WILLNEED)) == 0, "Unknown flags");
+    CV_Check(flags, (flags & MAPFILE_ADVISE_SEQUENTIAL) == 0 || (flags & MAPFILE_ADVISE_RANDOM) == 0, "Conflicting access hints");
+    CV_Assert(!path.empty());
+    CV_CheckLE((int)shape.size(), CV_MAX_DIM, "");
+
+    type = CV_MAT_TYPE(type);
+    const size_t esz = CV_ELEM_SIZE(type);
+    size_t dataSize = 0;  // 0 - rest of the file
+    if (!shape.empty())
+    {
+        dataSize = esz;
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            CV_CheckGT(shape[i], 0, "Invalid matrix shape");
+            CV_Assert(dataSize <= (size_t)-1 / (size_t)shape[i] && "Matrix size overflow");
+            dataSize *= (size_t)shape[i];
+        }
+    }
+    else
+    {
+        CV_CheckNE(access, (int)MAPFILE_CREATE, "MAPFILE_CREATE requires matrix shape");
+    }
+
+    size_t delta = 0;
+    uchar* data = mapRegion(path, flags, offset, dataSize, delta);
+
+    std::vector<int> sizes(shape);
+    if (sizes.empty())
+    {
+        const size_t count = dataSize / esz;
+        if (count == 0 || count > (size_t)INT_MAX)
+        {
+            unmapRegion(data, dataSize, delta);
+            CV_Error_(Error::StsOutOfRange, ("Can't map file '%s': unsupported number of elements (%lld)", path.c_str(), (long long)count));
+        }
+        sizes.push_back(1);
+        sizes.push_back((int)count);
+    }
+
+    UMatData* u = new UMatData(getMappedFileAllocator());
+    u->data = u->origdata = data;
+    u->size = dataSize;  // mapped size (tail of file which doesn't fit into the last element is mapped too)
+    u->allocatorFlags_ = (int)delta;
+
+    Mat m((int)sizes.size(), &sizes[0], type, data);
+    m.u = u;
+    u->refcount = 1;
+    return m;
+}
+
+#else  // OPENCV_HAVE_FILESYSTEM_SUPPORT
+
+Mat Mat::mapFile(const String& /*path*/, int /*type*/, const std::vector<int>& /*shape*/, int /*flags*/, size_t /*offset*/)
+{
+    CV_Error(Error::StsNotImplemented, "Memory-mapped files are not supported on this platform");
+}
+
+#endif  // OPENCV_HAVE_FILESYSTEM_SUPPORT
+
+}  // namespace cv
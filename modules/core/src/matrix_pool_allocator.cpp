@@ -0,0 +1,358 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/core/utils/tls.hpp>
+
+#include <atomic>
+
+//
+// Size-class pooling allocator for CPU buffers
+//
+// Allocation path: thread cache (magazine) => global free list => fastMalloc()
+// Release path: thread cache (if not full) => global free list (with trim policy) => fastFree()
+//
+
+namespace cv {
+
+namespace {
+
+static const size_t POOL_MIN_BLOCK_SIZE = 64;
+static const int POOL_CLASS_SUBSTEPS = 4;  // size classes per power of 2
+
+/** Size classes: 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, ... */
+static inline int getSizeClass(size_t size)
+{
+    if (size <= POOL_MIN_BLOCK_SIZE)
+        return 0;
+    size_t v = size - 1;
+    int k = 0;
+    while (v >> (k + 1))
+        k++;
+    const size_t base = (size_t)1 << k;  // base < size <= 2*base
+    const int sub = (int)(((size - base) * POOL_CLASS_SUBSTEPS + base - 1) / base);  // 1..4
+    return (k - 6) * POOL_CLASS_SUBSTEPS + sub;
+}
+
+static inline size_t getClassSize(int cls)
+{
+    if (cls == 0)
+        return POOL_MIN_BLOCK_SIZE;
+    const int k = 6 + (cls - 1) / POOL_CLASS_SUBSTEPS;
+    const int sub = (cls - 1) % POOL_CLASS_SUBSTEPS + 1;
+    const size_t base = (size_t)1 << k;
+    return base + base / POOL_CLASS_SUBSTEPS * sub;
+}
+
+class PoolMatAllocator;
+static PoolMatAllocator& getPoolMatAllocatorImpl();
+
+/** Thread-local magazines: a few free blocks per size class */
+struct PoolThreadCache
+{
+    PoolThreadCache();
+    ~PoolThreadCache();
+
+    std::mutex mutex;  // not contended (except trimming requests from other threads)
+    std::vector< std::vector<void*> > magazines;
+};
+
+class PoolMatAllocator CV_FINAL : public MatAllocator, public BufferPoolController
+{
+public:
+    PoolMatAllocator() :
+        maxBlockSize(utils::getConfigurationParameterSizeT("OPENCV_POOL_ALLOCATOR_MAX_BLOCK_SIZE", (size_t)64 << 20)),
+        magazineSize(utils::getConfigurationParameterSizeT("OPENCV_POOL_ALLOCATOR_THREAD_CACHE_SIZE", 4)),
+        numClasses(getSizeClass(std::max(maxBlockSize, POOL_MIN_BLOCK_SIZE)) + 1),
+        freeLists(numClasses)
+    {
+        maxReservedSize.store(utils::getConfigurationParameterSizeT("OPENCV_POOL_ALLOCATOR_LIMIT", (size_t)256 << 20), std::memory_order_relaxed);
+        allocations.store(0, std::memory_order_relaxed);
+        hits.store(0, std::memory_order_relaxed);
+        reservedSize.store(0, std::memory_order_relaxed);
+        releasedSize.store(0, std::memory_order_relaxed);
+    }
+
+    ~PoolMatAllocator()
+    {
+        freeAllReservedBuffers();
+    }
+
+    UMatData* allocate(int dims, const int* sizes, int type,
+                       void* data0, size_t* step, AccessFlag /*flags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        size_t total = CV_ELEM_SIZE(type);
+        for( int i = dims-1; i >= 0; i-- )
+        {
+            if( step )
+            {
+                if( data0 && step[i] != CV_AUTOSTEP )
+                {
+                    CV_Assert(total <= step[i]);
+                    total = step[i];
+                }
+                else
+                    step[i] = total;
+            }
+            total *= sizes[i];
+        }
+        int cls = -1;
+        uchar* data = data0 ? (uchar*)data0 : (uchar*)allocateBlock(total, cls);
+        UMatData* u = new UMatData(this);
+        u->data = u->origdata = data;
+        u->size = total;
+        u->allocatorFlags_ = cls + 1;  // 0 - not pooled
+        if(data0)
+            u->flags |= UMatData::USER_ALLOCATED;
+
+        return u;
+    }
+
+    bool allocate(UMatData* u, AccessFlag /*accessFlags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        if(!u) return false;
+        return true;
+    }
+
+    void deallocate(UMatData* u) const CV_OVERRIDE
+    {
+        if(!u)
+            return;
+
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        if( !(u->flags & UMatData::USER_ALLOCATED) )
+        {
+            releaseBlock(u->origdata, u->allocatorFlags_ - 1);
+            u->origdata = 0;
+        }
+        delete u;
+    }
+
+    BufferPoolController* getBufferPoolController(const char* /*id*/) const CV_OVERRIDE
+    {
+        return const_cast<PoolMatAllocator*>(this);
+    }
+
+    // BufferPoolController
+
+    size_t getReservedSize() const CV_OVERRIDE { return reservedSize.load(std::memory_order_relaxed); }
+
+    size_t getMaxReservedSize() const CV_OVERRIDE { return maxReservedSize.load(std::memory_order_relaxed); }
+
+    void setMaxReservedSize(size_t size) CV_OVERRIDE
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        maxReservedSize.store(size, std::memory_order_relaxed);
+        trim_(size);
+    }
+
+    void freeAllReservedBuffers() CV_OVERRIDE
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        trim_(0);
+    }
+
+    BufferPoolStatistics getStatistics() const
+    {
+        BufferPoolStatistics stat;
+        stat.allocations = allocations.load(std::memory_order_relaxed);
+        stat.hits = hits.load(std::memory_order_relaxed);
+        stat.reservedSize = reservedSize.load(std::memory_order_relaxed);
+        stat.releasedSize = releasedSize.load(std::memory_order_relaxed);
+        return stat;
+    }
+
+protected:
+    friend struct PoolThreadCache;
+
+    void* allocateBlock(size_t size, int& cls) const
+    {
+        if (size > maxBlockSize)
+        {
+            cls = -1;
+            return fastMalloc(size);
+        }
+        cls = getSizeClass(size);
+        const size_t classSize = getClassSize(cls);
+        allocations.fetch_add(1, std::memory_order_relaxed);
+
+        void* ptr = NULL;
+        PoolThreadCache* cache = magazineSize > 0 ? threadCaches.get() : NULL;
+        if (cache)
+        {
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            std::vector<void*>& magazine = cache->magazines[cls];
+            if (!magazine.empty())
+            {
+                ptr = magazine.back();
+                magazine.pop_back();
+            }
+        }
+        if (!ptr)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::vector<void*>& freeList = freeLists[cls];
+            if (!freeList.empty())
+            {
+                ptr = freeList.back();
+                freeList.pop_back();
+            }
+        }
+        if (ptr)
+        {
+            hits.fetch_add(1, std::memory_order_relaxed);
+            reservedSize.fetch_sub(classSize, std::memory_order_relaxed);
+            return ptr;
+        }
+        return fastMalloc(classSize);
+    }
+
+    void releaseBlock(void* ptr, int cls) const
+    {
+        if (cls < 0)
+        {
+            fastFree(ptr);
+            return;
+        }
+        const size_t classSize = getClassSize(cls);
+        PoolThreadCache* cache = magazineSize > 0 ? threadCaches.get() : NULL;
+        if (cache && reservedSize.load(std::memory_order_relaxed) + classSize <= maxReservedSize.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            std::vector<void*>& magazine = cache->magazines[cls];
+            if (magazine.size() < magazineSize)
+            {
+                magazine.push_back(ptr);
+                reservedSize.fetch_add(classSize, std::memory_order_relaxed);
+                return;
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        releaseBlockGlobal_(ptr, cls);
+    }
+
+    /** Put block into the global free list (trim policy: drop blocks of the largest classes first) */
+    void releaseBlockGlobal_(void* ptr, int cls) const
+    {
+        const size_t classSize = getClassSize(cls);
+        const size_t limit = maxReservedSize.load(std::memory_order_relaxed);
+        if (reservedSize.load(std::memory_order_relaxed) + classSize > limit)
+        {
+            trimGlobal_(limit > classSize ? limit - classSize : 0, cls);
+            if (reservedSize.load(std::memory_order_relaxed) + classSize > limit)
+            {
+                fastFree(ptr);
+                releasedSize.fetch_add(classSize, std::memory_order_relaxed);
+                return;
+            }
+        }
+        freeLists[cls].push_back(ptr);
+        reservedSize.fetch_add(classSize, std::memory_order_relaxed);
+    }
+
+    /** Free global blocks of classes larger than minClass until reserved size fits into the limit */
+    void trimGlobal_(size_t limit, int minClass = -1) const
+    {
+        for (int cls = numClasses - 1; cls > minClass && reservedSize.load(std::memory_order_relaxed) > limit; cls--)
+        {
+            std::vector<void*>& freeList = freeLists[cls];
+            const size_t classSize = getClassSize(cls);
+            while (!freeList.empty() && reservedSize.load(std::memory_order_relaxed) > limit)
+            {
+                fastFree(freeList.back());
+                freeList.pop_back();
+                reservedSize.fetch_sub(classSize, std::memory_order_relaxed);
+                releasedSize.fetch_add(classSize, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void trim_(size_t limit) const
+    {
+        trimGlobal_(limit);
+        for (size_t i = 0; i < caches.size() && reservedSize.load(std::memory_order_relaxed) > limit; i++)
+        {
+            PoolThreadCache& cache = *caches[i];
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            for (int cls = numClasses - 1; cls >= 0 && reservedSize.load(std::memory_order_relaxed) > limit; cls--)
+            {
+                std::vector<void*>& magazine = cache.magazines[cls];
+                const size_t classSize = getClassSize(cls);
+                while (!magazine.empty() && reservedSize.load(std::memory_order_relaxed) > limit)
+                {
+                    fastFree(magazine.back());
+                    magazine.pop_back();
+                    reservedSize.fetch_sub(classSize, std::memory_order_relaxed);
+                    releasedSize.fetch_add(classSize, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    const size_t maxBlockSize;
+    const size_t magazineSize;
+    const int numClasses;
+
+    mutable std::mutex mutex;  // guards freeLists and caches
+    std::atomic<size_t> maxReservedSize;
+    mutable std::vector< std::vector<void*> > freeLists;
+    std::vector<PoolThreadCache*> caches;  // registered thread caches
+
+    TLSData<PoolThreadCache> threadCaches;
+
+    mutable std::atomic<uint64_t> allocations;
+    mutable std::atomic<uint64_t> hits;
+    mutable std::atomic<size_t> reservedSize;  // global + thread caches
+    mutable std::atomic<size_t> releasedSize;
+};
+
+PoolThreadCache::PoolThreadCache()
+{
+    PoolMatAllocator& pool = getPoolMatAllocatorImpl();
+    magazines.resize(pool.numClasses);
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.caches.push_back(this);
+}
+
+PoolThreadCache::~PoolThreadCache()
+{
+    // thread is terminated: return cached blocks into the global free lists
+    PoolMatAllocator& pool = getPoolMatAllocatorImpl();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.caches.erase(std::remove(pool.caches.begin(), pool.caches.end(), this), pool.caches.end());
+    std::lock_guard<std::mutex> cache_lock(mutex);
+    for (int cls = 0; cls < (int)magazines.size(); cls++)
+    {
+        std::vector<void*>& magazine = magazines[cls];
+        const size_t classSize = getClassSize(cls);
+        for (size_t i = 0; i < magazine.size(); i++)
+        {
+            pool.reservedSize.fetch_sub(classSize, std::memory_order_relaxed);
+            pool.releaseBlockGlobal_(magazine[i], cls);
+        }
+        magazine.clear();
+    }
+}
+
+static PoolMatAllocator& getPoolMatAllocatorImpl()
+{
+    CV_SINGLETON_LAZY_INIT_REF(PoolMatAllocator, new PoolMatAllocator())
+}
+
+}  // namespace
+
+MatAllocator* getPoolMatAllocator()
+{
+    return &getPoolMatAllocatorImpl();
+}
+
+BufferPoolStatistics getPoolMatAllocatorStatistics()
+{
+    return getPoolMatAllocatorImpl().getStatistics();
+}
+
+}  // namespace cv
@@ -14,83 +14,188 @@ namespace cv {
 
 ////////////////////////////////////// transpose /////////////////////////////////////////
 
-template<typename T> static void
-transpose_( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size sz )
+// Matrices are transposed block by block, so that both the source rows and the destination
+// rows touched by a block stay in L1 cache and in the TLB. Inside a block, square tiles of
+// N x N elements are transposed in registers, see TransposeTile<>.
+
+template<typename T> struct TransposeTile
 {
-    int i=0, j, m = sz.width, n = sz.height;
+    enum { N = 1 };
+
+    static inline void transpose( const uchar* src, ptrdiff_t, uchar* dst, ptrdiff_t )
+    {
+        *(T*)dst = *(const T*)src;
+    }
 
-    #if CV_ENABLE_UNROLLED
-    for(; i <= m - 4; i += 4 )
+    static inline void swap( uchar* a, uchar* b, ptrdiff_t )
     {
-        T* d0 = (T*)(dst + dstep*i);
-        T* d1 = (T*)(dst + dstep*(i+1));
-        T* d2 = (T*)(dst + dstep*(i+2));
-        T* d3 = (T*)(dst + dstep*(i+3));
+        std::swap(*(T*)a, *(T*)b);
+    }
+};
 
-        for( j = 0; j <= n - 4; j += 4 )
+#if CV_SIMD128
+// transposes a tile of N x N lanes: log2(N) rounds of the "perfect shuffle",
+// each of them zipping the row k with the row k + N/2
+template<typename VT> static inline void
+v_transpose_tile( VT* r )
+{
+    const int N = VTraits<VT>::max_nlanes;
+    VT t[N];
+    for( int s = 1; s < N; s *= 2 )
+    {
+        for( int k = 0; k < N/2; k++ )
+            v_zip(r[k], r[k + N/2], t[2*k], t[2*k + 1]);
+        for( int k = 0; k < N; k++ )
+            r[k] = t[k];
+    }
+}
+
+// tile of N x N elements with cn channels; multi-channel elements are split into planes
+template<typename VT, int cn> struct TransposeTileSIMD
+{
+    typedef typename VTraits<VT>::lane_type LT;
+    enum { N = VTraits<VT>::max_nlanes };
+
+    static inline void load( const uchar* src, ptrdiff_t sstep, VT (&r)[cn][N] )
+    {
+        for( int k = 0; k < N; k++ )
         {
-            const T* s0 = (const T*)(src + i*sizeof(T) + sstep*j);
-            const T* s1 = (const T*)(src + i*sizeof(T) + sstep*(j+1));
-            const T* s2 = (const T*)(src + i*sizeof(T) + sstep*(j+2));
-            const T* s3 = (const T*)(src + i*sizeof(T) + sstep*(j+3));
-
-            d0[j] = s0[0]; d0[j+1] = s1[0]; d0[j+2] = s2[0]; d0[j+3] = s3[0];
-            d1[j] = s0[1]; d1[j+1] = s1[1]; d1[j+2] = s2[1]; d1[j+3] = s3[1];
-            d2[j] = s0[2]; d2[j+1] = s1[2]; d2[j+2] = s2[2]; d2[j+3] = s3[2];
-            d3[j] = s0[3]; d3[j+1] = s1[3]; d3[j+2] = s2[3]; d3[j+3] = s3[3];
+            const LT* s = (const LT*)(src + sstep*k);
+            if( cn == 1 )
+                r[0][k] = v_load(s);
+            else if( cn == 2 )
+                v_load_deinterleave(s, r[0][k], r[1 % cn][k]);
+            else
+                v_load_deinterleave(s, r[0][k], r[1 % cn][k], r[2 % cn][k]);
         }
+        for( int c = 0; c < cn; c++ )
+            v_transpose_tile(r[c]);
+    }
 
-        for( ; j < n; j++ )
+    static inline void store( uchar* dst, ptrdiff_t dstep, VT (&r)[cn][N] )
+    {
+        for( int k = 0; k < N; k++ )
         {
-            const T* s0 = (const T*)(src + i*sizeof(T) + j*sstep);
-            d0[j] = s0[0]; d1[j] = s0[1]; d2[j] = s0[2]; d3[j] = s0[3];
+            LT* d = (LT*)(dst + dstep*k);
+            if( cn == 1 )
+                v_store(d, r[0][k]);
+            else if( cn == 2 )
+                v_store_interleave(d, r[0][k], r[1 % cn][k]);
+            else
+                v_store_interleave(d, r[0][k], r[1 % cn][k], r[2 % cn][k]);
         }
     }
-    #endif
-    for( ; i < m; i++ )
+
+    static inline void transpose( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep )
     {
-        T* d0 = (T*)(dst + dstep*i);
-        j = 0;
-        #if CV_ENABLE_UNROLLED
-        for(; j <= n - 4; j += 4 )
-        {
-            const T* s0 = (const T*)(src + i*sizeof(T) + sstep*j);
-            const T* s1 = (const T*)(src + i*sizeof(T) + sstep*(j+1));
-            const T* s2 = (const T*)(src + i*sizeof(T) + sstep*(j+2));
-            const T* s3 = (const T*)(src + i*sizeof(T) + sstep*(j+3));
+        VT r[cn][N];
+        load(src, sstep, r);
+        store(dst, dstep, r);
+    }
 
-            d0[j] = s0[0]; d0[j+1] = s1[0]; d0[j+2] = s2[0]; d0[j+3] = s3[0];
-        }
-        #endif
-        for( ; j < n; j++ )
+    // transposes the tiles 'a' and 'b' and exchanges them; a == b for the tiles on the diagonal
+    static inline void swap( uchar* a, uchar* b, ptrdiff_t step )
+    {
+        VT ra[cn][N], rb[cn][N];
+        load(a, step, ra);
+        load(b, step, rb);
+        store(b, step, ra);
+        store(a, step, rb);
+    }
+};
+
+template<> struct TransposeTile<uchar> : TransposeTileSIMD<v_uint8x16, 1> {};
+template<> struct TransposeTile<ushort> : TransposeTileSIMD<v_uint16x8, 1> {};
+template<> struct TransposeTile<int> : TransposeTileSIMD<v_int32x4, 1> {};
+template<> struct TransposeTile<Vec3b> : TransposeTileSIMD<v_uint8x16, 3> {};
+template<> struct TransposeTile<Vec3s> : TransposeTileSIMD<v_int16x8, 3> {};
+template<> struct TransposeTile<Vec2i> : TransposeTileSIMD<v_int32x4, 2> {};
+template<> struct TransposeTile<Vec3i> : TransposeTileSIMD<v_int32x4, 3> {};
+#endif
+
+// block side in elements, it is a multiple of any TransposeTile<>::N
+static inline int transposeBlockSize( size_t esz )
+{
+    return std::min(64, std::max(16, 256/(int)esz)) & -16;
+}
+
+// steps may be negative, that is used by rotate() to read or write the rows in reverse order
+template<typename T> static void
+transpose_( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep, Size sz )
+{
+    typedef TransposeTile<T> Tile;
+    const int N = Tile::N, BS = transposeBlockSize(sizeof(T));
+    int m = sz.width, n = sz.height;
+
+    for( int ib = 0; ib < m; ib += BS )
+    {
+        int iend = std::min(ib + BS, m);
+        for( int jb = 0; jb < n; jb += BS )
         {
-            const T* s0 = (const T*)(src + i*sizeof(T) + j*sstep);
-            d0[j] = s0[0];
+            int jend = std::min(jb + BS, n), i = ib;
+            for( ; i <= iend - N; i += N )
+            {
+                int j = jb;
+                for( ; j <= jend - N; j += N )
+                    Tile::transpose(src + sstep*j + i*sizeof(T), sstep, dst + dstep*i + j*sizeof(T), dstep);
+                for( ; j < jend; j++ )
+                {
+                    const T* s = (const T*)(src + sstep*j) + i;
+                    for( int k = 0; k < N; k++ )
+                        ((T*)(dst + dstep*(i + k)))[j] = s[k];
+                }
+            }
+            for( ; i < iend; i++ )
+            {
+                T* d = (T*)(dst + dstep*i);
+                for( int j = jb; j < jend; j++ )
+                    d[j] = ((const T*)(src + sstep*j))[i];
+            }
         }
     }
 }
 
+// transposes the square matrix in-place, rows [i0, i1) are processed;
+// i0 must be a multiple of the block size
 template<typename T> static void
-transposeI_( uchar* data, size_t step, int n )
+transposeI_( uchar* data, size_t _step, int n, int i0, int i1 )
 {
-    for( int i = 0; i < n; i++ )
+    typedef TransposeTile<T> Tile;
+    const int N = Tile::N, BS = transposeBlockSize(sizeof(T));
+    const ptrdiff_t step = (ptrdiff_t)_step;
+    const int tn = n - n % N;
+
+    for( int ib = i0; ib < std::min(i1, tn); ib += BS )
+    {
+        int iend = std::min(std::min(ib + BS, i1), tn);
+        for( int jb = ib; jb < tn; jb += BS )
+        {
+            int jend = std::min(jb + BS, tn);
+            for( int i = ib; i < iend; i += N )
+                for( int j = std::max(i, jb); j < jend; j += N )
+                    Tile::swap(data + step*i + j*sizeof(T), data + step*j + i*sizeof(T), step);
+        }
+    }
+
+    // the columns not covered by the tiles
+    for( int i = i0; i < std::min(i1, n); i++ )
     {
         T* row = (T*)(data + step*i);
         uchar* data1 = data + i*sizeof(T);
-        for( int j = i+1; j < n; j++ )
+        for( int j = std::max(i + 1, tn); j < n; j++ )
             std::swap( row[j], *(T*)(data1 + step*j) );
     }
 }
 
-typedef void (*TransposeFunc)( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size sz );
-typedef void (*TransposeInplaceFunc)( uchar* data, size_t step, int n );
+typedef void (*TransposeFunc)( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep, Size sz );
+typedef void (*TransposeInplaceFunc)( uchar* data, size_t step, int n, int i0, int i1 );
 
 #define DEF_TRANSPOSE_FUNC(suffix, type) \
-static void transpose_##suffix( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size sz ) \
+static void transpose_##suffix( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep, Size sz ) \
 { transpose_<type>(src, sstep, dst, dstep, sz); } \
 \
-static void transposeI_##suffix( uchar* data, size_t step, int n ) \
-{ transposeI_<type>(data, step, n); }
+static void transposeI_##suffix( uchar* data, size_t step, int n, int i0, int i1 ) \
+{ transposeI_<type>(data, step, n, i0, i1); }
 
 DEF_TRANSPOSE_FUNC(8u, uchar)
 DEF_TRANSPOSE_FUNC(16u, ushort)
@@ -117,6 +222,72 @@ static TransposeInplaceFunc transposeInplaceTab[] =
     0, 0, 0, 0, 0, 0, 0, transposeI_32sC6, 0, 0, 0, 0, 0, 0, 0, transposeI_32sC8
 };
 
+// matrices larger than this are processed by several threads
+static const size_t TRANSFORM_PARALLEL_MIN_BYTES = 1 << 20;
+// number of source columns (destination rows) in a parallel stripe of transpose
+static const int TRANSPOSE_STRIPE = 64;
+
+class TransposeInvoker : public ParallelLoopBody
+{
+public:
+    TransposeInvoker( TransposeFunc _func, const uchar* _src, ptrdiff_t _sstep,
+                      uchar* _dst, ptrdiff_t _dstep, Size _sz, size_t _esz )
+        : func(_func), src(_src), dst(_dst), sstep(_sstep), dstep(_dstep), sz(_sz), esz(_esz) {}
+
+    void operator()( const Range& range ) const CV_OVERRIDE
+    {
+        int i0 = range.start*TRANSPOSE_STRIPE, i1 = std::min(range.end*TRANSPOSE_STRIPE, sz.width);
+        func( src + i0*esz, sstep, dst + dstep*i0, dstep, Size(i1 - i0, sz.height) );
+    }
+
+private:
+    TransposeFunc func;
+    const uchar* src;
+    uchar* dst;
+    ptrdiff_t sstep, dstep;
+    Size sz;
+    size_t esz;
+};
+
+class TransposeInplaceInvoker : public ParallelLoopBody
+{
+public:
+    TransposeInplaceInvoker( TransposeInplaceFunc _func, uchar* _data, size_t _step, int _n )
+        : func(_func), data(_data), step(_step), n(_n) {}
+
+    void operator()( const Range& range ) const CV_OVERRIDE
+    {
+        func( data, step, n, range.start*TRANSPOSE_STRIPE, std::min(range.end*TRANSPOSE_STRIPE, n) );
+    }
+
+private:
+    TransposeInplaceFunc func;
+    uchar* data;
+    size_t step;
+    int n;
+};
+
+static void
+transposeImpl( TransposeFunc func, const uchar* src, ptrdiff_t sstep,
+               uchar* dst, ptrdiff_t dstep, Size sz, size_t esz )
+{
+    if( (size_t)sz.area()*esz < TRANSFORM_PARALLEL_MIN_BYTES )
+        func( src, sstep, dst, dstep, sz );
+    else
+        parallel_for_( Range(0, (sz.width + TRANSPOSE_STRIPE - 1)/TRANSPOSE_STRIPE),
+                       TransposeInvoker(func, src, sstep, dst, dstep, sz, esz) );
+}
+
+static void
+transposeInplaceImpl( TransposeInplaceFunc func, uchar* data, size_t step, int n, size_t esz )
+{
+    if( (size_t)n*n*esz < TRANSFORM_PARALLEL_MIN_BYTES )
+        func( data, step, n, 0, n );
+    else
+        parallel_for_( Range(0, (n + TRANSPOSE_STRIPE - 1)/TRANSPOSE_STRIPE),
+                       TransposeInplaceInvoker(func, data, step, n) );
+}
+
 #ifdef HAVE_OPENCL
 
 static bool ocl_transpose( InputArray _src, OutputArray _dst )
@@ -278,13 +449,13 @@ void transpose( InputArray _src, OutputArray _dst )
         TransposeInplaceFunc func = transposeInplaceTab[esz];
         CV_Assert( func != 0 );
         CV_Assert( dst.cols == dst.rows );
-        func( dst.ptr(), dst.step, dst.rows );
+        transposeInplaceImpl( func, dst.ptr(), dst.step, dst.rows, esz );
     }
     else
     {
         TransposeFunc func = transposeTab[esz];
         CV_Assert( func != 0 );
-        func( src.ptr(), src.step, dst.ptr(), dst.step, src.size() );
+        transposeImpl( func, src.ptr(), src.step, dst.ptr(), dst.step, src.size(), esz );
     }
 }
 
@@ -589,14 +760,17 @@ flipHoriz( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size size,
     }
 }
 
+// swaps the rows y and size.height - 1 - y for y from the range 'pairs', i.e. [0, (size.height + 1)/2) for the whole matrix
 static void
-flipVert( const uchar* src0, size_t sstep, uchar* dst0, size_t dstep, Size size, size_t esz )
+flipVert( const uchar* src0, size_t sstep, uchar* dst0, size_t dstep, Size size, size_t esz, const Range& pairs )
 {
-    const uchar* src1 = src0 + (size.height - 1)*sstep;
-    uchar* dst1 = dst0 + (size.height - 1)*dstep;
+    const uchar* src1 = src0 + (size.height - 1 - pairs.start)*sstep;
+    uchar* dst1 = dst0 + (size.height - 1 - pairs.start)*dstep;
+    src0 += pairs.start*sstep;
+    dst0 += pairs.start*dstep;
     size.width *= (int)esz;
 
-    for( int y = 0; y < (size.height + 1)/2; y++, src0 += sstep, src1 -= sstep,
+    for( int y = pairs.start; y < pairs.end; y++, src0 += sstep, src1 -= sstep,
                                                   dst0 += dstep, dst1 -= dstep )
     {
         int i = 0;
@@ -677,6 +851,44 @@ flipVert( const uchar* src0, size_t sstep, uchar* dst0, size_t dstep, Size size,
     }
 }
 
+// processes the rows 'range' when flipping around the vertical axis,
+// otherwise the pairs of rows 'range' (see flipVert)
+class FlipInvoker : public ParallelLoopBody
+{
+public:
+    FlipInvoker( const Mat& _src, Mat& _dst, int _flipMode )
+        : src(_src), dst(_dst), flipMode(_flipMode) {}
+
+    void operator()( const Range& range ) const CV_OVERRIDE
+    {
+        size_t esz = src.elemSize();
+        if( flipMode > 0 )
+        {
+            flipHoriz( src.ptr(range.start), src.step, dst.ptr(range.start), dst.step,
+                       Size(src.cols, range.size()), esz );
+            return;
+        }
+
+        flipVert( src.ptr(), src.step, dst.ptr(), dst.step, src.size(), esz, range );
+        if( flipMode < 0 )
+        {
+            // flip the just swapped rows while they are still in cache;
+            // the middle row of an odd-height matrix is included only once
+            int h = dst.rows, y1 = std::max(h - range.end, range.end);
+            flipHoriz( dst.ptr(range.start), dst.step, dst.ptr(range.start), dst.step,
+                       Size(dst.cols, range.size()), esz );
+            if( h - range.start > y1 )
+                flipHoriz( dst.ptr(y1), dst.step, dst.ptr(y1), dst.step,
+                           Size(dst.cols, h - range.start - y1), esz );
+        }
+    }
+
+private:
+    const Mat& src;
+    Mat& dst;
+    int flipMode;
+};
+
 #ifdef HAVE_OPENCL
 
 enum { FLIP_COLS = 1 << 0, FLIP_ROWS = 1 << 1, FLIP_BOTH = FLIP_ROWS | FLIP_COLS };
@@ -811,14 +1023,13 @@ void flip( InputArray _src, OutputArray _dst, int flip_mode )
     CV_IPP_RUN_FAST(ipp_flip(src, dst, flip_mode));
 
     size_t esz = CV_ELEM_SIZE(type);
+    int nrows = flip_mode > 0 ? size.height : (size.height + 1)/2;
+    FlipInvoker invoker(src, dst, flip_mode);
 
-    if( flip_mode <= 0 )
-        flipVert( src.ptr(), src.step, dst.ptr(), dst.step, src.size(), esz );
+    if( src.total()*esz < TRANSFORM_PARALLEL_MIN_BYTES )
+        invoker(Range(0, nrows));
     else
-        flipHoriz( src.ptr(), src.step, dst.ptr(), dst.step, src.size(), esz );
-
-    if( flip_mode < 0 )
-        flipHoriz( dst.ptr(), dst.step, dst.ptr(), dst.step, dst.size(), esz );
+        parallel_for_(Range(0, nrows), invoker, (double)(src.total()*esz >> 16));
 }
 
 static void
@@ -1144,6 +1355,22 @@ void rotate(InputArray _src, OutputArray _dst, int rotateMode)
     CALL_HAL(rotate90, cv_hal_rotate90, type, src.ptr(), src.step, src.cols, src.rows,
              dst.ptr(), dst.step, angle);
 
+    // rotation by 90 degrees is a transposition reading the source rows (clockwise)
+    // or writing the destination rows (counterclockwise) in reverse order, so it is done in one pass
+    size_t esz = src.elemSize();
+    TransposeFunc func = esz <= 32 ? transposeTab[esz] : 0;
+    if( (rotateMode == ROTATE_90_CLOCKWISE || rotateMode == ROTATE_90_COUNTERCLOCKWISE) &&
+        func != 0 && dst.data != src.data && dst.rows == src.cols && dst.cols == src.rows )
+    {
+        if( rotateMode == ROTATE_90_CLOCKWISE )
+            transposeImpl( func, src.ptr(src.rows - 1), -(ptrdiff_t)src.step,
+                           dst.ptr(), (ptrdiff_t)dst.step, src.size(), esz );
+        else
+            transposeImpl( func, src.ptr(), (ptrdiff_t)src.step,
+                           dst.ptr(dst.rows - 1), -(ptrdiff_t)dst.step, src.size(), esz );
+        return;
+    }
+
     // use src (Mat) since _src (InputArray) is updated by _dst.create() when in-place
     rotateImpl(src, _dst, rotateMode);
 }
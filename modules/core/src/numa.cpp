@@ -0,0 +1,252 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+#include "parallel_impl.hpp"
+
+#include <opencv2/core/utils/numa.hpp>
+#include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/core/utils/logger.hpp>
+
+#if defined __linux__ && !defined __ANDROID__ && !defined OPENCV_DISABLE_THREAD_SUPPORT
+#define CV_HAVE_NUMA_SYSFS 1
+#include <fstream>
+#include <sched.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace cv { namespace utils { namespace numa {
+
+#ifdef CV_HAVE_NUMA_SYSFS
+
+/** parse list of form "0-1,3,5-7" */
+static std::vector<int> parseList(const std::string& str)
+{
+    std::vector<int> result;
+    const char* pbuf = str.c_str();
+    while (*pbuf)
+    {
+        int rstart = 0, rend = 0;
+        int n = 0;
+        if (sscanf(pbuf, "%d%n", &rstart, &n) != 1)
+            break;
+        pbuf += n;
+        rend = rstart;
+        if (*pbuf == '-')
+        {
+            pbuf++;
+            if (sscanf(pbuf, "%d%n", &rend, &n) != 1)
+                break;
+            pbuf += n;
+        }
+        for (int i = rstart; i <= rend; i++)
+            result.push_back(i);
+        while (*pbuf == ',' || *pbuf == '\n' || *pbuf == ' ')
+            pbuf++;
+    }
+    return result;
+}
+
+static std::string readLine(const std::string& filename)
+{
+    std::ifstream ifs(filename.c_str());
+    std::string line;
+    if (ifs.is_open())
+        std::getline(ifs, line);
+    return line;
+}
+
+struct Topology
+{
+    std::vector< std::vector<int> > nodes;  // available CPUs of used nodes
+    std::vector<int> cpuNode;  // CPU => index in nodes (-1 if not available)
+
+    Topology()
+    {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        bool hasAffinity = 0 == sched_getaffinity(0, sizeof(cpu_set), &cpu_set);
+        std::vector<int> online = parseList(readLine("/sys/devices/system/node/online"));
+        for (size_t i = 0; i < online.size(); i++)
+        {
+            std::vector<int> cpus = parseList(readLine(cv::format("/sys/devices/system/node/node%d/cpulist", online[i])));
+            std::vector<int> available;
+            for (size_t j = 0; j < cpus.size(); j++)
+            {
+                int cpu = cpus[j];
+                if (cpu < 0 || cpu >= CPU_SETSIZE)
+                    continue;
+                if (hasAffinity && !CPU_ISSET(cpu, &cpu_set))
+                    continue;
+                available.push_back(cpu);
+            }
+            if (available.empty())
+                continue;  // memory-only node or not allowed for this process
+            for (size_t j = 0; j < available.size(); j++)
+            {
+                int cpu = available[j];
+                if (cpu >= (int)cpuNode.size())
+                    cpuNode.resize(cpu + 1, -1);
+                cpuNode[cpu] = (int)nodes.size();
+            }
+            nodes.push_back(available);
+        }
+        CV_LOG_DEBUG(NULL, "core(numa): detected nodes with available CPUs: " << nodes.size());
+    }
+};
+
+static const Topology& getTopology()
+{
+    static Topology g_topology;
+    return g_topology;
+}
+
+bool isEnabled()
+{
+    static bool g_enabled = utils::getConfigurationParameterBool("OPENCV_THREAD_POOL_NUMA", false) && getTopology().nodes.size() > 1;
+    return g_enabled;
+}
+
+int getNumberOfNodes()
+{
+    return isEnabled() ? (int)getTopology().nodes.size() : 1;
+}
+
+int getCurrentNode()
+{
+    if (!isEnabled())
+        return 0;
+    int cpu = sched_getcpu();
+    const Topology& topology = getTopology();
+    if (cpu < 0 || cpu >= (int)topology.cpuNode.size() || topology.cpuNode[cpu] < 0)
+        return 0;
+    return topology.cpuNode[cpu];
+}
+
+int getNodeCPUsCount(int node)
+{
+    if (!isEnabled())
+        return node == 0 ? cv::getNumberOfCPUs() : 0;
+    const Topology& topology = getTopology();
+    CV_Assert(node >= 0 && node < (int)topology.nodes.size());
+    return (int)topology.nodes[node].size();
+}
+
+bool bindCurrentThreadToNode(int node)
+{
+    if (!isEnabled())
+        return false;
+    const Topology& topology = getTopology();
+    CV_Assert(node >= 0 && node < (int)topology.nodes.size());
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    const std::vector<int>& cpus = topology.nodes[node];
+    for (size_t i = 0; i < cpus.size(); i++)
+        CPU_SET(cpus[i], &cpu_set);
+    int res = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (res != 0)
+    {
+        CV_LOG_WARNING(NULL, "core(numa): can't bind thread to node " << node << ": res = " << res);
+        return false;
+    }
+    return true;
+}
+
+#else  // CV_HAVE_NUMA_SYSFS
+
+bool isEnabled() { return false; }
+int getNumberOfNodes() { return 1; }
+int getCurrentNode() { return 0; }
+int getNodeCPUsCount(int node) { return node == 0 ? cv::getNumberOfCPUs() : 0; }
+bool bindCurrentThreadToNode(int /*node*/) { return false; }
+
+#endif  // CV_HAVE_NUMA_SYSFS
+
+
+class FirstTouchMatAllocator CV_FINAL : public MatAllocator
+{
+public:
+    enum { ALLOCATOR_FLAG_MMAP = 1 };
+
+    UMatData* allocate(int dims, const int* sizes, int type,
+                       void* data0, size_t* step, AccessFlag flags, UMatUsageFlags usageFlags) const CV_OVERRIDE
+    {
+#ifdef CV_HAVE_NUMA_SYSFS
+        static size_t minSize = utils::getConfigurationParameterSizeT("OPENCV_NUMA_FIRST_TOUCH_MIN_SIZE", 1 << 20);
+        size_t total = CV_ELEM_SIZE(type);
+        for (int i = dims - 1; i >= 0; i--)
+            total *= sizes[i];
+        if (!data0 && dims > 0 && total >= minSize && isEnabled())
+        {
+            size_t sz = CV_ELEM_SIZE(type);
+            for (int i = dims - 1; i >= 0; i--)
+            {
+                if (step)
+                    step[i] = sz;
+                sz *= sizes[i];
+            }
+            // anonymous mapping: physical pages are not allocated until the first access
+            void* ptr = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ptr != MAP_FAILED)
+            {
+                firstTouch((uchar*)ptr, total, sizes[0]);
+                UMatData* u = new UMatData(this);
+                u->data = u->origdata = (uchar*)ptr;
+                u->size = total;
+                u->allocatorFlags_ = ALLOCATOR_FLAG_MMAP;
+                return u;
+            }
+            CV_LOG_DEBUG(NULL, "core(numa): mmap() failed, size=" << total);
+        }
+#endif
+        return Mat::getStdAllocator()->allocate(dims, sizes, type, data0, step, flags, usageFlags);
+    }
+
+    bool allocate(UMatData* u, AccessFlag /*accessFlags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        if (!u) return false;
+        return true;
+    }
+
+    void deallocate(UMatData* u) const CV_OVERRIDE
+    {
+        if (!u)
+            return;
+
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        CV_Assert(u->allocatorFlags_ == ALLOCATOR_FLAG_MMAP);  // other buffers are owned by StdMatAllocator
+#ifdef CV_HAVE_NUMA_SYSFS
+        munmap(u->origdata, u->size);
+#endif
+        u->origdata = 0;
+        delete u;
+    }
+
+protected:
+#ifdef CV_HAVE_NUMA_SYSFS
+    static void firstTouch(uchar* data, size_t total, int rows)
+    {
+        static const size_t pageSize = (size_t)std::max(4096L, sysconf(_SC_PAGESIZE));
+        const size_t rowSize = total / rows;
+        parallel_for_(Range(0, rows), [&](const Range& r)
+        {
+            size_t start = rowSize * r.start, end = r.end == rows ? total : rowSize * r.end;
+            // touch pages which begin inside of this stripe
+            for (size_t ofs = alignSize(start, pageSize); ofs < end; ofs += pageSize)
+                data[ofs] = 0;
+        });
+        data[0] = 0;
+    }
+#endif
+};
+
+MatAllocator* getFirstTouchAllocator()
+{
+    CV_SINGLETON_LAZY_INIT(MatAllocator, new FirstTouchMatAllocator())
+}
+
+}}}  // namespace
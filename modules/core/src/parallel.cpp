@@ -154,6 +154,7 @@
 #endif
 
 #include <atomic>
+#include <typeinfo>
 
 #include "parallel_impl.hpp"
 
@@ -517,6 +518,15 @@ void parallel_for_(const cv::Range& range, const cv::ParallelLoopBody& body, dou
     if (range.empty())
         return;
 
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+    if (isNestedParallelForSupported(getCurrentParallelForAPI()))
+    {
+        // nested and concurrent calls are scheduled by backend itself
+        parallel_for_impl(range, body, nstripes);
+        return;
+    }
+#endif
+
     static std::atomic<bool> flagNestedParallelFor(false);
     bool isNotNestedRegion = !flagNestedParallelFor.load();
     if (isNotNestedRegion)
@@ -549,6 +559,22 @@ void parallel_for_cb(int start, int end, void* data)
     body(Range(start, end));
 }
 
+#ifdef HAVE_PTHREADS_PF
+// Lambdas are wrapped by parallel_for_(), the type of the lambda identifies the call site.
+// Type names are compared, because the wrapper is instantiated in the caller's module.
+static const char* getParallelLoopBodyName(const cv::ParallelLoopBody& body)
+{
+    const char* name = typeid(body).name();
+    if (strcmp(name, typeid(ParallelLoopBodyLambdaWrapper).name()) == 0)
+    {
+        const std::type_info& functorType = static_cast<const ParallelLoopBodyLambdaWrapper&>(body).functorType();
+        if (functorType != typeid(void))
+            return functorType.name();
+    }
+    return name;
+}
+#endif
+
 static void parallel_for_impl(const cv::Range& range, const cv::ParallelLoopBody& body, double nstripes)
 {
     using namespace cv::parallel;
@@ -614,7 +640,20 @@ static void parallel_for_impl(const cv::Range& range, const cv::ParallelLoopBody
 
 #elif defined HAVE_PTHREADS_PF
 
-        parallel_for_pthreads(pbody.stripeRange(), pbody, pbody.stripeRange().size());
+        if (isParallelForMetricsEnabled())
+        {
+            ParallelForMetrics metrics;
+            parallel_for_pthreads(pbody.stripeRange(), pbody, pbody.stripeRange().size(), &metrics);
+            if (metrics.threads > 0)
+            {
+                metrics.rangeSize = range.size();
+                reportParallelForMetrics(getParallelLoopBodyName(body), metrics);
+            }
+        }
+        else
+        {
+            parallel_for_pthreads(pbody.stripeRange(), pbody, pbody.stripeRange().size());
+        }
 
 #else
 
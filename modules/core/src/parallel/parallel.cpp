@@ -60,6 +60,11 @@ std::shared_ptr<ParallelForAPI> createParallelForAPI()
             }
             isKnown = true;
         }
+        else if (info.explicitOnly)
+        {
+            CV_LOG_DEBUG(NULL, "core(parallel): skip backend (explicit request is required): " << info.name);
+            continue;
+        }
         try
         {
             CV_LOG_DEBUG(NULL, "core(parallel): trying backend: " << info.name << " (priority=" << info.priority << ")");
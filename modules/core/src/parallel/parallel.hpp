@@ -5,6 +5,7 @@
 #define OPENCV_CORE_SRC_PARALLEL_PARALLEL_HPP
 
 #include "opencv2/core/parallel/parallel_backend.hpp"
+#include "opencv2/core/parallel/parallel_metrics.hpp"
 
 namespace cv { namespace parallel {
 
@@ -22,6 +23,16 @@ std::shared_ptr<cv::parallel::ParallelForAPI> createParallelBackendTBB();
 std::shared_ptr<cv::parallel::ParallelForAPI> createParallelBackendOpenMP();
 #endif
 
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+std::shared_ptr<cv::parallel::ParallelForAPI> createParallelBackendWorkStealing();
+
+/** Backend schedules nested and concurrent parallel_for() calls itself */
+bool isNestedParallelForSupported(const std::shared_ptr<ParallelForAPI>& api);
+#endif
+
+/** Stores metrics of parallel_for_() invocation (last invocation of the calling thread, aggregated statistics, trace) */
+void reportParallelForMetrics(const char* name, const ParallelForMetrics& metrics);
+
 #endif  // BUILD_PLUGIN
 
 }}  // namespace
@@ -0,0 +1,160 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+#include "../precomp.hpp"
+#include "parallel.hpp"
+
+#include <opencv2/core/parallel/parallel_metrics.hpp>
+#include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/core/utils/trace.private.hpp>
+
+#include <atomic>
+#include <map>
+
+namespace cv { namespace parallel {
+
+ParallelForMetrics::ParallelForMetrics()
+    : rangeSize(0), stripes(0), threads(0), wallTime(0)
+    , activeWaitTime(0), sleepTime(0)
+    , workersWokenActive(0), workersWokenSleeping(0)
+    , stragglerRatio(0)
+{
+    // nothing
+}
+
+ParallelForStatistics::ParallelForStatistics()
+    : calls(0), stripes(0), maxThreads(0), wallTime(0)
+    , busyTime(0), idleTime(0), activeWaitTime(0), sleepTime(0)
+    , workersWokenActive(0), workersWokenSleeping(0)
+    , meanStragglerRatio(0), maxStragglerRatio(0)
+{
+    // nothing
+}
+
+namespace {
+
+static std::atomic<bool>& getMetricsEnabledFlag()
+{
+    static std::atomic<bool> g_enabled(utils::getConfigurationParameterBool("OPENCV_PARALLEL_METRICS", false));
+    return g_enabled;
+}
+
+struct ThreadLastMetrics
+{
+    ThreadLastMetrics() : valid(false) {}
+    bool valid;
+    ParallelForMetrics metrics;
+};
+
+static ThreadLastMetrics& getThreadLastMetrics()
+{
+    static thread_local ThreadLastMetrics g_lastMetrics;
+    return g_lastMetrics;
+}
+
+class StatisticsStorage
+{
+public:
+    static StatisticsStorage& getInstance()
+    {
+        CV_SINGLETON_LAZY_INIT_REF(StatisticsStorage, new StatisticsStorage())
+    }
+
+    void add(const char* name, const ParallelForMetrics& m)
+    {
+        cv::AutoLock lock(mutex);
+        ParallelForStatistics& s = stat[name];
+        if (s.calls == 0)
+            s.name = name;
+        s.calls++;
+        s.stripes += m.stripes;
+        s.maxThreads = std::max(s.maxThreads, m.threads);
+        s.wallTime += m.wallTime;
+        for (size_t i = 0; i < m.busyTime.size(); i++)
+            s.busyTime += m.busyTime[i];
+        for (size_t i = 0; i < m.idleTime.size(); i++)
+            s.idleTime += m.idleTime[i];
+        s.activeWaitTime += m.activeWaitTime;
+        s.sleepTime += m.sleepTime;
+        s.workersWokenActive += m.workersWokenActive;
+        s.workersWokenSleeping += m.workersWokenSleeping;
+        s.meanStragglerRatio += (m.stragglerRatio - s.meanStragglerRatio) / s.calls;
+        s.maxStragglerRatio = std::max(s.maxStragglerRatio, m.stragglerRatio);
+    }
+
+    std::vector<ParallelForStatistics> get()
+    {
+        cv::AutoLock lock(mutex);
+        std::vector<ParallelForStatistics> result;
+        result.reserve(stat.size());
+        for (std::map<std::string, ParallelForStatistics>::const_iterator it = stat.begin(); it != stat.end(); ++it)
+            result.push_back(it->second);
+        return result;
+    }
+
+    void reset()
+    {
+        cv::AutoLock lock(mutex);
+        stat.clear();
+    }
+
+protected:
+    cv::Mutex mutex;
+    std::map<std::string, ParallelForStatistics> stat;
+};
+
+}  // namespace
+
+void reportParallelForMetrics(const char* name, const ParallelForMetrics& metrics)
+{
+#ifdef OPENCV_TRACE
+    // attached to the current ("parallel_for") region
+    double busyTime = 0, idleTime = 0;
+    for (size_t i = 0; i < metrics.busyTime.size(); i++)
+        busyTime += metrics.busyTime[i];
+    for (size_t i = 0; i < metrics.idleTime.size(); i++)
+        idleTime += metrics.idleTime[i];
+    CV__TRACE_ARG_VALUE(stripes, "metrics.stripes", (int64)metrics.stripes);
+    CV__TRACE_ARG_VALUE(threads, "metrics.threads", (int64)metrics.threads);
+    CV__TRACE_ARG_VALUE(busy, "metrics.busyTime", busyTime);
+    CV__TRACE_ARG_VALUE(idle, "metrics.idleTime", idleTime);
+    CV__TRACE_ARG_VALUE(active_wait, "metrics.activeWaitTime", metrics.activeWaitTime);
+    CV__TRACE_ARG_VALUE(sleep, "metrics.sleepTime", metrics.sleepTime);
+    CV__TRACE_ARG_VALUE(straggler, "metrics.stragglerRatio", metrics.stragglerRatio);
+#endif
+    ThreadLastMetrics& last = getThreadLastMetrics();
+    last.metrics = metrics;
+    last.valid = true;
+    StatisticsStorage::getInstance().add(name, metrics);
+}
+
+void setParallelForMetricsEnabled(bool enabled)
+{
+    getMetricsEnabledFlag().store(enabled);
+}
+
+bool isParallelForMetricsEnabled()
+{
+    return getMetricsEnabledFlag().load(std::memory_order_relaxed);
+}
+
+bool getLastParallelForMetrics(ParallelForMetrics& metrics)
+{
+    const ThreadLastMetrics& last = getThreadLastMetrics();
+    if (!last.valid)
+        return false;
+    metrics = last.metrics;
+    return true;
+}
+
+std::vector<ParallelForStatistics> getParallelForStatistics()
+{
+    return StatisticsStorage::getInstance().get();
+}
+
+void resetParallelForStatistics()
+{
+    StatisticsStorage::getInstance().reset();
+}
+
+}}  // namespace
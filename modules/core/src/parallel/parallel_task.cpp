@@ -0,0 +1,430 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+#include "../precomp.hpp"
+
+#include <opencv2/core/parallel/task.hpp>
+#include <opencv2/core/detail/async_promise.hpp>
+#include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/core/utils/logger.defines.hpp>
+#include <opencv2/core/utils/logger.hpp>
+
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+
+//
+// Asynchronous tasks with dependencies
+//
+// Task is queued for execution when its dependencies counter drops to zero.
+// Task threads only run task bodies: data-parallel work is scheduled by parallel_for_() on the active backend.
+// Waiting threads execute queued tasks (and recursively their dependencies) themselves,
+// so waiting from task bodies doesn't deadlock with limited number of task threads.
+//
+
+namespace cv { namespace parallel {
+
+struct AsyncTask::Impl
+{
+    enum State
+    {
+        STATE_WAITING,  // for dependencies
+        STATE_QUEUED,
+        STATE_RUNNING,
+        STATE_DONE
+    };
+
+    explicit Impl(const TaskFunction& body_)
+        : body(body_)
+        , state(STATE_WAITING)
+        , pendingDependencies(1)  // guard: released after registration in all dependencies
+        , has_exception(false)
+    {
+        // nothing
+    }
+
+    TaskFunction body;
+
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+    std::mutex mutex;
+    std::condition_variable cond;
+#endif
+    State state;
+    int pendingDependencies;
+    std::vector< std::shared_ptr<Impl> > dependencies;  // used by waiting threads, released on completion
+    std::vector< std::shared_ptr<Impl> > dependents;
+    std::vector< std::shared_ptr<AsyncPromise> > promises;
+
+    Mat result;
+    bool has_exception;
+#if CV__EXCEPTION_PTR
+    std::exception_ptr exception;
+#endif
+    cv::Exception cv_exception;
+
+    void storeException(const Impl& failed)
+    {
+        if (has_exception)
+            return;
+        has_exception = true;
+#if CV__EXCEPTION_PTR
+        exception = failed.exception;
+#endif
+        cv_exception = failed.cv_exception;
+    }
+
+    void rethrow() const
+    {
+        CV_DbgAssert(has_exception);
+#if CV__EXCEPTION_PTR
+        if (exception)
+            std::rethrow_exception(exception);
+#endif
+        throw cv_exception;
+    }
+
+    void fulfill(AsyncPromise& promise) const
+    {
+        try
+        {
+            if (has_exception)
+            {
+#if CV__EXCEPTION_PTR
+                if (exception)
+                {
+                    promise.setException(exception);
+                    return;
+                }
+#endif
+                promise.setException(cv_exception);
+            }
+            else
+            {
+                promise.setValue(result);
+            }
+        }
+        catch (const cv::Exception& e)
+        {
+            CV_LOG_DEBUG(NULL, "parallel(task): can't deliver task result: " << e.what());
+        }
+    }
+
+    void execute()
+    {
+        try
+        {
+            body(result);
+        }
+        catch (const cv::Exception& e)
+        {
+            has_exception = true;
+            cv_exception = e;
+#if CV__EXCEPTION_PTR
+            exception = std::current_exception();
+#endif
+        }
+        catch (...)
+        {
+            has_exception = true;
+            cv_exception = cv::Exception(Error::StsError, "Unknown C++ exception in asynchronous task", CV_Func, __FILE__, __LINE__);
+#if CV__EXCEPTION_PTR
+            exception = std::current_exception();
+#endif
+        }
+    }
+};
+
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+
+typedef std::shared_ptr<AsyncTask::Impl> TaskPtr;
+
+static void runTask(const TaskPtr& task);
+
+class TaskScheduler
+{
+public:
+    TaskScheduler()
+        : numThreads((int)utils::getConfigurationParameterSizeT("OPENCV_PARALLEL_TASK_THREADS", 2))
+    {
+        numThreads = std::max(1, numThreads);
+    }
+
+    static TaskScheduler& getInstance()
+    {
+        CV_SINGLETON_LAZY_INIT_REF(TaskScheduler, new TaskScheduler())
+    }
+
+    void enqueue(const TaskPtr& task)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (threads.empty())
+        {
+            CV_LOG_DEBUG(NULL, "parallel(task): starting " << numThreads << " task threads");
+            for (int i = 0; i < numThreads; i++)
+                threads.push_back(std::make_shared<std::thread>(&TaskScheduler::thread_body, this));
+        }
+        queue.push_back(task);
+        cond.notify_one();
+    }
+
+protected:
+    void thread_body()
+    {
+        for (;;)
+        {
+            TaskPtr task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                while (queue.empty())
+                    cond.wait(lock);
+                task = queue.front();
+                queue.pop_front();
+            }
+            runTask(task);  // no-op if task has been executed by waiting thread
+        }
+    }
+
+    int numThreads;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<TaskPtr> queue;
+    std::vector< std::shared_ptr<std::thread> > threads;  // threads are not joined (singleton is not destroyed)
+};
+
+static void completeTask(const TaskPtr& task);
+
+static void releaseDependency(const TaskPtr& task, const AsyncTask::Impl* failed)
+{
+    {
+        std::unique_lock<std::mutex> lock(task->mutex);
+        if (failed && failed->has_exception)
+            task->storeException(*failed);
+        CV_Assert(task->pendingDependencies > 0);
+        if (--task->pendingDependencies > 0)
+            return;
+        if (!task->has_exception)
+        {
+            task->state = AsyncTask::Impl::STATE_QUEUED;
+            task->cond.notify_all();
+        }
+    }
+    if (task->has_exception)
+        completeTask(task);  // dependency has failed: don't execute
+    else
+        TaskScheduler::getInstance().enqueue(task);
+}
+
+static void completeTask(const TaskPtr& task)
+{
+    std::vector<TaskPtr> dependents;
+    std::vector< std::shared_ptr<AsyncPromise> > promises;
+    TaskFunction body;
+    {
+        std::unique_lock<std::mutex> lock(task->mutex);
+        task->state = AsyncTask::Impl::STATE_DONE;
+        std::swap(dependents, task->dependents);
+        std::swap(promises, task->promises);
+        std::swap(body, task->body);  // release captured objects outside of lock
+        task->dependencies.clear();
+        task->cond.notify_all();
+    }
+    for (size_t i = 0; i < promises.size(); i++)
+        task->fulfill(*promises[i]);
+    for (size_t i = 0; i < dependents.size(); i++)
+        releaseDependency(dependents[i], task.get());
+}
+
+static void runTask(const TaskPtr& task)
+{
+    {
+        std::unique_lock<std::mutex> lock(task->mutex);
+        if (task->state != AsyncTask::Impl::STATE_QUEUED)
+            return;
+        task->state = AsyncTask::Impl::STATE_RUNNING;
+    }
+    task->execute();
+    completeTask(task);
+}
+
+static void waitTask(const TaskPtr& task)
+{
+    std::unique_lock<std::mutex> lock(task->mutex);
+    while (task->state != AsyncTask::Impl::STATE_DONE)
+    {
+        if (task->state == AsyncTask::Impl::STATE_QUEUED)
+        {
+            lock.unlock();
+            runTask(task);  // help: execute task in the current thread
+            lock.lock();
+        }
+        else if (task->state == AsyncTask::Impl::STATE_WAITING && !task->dependencies.empty())
+        {
+            std::vector<TaskPtr> dependencies(task->dependencies);
+            lock.unlock();
+            for (size_t i = 0; i < dependencies.size(); i++)
+                waitTask(dependencies[i]);
+            lock.lock();
+            if (task->state == AsyncTask::Impl::STATE_WAITING)
+                task->dependencies.clear();  // all are completed, task state is updated soon
+        }
+        else
+        {
+            task->cond.wait(lock);
+        }
+    }
+}
+
+AsyncTask submit(const TaskFunction& body, const std::vector<AsyncTask>& dependencies)
+{
+    CV_Assert(body);
+    TaskPtr task = std::make_shared<AsyncTask::Impl>(body);
+    for (size_t i = 0; i < dependencies.size(); i++)
+    {
+        const TaskPtr& dep = dependencies[i]._getImpl();
+        CV_Assert(dep && "invalid dependency");
+        std::unique_lock<std::mutex> lock(dep->mutex);
+        if (dep->state == AsyncTask::Impl::STATE_DONE)
+        {
+            if (dep->has_exception)
+                task->storeException(*dep);
+            continue;
+        }
+        dep->dependents.push_back(task);
+        task->dependencies.push_back(dep);
+        task->pendingDependencies++;  // task is not visible to other threads yet
+    }
+    releaseDependency(task, NULL);  // release guard
+    return AsyncTask(task);
+}
+
+bool AsyncTask::isReady() const
+{
+    CV_Assert(p);
+    std::unique_lock<std::mutex> lock(p->mutex);
+    return p->state == Impl::STATE_DONE;
+}
+
+void AsyncTask::wait() const
+{
+    CV_Assert(p);
+    waitTask(p);
+}
+
+bool AsyncTask::wait_for(int64 timeoutNs) const
+{
+    CV_Assert(p);
+    if (timeoutNs < 0)
+    {
+        waitTask(p);
+        return true;
+    }
+    std::unique_lock<std::mutex> lock(p->mutex);
+    return p->cond.wait_for(lock, std::chrono::nanoseconds(timeoutNs), [&]() { return p->state == Impl::STATE_DONE; });
+}
+
+AsyncArray AsyncTask::getArrayResult() const
+{
+    CV_Assert(p);
+    std::shared_ptr<AsyncPromise> promise = std::make_shared<AsyncPromise>();
+    AsyncArray result = promise->getArrayResult();
+    {
+        std::unique_lock<std::mutex> lock(p->mutex);
+        if (p->state != Impl::STATE_DONE)
+        {
+            p->promises.push_back(promise);
+            return result;
+        }
+    }
+    p->fulfill(*promise);
+    return result;
+}
+
+#else  // OPENCV_DISABLE_THREAD_SUPPORT
+
+// tasks are executed immediately
+
+AsyncTask submit(const TaskFunction& body, const std::vector<AsyncTask>& dependencies)
+{
+    CV_Assert(body);
+    std::shared_ptr<AsyncTask::Impl> task = std::make_shared<AsyncTask::Impl>(body);
+    for (size_t i = 0; i < dependencies.size(); i++)
+    {
+        const std::shared_ptr<AsyncTask::Impl>& dep = dependencies[i]._getImpl();
+        CV_Assert(dep && "invalid dependency");
+        CV_Assert(dep->state == AsyncTask::Impl::STATE_DONE);
+        task->storeException(*dep);
+    }
+    if (!task->has_exception)
+        task->execute();
+    task->state = AsyncTask::Impl::STATE_DONE;
+    task->body = TaskFunction();
+    return AsyncTask(task);
+}
+
+bool AsyncTask::isReady() const
+{
+    CV_Assert(p);
+    return true;
+}
+
+void AsyncTask::wait() const
+{
+    CV_Assert(p);
+}
+
+bool AsyncTask::wait_for(int64 /*timeoutNs*/) const
+{
+    CV_Assert(p);
+    return true;
+}
+
+AsyncArray AsyncTask::getArrayResult() const
+{
+    CV_Assert(p);
+    AsyncPromise promise;
+    AsyncArray result = promise.getArrayResult();
+    p->fulfill(promise);
+    return result;
+}
+
+#endif  // OPENCV_DISABLE_THREAD_SUPPORT
+
+AsyncTask::AsyncTask() CV_NOEXCEPT
+{
+    // nothing
+}
+
+AsyncTask::AsyncTask(const std::shared_ptr<Impl>& impl) CV_NOEXCEPT
+    : p(impl)
+{
+    // nothing
+}
+
+AsyncTask::~AsyncTask() CV_NOEXCEPT
+{
+    // nothing
+}
+
+bool AsyncTask::valid() const CV_NOEXCEPT
+{
+    return (bool)p;
+}
+
+void AsyncTask::get(OutputArray dst) const
+{
+    wait();
+    if (p->has_exception)
+        p->rethrow();
+    dst.assign(p->result);
+}
+
+void waitAll(const std::vector<AsyncTask>& tasks)
+{
+    for (size_t i = 0; i < tasks.size(); i++)
+        tasks[i].wait();
+}
+
+}}  // namespace
@@ -0,0 +1,412 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+#include "../precomp.hpp"
+#include "parallel.hpp"
+
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+
+#include "../parallel_impl.hpp"  // defaultNumberOfThreads()
+
+#include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/core/utils/logger.defines.hpp>
+#include <opencv2/core/utils/logger.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+//
+// Work-stealing parallel_for() backend
+//
+// Each worker owns a deque of tasks (ranges of stripes). The owner pushes/pops at the back (LIFO, cache-friendly),
+// idle threads steal from the front (FIFO, the largest not-yet-split ranges).
+// Ranges are split lazily in halves until the job grain size is reached.
+//
+// Blocked callers (external threads or workers with nested parallel_for() calls) never go idle while their own job
+// has unclaimed tasks: they help by executing tasks of *their* job only, so nested calls don't deadlock and
+// don't fall back to serial execution.
+//
+
+namespace cv { namespace parallel { namespace worksteal {
+
+static int WORKSTEAL_ACTIVE_WAIT = (int)utils::getConfigurationParameterSizeT("OPENCV_PARALLEL_WORKSTEAL_ACTIVE_WAIT", 2000);  // iterations
+static int WORKSTEAL_CHUNKS_PER_THREAD = (int)utils::getConfigurationParameterSizeT("OPENCV_PARALLEL_WORKSTEAL_CHUNKS_PER_THREAD", 4);
+
+struct Job
+{
+    Job(int tasks_, ParallelForAPI::FN_parallel_for_body_cb_t body_callback_, void* callback_data_, int grain_) :
+        body_callback(body_callback_),
+        callback_data(callback_data_),
+        grain(grain_),
+        pending(tasks_),
+        is_completed(false)
+    {
+        // nothing
+    }
+
+    const ParallelForAPI::FN_parallel_for_body_cb_t body_callback;
+    void* const callback_data;
+    const int grain;  // don't split ranges smaller than this
+
+    std::atomic<int> pending;  // number of not completed tasks (stripes)
+
+    std::mutex mutex;
+    std::condition_variable cond_completed;
+    bool is_completed;  // guarded by mutex
+};
+
+struct Task
+{
+    Job* job;
+    int begin;
+    int end;
+};
+
+class TaskQueue
+{
+public:
+    TaskQueue() : size_hint(0) {}
+
+    void push(const Task& task)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(task);
+        size_hint.store((int)tasks.size(), std::memory_order_release);
+    }
+
+    /** owner side (back) */
+    bool pop(Task& task, const Job* job = NULL)
+    {
+        if (size_hint.load(std::memory_order_acquire) == 0)
+            return false;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty() || (job && tasks.back().job != job))
+            return false;
+        task = tasks.back();
+        tasks.pop_back();
+        size_hint.store((int)tasks.size(), std::memory_order_release);
+        return true;
+    }
+
+    /** thief side (front) */
+    bool steal(Task& task)
+    {
+        if (size_hint.load(std::memory_order_acquire) == 0)
+            return false;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty())
+            return false;
+        task = tasks.front();
+        tasks.pop_front();
+        size_hint.store((int)tasks.size(), std::memory_order_release);
+        return true;
+    }
+
+    /** extract the oldest task of the specified job (used by threads which wait for job completion) */
+    bool take(const Job* job, Task& task)
+    {
+        if (size_hint.load(std::memory_order_acquire) == 0)
+            return false;
+        std::lock_guard<std::mutex> lock(mutex);
+        for (std::deque<Task>::iterator it = tasks.begin(); it != tasks.end(); ++it)
+        {
+            if (it->job == job)
+            {
+                task = *it;
+                tasks.erase(it);
+                size_hint.store((int)tasks.size(), std::memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+protected:
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    std::atomic<int> size_hint;  // lock-free emptiness pre-check
+    int64 dummy_[8];  // avoid cache-line sharing between queues
+};
+
+class ThreadPool;
+
+struct WorkerThread
+{
+    WorkerThread(ThreadPool& pool_, int id_) : pool(pool_), id(id_), seed((unsigned)id_ * 2654435761u + 1) {}
+
+    ThreadPool& pool;
+    const int id;
+    unsigned seed;  // victim selection
+    TaskQueue queue;
+    std::thread thread;
+};
+
+/** Currently executed worker (NULL for non-worker threads) */
+static thread_local WorkerThread* g_currentWorker = NULL;
+
+class ThreadPool
+{
+public:
+    explicit ThreadPool(int num_workers) :
+        stop_threads(false), epoch(0), sleepers(0)
+    {
+        CV_LOG_DEBUG(NULL, "core(parallel): worksteal: spawn " << num_workers << " worker threads");
+        workers.reserve(num_workers);
+        for (int i = 0; i < num_workers; i++)
+            workers.push_back(Ptr<WorkerThread>(new WorkerThread(*this, i)));
+        for (int i = 0; i < num_workers; i++)
+        {
+            WorkerThread* w = workers[i].get();
+            w->thread = std::thread([w]() { w->pool.thread_body(*w); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop_threads = true;
+            epoch.fetch_add(1, std::memory_order_seq_cst);
+        }
+        cond_wake.notify_all();
+        for (size_t i = 0; i < workers.size(); i++)
+        {
+            if (workers[i]->thread.joinable())
+                workers[i]->thread.join();
+        }
+    }
+
+    int size() const { return (int)workers.size(); }
+
+    void run(int tasks, ParallelForAPI::FN_parallel_for_body_cb_t body_callback, void* callback_data)
+    {
+        const int chunks = std::max(1, (size() + 1) * WORKSTEAL_CHUNKS_PER_THREAD);
+        Job job(tasks, body_callback, callback_data, std::max(1, tasks / chunks));
+        WorkerThread* self = (g_currentWorker && &g_currentWorker->pool == this) ? g_currentWorker : NULL;
+        execute(self, Task{&job, 0, tasks});
+        wait(self, job);
+    }
+
+    void thread_body(WorkerThread& self);
+
+protected:
+    void push(WorkerThread* self, const Task& task)
+    {
+        (self ? self->queue : injection_queue).push(task);
+        epoch.fetch_add(1, std::memory_order_seq_cst);
+        if (sleepers.load(std::memory_order_seq_cst) > 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);  // to avoid signal miss due pre-check
+            }
+            cond_wake.notify_one();
+        }
+    }
+
+    void execute(WorkerThread* self, Task task)
+    {
+        Job& job = *task.job;
+        while (task.end - task.begin > job.grain)
+        {
+            int middle = task.begin + (task.end - task.begin) / 2;
+            push(self, Task{&job, middle, task.end});
+            task.end = middle;
+        }
+        job.body_callback(task.begin, task.end, job.callback_data);
+        int done = task.end - task.begin;
+        if (job.pending.fetch_sub(done, std::memory_order_acq_rel) == done)
+        {
+            std::lock_guard<std::mutex> lock(job.mutex);
+            job.is_completed = true;
+            job.cond_completed.notify_all();
+        }
+    }
+
+    bool trySteal(WorkerThread* self, Task& task)
+    {
+        if (injection_queue.steal(task))
+            return true;
+        const int n = size();
+        if (n == 0)
+            return false;
+        int start = 0;
+        if (self)
+        {
+            self->seed = self->seed * 1664525u + 1013904223u;
+            start = (int)((self->seed >> 8) % (unsigned)n);
+        }
+        for (int i = 0; i < n; i++)
+        {
+            WorkerThread& victim = *workers[(start + i) % n];
+            if (&victim != self && victim.queue.steal(task))
+                return true;
+        }
+        return false;
+    }
+
+    bool tryTakeJobTask(WorkerThread* self, const Job& job, Task& task)
+    {
+        if (self && self->queue.pop(task, &job))  // own tasks of the job are always on the back
+            return true;
+        if (injection_queue.take(&job, task))
+            return true;
+        for (int i = 0; i < size(); i++)
+        {
+            WorkerThread& victim = *workers[i];
+            if (&victim != self && victim.queue.take(&job, task))
+                return true;
+        }
+        return false;
+    }
+
+    void wait(WorkerThread* self, Job& job)
+    {
+        int spin = 0;
+        while (job.pending.load(std::memory_order_acquire) > 0)
+        {
+            Task task;
+            if (tryTakeJobTask(self, job, task))
+            {
+                execute(self, task);
+                spin = 0;
+                continue;
+            }
+            if (spin++ >= WORKSTEAL_ACTIVE_WAIT)
+                break;  // remaining tasks are in progress by other threads
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lock(job.mutex);
+        while (!job.is_completed)
+            job.cond_completed.wait(lock);
+    }
+
+    std::vector< Ptr<WorkerThread> > workers;
+    TaskQueue injection_queue;  // tasks submitted by non-worker threads
+
+    std::mutex mutex;  // guards sleep/wake transitions
+    std::condition_variable cond_wake;
+    bool stop_threads;
+    std::atomic<unsigned> epoch;  // incremented on each new task
+    std::atomic<int> sleepers;
+};
+
+void ThreadPool::thread_body(WorkerThread& self)
+{
+    (void)cv::utils::getThreadID(); // notify OpenCV about new thread
+    g_currentWorker = &self;
+    int spin = 0;
+    for (;;)
+    {
+        unsigned current_epoch = epoch.load(std::memory_order_seq_cst);
+        Task task;
+        if (self.queue.pop(task) || trySteal(&self, task))
+        {
+            execute(&self, task);
+            spin = 0;
+            continue;
+        }
+        if (spin++ < WORKSTEAL_ACTIVE_WAIT)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        while (!stop_threads && epoch.load(std::memory_order_seq_cst) == current_epoch)
+            cond_wake.wait(lock);
+        sleepers.fetch_sub(1, std::memory_order_seq_cst);
+        if (stop_threads)
+            break;
+        spin = 0;
+    }
+    g_currentWorker = NULL;
+}
+
+
+class ParallelForBackend CV_FINAL : public ParallelForAPI
+{
+public:
+    ParallelForBackend() : numThreads((int)defaultNumberOfThreads()) {}
+
+    ~ParallelForBackend() CV_OVERRIDE {}
+
+    void parallel_for(int tasks, FN_parallel_for_body_cb_t body_callback, void* callback_data) CV_OVERRIDE
+    {
+        if (g_currentWorker)  // nested call: schedule on the pool of the calling worker
+        {
+            g_currentWorker->pool.run(tasks, body_callback, callback_data);
+            return;
+        }
+        std::shared_ptr<ThreadPool> threadPool = getPool();
+        if (!threadPool)
+        {
+            body_callback(0, tasks, callback_data);
+            return;
+        }
+        threadPool->run(tasks, body_callback, callback_data);
+    }
+
+    int getThreadNum() const CV_OVERRIDE
+    {
+        return g_currentWorker ? g_currentWorker->id + 1 : 0;
+    }
+
+    int getNumThreads() const CV_OVERRIDE
+    {
+        return numThreads;
+    }
+
+    int setNumThreads(int nThreads) CV_OVERRIDE
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        int oldNumThreads = numThreads;
+        numThreads = nThreads > 0 ? nThreads : (int)defaultNumberOfThreads();
+        if (pool && pool->size() != numThreads - 1)
+            pool.reset();  // workers are stopped after completion of in-progress jobs
+        return oldNumThreads;
+    }
+
+    const char* getName() const CV_OVERRIDE
+    {
+        return "worksteal";
+    }
+
+protected:
+    std::shared_ptr<ThreadPool> getPool()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!pool && numThreads > 1)
+            pool = std::make_shared<ThreadPool>(numThreads - 1);
+        return pool;
+    }
+
+    std::mutex mutex;  // guards pool and numThreads
+    std::shared_ptr<ThreadPool> pool;  // created lazily
+    int numThreads;
+};
+
+}  // namespace worksteal
+
+static
+std::shared_ptr<worksteal::ParallelForBackend>& getInstance()
+{
+    static std::shared_ptr<worksteal::ParallelForBackend> g_instance = std::make_shared<worksteal::ParallelForBackend>();
+    return g_instance;
+}
+
+std::shared_ptr<cv::parallel::ParallelForAPI> createParallelBackendWorkStealing()
+{
+    return getInstance();
+}
+
+bool isNestedParallelForSupported(const std::shared_ptr<ParallelForAPI>& api)
+{
+    return api && api.get() == getInstance().get();
+}
+
+}}  // namespace
+
+#endif  // OPENCV_DISABLE_THREAD_SUPPORT
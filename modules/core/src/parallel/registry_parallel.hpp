@@ -16,6 +16,8 @@ struct ParallelBackendInfo
                       // >10000 - prioritized list (OPENCV_PARALLEL_PRIORITY_LIST)
     std::string name;
     std::shared_ptr<IParallelBackendFactory> backendFactory;
+    bool explicitOnly;  // not selected automatically, requested by name only (OPENCV_PARALLEL_BACKEND, setParallelForBackend())
+                        // or through priority configuration
 };
 
 const std::vector<ParallelBackendInfo>& getParallelBackendsInfo();
@@ -13,16 +13,18 @@ namespace cv { namespace parallel {
 #if OPENCV_HAVE_FILESYSTEM_SUPPORT && defined(PARALLEL_ENABLE_PLUGINS)
 #define DECLARE_DYNAMIC_BACKEND(name) \
 ParallelBackendInfo { \
-    1000, name, createPluginParallelBackendFactory(name) \
+    1000, name, createPluginParallelBackendFactory(name), false \
 },
 #else
 #define DECLARE_DYNAMIC_BACKEND(name) /* nothing */
 #endif
 
-#define DECLARE_STATIC_BACKEND(name, createBackendAPI) \
+#define DECLARE_STATIC_BACKEND_(name, createBackendAPI, explicitOnly) \
 ParallelBackendInfo { \
-    1000, name, std::make_shared<cv::parallel::StaticBackendFactory>([=] () -> std::shared_ptr<cv::parallel::ParallelForAPI> { return createBackendAPI(); }) \
+    1000, name, std::make_shared<cv::parallel::StaticBackendFactory>([=] () -> std::shared_ptr<cv::parallel::ParallelForAPI> { return createBackendAPI(); }), explicitOnly \
 },
+#define DECLARE_STATIC_BACKEND(name, createBackendAPI) DECLARE_STATIC_BACKEND_(name, createBackendAPI, false)
+#define DECLARE_STATIC_BACKEND_EXPLICIT(name, createBackendAPI) DECLARE_STATIC_BACKEND_(name, createBackendAPI, true)
 
 static
 std::vector<ParallelBackendInfo>& getBuiltinParallelBackendsInfo()
@@ -41,6 +43,10 @@ std::vector<ParallelBackendInfo>& getBuiltinParallelBackendsInfo()
 #elif defined(PARALLEL_ENABLE_PLUGINS)
         DECLARE_DYNAMIC_BACKEND("OPENMP")  // TODO Intel OpenMP?
 #endif
+
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+        DECLARE_STATIC_BACKEND_EXPLICIT("WORKSTEAL", createParallelBackendWorkStealing)  // builtin, replaces legacy pthreads code on request only
+#endif
     };
     return g_backends;
 }
@@ -82,6 +88,8 @@ protected:
             CV_Assert(param_priority == (size_t)(int)param_priority); // overflow check
             if (param_priority > 0)
             {
+                if (info.explicitOnly && param_priority != (size_t)info.priority)
+                    info.explicitOnly = false;  // configured by user
                 info.priority = (int)param_priority;
                 enabled++;
             }
@@ -127,6 +135,7 @@ protected:
                 if (name == info.name)
                 {
                     info.priority = priority;
+                    info.explicitOnly = false;
                     CV_LOG_DEBUG(NULL, "core(parallel): New backend priority: '" << name << "' => " << info.priority);
                     found = true;
                     hasChanges = true;
@@ -136,7 +145,7 @@ protected:
             if (!found)
             {
                 CV_LOG_INFO(NULL, "core(parallel): Adding parallel backend (plugin): '" << name << "'");
-                enabledBackends.push_back(ParallelBackendInfo{priority, name, createPluginParallelBackendFactory(name)});
+                enabledBackends.push_back(ParallelBackendInfo{priority, name, createPluginParallelBackendFactory(name), false});
                 hasChanges = true;
             }
         }
@@ -150,7 +159,7 @@ public:
         {
             if (i > 0) os << "; ";
             const ParallelBackendInfo& info = enabledBackends[i];
-            os << info.name << '(' << info.priority << ')';
+            os << info.name << '(' << info.priority << (info.explicitOnly ? ", explicit" : "") << ')';
         }
         return os.str();
     }
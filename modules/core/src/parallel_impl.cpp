@@ -18,6 +18,9 @@
 
 #include <opencv2/core/utils/trace.private.hpp>
 
+#include <opencv2/core/utils/numa.hpp>
+#include <opencv2/core/parallel/parallel_metrics.hpp>
+
 //#define CV_PROFILE_THREADS 64
 //#define getTickCount getCPUTickCount  // use this if getTickCount() calls are expensive (and getCPUTickCount() is accurate)
 
@@ -106,10 +109,16 @@ public:
     }
     bool reconfigure_(unsigned new_threads_count); // internal implementation
 
-    void run(const Range& range, const ParallelLoopBody& body, double nstripes);
+    /** NUMA node of each worker (proportional to number of available CPUs of nodes), -1 if NUMA mode is not active */
+    static std::vector<int> getWorkerNodes(unsigned workers_count);
+
+    void run(const Range& range, const ParallelLoopBody& body, double nstripes, parallel::ParallelForMetrics* metrics);
 
     size_t getNumOfThreads();
 
+    /** fills parallel_for_() metrics of the completed job */
+    void fillMetrics(parallel::ParallelForMetrics& metrics, const ParallelJob& j, int64 wall_ticks, int64 active_wait_ticks, int64 sleep_ticks);
+
     void setNumOfThreads(unsigned n);
 
     ThreadPool();
@@ -197,6 +206,7 @@ class WorkerThread
 public:
     ThreadPool& thread_pool;
     const unsigned id;
+    const int numa_node;  // -1 if NUMA mode is not active
     pthread_t posix_thread;
     bool is_created;
 
@@ -212,9 +222,10 @@ public:
     pthread_cond_t cond_thread_wake;
 #endif
 
-    WorkerThread(ThreadPool& thread_pool_, unsigned id_) :
+    WorkerThread(ThreadPool& thread_pool_, unsigned id_, int numa_node_) :
         thread_pool(thread_pool_),
         id(id_),
+        numa_node(numa_node_),
         posix_thread(0),
         is_created(false),
         stop_thread(false),
@@ -223,7 +234,7 @@ public:
         , isActive(true)
 #endif
     {
-        CV_LOG_VERBOSE(NULL, 1, "MainThread: initializing new worker: " << id);
+        CV_LOG_VERBOSE(NULL, 1, "MainThread: initializing new worker: " << id << " (NUMA node: " << numa_node << ")");
         int res = pthread_mutex_init(&mutex, NULL);
         if (res != 0)
         {
@@ -287,54 +298,64 @@ public:
 class ParallelJob
 {
 public:
-    ParallelJob(const ThreadPool& thread_pool_, const Range& range_, const ParallelLoopBody& body_, int nstripes_) :
-        thread_pool(thread_pool_),
-        body(body_),
-        range(range_),
-        nstripes((unsigned)nstripes_),
-        is_completed(false)
-    {
-        CV_LOG_VERBOSE(NULL, 5, "ParallelJob::ParallelJob(" << (void*)this << ")");
-        current_task.store(0, std::memory_order_relaxed);
-        active_thread_count.store(0, std::memory_order_relaxed);
-        completed_thread_count.store(0, std::memory_order_relaxed);
-        dummy0_[0] = 0, dummy1_[0] = 0, dummy2_[0] = 0; // compiler warning
-    }
+    ParallelJob(const ThreadPool& thread_pool_, const Range& range_, const ParallelLoopBody& body_, int nstripes_, int main_thread_node, bool collect_metrics_);
 
     ~ParallelJob()
     {
         CV_LOG_VERBOSE(NULL, 5, "ParallelJob::~ParallelJob(" << (void*)this << ")");
     }
 
-    unsigned execute(bool is_worker_thread)
+    /** Range part processed by threads of the same NUMA node (single part if NUMA mode is not active) */
+    struct Part
+    {
+        Part() : end(0), remaining_multiplier(1) { current_task.store(0, std::memory_order_relaxed); dummy_[0] = 0; }
+
+        std::atomic<int> current_task;  // next free part of job
+        int end;
+        int remaining_multiplier;
+        int64 dummy_[8];  // avoid cache-line reusing for the same atomics
+    };
+
+    bool hasFreeTasks() const
+    {
+        for (size_t i = 0; i < parts.size(); i++)
+        {
+            if (parts[i].current_task < parts[i].end)
+                return true;
+        }
+        return false;
+    }
+
+    unsigned execute(bool is_worker_thread, int numa_node)
     {
         unsigned executed_tasks = 0;
-        const int task_count = range.size();
-        const int remaining_multiplier = std::min(nstripes,
-                std::max(
-                        std::min(100u, thread_pool.num_threads * 4),
-                        thread_pool.num_threads * 2
-                ));  // experimental value
-        for (;;)
+        const int nparts = (int)parts.size();
+        for (int p = 0; p < nparts; p++)  // own part first, then help other nodes
         {
-            int chunk_size = std::max(1, (task_count - current_task) / remaining_multiplier);
-            int id = current_task.fetch_add(chunk_size, std::memory_order_seq_cst);
-            if (id >= task_count)
-                break; // no more free tasks
+            Part& part = parts[(numa_node + p) % nparts];
+            const int task_count = part.end;
+            const int remaining_multiplier = part.remaining_multiplier;
+            for (;;)
+            {
+                int chunk_size = std::max(1, (task_count - part.current_task) / remaining_multiplier);
+                int id = part.current_task.fetch_add(chunk_size, std::memory_order_seq_cst);
+                if (id >= task_count)
+                    break; // no more free tasks
 
-            executed_tasks += chunk_size;
-            int start_id = id;
-            int end_id = std::min(task_count, id + chunk_size);
-            CV_LOG_VERBOSE(NULL, 9, "Thread: job " << start_id << "-" << end_id);
+                executed_tasks += chunk_size;
+                int start_id = id;
+                int end_id = std::min(task_count, id + chunk_size);
+                CV_LOG_VERBOSE(NULL, 9, "Thread: job " << start_id << "-" << end_id);
 
-            //TODO: if (not pending exception)
-            {
-                body.operator()(Range(range.start + start_id, range.start + end_id));
-            }
-            if (is_worker_thread && is_completed)
-            {
-                CV_LOG_ERROR(NULL, "\t\t\t\tBUG! Job: " << (void*)this << " " << id << " " << active_thread_count << " " << completed_thread_count);
-                CV_Assert(!is_completed); // TODO Dbg this
+                //TODO: if (not pending exception)
+                {
+                    body.operator()(Range(range.start + start_id, range.start + end_id));
+                }
+                if (is_worker_thread && is_completed)
+                {
+                    CV_LOG_ERROR(NULL, "\t\t\t\tBUG! Job: " << (void*)this << " " << id << " " << active_thread_count << " " << completed_thread_count);
+                    CV_Assert(!is_completed); // TODO Dbg this
+                }
             }
         }
         return executed_tasks;
@@ -345,8 +366,7 @@ public:
     const Range range;
     const unsigned nstripes;
 
-    std::atomic<int> current_task;  // next free part of job
-    int64 dummy0_[8];  // avoid cache-line reusing for the same atomics
+    std::vector<Part> parts;
 
     std::atomic<int> active_thread_count;  // number of threads worked on this job
     int64 dummy1_[8];  // avoid cache-line reusing for the same atomics
@@ -356,10 +376,113 @@ public:
 
     std::atomic<bool> is_completed;
 
+    // scheduling metrics (see parallel_metrics.hpp)
+    const bool collect_metrics;
+    std::unique_ptr< std::atomic<int64>[] > thread_busy_ticks;  // [0] - main thread, [1..N] - workers; -1 if thread has no processed stripes
+    std::atomic<int> workers_woken_active;
+    std::atomic<int> workers_woken_sleeping;
+
+    void storeBusyTicks(int slot, int64 ticks)
+    {
+        if (collect_metrics)
+            thread_busy_ticks[slot].store(ticks, std::memory_order_relaxed);
+    }
+
     // TODO exception handling
 };
 
 
+ParallelJob::ParallelJob(const ThreadPool& thread_pool_, const Range& range_, const ParallelLoopBody& body_, int nstripes_, int main_thread_node, bool collect_metrics_) :
+    thread_pool(thread_pool_),
+    body(body_),
+    range(range_),
+    nstripes((unsigned)nstripes_),
+    parts(utils::numa::getNumberOfNodes()),
+    is_completed(false),
+    collect_metrics(collect_metrics_)
+{
+    CV_LOG_VERBOSE(NULL, 5, "ParallelJob::ParallelJob(" << (void*)this << ")");
+    const int nparts = (int)parts.size();
+    std::vector<unsigned> part_threads(nparts, 0);
+    if (nparts == 1)
+    {
+        part_threads[0] = thread_pool.num_threads;
+    }
+    else
+    {
+        part_threads[main_thread_node]++;
+        for (size_t i = 0; i < thread_pool.threads.size(); i++)
+        {
+            int node = thread_pool.threads[i]->numa_node;
+            if (node >= 0 && node < nparts)
+                part_threads[node]++;
+        }
+    }
+    unsigned total_threads = 0;
+    for (int p = 0; p < nparts; p++)
+        total_threads += part_threads[p];
+    total_threads = std::max(1u, total_threads);
+
+    // split range proportionally to the number of threads of each node
+    const int task_count = range.size();
+    int start = 0;
+    unsigned threads_acc = 0;
+    for (int p = 0; p < nparts; p++)
+    {
+        threads_acc += part_threads[p];
+        const unsigned num_threads = std::max(1u, part_threads[p]);
+        Part& part = parts[p];
+        part.current_task.store(start, std::memory_order_relaxed);
+        part.end = (p == nparts - 1) ? task_count : (int)((int64)task_count * threads_acc / total_threads);
+        part.remaining_multiplier = std::max(1, (int)std::min(nstripes,
+                std::max(
+                        std::min(100u, num_threads * 4),
+                        num_threads * 2
+                )));  // experimental value
+        start = part.end;
+    }
+
+    active_thread_count.store(0, std::memory_order_relaxed);
+    completed_thread_count.store(0, std::memory_order_relaxed);
+    dummy1_[0] = 0, dummy2_[0] = 0; // compiler warning
+
+    workers_woken_active.store(0, std::memory_order_relaxed);
+    workers_woken_sleeping.store(0, std::memory_order_relaxed);
+    if (collect_metrics)
+    {
+        const size_t slots = thread_pool.threads.size() + 1;
+        thread_busy_ticks.reset(new std::atomic<int64>[slots]);
+        for (size_t i = 0; i < slots; i++)
+            thread_busy_ticks[i].store(-1, std::memory_order_relaxed);
+    }
+}
+
+std::vector<int> ThreadPool::getWorkerNodes(unsigned workers_count)
+{
+    std::vector<int> nodes(workers_count, -1);
+    if (!utils::numa::isEnabled())
+        return nodes;
+    const int nnodes = utils::numa::getNumberOfNodes();
+    std::vector<int64> cpus_acc(nnodes, 0);
+    int64 total_cpus = 0;
+    for (int k = 0; k < nnodes; k++)
+    {
+        total_cpus += utils::numa::getNodeCPUsCount(k);
+        cpus_acc[k] = total_cpus;
+    }
+    for (unsigned i = 0; i < workers_count; i++)
+    {
+        // center of worker's slot in CPUs list: (i + 0.5) * total_cpus / workers_count
+        const int64 pos = ((int64)2 * i + 1) * total_cpus;
+        int k = 0;
+        while (k < nnodes - 1 && pos >= (int64)2 * workers_count * cpus_acc[k])
+            k++;
+        nodes[i] = k;
+    }
+    return nodes;
+}
+
+
 // Disable thread sanitization check when CV_USE_GLOBAL_WORKERS_COND_VAR is not
 // set because it triggers as the main thread reads isActive while the children
 // thread writes it (but it all works out because a mutex is locked in the main
@@ -375,6 +498,9 @@ void WorkerThread::thread_body()
     (void)cv::utils::getThreadID(); // notify OpenCV about new thread
     CV_LOG_VERBOSE(NULL, 5, "Thread: new thread: " << id);
 
+    if (numa_node >= 0)
+        utils::numa::bindCurrentThreadToNode(numa_node);
+
     bool allow_active_wait = true;
 
 #ifdef CV_PROFILE_THREADS
@@ -401,6 +527,7 @@ void WorkerThread::thread_body()
 #ifdef CV_PROFILE_THREADS
         stat.threadWait = getTickCount();
 #endif
+        const bool was_sleeping = !has_wake_signal;
         while (!has_wake_signal) // to handle spurious wakeups
         {
             //CV_LOG_VERBOSE(NULL, 5, "Thread: wait (sleep) ...");
@@ -429,17 +556,23 @@ void WorkerThread::thread_body()
             ParallelJob* j = j_ptr;
             if (j)
             {
-                CV_LOG_VERBOSE(NULL, 5, "Thread: job size=" << j->range.size() << " done=" << j->current_task);
-                if (j->current_task < j->range.size())
+                CV_LOG_VERBOSE(NULL, 5, "Thread: job size=" << j->range.size());
+                if (j->collect_metrics)
+                    (was_sleeping ? j->workers_woken_sleeping : j->workers_woken_active).fetch_add(1, std::memory_order_relaxed);
+                if (j->hasFreeTasks())
                 {
                     int other = j->active_thread_count.fetch_add(1, std::memory_order_seq_cst);
                     CV_LOG_VERBOSE(NULL, 5, "Thread: processing new job (with " << other << " other threads)"); CV_UNUSED(other);
 #ifdef CV_PROFILE_THREADS
                     stat.threadExecuteStart = getTickCount();
-                    stat.executedTasks = j->execute(true);
+#endif
+                    const int64 execute_start = j->collect_metrics ? getTickCount() : 0;
+                    unsigned executed_tasks = j->execute(true, std::max(0, numa_node));
+                    if (executed_tasks > 0)
+                        j->storeBusyTicks(id + 1, getTickCount() - execute_start);
+#ifdef CV_PROFILE_THREADS
+                    stat.executedTasks = executed_tasks;
                     stat.threadExecuteStop = getTickCount();
-#else
-                    j->execute(true);
 #endif
                     int completed = j->completed_thread_count.fetch_add(1, std::memory_order_seq_cst) + 1;
                     int active = j->active_thread_count.load(std::memory_order_acquire);
@@ -504,6 +637,13 @@ bool ThreadPool::reconfigure_(unsigned new_threads_count)
     if (new_threads_count == threads.size())
         return false;
 
+    if (utils::numa::isEnabled() && !threads.empty() && new_threads_count > 0)
+    {
+        // distribution of workers between nodes depends on the total number of workers
+        CV_LOG_VERBOSE(NULL, 1, "MainThread: re-create NUMA worker pool: " << threads.size() << " => " << new_threads_count);
+        reconfigure_(0);
+    }
+
     if (new_threads_count < threads.size())
     {
         CV_LOG_VERBOSE(NULL, 1, "MainThread: reduce worker pool: " << threads.size() << " => " << new_threads_count);
@@ -532,9 +672,10 @@ bool ThreadPool::reconfigure_(unsigned new_threads_count)
     else
     {
         CV_LOG_VERBOSE(NULL, 1, "MainThread: upgrade worker pool: " << threads.size() << " => " << new_threads_count);
+        std::vector<int> nodes = getWorkerNodes(new_threads_count);
         for (size_t i = threads.size(); i < new_threads_count; ++i)
         {
-            threads.push_back(Ptr<WorkerThread>(new WorkerThread(*this, (unsigned)i))); // spawn more threads
+            threads.push_back(Ptr<WorkerThread>(new WorkerThread(*this, (unsigned)i, nodes[i]))); // spawn more threads
         }
     }
     return false;
@@ -551,7 +692,7 @@ ThreadPool::~ThreadPool()
     pthread_mutex_destroy(&mutex_notify);
 }
 
-void ThreadPool::run(const Range& range, const ParallelLoopBody& body, double nstripes)
+void ThreadPool::run(const Range& range, const ParallelLoopBody& body, double nstripes, parallel::ParallelForMetrics* metrics)
 {
     CV_LOG_VERBOSE(NULL, 1, "MainThread: new parallel job: num_threads=" << num_threads << "   range=" << range.size() << "   nstripes=" << nstripes << "   job=" << (void*)job);
 #ifdef CV_PROFILE_THREADS
@@ -576,14 +717,16 @@ void ThreadPool::run(const Range& range, const ParallelLoopBody& body, double ns
 
         {
             CV_LOG_VERBOSE(NULL, 1, "MainThread: initialize parallel job: " << range.size());
-            job = Ptr<ParallelJob>(new ParallelJob(*this, range, body, nstripes));
+            const int64 submit_ticks = metrics ? getTickCount() : 0;
+            int64 active_wait_ticks = 0, sleep_ticks = 0;
+            job = Ptr<ParallelJob>(new ParallelJob(*this, range, body, nstripes, utils::numa::getCurrentNode(), metrics != NULL));
             pthread_mutex_unlock(&mutex);
 
             CV_LOG_VERBOSE(NULL, 5, "MainThread: wake worker threads...");
             size_t num_threads_to_wake = std::min(static_cast<size_t>(range.size()), threads.size());
             for (size_t i = 0; i < num_threads_to_wake; ++i)
             {
-                if (job->current_task >= job->range.size())
+                if (!job->hasFreeTasks())
                     break;
                 WorkerThread& thread = *(threads[i].get());
                 if (
@@ -644,12 +787,16 @@ void ThreadPool::run(const Range& range, const ParallelLoopBody& body, double ns
                 ParallelJob& j = *(this->job);
 #ifdef CV_PROFILE_THREADS
                 threads_stat[0].threadExecuteStart = getTickCount();
-                threads_stat[0].executedTasks = j.execute(false);
+#endif
+                const int64 execute_start = metrics ? getTickCount() : 0;
+                unsigned executed_tasks = j.execute(false, utils::numa::getCurrentNode());
+                if (executed_tasks > 0)
+                    j.storeBusyTicks(0, getTickCount() - execute_start);
+#ifdef CV_PROFILE_THREADS
+                threads_stat[0].executedTasks = executed_tasks;
                 threads_stat[0].threadExecuteStop = getTickCount();
-#else
-                j.execute(false);
 #endif
-                CV_Assert(j.current_task >= j.range.size());
+                CV_Assert(!j.hasFreeTasks());
                 CV_LOG_VERBOSE(NULL, 5, "MainThread: complete self-tasks: " << j.active_thread_count << " " << j.completed_thread_count);
                 if (job->is_completed || j.active_thread_count == 0)
                 {
@@ -658,6 +805,7 @@ void ThreadPool::run(const Range& range, const ParallelLoopBody& body, double ns
                 }
                 else
                 {
+                    const int64 wait_start = metrics ? getTickCount() : 0;
                     if (CV_MAIN_THREAD_ACTIVE_WAIT > 0)
                     {
                         for (int i = 0; i < CV_MAIN_THREAD_ACTIVE_WAIT; i++)  // don't spin too much in any case (inaccurate getTickCount())
@@ -673,6 +821,9 @@ void ThreadPool::run(const Range& range, const ParallelLoopBody& body, double ns
                                 CV_YIELD();
                         }
                     }
+                    const int64 sleep_start = metrics ? getTickCount() : 0;
+                    if (metrics)
+                        active_wait_ticks = sleep_start - wait_start;
                     if (!job->is_completed)
                     {
                         CV_LOG_VERBOSE(NULL, 5, "MainThread: prepare wait " << j.active_thread_count << " " << j.completed_thread_count);
@@ -689,9 +840,13 @@ void ThreadPool::run(const Range& range, const ParallelLoopBody& body, double ns
                             CV_LOG_VERBOSE(NULL, 5, "MainThread: wake");
                         }
                         pthread_mutex_unlock(&mutex_notify);
+                        if (metrics)
+                            sleep_ticks = getTickCount() - sleep_start;
                     }
                 }
             }
+            if (metrics)
+                fillMetrics(*metrics, *job, getTickCount() - submit_ticks, active_wait_ticks, sleep_ticks);
 #ifdef CV_PROFILE_THREADS
             threads_stat[0].threadFree = getTickCount();
             std::cout << "Job: sz=" << range.size() << " nstripes=" << nstripes << "    Time: " << (threads_stat[0].threadFree - jobSubmitTime) / tickFreq * 1e6 << " usec" << std::endl;
@@ -716,6 +871,35 @@ void ThreadPool::run(const Range& range, const ParallelLoopBody& body, double ns
     }
 }
 
+void ThreadPool::fillMetrics(parallel::ParallelForMetrics& metrics, const ParallelJob& j, int64 wall_ticks, int64 active_wait_ticks, int64 sleep_ticks)
+{
+    const double tick_time = 1.0 / getTickFrequency();
+    const size_t slots = threads.size() + 1;
+    metrics.stripes = j.range.size();
+    metrics.wallTime = wall_ticks * tick_time;
+    metrics.activeWaitTime = active_wait_ticks * tick_time;
+    metrics.sleepTime = sleep_ticks * tick_time;
+    metrics.workersWokenActive = j.workers_woken_active.load(std::memory_order_relaxed);
+    metrics.workersWokenSleeping = j.workers_woken_sleeping.load(std::memory_order_relaxed);
+    metrics.busyTime.assign(slots, 0.0);
+    metrics.idleTime.assign(slots, 0.0);
+    metrics.threads = 0;
+    double busy_sum = 0, busy_max = 0;
+    for (size_t i = 0; i < slots; i++)
+    {
+        int64 ticks = j.thread_busy_ticks[i].load(std::memory_order_relaxed);
+        if (ticks < 0)
+            continue;  // thread has not processed any stripe
+        const double busy = ticks * tick_time;
+        metrics.busyTime[i] = busy;
+        metrics.idleTime[i] = std::max(0.0, metrics.wallTime - busy);
+        metrics.threads++;
+        busy_sum += busy;
+        busy_max = std::max(busy_max, busy);
+    }
+    metrics.stragglerRatio = busy_sum > 0 ? busy_max * metrics.threads / busy_sum : 1.0;
+}
+
 size_t ThreadPool::getNumOfThreads()
 {
     return num_threads;
@@ -748,9 +932,9 @@ void parallel_pthreads_set_threads_num(int num)
     }
 }
 
-void parallel_for_pthreads(const Range& range, const ParallelLoopBody& body, double nstripes)
+void parallel_for_pthreads(const Range& range, const ParallelLoopBody& body, double nstripes, parallel::ParallelForMetrics* metrics)
 {
-    ThreadPool::instance().run(range, body, nstripes);
+    ThreadPool::instance().run(range, body, nstripes, metrics);
 }
 
 }
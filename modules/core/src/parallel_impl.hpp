@@ -8,10 +8,18 @@ namespace cv {
 
 unsigned defaultNumberOfThreads();
 
-void parallel_for_pthreads(const Range& range, const ParallelLoopBody& body, double nstripes);
+namespace parallel { struct ParallelForMetrics; }
+
+/** @param metrics optional output: scheduling metrics (untouched if job is executed serially) */
+void parallel_for_pthreads(const Range& range, const ParallelLoopBody& body, double nstripes, parallel::ParallelForMetrics* metrics = NULL);
 size_t parallel_pthreads_get_threads_num();
 void parallel_pthreads_set_threads_num(int num);
 
+namespace utils { namespace numa {
+int getNodeCPUsCount(int node);  // number of available CPUs of the node
+bool bindCurrentThreadToNode(int node);  // set CPU affinity of the calling thread
+}}
+
 }
 
 #endif // OPENCV_CORE_PARALLEL_IMPL_HPP
@@ -441,6 +441,8 @@ void FileStorage::Impl::release(String *out) {
                 puts("</opencv_storage>\n");
             else if (fmt == FileStorage::FORMAT_JSON)
                 puts("}\n");
+            else if (fmt == FileStorage::FORMAT_BINARY)
+                finalizeBinaryStorage(this);
         }
         if (mem_mode && out) {
             *out = cv::String(outbuf.begin(), outbuf.end());
@@ -524,7 +526,20 @@ bool FileStorage::Impl::open(const char *filename_or_buf, int _flags, const char
                 dot_pos[3] = '\0', fnamelen--;
         }
 
-        if (!isGZ) {
+        bool isBinary = write_mode && ((flags & FileStorage::FORMAT_MASK) == FileStorage::FORMAT_BINARY ||
+                ((flags & FileStorage::FORMAT_MASK) == FileStorage::FORMAT_AUTO && isBinaryFileName(filename)));
+        if (isBinary) {
+            if (isGZ || append)
+                CV_Error(cv::Error::StsNotImplemented, "Compression and appending are not supported by binary file storage");
+            // don't truncate the existing file: matrices which are mapped from it stay valid
+            remove(filename.c_str());
+            file = fopen(filename.c_str(), "w+b");
+            if (!file)
+            {
+                CV_LOG_ERROR(NULL, "Can't open file: '" << filename << "' in write mode");
+                return false;
+            }
+        } else if (!isGZ) {
             file = fopen(filename.c_str(), !write_mode ? "rt" : !append ? "wt" : "a+t");
             if (!file)
             {
@@ -576,11 +591,18 @@ bool FileStorage::Impl::open(const char *filename_or_buf, int _flags, const char
                   ? FileStorage::FORMAT_XML
                   : (fs::strcasecmp(dot_pos, ".json") == 0 || fs::strcasecmp(dot_pos, ".json.gz") == 0)
                     ? FileStorage::FORMAT_JSON
-                    : FileStorage::FORMAT_YAML;
+                    : fs::strcasecmp(dot_pos, ".cvbin") == 0
+                      ? FileStorage::FORMAT_BINARY
+                      : FileStorage::FORMAT_YAML;
         } else if (fmt == FileStorage::FORMAT_AUTO) {
             fmt = FileStorage::FORMAT_XML;
         }
 
+        if (fmt == FileStorage::FORMAT_BINARY && (mem_mode || !file)) {
+            release();
+            CV_Error(cv::Error::StsNotImplemented, "Binary file storage supports regular files only");
+        }
+
         // we use factor=6 for XML (the longest characters (' and ") are encoded with 6 bytes (&apos; and &quot;)
         // and factor=4 for YAML ( as we use 4 bytes for non ASCII characters (e.g. \xAB))
         int buf_size = CV_FS_MAX_LEN * (fmt == FileStorage::FORMAT_XML ? 6 : 4) + 1024;
@@ -597,7 +619,7 @@ bool FileStorage::Impl::open(const char *filename_or_buf, int _flags, const char
         buffer.reserve(buf_size + 1024);
         buffer.resize(buf_size);
         bufofs = 0;
-        is_using_base64 = write_base64;
+        is_using_base64 = write_base64 && fmt != FileStorage::FORMAT_BINARY;
         state_of_writing_base64 = FileStorage_API::Base64State::Uncertain;
 
         if (fmt == FileStorage::FORMAT_XML) {
@@ -660,6 +682,8 @@ bool FileStorage::Impl::open(const char *filename_or_buf, int _flags, const char
                 puts("...\n---\n");
 
             emitter_do_not_use_direct_dereference = createYAMLEmitter(this);
+        } else if (fmt == FileStorage::FORMAT_BINARY) {
+            emitter_do_not_use_direct_dereference = createBinaryEmitter(this);
         } else {
             CV_Assert(fmt == FileStorage::FORMAT_JSON);
             if (!append)
@@ -703,6 +727,7 @@ bool FileStorage::Impl::open(const char *filename_or_buf, int _flags, const char
         const char *yaml_signature = "%YAML";
         const char *json_signature = "{";
         const char *xml_signature = "<?xml";
+        const char *binary_signature = "\x89OCVBIN";
         char *buf = this->gets(16);
         CV_Assert(buf);
         char *bufPtr = cv_skip_BOM(buf);
@@ -714,6 +739,8 @@ bool FileStorage::Impl::open(const char *filename_or_buf, int _flags, const char
             fmt = FileStorage::FORMAT_JSON;
         else if (strncmp(bufPtr, xml_signature, strlen(xml_signature)) == 0)
             fmt = FileStorage::FORMAT_XML;
+        else if (strncmp(bufPtr, binary_signature, strlen(binary_signature)) == 0 && !mem_mode && file)
+            fmt = FileStorage::FORMAT_BINARY;
         else if (strbufsize == bufOffset)
             CV_Error(cv::Error::StsBadArg, "Input file is invalid");
         else
@@ -745,6 +772,9 @@ bool FileStorage::Impl::open(const char *filename_or_buf, int _flags, const char
                 case FileStorage::FORMAT_JSON:
                     parser_do_not_use_direct_dereference = createJSONParser(this);
                     break;
+                case FileStorage::FORMAT_BINARY:
+                    parser_do_not_use_direct_dereference = createBinaryParser(this);
+                    break;
                 default:
                     parser_do_not_use_direct_dereference = Ptr<FileStorageParser>();
             }
@@ -1069,6 +1099,11 @@ void FileStorage::Impl::write(const String &key, const String &value) {
 void FileStorage::Impl::writeRawData(const std::string &dt, const void *_data, size_t len) {
     CV_Assert(write_mode);
 
+    if (fmt == FileStorage::FORMAT_BINARY) {
+        writeBinaryRawData(this, dt, _data, len);
+        return;
+    }
+
     if (is_using_base64 || state_of_writing_base64 == FileStorage_API::Base64State::InUse) {
         writeRawDataBase64(_data, len, dt.c_str());
         return;
@@ -2527,7 +2562,16 @@ FileNodeIterator& FileNodeIterator::operator ++ ()
         return *this;
     idx++;
     FileNode n(fs, blockIdx, ofs);
-    ofs += n.rawSize();
+    const uchar* p = n.ptr();
+    if( *p == CV_FS_BINARY_BLOB_TAG )
+    {
+        // all elements of the sequence are stored in the blob
+        if( idx < nodeNElems )
+            return *this;
+        ofs += getBinaryBlobRefSize(p);
+    }
+    else
+        ofs += n.rawSize();
     if( ofs >= blockSize )
     {
         fs->normalizeNodeOfs(blockIdx, ofs);
@@ -2553,7 +2597,19 @@ FileNodeIterator& FileNodeIterator::operator += (int _ofs)
 
 FileNodeIterator& FileNodeIterator::readRaw( const String& fmt, void* _data0, size_t maxsz)
 {
-    if( fs && idx < nodeNElems )
+    if( fs && idx < nodeNElems && *fs->getNodePtr(blockIdx, ofs) == CV_FS_BINARY_BLOB_TAG )
+    {
+        const uchar* ref = fs->getNodePtr(blockIdx, ofs);
+        size_t count = readBinaryBlob(fs, ref, idx, nodeNElems, fmt, (uchar*)_data0, maxsz);
+        idx += count;
+        if( count > 0 && idx == nodeNElems )
+        {
+            ofs += getBinaryBlobRefSize(ref);
+            fs->normalizeNodeOfs(blockIdx, ofs);
+            blockSize = fs->fs_data_blksz[blockIdx];
+        }
+    }
+    else if( fs && idx < nodeNElems )
     {
         uchar* data0 = (uchar*)_data0;
         int fmt_pairs[CV_FS_MAX_FMT_PAIRS*2];
@@ -95,6 +95,9 @@ CV_DEPRECATED char* encodeFormat( int elem_type, char* dt );
 char* encodeFormat( int elem_type, char* dt, size_t dt_len );
 int decodeFormat( const char* dt, int* fmt_pairs, int max_len );
 int decodeSimpleFormat( const char* dt );
+
+// zero-copy reading of raw data stored in binary storage, returns false if the node data can't be mapped
+bool mapBinaryBlob( const FileNode& node, int type, int dims, const int* sizes, Mat& m );
 }
 
 
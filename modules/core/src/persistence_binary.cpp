@@ -0,0 +1,699 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+#include "precomp.hpp"
+#include "persistence_impl.hpp"
+#include "opencv2/core/utils/filesystem.private.hpp"
+
+//
+// Binary storage format
+//
+// File layout (integer fields are little-endian):
+// - header (64 bytes): signature "\x89OCVBIN\n", version, header size, offset and sizes of the index
+// - raw data blobs, each blob starts at 64-byte aligned file offset
+// - index: string table (names of nodes) followed by the tree of file nodes
+//
+// The index keeps in-memory representation of FileNode tree (see FileStorage::Impl::addNode()),
+// so it is loaded without parsing. Sequences written by FileStorage::writeRaw() refer to the blobs
+// (see CV_FS_BINARY_BLOB_TAG), matrices are mapped from the file on reading (see Mat::mapFile()).
+//
+
+namespace cv
+{
+
+static const char binarySignature[] = "\x89OCVBIN\n";
+
+enum
+{
+    BINARY_SIGNATURE_SIZE = 8,
+    BINARY_VERSION = 1,
+    BINARY_HEADER_SIZE = 64,
+    BINARY_BLOB_ALIGNMENT = 64,
+    BINARY_MIN_BLOB_SIZE = 256,  // smaller raw data is stored in the index as regular nodes
+    BINARY_MAX_NESTING = 1024,
+    // blob reference: tag, file offset (8 bytes), size (8 bytes), zero-terminated format string
+    BINARY_BLOB_REF_OFS = 1,
+    BINARY_BLOB_REF_SIZE = 9,
+    BINARY_BLOB_REF_DT = 17
+};
+
+static inline void putUInt32(uchar* p, uint32_t v)
+{
+    p[0] = (uchar)v;
+    p[1] = (uchar)(v >> 8);
+    p[2] = (uchar)(v >> 16);
+    p[3] = (uchar)(v >> 24);
+}
+
+static inline uint32_t getUInt32(const uchar* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void putUInt64(uchar* p, uint64_t v)
+{
+    putUInt32(p, (uint32_t)v);
+    putUInt32(p + 4, (uint32_t)(v >> 32));
+}
+
+static inline uint64_t getUInt64(const uchar* p)
+{
+    return (uint64_t)getUInt32(p) | ((uint64_t)getUInt32(p + 4) << 32);
+}
+
+static bool seekFile(FILE* f, uint64_t pos)
+{
+#ifdef _WIN32
+    return _fseeki64(f, (__int64)pos, SEEK_SET) == 0;
+#else
+    return fseeko(f, (off_t)pos, SEEK_SET) == 0;
+#endif
+}
+
+static uint64_t getFileSize(FILE* f)
+{
+#ifdef _WIN32
+    if (_fseeki64(f, 0, SEEK_END) != 0)
+        return 0;
+    __int64 sz = _ftelli64(f);
+#else
+    if (fseeko(f, 0, SEEK_END) != 0)
+        return 0;
+    off_t sz = ftello(f);
+#endif
+    return sz > 0 ? (uint64_t)sz : 0;
+}
+
+// expands format of raw data into (depth, offset) pairs of the structure fields, returns size of the structure
+static size_t decodeLayout(const char* dt, std::vector<std::pair<int, size_t> >& layout)
+{
+    int fmt_pairs[CV_FS_MAX_FMT_PAIRS*2];
+    int fmt_pair_count = fs::decodeFormat(dt, fmt_pairs, CV_FS_MAX_FMT_PAIRS);
+    layout.clear();
+    size_t offset = 0;
+    for (int k = 0; k < fmt_pair_count; k++)
+    {
+        int depth = fmt_pairs[k*2+1];
+        size_t elem_size = CV_ELEM_SIZE(depth);
+        offset = alignSize(offset, (int)elem_size);
+        for (int i = 0; i < fmt_pairs[k*2]; i++, offset += elem_size)
+            layout.push_back(std::make_pair(depth, offset));
+    }
+    return (size_t)fs::calcStructSize(dt, 0);
+}
+
+static double loadScalar(const uchar* p, int depth)
+{
+    switch (depth)
+    {
+    case CV_8U: return *p;
+    case CV_8S: return *(const schar*)p;
+    case CV_16U: { ushort v; memcpy(&v, p, sizeof(v)); return v; }
+    case CV_16S: { short v; memcpy(&v, p, sizeof(v)); return v; }
+    case CV_32S: { int v; memcpy(&v, p, sizeof(v)); return v; }
+    case CV_32F: { float v; memcpy(&v, p, sizeof(v)); return v; }
+    case CV_64F: { double v; memcpy(&v, p, sizeof(v)); return v; }
+    case CV_16F: { hfloat v; memcpy(&v, p, sizeof(v)); return (float)v; }
+    default:
+        CV_Error(Error::StsUnsupportedFormat, "Unsupported type");
+    }
+}
+
+static void storeScalar(uchar* p, int depth, double v)
+{
+    switch (depth)
+    {
+    case CV_8U: *p = saturate_cast<uchar>(v); break;
+    case CV_8S: *(schar*)p = saturate_cast<schar>(v); break;
+    case CV_16U: { ushort t = saturate_cast<ushort>(v); memcpy(p, &t, sizeof(t)); break; }
+    case CV_16S: { short t = saturate_cast<short>(v); memcpy(p, &t, sizeof(t)); break; }
+    case CV_32S: { int t = saturate_cast<int>(v); memcpy(p, &t, sizeof(t)); break; }
+    case CV_32F: { float t = (float)v; memcpy(p, &t, sizeof(t)); break; }
+    case CV_64F: memcpy(p, &v, sizeof(v)); break;
+    case CV_16F: { hfloat t((float)v); memcpy(p, &t, sizeof(t)); break; }
+    default:
+        CV_Error(Error::StsUnsupportedFormat, "Unsupported type");
+    }
+}
+
+class BinaryEmitter : public FileStorageEmitter
+{
+public:
+    BinaryEmitter(FileStorage::Impl* _fs) : fs(_fs), pos(0)
+    {
+        CV_Assert(fs->file);
+
+        // collection of streams, see FileStorage::Impl::open()
+        FileNode roots(fs->fs_ext, 0, 0);
+        uchar* ptr = fs->reserveNodeSpace(roots, 9);
+        ptr[0] = FileNode::SEQ;
+        putUInt32(ptr + 1, 4);
+        putUInt32(ptr + 5, 0);
+        levels.push_back(Level(roots));
+
+        uchar header[BINARY_HEADER_SIZE] = {0};
+        writeData(header, sizeof(header));  // updated by finalize()
+    }
+    virtual ~BinaryEmitter() {}
+
+    FStructData startWriteStruct(const FStructData& /*parent*/, const char* key,
+                                 int struct_flags, const char* type_name)
+    {
+        Level& parent = prepareElement();
+        FileNode node = fs->addNode(parent.node, key ? key : "", FileNode::NONE, 0, -1);
+        fs->convertToCollection(FileNode::isMap(struct_flags) ? FileNode::MAP : FileNode::SEQ, node);
+        levels.push_back(Level(node));
+        fs->setNonEmpty();
+        return FStructData(type_name ? type_name : "", struct_flags, 0);
+    }
+
+    void endWriteStruct(const FStructData& /*current_struct*/)
+    {
+        if (levels.size() > 1)  // top-level collection is created on the first write
+            closeLevel();
+    }
+
+    void write(const char* key, int value)
+    {
+        fs->addNode(prepareElement().node, key ? key : "", FileNode::INT, &value, -1);
+        fs->setNonEmpty();
+    }
+
+    void write(const char* key, double value)
+    {
+        fs->addNode(prepareElement().node, key ? key : "", FileNode::REAL, &value, -1);
+        fs->setNonEmpty();
+    }
+
+    void write(const char* key, const char* str, bool /*quote*/)
+    {
+        if (!str)
+            CV_Error(cv::Error::StsNullPtr, "Null string pointer");
+        fs->addNode(prepareElement().node, key ? key : "", FileNode::STRING, str, -1);
+        fs->setNonEmpty();
+    }
+
+    void writeScalar(const char* key, const char* value)
+    {
+        write(key, value, false);
+    }
+
+    void writeComment(const char* /*comment*/, bool /*eol_comment*/)
+    {
+        // not stored
+    }
+
+    void startNextStream()
+    {
+        // the next top-level collection is created on the first write
+    }
+
+    void writeRawData(const std::string& dt, const void* data, size_t len)
+    {
+        size_t elemSize = fs::calcStructSize(dt.c_str(), 0);
+        CV_Assert(elemSize);
+        CV_Assert(len % elemSize == 0);
+        if (len == 0)
+            return;
+        if (!data)
+            CV_Error(cv::Error::StsNullPtr, "Null data pointer");
+
+        if (levels.size() == 1 || (levels.back().blob && levels.back().dt != dt))
+            prepareElement();
+        Level& l = levels.back();
+        if (!l.blob && l.node.isSeq() && l.node.size() == 0)
+            startBlob(l, dt);
+        if (!l.blob)
+        {
+            writeElements(l, dt, (const uchar*)data, len);
+            return;
+        }
+        writeData(data, len);
+        l.blobSize += len;
+        l.blobElems += (len / elemSize) * l.elemScalars;
+    }
+
+    void finalize()
+    {
+        while (levels.size() > 1)
+            closeLevel();
+        CV_Assert(levels.size() == 1);
+        fs->finalizeCollection(levels[0].node);
+        levels.clear();
+
+        const uint64_t indexOffset = pos;
+        const std::vector<char>& strings = fs->str_hash_data;
+        writeData(&strings[0], strings.size());
+        uint64_t nodesSize = 0;
+        size_t lastBlockIdx = fs->fs_data_ptrs.size() - 1;
+        for (size_t i = 0; i <= lastBlockIdx; i++)
+        {
+            size_t sz = i < lastBlockIdx ? fs->fs_data_blksz[i] : fs->freeSpaceOfs;
+            writeData(fs->fs_data_ptrs[i], sz);
+            nodesSize += sz;
+        }
+
+        uchar header[BINARY_HEADER_SIZE] = {0};
+        memcpy(header, binarySignature, BINARY_SIGNATURE_SIZE);
+        putUInt32(header + 8, BINARY_VERSION);
+        putUInt32(header + 12, BINARY_HEADER_SIZE);
+        putUInt64(header + 16, indexOffset);
+        putUInt64(header + 24, strings.size());
+        putUInt64(header + 32, nodesSize);
+        seek(0);
+        writeData(header, sizeof(header));
+        fflush(fs->file);
+    }
+
+protected:
+    struct Level
+    {
+        explicit Level(const FileNode& node_)
+            : node(node_), blob(false), elemScalars(0)
+            , blobStart(0), blobOffset(0), blobSize(0), blobElems(0)
+        {
+            // nothing
+        }
+
+        FileNode node;
+        bool blob;            //!< raw data of the sequence is written into blob
+        std::string dt;       //!< format of raw data
+        size_t elemScalars;   //!< number of scalars in the raw data element
+        FileNode blobRef;     //!< blob reference node (filled on closing of the sequence)
+        uint64_t blobStart;   //!< file position before alignment of the blob
+        uint64_t blobOffset;
+        uint64_t blobSize;
+        uint64_t blobElems;
+    };
+
+    // returns collection to add the next element into
+    Level& prepareElement()
+    {
+        if (levels.size() == 1)
+        {
+            FileNode stream = fs->addNode(levels[0].node, std::string(), FileNode::NONE, 0, -1);
+            fs->convertToCollection(FileNode::MAP, stream);
+            levels.push_back(Level(stream));
+        }
+        Level& l = levels.back();
+        if (l.blob)
+            expandBlob(l);  // sequence is not homogeneous
+        return l;
+    }
+
+    void closeLevel()
+    {
+        Level& l = levels.back();
+        if (l.blob)
+        {
+            if (l.blobSize < BINARY_MIN_BLOB_SIZE)
+            {
+                expandBlob(l);
+            }
+            else
+            {
+                CV_Assert(l.blobElems <= (uint64_t)UINT_MAX);
+                uchar* ref = l.blobRef.ptr();
+                putUInt64(ref + BINARY_BLOB_REF_OFS, l.blobOffset);
+                putUInt64(ref + BINARY_BLOB_REF_SIZE, l.blobSize);
+                uchar* p = l.node.ptr();
+                p += (*p & FileNode::NAMED) ? 5 : 1;
+                putUInt32(p + 4, (uint32_t)l.blobElems);
+                l.blob = false;
+            }
+        }
+        fs->finalizeCollection(l.node);
+        levels.pop_back();
+    }
+
+    void startBlob(Level& l, const std::string& dt)
+    {
+        std::vector<std::pair<int, size_t> > layout;
+        decodeLayout(dt.c_str(), layout);
+
+        l.blob = true;
+        l.dt = dt;
+        l.elemScalars = layout.size();
+        l.blobStart = pos;
+        uchar padding[BINARY_BLOB_ALIGNMENT] = {0};
+        writeData(padding, (size_t)(alignSize((size_t)pos, BINARY_BLOB_ALIGNMENT) - pos));
+        l.blobOffset = pos;
+        l.blobSize = 0;
+        l.blobElems = 0;
+
+        l.blobRef = FileNode(fs->fs_ext, fs->fs_data_ptrs.size() - 1, fs->freeSpaceOfs);
+        uchar* ref = fs->reserveNodeSpace(l.blobRef, BINARY_BLOB_REF_DT + dt.size() + 1);
+        ref[0] = CV_FS_BINARY_BLOB_TAG;
+        putUInt64(ref + BINARY_BLOB_REF_OFS, 0);
+        putUInt64(ref + BINARY_BLOB_REF_SIZE, 0);
+        memcpy(ref + BINARY_BLOB_REF_DT, dt.c_str(), dt.size() + 1);
+    }
+
+    // moves data of the blob into the index (as regular nodes)
+    void expandBlob(Level& l)
+    {
+        CV_Assert(l.blob);
+        std::vector<uchar> data((size_t)l.blobSize);
+        if (!data.empty())
+        {
+            seek(l.blobOffset);
+            if (fread(&data[0], 1, data.size(), fs->file) != data.size())
+                CV_Error_(Error::StsError, ("Can't read back raw data from '%s'", fs->filename.c_str()));
+        }
+        seek(l.blobStart);  // the next blob overwrites the data
+
+        CV_Assert(l.blobRef.blockIdx == fs->fs_data_ptrs.size() - 1);
+        fs->freeSpaceOfs = l.blobRef.ofs;
+        l.blob = false;
+        if (!data.empty())
+            writeElements(l, l.dt, &data[0], data.size());
+    }
+
+    void writeElements(Level& l, const std::string& dt, const uchar* data0, size_t len)
+    {
+        std::vector<std::pair<int, size_t> > layout;
+        size_t elemSize = decodeLayout(dt.c_str(), layout);
+        for (const uchar* data = data0; data < data0 + len; data += elemSize)
+        {
+            for (size_t i = 0; i < layout.size(); i++)
+            {
+                int depth = layout[i].first;
+                double v = loadScalar(data + layout[i].second, depth);
+                if (depth == CV_32F || depth == CV_64F || depth == CV_16F)
+                {
+                    fs->addNode(l.node, std::string(), FileNode::REAL, &v, -1);
+                }
+                else
+                {
+                    int ival = (int)v;
+                    fs->addNode(l.node, std::string(), FileNode::INT, &ival, -1);
+                }
+            }
+        }
+    }
+
+    void writeData(const void* data, size_t size)
+    {
+        if (size > 0 && fwrite(data, 1, size, fs->file) != size)
+            CV_Error_(Error::StsError, ("Can't write data into '%s'", fs->filename.c_str()));
+        pos += size;
+    }
+
+    void seek(uint64_t newPos)
+    {
+        if (!seekFile(fs->file, newPos))
+            CV_Error_(Error::StsError, ("Can't seek in '%s'", fs->filename.c_str()));
+        pos = newPos;
+    }
+
+    FileStorage::Impl* fs;
+    std::vector<Level> levels;  // [0] - collection of streams
+    uint64_t pos;
+};
+
+
+class BinaryParser : public FileStorageParser
+{
+public:
+    BinaryParser(FileStorage::Impl* _fs) : fs(_fs), fileSize(0) {}
+    virtual ~BinaryParser() {}
+
+    bool parse(char* /*ptr*/)
+    {
+        // file is opened in text mode to detect the format
+        fs->closeFile();
+        fs->file = fopen(fs->filename.c_str(), "rb");
+        if (!fs->file)
+            CV_Error_(Error::StsError, ("Can't open file: '%s'", fs->filename.c_str()));
+        fileSize = getFileSize(fs->file);
+
+        uchar header[BINARY_HEADER_SIZE];
+        if (fileSize < BINARY_HEADER_SIZE || !seekFile(fs->file, 0) ||
+            fread(header, 1, sizeof(header), fs->file) != sizeof(header) ||
+            memcmp(header, binarySignature, BINARY_SIGNATURE_SIZE) != 0)
+            CV_PARSE_ERROR_CPP("Invalid binary storage header");
+        if (getUInt32(header + 8) != BINARY_VERSION)
+            CV_PARSE_ERROR_CPP(cv::format("Unsupported binary storage version: %d", (int)getUInt32(header + 8)));
+        const uint64_t indexOffset = getUInt64(header + 16);
+        const uint64_t stringsSize = getUInt64(header + 24);
+        const uint64_t nodesSize = getUInt64(header + 32);
+        if (getUInt32(header + 12) < BINARY_HEADER_SIZE || indexOffset < getUInt32(header + 12) ||
+            stringsSize == 0 || nodesSize < 9 || indexOffset > fileSize ||
+            stringsSize > fileSize - indexOffset || nodesSize > fileSize - indexOffset - stringsSize)
+            CV_PARSE_ERROR_CPP("Invalid binary storage index");
+
+        std::vector<char> strings((size_t)stringsSize);
+        Ptr<std::vector<uchar> > nodes = makePtr<std::vector<uchar> >((size_t)nodesSize);
+        if (!seekFile(fs->file, indexOffset) ||
+            fread(&strings[0], 1, strings.size(), fs->file) != strings.size() ||
+            fread(&nodes->at(0), 1, nodes->size(), fs->file) != nodes->size())
+            CV_PARSE_ERROR_CPP("Can't read binary storage index");
+        if (strings[0] != '\0' || strings.back() != '\0')
+            CV_PARSE_ERROR_CPP("Invalid binary storage string table");
+
+        fs->str_hash.clear();
+        for (size_t ofs = 1; ofs < strings.size(); )
+        {
+            std::string key(&strings[ofs]);
+            fs->str_hash.insert(std::make_pair(key, (unsigned)ofs));
+            ofs += key.size() + 1;
+        }
+        std::swap(fs->str_hash_data, strings);
+
+        const uchar* p = &nodes->at(0);
+        if (p[0] != FileNode::SEQ || validateNode(p, p + nodes->size(), 0) != nodes->size())
+            CV_PARSE_ERROR_CPP("Invalid binary storage index");
+
+        fs->fs_data.assign(1, nodes);
+        fs->fs_data_ptrs.assign(1, &nodes->at(0));
+        fs->fs_data_blksz.assign(1, nodes->size());
+        fs->freeSpaceOfs = nodes->size();
+        return true;
+    }
+
+    bool getBase64Row(char* /*ptr*/, int /*indent*/, char* &/*beg*/, char* &/*end*/)
+    {
+        return false;
+    }
+
+protected:
+    // checks the loaded tree of nodes, returns size of the node
+    size_t validateNode(const uchar* p0, const uchar* end, int depth)
+    {
+        if (depth > BINARY_MAX_NESTING)
+            CV_PARSE_ERROR_CPP("Too deep nesting of binary storage nodes");
+        const uchar* p = p0 + 1;
+        if (p > end)
+            CV_PARSE_ERROR_CPP("Invalid binary storage node");
+        int tag = *p0;
+        int type = tag & FileNode::TYPE_MASK;
+        if ((tag & ~(FileNode::TYPE_MASK | FileNode::NAMED)) != 0)
+            CV_PARSE_ERROR_CPP("Invalid binary storage node");
+        if (tag & FileNode::NAMED)
+        {
+            if (end - p < 4 || getUInt32(p) >= fs->str_hash_data.size())
+                CV_PARSE_ERROR_CPP("Invalid binary storage node name");
+            p += 4;
+        }
+
+        size_t sz = 0;
+        if (type == FileNode::NONE)
+            sz = 0;
+        else if (type == FileNode::INT)
+            sz = 4;
+        else if (type == FileNode::REAL)
+            sz = 8;
+        else if (type == FileNode::STRING)
+        {
+            if (end - p < 4)
+                CV_PARSE_ERROR_CPP("Invalid binary storage node");
+            sz = 4 + (size_t)getUInt32(p);
+            if (sz == 4 || (size_t)(end - p) < sz || p[sz - 1] != '\0')
+                CV_PARSE_ERROR_CPP("Invalid binary storage string");
+        }
+        else if (type == FileNode::SEQ || type == FileNode::MAP)
+        {
+            if (end - p < 8)
+                CV_PARSE_ERROR_CPP("Invalid binary storage node");
+            sz = 4 + (size_t)getUInt32(p);
+            size_t nelems = getUInt32(p + 4);
+            if (sz < 8 || (size_t)(end - p) < sz)
+                CV_PARSE_ERROR_CPP("Invalid binary storage collection");
+            const uchar* child = p + 8;
+            const uchar* childrenEnd = p + sz;
+            if (type == FileNode::SEQ && nelems > 0 && *child == CV_FS_BINARY_BLOB_TAG)
+            {
+                validateBlobRef(child, childrenEnd, nelems);
+                child = childrenEnd;
+            }
+            else
+            {
+                for (size_t i = 0; i < nelems; i++)
+                {
+                    if (child >= childrenEnd || ((*child & FileNode::NAMED) != 0) != (type == FileNode::MAP))
+                        CV_PARSE_ERROR_CPP("Invalid binary storage collection");
+                    child += validateNode(child, childrenEnd, depth + 1);
+                }
+            }
+            if (child != childrenEnd)
+                CV_PARSE_ERROR_CPP("Invalid binary storage collection");
+        }
+        else
+            CV_PARSE_ERROR_CPP("Invalid binary storage node");
+
+        if ((size_t)(end - p) < sz)
+            CV_PARSE_ERROR_CPP("Invalid binary storage node");
+        return (size_t)(p - p0) + sz;
+    }
+
+    void validateBlobRef(const uchar* ref, const uchar* end, size_t nelems)
+    {
+        if (end - ref <= BINARY_BLOB_REF_DT || end[-1] != '\0' ||
+            getBinaryBlobRefSize(ref) != (size_t)(end - ref))
+            CV_PARSE_ERROR_CPP("Invalid binary storage blob reference");
+        uint64_t offset = getUInt64(ref + BINARY_BLOB_REF_OFS);
+        uint64_t size = getUInt64(ref + BINARY_BLOB_REF_SIZE);
+        if (offset > fileSize || size > fileSize - offset)
+            CV_PARSE_ERROR_CPP("Invalid binary storage blob reference");
+        std::vector<std::pair<int, size_t> > layout;
+        size_t elemSize = decodeLayout((const char*)ref + BINARY_BLOB_REF_DT, layout);
+        if (elemSize == 0 || size % elemSize != 0 || (size / elemSize) * layout.size() != nelems)
+            CV_PARSE_ERROR_CPP("Invalid binary storage blob reference");
+    }
+
+    FileStorage::Impl* fs;
+    uint64_t fileSize;
+};
+
+Ptr<FileStorageEmitter> createBinaryEmitter(FileStorage::Impl* fs)
+{
+    return makePtr<BinaryEmitter>(fs);
+}
+
+Ptr<FileStorageParser> createBinaryParser(FileStorage::Impl* fs)
+{
+    return makePtr<BinaryParser>(fs);
+}
+
+bool isBinaryFileName(const std::string& filename)
+{
+    size_t dot_pos = filename.find_last_of('.');
+    return dot_pos != std::string::npos && fs::strcasecmp(filename.c_str() + dot_pos, ".cvbin") == 0;
+}
+
+void writeBinaryRawData(FileStorage::Impl* fs, const std::string& dt, const void* data, size_t len)
+{
+    CV_Assert(fs->fmt == FileStorage::FORMAT_BINARY);
+    static_cast<BinaryEmitter&>(fs->getEmitter()).writeRawData(dt, data, len);
+}
+
+void finalizeBinaryStorage(FileStorage::Impl* fs)
+{
+    CV_Assert(fs->fmt == FileStorage::FORMAT_BINARY);
+    static_cast<BinaryEmitter&>(fs->getEmitter()).finalize();
+}
+
+size_t getBinaryBlobRefSize(const uchar* ref)
+{
+    CV_DbgAssert(*ref == CV_FS_BINARY_BLOB_TAG);
+    return BINARY_BLOB_REF_DT + strlen((const char*)ref + BINARY_BLOB_REF_DT) + 1;
+}
+
+size_t readBinaryBlob(const FileStorage::Impl* fs, const uchar* ref, size_t firstElem, size_t nelems,
+                      const std::string& fmt, uchar* data, size_t maxsz)
+{
+    CV_Assert(*ref == CV_FS_BINARY_BLOB_TAG);
+    const uint64_t blobOffset = getUInt64(ref + BINARY_BLOB_REF_OFS);
+    const char* dt = (const char*)ref + BINARY_BLOB_REF_DT;
+
+    std::vector<std::pair<int, size_t> > src_layout, dst_layout;
+    const size_t src_esz = decodeLayout(dt, src_layout);
+    const size_t dst_esz = decodeLayout(fmt.c_str(), dst_layout);
+    CV_Assert(maxsz % dst_esz == 0);
+    const size_t count = (maxsz / dst_esz) * dst_layout.size();
+    if (count == 0)
+        return 0;
+    if (count > nelems - firstElem)
+        CV_Error(Error::StsOutOfRange, "Not enough elements in the raw data sequence");
+
+    FILE* f = fopen(fs->filename.c_str(), "rb");
+    if (!f)
+        CV_Error_(Error::StsError, ("Can't open file: '%s'", fs->filename.c_str()));
+
+    const size_t src_n = src_layout.size(), dst_n = dst_layout.size();
+    bool ok = true;
+    if (src_layout == dst_layout && firstElem % src_n == 0)
+    {
+        // same format: read directly into the destination buffer
+        ok = seekFile(f, blobOffset + (uint64_t)(firstElem / src_n) * src_esz) &&
+             fread(data, 1, maxsz, f) == maxsz;
+    }
+    else
+    {
+        const size_t maxChunkElems = std::max((size_t)1, ((size_t)1 << 20) / src_esz) * src_n;
+        std::vector<uchar> buf;
+        for (size_t done = 0; ok && done < count; )
+        {
+            const size_t n = std::min(count - done, maxChunkElems);
+            const size_t first = firstElem + done;
+            const size_t firstStruct = first / src_n, lastStruct = (first + n - 1) / src_n;
+            buf.resize((lastStruct - firstStruct + 1) * src_esz);
+            ok = seekFile(f, blobOffset + (uint64_t)firstStruct * src_esz) &&
+                 fread(&buf[0], 1, buf.size(), f) == buf.size();
+            for (size_t i = 0; ok && i < n; i++)
+            {
+                const size_t s = first + i, d = done + i;
+                const std::pair<int, size_t>& src = src_layout[s % src_n];
+                const std::pair<int, size_t>& dst = dst_layout[d % dst_n];
+                double v = loadScalar(&buf[(s / src_n - firstStruct) * src_esz + src.second], src.first);
+                storeScalar(data + (d / dst_n) * dst_esz + dst.second, dst.first, v);
+            }
+            done += n;
+        }
+    }
+    fclose(f);
+    if (!ok)
+        CV_Error_(Error::StsError, ("Can't read raw data from '%s'", fs->filename.c_str()));
+    return count;
+}
+
+namespace fs {
+
+bool mapBinaryBlob(const FileNode& node, int type, int dims, const int* sizes, Mat& m)
+{
+#if OPENCV_HAVE_FILESYSTEM_SUPPORT
+    if (node.empty() || !node.isSeq() || node.size() == 0 || dims <= 0)
+        return false;
+    const uchar* ref = (*node.begin()).ptr();
+    if (*ref != CV_FS_BINARY_BLOB_TAG)
+        return false;
+
+    int fmt_pairs[CV_FS_MAX_FMT_PAIRS*2];
+    int fmt_pair_count = fs::decodeFormat((const char*)ref + BINARY_BLOB_REF_DT, fmt_pairs, CV_FS_MAX_FMT_PAIRS);
+    if (fmt_pair_count != 1 || fmt_pairs[0] != CV_MAT_CN(type) || fmt_pairs[1] != CV_MAT_DEPTH(type))
+        return false;
+
+    std::vector<int> shape(sizes, sizes + dims);
+    uint64_t total = CV_ELEM_SIZE(type);
+    for (int i = 0; i < dims; i++)
+    {
+        if (sizes[i] <= 0)
+            return false;
+        total *= (uint64_t)sizes[i];
+    }
+    if (total != getUInt64(ref + BINARY_BLOB_REF_SIZE))
+        return false;
+
+    m = Mat::mapFile(node.fs->filename, type, shape, Mat::MAPFILE_COPY_ON_WRITE,
+                     (size_t)getUInt64(ref + BINARY_BLOB_REF_OFS));
+    return true;
+#else
+    CV_UNUSED(node); CV_UNUSED(type); CV_UNUSED(dims); CV_UNUSED(sizes); CV_UNUSED(m);
+    return false;
+#endif
+}
+
+}  // namespace fs
+
+}
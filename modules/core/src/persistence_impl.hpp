@@ -244,6 +244,24 @@ public:
     int lineno;
 };
 
+// Binary storage format (persistence_binary.cpp)
+
+// Tag of the raw data blob reference. The reference is the only child node of the sequence,
+// all elements of the sequence (FileNode::size()) are stored in the blob.
+#define CV_FS_BINARY_BLOB_TAG 64
+
+Ptr<FileStorageEmitter> createBinaryEmitter(FileStorage::Impl* fs);
+Ptr<FileStorageParser> createBinaryParser(FileStorage::Impl* fs);
+
+bool isBinaryFileName(const std::string& filename);
+void writeBinaryRawData(FileStorage::Impl* fs, const std::string& dt, const void* data, size_t len);
+void finalizeBinaryStorage(FileStorage::Impl* fs);
+
+size_t getBinaryBlobRefSize(const uchar* ref);
+// reads elements [firstElem; firstElem + N) of the blob, returns N
+size_t readBinaryBlob(const FileStorage::Impl* fs, const uchar* ref, size_t firstElem, size_t nelems,
+                      const std::string& fmt, uchar* data, size_t maxsz);
+
 }
 
 #endif
@@ -123,6 +123,7 @@ void read(const FileNode& node, Mat& m, const Mat& default_mat)
 
     std::string dt;
     int rows, cols, elem_type;
+    int sizes[CV_MAX_DIM] = {0}, dims;
 
     read(node["dt"], dt, std::string());
     CV_Assert( !dt.empty() );
@@ -133,23 +134,27 @@ void read(const FileNode& node, Mat& m, const Mat& default_mat)
     if( rows >= 0 )
     {
         read(node["cols"], cols, -1);
-        m.create(rows, cols, elem_type);
+        dims = 2;
+        sizes[0] = rows;
+        sizes[1] = cols;
     }
     else
     {
-        int sizes[CV_MAX_DIM] = {0}, dims;
         FileNode sizes_node = node["sizes"];
         CV_Assert( !sizes_node.empty() );
 
         dims = (int)sizes_node.size();
+        CV_Assert( dims <= CV_MAX_DIM );
         sizes_node.readRaw("i", sizes, dims*sizeof(sizes[0]));
-
-        m.create(dims, sizes, elem_type);
     }
 
     FileNode data_node = node["data"];
     CV_Assert(!data_node.empty());
 
+    if( fs::mapBinaryBlob(data_node, elem_type, dims, sizes, m) )
+        return;
+    m.create(dims, sizes, elem_type);
+
     size_t nelems = data_node.size();
     CV_Assert(nelems == m.total()*m.channels());
 
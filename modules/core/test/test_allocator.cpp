@@ -2,6 +2,10 @@
 // It is subject to the license terms in the LICENSE file found in the top-level directory
 // of this distribution and at http://opencv.org/license.html.
 #include "test_precomp.hpp"
+#include "opencv2/core/utils/numa.hpp"
+#include "opencv2/core/bufferpool.hpp"
+
+#include <thread>
 
 namespace opencv_test { namespace {
 
@@ -141,4 +145,95 @@ TEST_F(AllocatorTest, DummyAllocator)
     EXPECT_EQ(2, DummyAllocator::deallocations);
 }
 
+TEST(Core_Allocator, NUMAFirstTouchAllocator)
+{
+    cv::MatAllocator* allocator = cv::utils::numa::getFirstTouchAllocator();
+    ASSERT_TRUE(allocator != nullptr);
+    EXPECT_GE(cv::utils::numa::getNumberOfNodes(), 1);
+    EXPECT_GE(cv::utils::numa::getCurrentNode(), 0);
+    EXPECT_LT(cv::utils::numa::getCurrentNode(), cv::utils::numa::getNumberOfNodes());
+
+    for (int rows : {1, 7, 1024})
+    {
+        SCOPED_TRACE(rows);
+        cv::Mat m;
+        m.allocator = allocator;
+        m.create(rows, 3000, CV_32FC3);  // 36Kb per row
+        ASSERT_TRUE(m.isContinuous());
+        EXPECT_EQ(3000 * 3 * sizeof(float), m.step[0]);
+        m.setTo(cv::Scalar(1, 2, 3));
+        cv::Scalar s = cv::sum(m);
+        EXPECT_EQ(rows * 3000 * 1.0, s[0]);
+        EXPECT_EQ(rows * 3000 * 3.0, s[2]);
+        cv::Mat roi = m.rowRange(0, (rows + 1) / 2);
+        m.release();
+        EXPECT_EQ(cv::Vec3f(1, 2, 3), roi.at<cv::Vec3f>(roi.rows - 1, 2999));
+    }
+}
+
+TEST(Core_Allocator, PoolMatAllocator)
+{
+    cv::MatAllocator* allocator = cv::getPoolMatAllocator();
+    ASSERT_TRUE(allocator != nullptr);
+    cv::BufferPoolController* controller = allocator->getBufferPoolController();
+    ASSERT_TRUE(controller != nullptr);
+    controller->freeAllReservedBuffers();
+    EXPECT_EQ(0u, controller->getReservedSize());
+
+    cv::BufferPoolStatistics stat0 = cv::getPoolMatAllocatorStatistics();
+    for (int iter = 0; iter < 10; iter++)
+    {
+        cv::Mat m;
+        m.allocator = allocator;
+        m.create(100, 100 + iter, CV_8UC3);
+        m.setTo(cv::Scalar::all(iter));
+        EXPECT_EQ(100.0 * (100 + iter) * iter, cv::sum(m)[0]);
+    }
+    cv::BufferPoolStatistics stat1 = cv::getPoolMatAllocatorStatistics();
+    EXPECT_EQ(10u, stat1.allocations - stat0.allocations);
+    EXPECT_LE(8u, stat1.hits - stat0.hits);  // nearby sizes share size class
+    EXPECT_GT(controller->getReservedSize(), 0u);
+
+    controller->freeAllReservedBuffers();
+    EXPECT_EQ(0u, controller->getReservedSize());
+
+    // limit
+    size_t prevLimit = controller->getMaxReservedSize();
+    controller->setMaxReservedSize(0);
+    {
+        cv::Mat m;
+        m.allocator = allocator;
+        m.create(10, 10, CV_32F);
+    }
+    EXPECT_EQ(0u, controller->getReservedSize());
+    controller->setMaxReservedSize(prevLimit);
+}
+
+TEST(Core_Allocator, MatAllocatorThreadScope)
+{
+    cv::MatAllocator* defaultAllocator = cv::Mat::getDefaultAllocator();
+    cv::MatAllocator* pool = cv::getPoolMatAllocator();
+    ASSERT_NE(defaultAllocator, pool);
+    {
+        cv::MatAllocatorThreadScope scope(pool);
+        EXPECT_EQ(pool, cv::Mat::getDefaultAllocator());
+        cv::Mat m(10, 10, CV_8UC1);
+        ASSERT_TRUE(m.u != nullptr);
+        EXPECT_EQ(pool, m.u->currAllocator);
+
+#ifndef OPENCV_DISABLE_THREAD_SUPPORT
+        cv::MatAllocator* otherThreadAllocator = nullptr;
+        std::thread t([&]() { otherThreadAllocator = cv::Mat::getDefaultAllocator(); });
+        t.join();
+        EXPECT_EQ(defaultAllocator, otherThreadAllocator);
+#endif
+        {
+            cv::MatAllocatorThreadScope nested(defaultAllocator);
+            EXPECT_EQ(defaultAllocator, cv::Mat::getDefaultAllocator());
+        }
+        EXPECT_EQ(pool, cv::Mat::getDefaultAllocator());
+    }
+    EXPECT_EQ(defaultAllocator, cv::Mat::getDefaultAllocator());
+}
+
 }} // namespace
@@ -3019,6 +3019,99 @@ TEST(Core_MinMaxIdx, rows_overflow)
     }
 }
 
+TEST(Core_Arithm, row_tails)
+{
+    const int types[] = { CV_8UC1, CV_8SC1, CV_16UC1, CV_16SC1, CV_32SC1, CV_32FC1, CV_64FC1 };
+    RNG& rng = theRNG();
+    for (size_t t = 0; t < sizeof(types)/sizeof(types[0]); t++)
+    {
+        const int type = types[t];
+        for (int width = 1; width <= 130; width++)
+        {
+            SCOPED_TRACE(cv::format("type=%s width=%d", typeToString(type).c_str(), width));
+            Mat a(3, width, type), b(3, width, type);
+            rng.fill(a, RNG::UNIFORM, -200, 200);
+            rng.fill(b, RNG::UNIFORM, -200, 200);
+            Mat a64, b64, ref;
+            a.convertTo(a64, CV_64F);
+            b.convertTo(b64, CV_64F);
+
+            // the destination is a ROI, the elements around it must not be touched
+            Mat buf(5, width + 2, type, Scalar::all(7)), dst = buf(Rect(1, 1, width, 3));
+            Mat guard = buf.clone();
+            cv::add(a, b, dst);
+            Mat sum64 = a64 + b64;
+            sum64.convertTo(ref, type);
+            EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+
+            cv::absdiff(a, b, dst);
+            Mat absdiff64 = abs(a64 - b64);
+            absdiff64.convertTo(ref, type);
+            EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+
+            cv::max(a, b, dst);
+            Mat max64 = max(a64, b64);
+            max64.convertTo(ref, type);
+            EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+
+            dst.setTo(Scalar::all(7));
+            EXPECT_EQ(0, cvtest::norm(guard, buf, NORM_INF));
+        }
+    }
+}
+
+TEST(Core_Transpose, blocked_all_types)
+{
+    const int types[] = { CV_8UC1, CV_8UC2, CV_8UC3, CV_8UC4, CV_16UC3, CV_32FC1,
+                          CV_32SC2, CV_32SC3, CV_32FC4, CV_32SC(6), CV_64FC4 };
+    // sizes which are not multiples of the tiles and blocks; the largest ones use several threads
+    const Size sizes[] = { Size(1, 1), Size(17, 3), Size(100, 37), Size(515, 515), Size(1031, 517) };
+    RNG& rng = theRNG();
+
+    for (size_t t = 0; t < sizeof(types)/sizeof(types[0]); t++)
+    {
+        for (size_t k = 0; k < sizeof(sizes)/sizeof(sizes[0]); k++)
+        {
+            const int type = types[t];
+            const Size sz = sizes[k];
+            SCOPED_TRACE(cv::format("type=%s size=%dx%d", typeToString(type).c_str(), sz.width, sz.height));
+
+            Mat buf(sz.height + 2, sz.width + 3, type);
+            Mat src = buf(Rect(1, 1, sz.width, sz.height));
+            rng.fill(src, RNG::UNIFORM, 0, 255);
+
+            Mat ref, dst;
+            cvtest::transpose(src, ref);
+            cv::transpose(src, dst);
+            EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+
+            if (sz.width == sz.height)
+            {
+                dst = src.clone();
+                cv::transpose(dst, dst);
+                EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+            }
+
+            for (int code = ROTATE_90_CLOCKWISE; code <= ROTATE_90_COUNTERCLOCKWISE; code++)
+            {
+                reference::rotate(src, ref, code);
+                cv::rotate(src, dst, code);
+                EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF)) << "rotate " << code;
+            }
+
+            for (int code = -1; code <= 1; code++)
+            {
+                reference::flip(src, ref, code);
+                cv::flip(src, dst, code);
+                EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF)) << "flip " << code;
+                dst = src.clone();
+                cv::flip(dst, dst, code);
+                EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF)) << "flip in-place " << code;
+            }
+        }
+    }
+}
+
 TEST(Core_Magnitude, regression_19506)
 {
     for (int N = 1; N <= 64; ++N)
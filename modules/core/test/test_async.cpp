@@ -4,6 +4,7 @@
 #include "test_precomp.hpp"
 #include <opencv2/core/async.hpp>
 #include <opencv2/core/detail/async_promise.hpp>
+#include <opencv2/core/parallel/task.hpp>
 
 #include <opencv2/core/bindings_utils.hpp>
 
@@ -152,4 +153,115 @@ TEST(Core_Async, AsyncThread_DetachedResult)
 
 #endif
 
+TEST(Core_Async, parallel_submit_BasicCheck)
+{
+    cv::parallel::AsyncTask task = cv::parallel::submit([](OutputArray result) {
+        Mat m(3, 3, CV_32FC1, Scalar::all(5.0f));
+        m.copyTo(result);
+    });
+    EXPECT_TRUE(task.valid());
+    task.wait();
+    EXPECT_TRUE(task.isReady());
+
+    Mat m1, m2;
+    task.get(m1);
+    task.get(m2);  // result can be fetched multiple times
+    EXPECT_EQ(0, cvtest::norm(m1, Mat(3, 3, CV_32FC1, Scalar::all(5.0f)), NORM_INF));
+    EXPECT_EQ(m1.data, m2.data);
+
+    AsyncArray r = task.getArrayResult();
+    Mat m3;
+    ASSERT_TRUE(r.get(m3, 1e9));
+    EXPECT_EQ(0, cvtest::norm(m1, m3, NORM_INF));
+}
+
+TEST(Core_Async, parallel_submit_dependencies)
+{
+    const int N = 16;
+    Mat src(64, 64, CV_32SC1, Scalar::all(1));
+    std::vector<cv::parallel::AsyncTask> stages;
+    std::vector<Mat> results(N);
+    for (int i = 0; i < N; i++)
+    {
+        std::vector<cv::parallel::AsyncTask> deps;
+        if (i > 0)
+            deps.push_back(stages[i - 1]);
+        stages.push_back(cv::parallel::submit([&results, &src, i](OutputArray) {
+            Mat prev = i > 0 ? results[i - 1] : src;
+            ASSERT_FALSE(prev.empty());
+            Mat dst(prev.size(), prev.type());
+            parallel_for_(Range(0, prev.rows), [&](const Range& r) {
+                for (int y = r.start; y < r.end; y++)
+                    for (int x = 0; x < prev.cols; x++)
+                        dst.at<int>(y, x) = prev.at<int>(y, x) + 1;
+            });
+            results[i] = dst;
+        }, deps));
+    }
+
+    // diamond: a => (b, c) => d
+    cv::parallel::AsyncTask a = cv::parallel::submit([](OutputArray result) { Mat(1, 1, CV_32SC1, Scalar::all(10)).copyTo(result); });
+    cv::parallel::AsyncTask b = cv::parallel::submit([a](OutputArray result) {
+        Mat m; a.get(m); cv::add(m, 1, result);
+    }, { a });
+    cv::parallel::AsyncTask c = cv::parallel::submit([a](OutputArray result) {
+        Mat m; a.get(m); cv::add(m, 2, result);
+    }, { a });
+    cv::parallel::AsyncTask d = cv::parallel::submit([b, c](OutputArray result) {
+        Mat mb, mc; b.get(mb); c.get(mc); cv::add(mb, mc, result);
+    }, { b, c });
+    Mat md;
+    d.get(md);
+    EXPECT_EQ(23, md.at<int>(0, 0));
+
+    stages.back().wait();
+    cv::parallel::waitAll(stages);
+    for (int i = 0; i < N; i++)
+        EXPECT_TRUE(stages[i].isReady());
+    EXPECT_EQ(0, cvtest::norm(results[N - 1], Mat(src.size(), src.type(), Scalar::all(N + 1)), NORM_INF));
+}
+
+TEST(Core_Async, parallel_submit_exceptions)
+{
+    cv::parallel::AsyncTask failed = cv::parallel::submit([](OutputArray) {
+        CV_Error(Error::StsBadArg, "test");
+    });
+    bool executed = false;
+    cv::parallel::AsyncTask dependent = cv::parallel::submit([&](OutputArray) { executed = true; }, { failed });
+    Mat m;
+    EXPECT_THROW(failed.get(m), cv::Exception);
+    EXPECT_THROW(dependent.get(m), cv::Exception);
+    EXPECT_FALSE(executed);
+
+    AsyncArray r = dependent.getArrayResult();
+    EXPECT_THROW(r.get(m), cv::Exception);
+}
+
+#if !defined(OPENCV_DISABLE_THREAD_SUPPORT)
+TEST(Core_Async, parallel_submit_nested_wait)
+{
+    // task bodies wait for tasks submitted later: waiting thread executes them
+    const int N = 8;
+    std::vector<cv::parallel::AsyncTask> outer;
+    for (int i = 0; i < N; i++)
+    {
+        outer.push_back(cv::parallel::submit([i](OutputArray result) {
+            cv::parallel::AsyncTask inner = cv::parallel::submit([i](OutputArray innerResult) {
+                Mat(1, 1, CV_32SC1, Scalar::all(i)).copyTo(innerResult);
+            });
+            Mat m;
+            inner.get(m);
+            m.copyTo(result);
+        }));
+    }
+    for (int i = 0; i < N; i++)
+    {
+        Mat m;
+        ASSERT_TRUE(outer[i].wait_for(std::chrono::seconds(10)));
+        outer[i].get(m);
+        EXPECT_EQ(i, m.at<int>(0, 0));
+    }
+}
+#endif
+
 }} // namespace
@@ -2003,4 +2003,140 @@ TEST(Core_InputOutput, FileStorage_invalid_attribute_value_regression_25946)
     ASSERT_EQ(0, std::remove(fileName.c_str()));
 }
 
+
+TEST(Core_InputOutput, FileStorage_binary)
+{
+    const std::string fileName = cv::tempfile(".cvbin");
+
+    Mat weights(64, 96, CV_32FC3), small(3, 3, CV_64FC1);
+    randu(weights, -1, 1);
+    randu(small, -1, 1);
+    int nd_sizes[] = { 4, 8, 16 };
+    Mat nd(3, nd_sizes, CV_16SC1);
+    randu(nd, -1000, 1000);
+    std::vector<float> values(1000);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = (float)i * 0.25f;
+    std::vector<int> ids = { 1, 2, 3 };
+    {
+        FileStorage fs(fileName, FileStorage::WRITE);
+        ASSERT_TRUE(fs.isOpened());
+        EXPECT_EQ(FileStorage::FORMAT_BINARY, fs.getFormat());
+        fs << "name" << "model";
+        fs << "version" << 3;
+        fs << "scale" << 0.5;
+        fs << "layers" << "[";
+        fs << "{" << "weights" << weights << "bias" << small << "}";
+        fs << "{" << "weights" << nd << "}";
+        fs << "]";
+        fs << "values" << values;
+        fs << "ids" << ids;
+        fs << "mixed" << "[:";
+        fs.writeRaw("f", &values[0], values.size() * sizeof(float));
+        fs << 42;
+        fs << "]";
+        fs.release();
+    }
+
+    Mat weights_result, small_result, nd_result;
+    {
+        FileStorage fs(fileName, FileStorage::READ);
+        ASSERT_TRUE(fs.isOpened());
+        EXPECT_EQ(FileStorage::FORMAT_BINARY, fs.getFormat());
+        EXPECT_EQ("model", (std::string)fs["name"]);
+        EXPECT_EQ(3, (int)fs["version"]);
+        EXPECT_EQ(0.5, (double)fs["scale"]);
+
+        FileNode layers = fs["layers"];
+        ASSERT_TRUE(layers.isSeq());
+        ASSERT_EQ(2u, layers.size());
+        layers[0]["weights"] >> weights_result;
+        layers[0]["bias"] >> small_result;
+        layers[1]["weights"] >> nd_result;
+
+        std::vector<float> values_result;
+        fs["values"] >> values_result;
+        EXPECT_EQ(values, values_result);
+        std::vector<double> values_converted;
+        fs["values"] >> values_converted;
+        ASSERT_EQ(values.size(), values_converted.size());
+        EXPECT_EQ(values[999], values_converted[999]);
+
+        std::vector<int> ids_result;
+        fs["ids"] >> ids_result;
+        EXPECT_EQ(ids, ids_result);
+
+        FileNode mixed = fs["mixed"];
+        ASSERT_EQ(values.size() + 1, mixed.size());
+        EXPECT_EQ(values[10], (float)mixed[10]);
+        EXPECT_EQ(42, (int)mixed[(int)values.size()]);
+    }
+
+    // matrices are still valid after release of the storage
+    EXPECT_MAT_NEAR(weights, weights_result, 0);
+    EXPECT_MAT_NEAR(small, small_result, 0);
+    EXPECT_MAT_NEAR(nd, nd_result, 0);
+    EXPECT_EQ(0u, (size_t)weights_result.data % 64);
+
+    // mapped data is copied on write
+    weights_result.at<Vec3f>(0, 0) = Vec3f(5, 5, 5);
+    {
+        FileStorage fs(fileName, FileStorage::READ);
+        Mat m;
+        fs["layers"][0]["weights"] >> m;
+        EXPECT_MAT_NEAR(weights, m, 0);
+    }
+
+#ifndef _WIN32
+    // file is re-created on writing, mapped matrices are not affected
+    {
+        FileStorage fs(fileName, FileStorage::WRITE);
+        fs << "empty" << Mat();
+    }
+    EXPECT_MAT_NEAR(nd, nd_result, 0);
+#endif
+    weights_result.release();
+    nd_result.release();
+    {
+        FileStorage fs(fileName, FileStorage::WRITE);
+        fs << "empty" << Mat();
+    }
+    {
+        FileStorage fs(fileName, FileStorage::READ);
+        Mat m;
+        fs["empty"] >> m;
+        EXPECT_TRUE(m.empty());
+        EXPECT_TRUE(fs["weights"].empty());
+    }
+
+    EXPECT_EQ(0, remove(fileName.c_str()));
+}
+
+TEST(Core_InputOutput, FileStorage_binary_invalid)
+{
+    const std::string fileName = cv::tempfile(".cvbin");
+    {
+        FileStorage fs(fileName, FileStorage::WRITE);
+        fs << "m" << Mat::eye(32, 32, CV_32FC1);
+    }
+    std::vector<char> content;
+    {
+        std::ifstream f(fileName.c_str(), std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    }
+    ASSERT_GT(content.size(), 64u);
+    {
+        // truncated index
+        std::ofstream f(fileName.c_str(), std::ios::binary | std::ios::trunc);
+        f.write(&content[0], content.size() - 8);
+    }
+    FileStorage fs;
+    EXPECT_ANY_THROW(fs.open(fileName, FileStorage::READ));
+    EXPECT_FALSE(fs.isOpened());
+
+    EXPECT_THROW(FileStorage("test.cvbin", FileStorage::WRITE | FileStorage::MEMORY), cv::Exception);
+
+    EXPECT_EQ(0, remove(fileName.c_str()));
+}
+
 }} // namespace
@@ -2244,6 +2244,135 @@ TEST(Core_MatExpr, issue_16689)
     }
 }
 
+struct MatExprFusionScope
+{
+    bool prev;
+    explicit MatExprFusionScope(bool flag) : prev(MatExpr::useFusion()) { MatExpr::setUseFusion(flag); }
+    ~MatExprFusionScope() { MatExpr::setUseFusion(prev); }
+};
+
+TEST(Core_MatExpr, fused_chain_8u)
+{
+    MatExprFusionScope fusion(true);
+    RNG& rng = theRNG();
+    Mat a(Size(67, 31), CV_8UC3), b(a.size(), a.type()), c(a.size(), a.type());
+    rng.fill(a, RNG::UNIFORM, 0, 256);
+    rng.fill(b, RNG::UNIFORM, 0, 256);
+    rng.fill(c, RNG::UNIFORM, 0, 256);
+
+    Mat ref, t;
+    cv::addWeighted(a, 0.5, b, 0.25, 0, t);
+    cv::subtract(t, c, ref);
+    MatExpr e = a*0.5 + b*0.25 - c;
+    EXPECT_EQ(a.size(), e.size());
+    EXPECT_EQ(CV_8UC3, e.type());
+    EXPECT_EQ(0, cvtest::norm(ref, Mat(e), NORM_INF));
+    EXPECT_EQ(0, cvtest::norm(ref(Rect(3, 5, 40, 20)), Mat(e(Rect(3, 5, 40, 20))), NORM_INF));
+
+    // intermediate results are saturated
+    cv::add(a, b, t);
+    cv::subtract(t, c, ref);
+    EXPECT_EQ(0, cvtest::norm(ref, Mat((a + b) - (c + 0)), NORM_INF));
+
+    cv::absdiff(a, b, t);
+    t.convertTo(t, -1, 2);
+    cv::add(t, c, ref);
+    EXPECT_EQ(0, cvtest::norm(ref, Mat(abs(a - b)*2 + c), NORM_INF));
+
+    Mat_<Vec3f> f = (a + b) - c;
+    cv::add(a, b, t);
+    cv::subtract(t, c, t);
+    t.convertTo(ref, CV_32F);
+    EXPECT_EQ(0, cvtest::norm(ref, f, NORM_INF));
+
+    // in-place
+    cv::addWeighted(a, 0.5, b, 0.25, 0, t);
+    cv::subtract(t, c, ref);
+    a = a*0.5 + b*0.25 - c;
+    EXPECT_EQ(0, cvtest::norm(ref, a, NORM_INF));
+}
+
+TEST(Core_MatExpr, fused_chain_scalar_cmp)
+{
+    MatExprFusionScope fusion(true);
+    RNG& rng = theRNG();
+    Mat a(Size(100, 50), CV_8UC1), b(a.size(), a.type()), c(a.size(), a.type());
+    rng.fill(a, RNG::UNIFORM, 0, 256);
+    rng.fill(b, RNG::UNIFORM, 0, 256);
+    rng.fill(c, RNG::UNIFORM, 0, 10);
+
+    Mat ref, t1, t2;
+    cv::compare(a, b, t1, CMP_GT);
+    cv::compare(c, 3.5, t2, CMP_GE);
+    cv::subtract(t1, t2, ref);
+    EXPECT_EQ(0, cvtest::norm(ref, Mat((a > b) - (c >= 3.5)), NORM_INF));
+
+    cv::min(a, b, t1);
+    cv::add(t1, Scalar(7.5), t1);
+    cv::subtract(Scalar(300), t1, ref);
+    EXPECT_EQ(0, cvtest::norm(ref, Mat(300 - (min(a, b) + 7.5)), NORM_INF));
+
+    cv::max(a, 100, t1);
+    cv::absdiff(t1, c, ref);
+    EXPECT_EQ(0, cvtest::norm(ref, Mat(abs(max(a, 100) - c)), NORM_INF));
+}
+
+TEST(Core_MatExpr, fused_chain_16s_32f)
+{
+    MatExprFusionScope fusion(true);
+    RNG& rng = theRNG();
+    Mat a(Size(99, 33), CV_16SC1), b(a.size(), a.type()), c(a.size(), a.type());
+    rng.fill(a, RNG::UNIFORM, -1000, 1000);
+    rng.fill(b, RNG::UNIFORM, -1000, 1000);
+    rng.fill(c, RNG::UNIFORM, -1000, 1000);
+
+    Mat ref, t;
+    cv::multiply(a, b, t);
+    cv::add(t, c, ref);
+    EXPECT_EQ(0, cvtest::norm(ref, Mat(a.mul(b) + c), NORM_INF));
+
+    Mat af, bf, cf;
+    a.convertTo(af, CV_32F, 0.01);
+    b.convertTo(bf, CV_32F, 0.01);
+    c.convertTo(cf, CV_32F, 0.01);
+    cv::min(af, bf, t);
+    cv::addWeighted(t, 0.3, cf.mul(bf), 1, 0, ref);
+    EXPECT_LE(cvtest::norm(ref, Mat(min(af, bf)*0.3 + cf.mul(bf)), NORM_INF), 1e-4);
+}
+
+TEST(Core_MatExpr, fused_chain_position_independent)
+{
+    MatExprFusionScope fusion(true);
+    RNG& rng = theRNG();
+    Mat a(Size(67, 5), CV_32FC1), b(a.size(), a.type()), c(a.size(), a.type());
+    rng.fill(a, RNG::UNIFORM, -10, 10);
+    rng.fill(b, RNG::UNIFORM, -10, 10);
+    rng.fill(c, RNG::UNIFORM, -10, 10);
+
+    Mat ref = min(a, b)*0.3 + c*0.7 + 1.5;
+    for (int x = 1; x < 17; x++)
+    {
+        Rect roi(x, 0, a.cols - x, a.rows);
+        Mat dst = min(a(roi), b(roi))*0.3 + c(roi)*0.7 + 1.5;
+        EXPECT_EQ(0, cvtest::norm(ref(roi), dst, NORM_INF)) << "x=" << x;
+    }
+}
+
+TEST(Core_MatExpr, nested_operands_read_when_built)
+{
+    MatExprFusionScope fusion(false);
+    RNG& rng = theRNG();
+    Mat a(Size(40, 30), CV_8UC1), b(a.size(), a.type()), c(a.size(), a.type());
+    rng.fill(a, RNG::UNIFORM, 0, 256);
+    rng.fill(b, RNG::UNIFORM, 0, 256);
+    rng.fill(c, RNG::UNIFORM, 0, 256);
+
+    Mat ref = abs(a - b)*2 + min(a, c);
+    MatExpr e = abs(a - b)*2 + min(a, c);
+    a.setTo(Scalar::all(0));
+    EXPECT_EQ(0, cvtest::norm(ref, Mat(e), NORM_INF));
+}
+
 #ifdef HAVE_EIGEN
 TEST(Core_Eigen, eigen2cv_check_Mat_type)
 {
@@ -2619,4 +2748,76 @@ TEST(Mat, Recreate1DMatWithSameMeta)
     EXPECT_NO_THROW(m.create(dims, depth));
 }
 
+TEST(Core_Mat, mapFile)
+{
+    const std::string fname = cv::tempfile(".bin");
+    const int header = 13;  // unaligned data offset
+    Mat_<float> ref(100, 200);
+    randu(ref, -10, 10);
+    {
+        FILE* f = fopen(fname.c_str(), "wb");
+        ASSERT_TRUE(f != NULL);
+        std::vector<char> hdr(header, 'h');
+        ASSERT_EQ((size_t)header, fwrite(&hdr[0], 1, header, f));
+        ASSERT_EQ(ref.total(), fwrite(ref.ptr<float>(), sizeof(float), ref.total(), f));
+        fclose(f);
+    }
+
+    Mat m;
+    ASSERT_NO_THROW(m = Mat::mapFile(fname, CV_32FC1, {100, 200}, Mat::MAPFILE_READ_ONLY | Mat::MAPFILE_ADVISE_SEQUENTIAL, header));
+    ASSERT_TRUE(m.u != NULL);
+    EXPECT_EQ(Size(200, 100), m.size());
+    EXPECT_TRUE(m.isContinuous());
+    EXPECT_EQ(0, cvtest::norm(m, ref, NORM_INF));
+
+    // reference counting: mapping is alive while any header refers to it
+    Mat roi = m(Rect(10, 20, 30, 40));
+    m.release();
+    EXPECT_EQ(0, cvtest::norm(roi, ref(Rect(10, 20, 30, 40)), NORM_INF));
+    roi.release();
+
+    // shape from file size
+    Mat row = Mat::mapFile(fname, CV_32FC1, std::vector<int>(), Mat::MAPFILE_READ_ONLY, header);
+    EXPECT_EQ(Size((int)ref.total(), 1), row.size());
+    EXPECT_EQ(0, cvtest::norm(row, ref.reshape(1, 1), NORM_INF));
+    row.release();
+
+    // copy-on-write: changes are not written into the file
+    {
+        Mat cow = Mat::mapFile(fname, CV_32FC1, {100, 200}, Mat::MAPFILE_COPY_ON_WRITE, header);
+        cow.setTo(Scalar::all(0));
+        EXPECT_EQ(0, cvtest::norm(cow, NORM_INF));
+    }
+    m = Mat::mapFile(fname, CV_32FC1, {100, 200}, Mat::MAPFILE_READ_ONLY, header);
+    EXPECT_EQ(0, cvtest::norm(m, ref, NORM_INF));
+    m.release();
+
+    // shared read-write mapping
+    {
+        Mat rw = Mat::mapFile(fname, CV_32FC1, {100, 200}, Mat::MAPFILE_READ_WRITE, header);
+        rw.row(5).setTo(Scalar::all(1));
+    }
+    ref.row(5).setTo(Scalar::all(1));
+    m = Mat::mapFile(fname, CV_32FC1, {100, 200}, Mat::MAPFILE_READ_ONLY, header);
+    EXPECT_EQ(0, cvtest::norm(m, ref, NORM_INF));
+    m.release();
+
+    // errors
+    EXPECT_THROW(Mat::mapFile(fname, CV_32FC1, {101, 200}, Mat::MAPFILE_READ_ONLY, header), cv::Exception);
+    EXPECT_THROW(Mat::mapFile(fname + ".not_exists", CV_8UC1, {1}), cv::Exception);
+    EXPECT_EQ(0, remove(fname.c_str()));
+
+    // new file
+    {
+        Mat created = Mat::mapFile(fname, CV_8UC3, {2, 3, 4}, Mat::MAPFILE_CREATE);
+        EXPECT_EQ(3, created.dims);
+        created.setTo(Scalar(1, 2, 3));
+    }
+    m = Mat::mapFile(fname, CV_8UC1, std::vector<int>());
+    EXPECT_EQ(2 * 3 * 4 * 3, (int)m.total());
+    EXPECT_EQ(2.0 * 3 * 4 * (1 + 2 + 3), cv::sum(m)[0]);
+    m.release();
+    EXPECT_EQ(0, remove(fname.c_str()));
+}
+
 }} // namespace
@@ -7,6 +7,8 @@
 #include "opencv2/core/utils/logger.hpp"
 
 #include <opencv2/core/utils/fp_control_utils.hpp>
+#include <opencv2/core/parallel/parallel_backend.hpp>
+#include <opencv2/core/parallel/parallel_metrics.hpp>
 
 #include <chrono>
 #include <thread>
@@ -304,6 +306,136 @@ TEST(Core_Parallel, propagate_fp_denormals_ignore_hint)
     }
 }
 
+class NestedSumParallelLoopBody : public cv::ParallelLoopBody
+{
+public:
+    NestedSumParallelLoopBody(cv::Mat& dst) : dst_(dst) {}
+    void operator()(const cv::Range& r) const
+    {
+        for (int i = r.start; i < r.end; i++)
+        {
+            Mat row = dst_.row(i);
+            parallel_for_(cv::Range(0, row.cols), [&](const cv::Range& c) {
+                for (int j = c.start; j < c.end; j++)
+                    row.at<int>(j) += i + j;
+            });
+        }
+    }
+protected:
+    Mat dst_;
+};
+
+static void checkNestedSum(const Mat& dst)
+{
+    for (int i = 0; i < dst.rows; i++)
+        for (int j = 0; j < dst.cols; j++)
+            ASSERT_EQ(i + j, dst.at<int>(i, j)) << "i=" << i << " j=" << j;
+}
+
+TEST(Core_Parallel, worksteal_backend)
+{
+    ASSERT_TRUE(cv::parallel::setParallelForBackend("WORKSTEAL"));
+
+    // nested calls
+    Mat dst(64, 1000, CV_32SC1, Scalar::all(0));
+    EXPECT_NO_THROW(parallel_for_(cv::Range(0, dst.rows), NestedSumParallelLoopBody(dst)));
+    checkNestedSum(dst);
+
+    // concurrent calls from application threads
+    const int nAppThreads = 4;
+    std::vector<Mat> results(nAppThreads);
+    std::vector<std::thread> appThreads;
+    for (int t = 0; t < nAppThreads; t++)
+    {
+        appThreads.push_back(std::thread([&results, t]() {
+            Mat m(32, 333, CV_32SC1, Scalar::all(0));
+            parallel_for_(cv::Range(0, m.rows), NestedSumParallelLoopBody(m));
+            results[t] = m;
+        }));
+    }
+    for (size_t t = 0; t < appThreads.size(); t++)
+        appThreads[t].join();
+    for (int t = 0; t < nAppThreads; t++)
+    {
+        SCOPED_TRACE(cv::format("thread=%d", t));
+        ASSERT_FALSE(results[t].empty());
+        checkNestedSum(results[t]);
+    }
+
+    // exceptions
+    Mat dst2(1000, 100, CV_8SC1, Scalar::all(0));
+    EXPECT_THROW({
+        parallel_for_(cv::Range(0, dst2.rows), ThrowErrorParallelLoopBody(dst2, dst2.rows / 2));
+    }, cv::Exception);
+
+    cv::parallel::setParallelForBackend(std::string());  // restore default backend
+}
+
+TEST(Core_Parallel, metrics)
+{
+    const int prevThreads = cv::getNumThreads();
+    cv::setNumThreads(4);
+    cv::parallel::setParallelForMetricsEnabled(true);
+    cv::parallel::resetParallelForStatistics();
+
+    Mat m(1000, 100, CV_8UC1, Scalar::all(0));
+    parallel_for_(cv::Range(0, m.rows), [&](const cv::Range& r) {
+        m.rowRange(r.start, r.end) += Scalar::all(1);
+    });
+    cv::parallel::ParallelForMetrics metrics;
+    bool collected = cv::parallel::getLastParallelForMetrics(metrics);
+    std::vector<cv::parallel::ParallelForStatistics> stat = cv::parallel::getParallelForStatistics();
+
+    cv::parallel::setParallelForMetricsEnabled(false);
+    cv::setNumThreads(prevThreads);
+
+    EXPECT_EQ(m.total(), (size_t)cv::countNonZero(m));
+    if (!collected)
+        throw SkipTestException("parallel_for_() metrics are collected by builtin thread pool only");
+
+    EXPECT_EQ(1000, metrics.rangeSize);
+    EXPECT_GT(metrics.stripes, 1);
+    EXPECT_GE(metrics.threads, 1);
+    EXPECT_GT(metrics.wallTime, 0.0);
+    ASSERT_EQ(metrics.busyTime.size(), metrics.idleTime.size());
+    EXPECT_LE((size_t)metrics.threads, metrics.busyTime.size());
+    EXPECT_GE(metrics.stragglerRatio, 1.0 - 1e-6);
+    EXPECT_LE(metrics.stragglerRatio, metrics.threads + 1e-6);
+    for (size_t i = 0; i < metrics.busyTime.size(); i++)
+    {
+        EXPECT_GE(metrics.busyTime[i], 0.0);
+        EXPECT_LE(metrics.busyTime[i], metrics.wallTime * 1.01);
+        EXPECT_GE(metrics.idleTime[i], 0.0);
+    }
+
+    ASSERT_EQ(1u, stat.size());
+    EXPECT_EQ(1, stat[0].calls);
+    EXPECT_EQ(metrics.stripes, stat[0].stripes);
+    EXPECT_EQ(metrics.threads, stat[0].maxThreads);
+    EXPECT_FALSE(stat[0].name.empty());
+
+    // lambdas of different call sites have separate entries
+    cv::parallel::setParallelForMetricsEnabled(true);
+    cv::setNumThreads(4);
+    for (int i = 0; i < 2; i++)
+    {
+        parallel_for_(cv::Range(0, m.rows), [&](const cv::Range& r) {
+            m.rowRange(r.start, r.end) -= Scalar::all(1);
+        });
+    }
+    stat = cv::parallel::getParallelForStatistics();
+    cv::parallel::setParallelForMetricsEnabled(false);
+    cv::setNumThreads(prevThreads);
+
+    EXPECT_EQ(0, cv::countNonZero(m));
+    ASSERT_EQ(2u, stat.size());
+    EXPECT_NE(stat[0].name, stat[1].name);
+    EXPECT_EQ(3, stat[0].calls + stat[1].calls);
+
+    cv::parallel::resetParallelForStatistics();
+    EXPECT_TRUE(cv::parallel::getParallelForStatistics().empty());
+}
+
 TEST(Core_Version, consistency)
 {
     // this test verifies that OpenCV version loaded in runtime
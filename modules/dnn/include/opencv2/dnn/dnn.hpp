@@ -104,7 +104,13 @@ CV__DNN_INLINE_NS_BEGIN
         DNN_TARGET_CUDA_FP16,
         DNN_TARGET_HDDL,
         DNN_TARGET_NPU,
-        DNN_TARGET_CPU_FP16, // Only the ARM platform is supported. Low precision computing, accelerate model inference.
+        DNN_TARGET_CPU_FP16, //!< Low precision computing, accelerate model inference. ARM v8 computes in FP16.
+                             //!< On x86 CPUs with AVX2 this is only a weight storage fallback: the weights of generic
+                             //!< convolutions and of GEMM with constant B are kept in FP16 and expanded to FP32 (F16C)
+                             //!< while they are loaded, activations and arithmetic stay in FP32, depthwise and Winograd
+                             //!< convolutions are not affected. FP16/BF16 activations and AVX512-FP16, AVX512-BF16 or
+                             //!< AMX computations are not implemented. The target is not listed by getAvailableTargets()
+                             //!< on x86, it has to be set explicitly.
     };
 
     /**
@@ -658,6 +664,22 @@ CV__DNN_INLINE_NS_BEGIN
         CV_WRAP_AS(forwardAndRetrieve) void forward(CV_OUT std::vector<std::vector<Mat> >& outputBlobs,
                                                     const std::vector<String>& outBlobNames);
 
+        /** @brief Creates an execution context which shares the layers of this network.
+         *  @details The context is a network that refers to the layers of this one, together with
+         *  their weights and prepacked kernels, and owns only the memory for intermediate blobs.
+         *  Several threads can run forward() at the same time, each one on its own context.
+         *
+         *  The context is created for the input shapes and the outputs of the last forward() call
+         *  of this network, so run forward() once before creating contexts. The contexts then accept
+         *  inputs of the same shapes and any of these outputs. They can't be used anymore after this
+         *  network is reconfigured or gets inputs of other shapes.
+         *
+         *  Only dnn::DNN_BACKEND_OPENCV backend with dnn::DNN_TARGET_CPU or dnn::DNN_TARGET_CPU_FP16
+         *  target is supported. Layers that keep a state between forward calls or take their weights
+         *  from network inputs must not be shared.
+         */
+        CV_WRAP Net createExecutionContext();
+
         /** @brief Returns a quantized Net from a floating-point Net.
          *  @param calibData Calibration data to compute the quantization parameters.
          *  @param inputsDtype Datatype of quantized net's inputs. Can be CV_32F or CV_8S.
@@ -713,6 +735,7 @@ CV__DNN_INLINE_NS_BEGIN
          * | DNN_TARGET_CUDA        |                    |                              |                    |                 + |
          * | DNN_TARGET_CUDA_FP16   |                    |                              |                    |                 + |
          * | DNN_TARGET_HDDL        |                    |                            + |                    |                   |
+         * | DNN_TARGET_CPU_FP16    |                  + |                              |                    |                   |
          */
         CV_WRAP void setPreferableTarget(int targetId);
 
@@ -863,6 +886,20 @@ CV__DNN_INLINE_NS_BEGIN
                                           CV_OUT std::vector<size_t>& weights,
                                           CV_OUT std::vector<size_t>& blobs) const; // FIXIT: CV_WRAP
 
+        /** @brief Computes bytes number which are required to store intermediate blobs
+         * with and without reuse of their memory.
+         * @param netInputShapes vector of shapes for all net inputs.
+         * @param weights output parameter to store resulting bytes for weights.
+         * @param blobs output parameter to store resulting bytes for intermediate blobs
+         * (including internal buffers of layers) if every blob has its own memory.
+         * @param plannedBlobs output parameter to store resulting bytes for intermediate blobs
+         * if blobs that are not used at the same time share memory. The memory of dnn::DNN_BACKEND_OPENCV
+         * backend with CPU targets is planned this way.
+         */
+        void getMemoryConsumption(const std::vector<MatShape>& netInputShapes,
+                                  CV_OUT size_t& weights, CV_OUT size_t& blobs,
+                                  CV_OUT size_t& plannedBlobs) const;
+
         /** @brief Enables or disables layer fusion in the network.
          * @param fusion true to enable the fusion, false to disable. The fusion is enabled by default.
          */
@@ -874,6 +911,19 @@ CV__DNN_INLINE_NS_BEGIN
         */
         CV_WRAP void enableWinograd(bool useWinograd);
 
+        /** @brief Sets the number of layers which may be computed concurrently.
+         *
+         * Layers which don't depend on each other (branches of Inception modules, heads of detectors,
+         * outputs of Split) are computed at the same time by the parallel backend, see cv::parallel_for_.
+         * The layers which are started together use a single thread each unless the parallel backend
+         * supports nested loops, and a layer without independent neighbours uses all the threads.
+         * The results do not depend on this setting.
+         * Supported by DNN_BACKEND_OPENCV on CPU targets only.
+         * @param nthreads maximal number of the concurrent layers. The values less than 2 disable
+         * the concurrent execution. The default is 0, it can be changed by OPENCV_DNN_INTER_OP_THREADS.
+         */
+        CV_WRAP void setInterOpThreads(int nthreads);
+
         /** @brief Returns overall time for inference and timings (in ticks) for layers.
          *
          * Indexes in returned vector correspond to layers ids. Some layers can be fused with others,
@@ -18,6 +18,15 @@ CV__DNN_INLINE_NS_BEGIN
  */
 CV_EXPORTS void skipModelImport(bool skip);
 
+/**
+ * @brief Overrides OPENCV_DNN_MEMORY_PLANNER for the networks allocated after the call.
+ * @param[in] enable Indicates whether the intermediate blobs of CPU networks are planned in a single arena.
+ * @returns the previous value.
+ *
+ * This is an internal OpenCV function not intended for users.
+ */
+CV_EXPORTS bool enableMemoryPlanner(bool enable);
+
 CV__DNN_INLINE_NS_END
 }} // namespace
 
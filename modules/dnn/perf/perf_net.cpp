@@ -21,6 +21,8 @@ public:
     dnn::Target target;
 
     dnn::Net net;
+    bool quantized = false; // run the model quantized to int8 by Net::quantize()
+    int interOpThreads = 0; // see Net::setInterOpThreads()
 
     DNNTestNetwork()
     {
@@ -41,6 +43,13 @@ public:
                 halide_scheduler = findDataFile(std::string("dnn/halide_scheduler_") + (target == DNN_TARGET_OPENCL ? "opencl_" : "") + halide_scheduler, true);
         }
         net = readNet(weights, proto);
+        if (quantized)
+        {
+            std::vector<Mat> calibData;
+            for(auto &inp: inputs)
+                calibData.push_back(std::get<0>(inp));
+            net = net.quantize(calibData, CV_32F, CV_32F);
+        }
         // Set multiple inputs
         for(auto &inp: inputs){
             net.setInput(std::get<0>(inp), std::get<1>(inp));
@@ -48,6 +57,7 @@ public:
 
         net.setPreferableBackend(backend);
         net.setPreferableTarget(target);
+        net.setInterOpThreads(interOpThreads);
         if (backend == DNN_BACKEND_HALIDE)
         {
             net.setHalideScheduler(halide_scheduler);
@@ -77,6 +87,21 @@ public:
         SANITY_CHECK_NOTHING();
     }
 
+    void useInt8()
+    {
+        if (backend != DNN_BACKEND_OPENCV || target != DNN_TARGET_CPU)
+            throw SkipTestException("");
+        quantized = true;
+    }
+
+    // compute the independent branches concurrently
+    void useInterOpThreads()
+    {
+        if (backend != DNN_BACKEND_OPENCV || (target != DNN_TARGET_CPU && target != DNN_TARGET_CPU_FP16))
+            throw SkipTestException("");
+        interOpThreads = getNumThreads();
+    }
+
     void processNet(std::string weights, std::string proto, std::string halide_scheduler,
                     Mat &input, const std::string& outputLayer = "")
     {
@@ -445,6 +470,86 @@ PERF_TEST_P_(DNNTestNetwork, VIT_B_32)
     processNet("dnn/onnx/models/vit_b_32.onnx", "", "", cv::Size(224, 224));
 }
 
+PERF_TEST_P_(DNNTestNetwork, AlexNet_int8)
+{
+    useInt8();
+    processNet("dnn/bvlc_alexnet.caffemodel", "dnn/bvlc_alexnet.prototxt",
+            "", cv::Size(227, 227));
+}
+
+PERF_TEST_P_(DNNTestNetwork, GoogLeNet_int8)
+{
+    useInt8();
+    processNet("dnn/bvlc_googlenet.caffemodel", "dnn/bvlc_googlenet.prototxt",
+            "", cv::Size(224, 224));
+}
+
+PERF_TEST_P_(DNNTestNetwork, ResNet_50_int8)
+{
+    useInt8();
+    processNet("dnn/ResNet-50-model.caffemodel", "dnn/ResNet-50-deploy.prototxt",
+            "", cv::Size(224, 224));
+}
+
+PERF_TEST_P_(DNNTestNetwork, SqueezeNet_v1_1_int8)
+{
+    useInt8();
+    processNet("dnn/squeezenet_v1.1.caffemodel", "dnn/squeezenet_v1.1.prototxt",
+            "", cv::Size(227, 227));
+}
+
+PERF_TEST_P_(DNNTestNetwork, MobileNet_SSD_Caffe_int8)
+{
+    useInt8();
+    processNet("dnn/MobileNetSSD_deploy_19e3ec3.caffemodel", "dnn/MobileNetSSD_deploy_19e3ec3.prototxt", "",
+            cv::Size(300, 300));
+}
+
+PERF_TEST_P_(DNNTestNetwork, DenseNet_121_int8)
+{
+    useInt8();
+    processNet("dnn/DenseNet_121.caffemodel", "dnn/DenseNet_121.prototxt", "",
+               cv::Size(224, 224));
+}
+
+PERF_TEST_P_(DNNTestNetwork, GoogLeNet_inter_op)
+{
+    useInterOpThreads();
+    processNet("dnn/bvlc_googlenet.caffemodel", "dnn/bvlc_googlenet.prototxt",
+            "", cv::Size(224, 224));
+}
+
+PERF_TEST_P_(DNNTestNetwork, Inception_5h_inter_op)
+{
+    useInterOpThreads();
+    processNet("dnn/tensorflow_inception_graph.pb", "", "",
+            cv::Size(224, 224), "softmax2");
+}
+
+PERF_TEST_P_(DNNTestNetwork, MobileNet_SSD_Caffe_inter_op)
+{
+    useInterOpThreads();
+    processNet("dnn/MobileNetSSD_deploy_19e3ec3.caffemodel", "dnn/MobileNetSSD_deploy_19e3ec3.prototxt", "",
+            cv::Size(300, 300));
+}
+
+PERF_TEST_P_(DNNTestNetwork, Inception_v2_SSD_TensorFlow_inter_op)
+{
+    applyTestTag(CV_TEST_TAG_DEBUG_VERYLONG);
+
+    useInterOpThreads();
+    processNet("dnn/ssd_inception_v2_coco_2017_11_17.pb", "ssd_inception_v2_coco_2017_11_17.pbtxt", "",
+            cv::Size(300, 300));
+}
+
+PERF_TEST_P_(DNNTestNetwork, YOLOv4_tiny_inter_op)
+{
+    useInterOpThreads();
+    Mat sample = imread(findDataFile("dnn/dog416.png"));
+    Mat inp = blobFromImage(sample, 1.0 / 255.0, Size(), Scalar(), true);
+    processNet("dnn/yolov4-tiny-2020-12.weights", "dnn/yolov4-tiny-2020-12.cfg", "", inp);
+}
+
 INSTANTIATE_TEST_CASE_P(/*nothing*/, DNNTestNetwork, dnnBackendsAndTargets());
 
 } // namespace
@@ -15,6 +15,19 @@ CV__DNN_INLINE_NS_BEGIN
 #define IS_DNN_OPENCL_TARGET(id) (id == DNN_TARGET_OPENCL || id == DNN_TARGET_OPENCL_FP16)
 #define IS_DNN_CPU_TARGET(id) (id == DNN_TARGET_CPU || id == DNN_TARGET_CPU_FP16)
 #define IS_DNN_VULKAN_TARGET(id) (id == DNN_TARGET_VULKAN)
+
+/// DNN_TARGET_CPU_FP16 computes in FP16 on ARM v8 and keeps the weights in FP16 on x86 with AVX2 (F16C)
+inline bool haveCPU_FP16()
+{
+#if defined(__arm64__) && __arm64__
+    return true;
+#elif CV_TRY_AVX2
+    return checkHardwareSupport(CPU_AVX2);
+#else
+    return false;
+#endif
+}
+
 Mutex& getInitializationMutex();
 void initializeLayerFactory();
 
@@ -31,6 +44,12 @@ size_t getParam_DNN_NETWORK_DUMP();
 /// This parameter is useful to run with valgrind memory errors detection
 bool getParam_DNN_DISABLE_MEMORY_OPTIMIZATIONS();
 
+/// Memory plan of intermediate blobs on CPU (see BlobManager)
+bool getParam_DNN_MEMORY_PLANNER();
+
+/// Default number of layers which may run concurrently on CPU (see Net::setInterOpThreads)
+int getParam_DNN_INTER_OP_THREADS();
+
 #ifdef HAVE_OPENCL
 bool getParam_DNN_OPENCL_ALLOW_ALL_DEVICES();
 #endif
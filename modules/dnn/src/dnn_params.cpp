@@ -6,6 +6,7 @@
 
 #include "dnn_common.hpp"
 #include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/dnn/utils/debug_utils.hpp>
 
 namespace cv {
 namespace dnn {
@@ -25,6 +26,32 @@ bool getParam_DNN_DISABLE_MEMORY_OPTIMIZATIONS()
     return DNN_DISABLE_MEMORY_OPTIMIZATIONS;
 }
 
+// memory plan of intermediate blobs on CPU, otherwise released blobs are reused
+static bool& memoryPlannerFlag()
+{
+    static bool DNN_MEMORY_PLANNER = utils::getConfigurationParameterBool("OPENCV_DNN_MEMORY_PLANNER", true);
+    return DNN_MEMORY_PLANNER;
+}
+
+bool getParam_DNN_MEMORY_PLANNER()
+{
+    return memoryPlannerFlag();
+}
+
+bool enableMemoryPlanner(bool enable)
+{
+    bool& flag = memoryPlannerFlag();
+    bool prev = flag;
+    flag = enable;
+    return prev;
+}
+
+int getParam_DNN_INTER_OP_THREADS()
+{
+    static int DNN_INTER_OP_THREADS = (int)utils::getConfigurationParameterSizeT("OPENCV_DNN_INTER_OP_THREADS", 0);
+    return DNN_INTER_OP_THREADS;
+}
+
 #ifdef HAVE_OPENCL
 bool getParam_DNN_OPENCL_ALLOW_ALL_DEVICES()
 {
@@ -163,6 +163,7 @@ public:
     enum { VEC_ALIGN = 32, DFT_TYPE = CV_8S };
     Mat weightsMat;
     std::vector<int> biasvec;
+    std::vector<int> weightsSum; // sums of the weights rows, used by the AVX512-VNNI kernel
     std::vector<float> outputMultiplier;
     Mat activationLUT;
     Ptr<ActivationLayerInt8> activ;
@@ -262,6 +263,10 @@ public:
         }
         weightsMat = wm;
 
+        weightsSum.resize(numOutput);
+        for(int i = 0; i < numOutput; i++ )
+            weightsSum[i] = (int)cv::sum(wm.row(i))[0];
+
         Mat biasMat = blobs[1];
         biasvec.resize(numOutput+2);
 
@@ -696,11 +701,13 @@ public:
         int ngroups_, nstripes_;
         std::vector<int> ofstab_;
         const std::vector<int>* biasvec_;
+        std::vector<int> biasvecVNNI_; // biasvec compensated for the unsigned activations of the VNNI kernel
         const Mat* activLUT_;
         const ActivationLayerInt8* activ_;
         bool is1x1_;
         bool useAVX2;
         bool useAVX512;
+        bool useVNNI;
         bool useLASX;
         bool useRVV;
         int blk_size_cn;
@@ -709,12 +716,12 @@ public:
 
         ParallelConv()
             : input_(0), weights_(0), output_(0), ngroups_(0), nstripes_(0),
-              biasvec_(0), activLUT_(0), activ_(0), is1x1_(false), useAVX2(false), useAVX512(false), useLASX(false), useRVV(false)
+              biasvec_(0), activLUT_(0), activ_(0), is1x1_(false), useAVX2(false), useAVX512(false), useVNNI(false), useLASX(false), useRVV(false)
             , blk_size_cn(0), inpZp(0), outZp(0), multiplier(0)
         {}
 
         static void run( const Mat& input, Mat& output, const Mat& weights, const std::vector<float>& multipliers,
-                         const std::vector<int>& biasvec, const Mat& activLUT,
+                         const std::vector<int>& biasvec, const std::vector<int>& weightsSum, const Mat& activLUT,
                          const std::vector<size_t>& kernel_size, const std::vector<size_t>& strides,
                          const std::vector<size_t>& pads_begin, const std::vector<size_t>& pads_end,
                          const std::vector<size_t>& dilations,
@@ -764,6 +771,7 @@ public:
 
             p.useAVX2   = checkHardwareSupport(CPU_AVX2) && isConv2D;
             p.useAVX512 = CV_CPU_HAS_SUPPORT_AVX512_SKX  && isConv2D;
+            p.useVNNI   = CV_CPU_HAS_SUPPORT_AVX512_CLX  && isConv2D;
 
             p.useLASX   = checkHardwareSupport(CPU_LASX) && isConv2D;
             p.useRVV   = checkHardwareSupport(CPU_RVV) && isConv2D;
@@ -815,6 +823,16 @@ public:
             }
 
             p.biasvec_ = &biasvec;
+            if (p.useVNNI)
+            {
+                // vpdpbusd takes the activations as uint8 (x + 128), 128*sum(w) is subtracted in advance
+                int outCnAll = output.size[1];
+                CV_Assert(weightsSum.size() == (size_t)outCnAll);
+                p.biasvecVNNI_.resize(outCnAll + 2);
+                for( int i = 0; i < outCnAll; i++ )
+                    p.biasvecVNNI_[i] = biasvec[i] - 128*weightsSum[i];
+                p.biasvecVNNI_[outCnAll] = p.biasvecVNNI_[outCnAll+1] = p.biasvecVNNI_[outCnAll-1];
+            }
             p.activLUT_ = &activLUT;
             p.activ_ = !activLUT.empty() ? activ : 0;
 
@@ -894,6 +912,7 @@ public:
             const int8_t* wptr_orig_ = weights_->ptr<int8_t>();
             size_t wstep = weights_->step1();
             const int* biasptr_ = &biasvec_->at(0);
+            const int* biasptrVNNI_ = useVNNI ? &biasvecVNNI_[0] : 0;
             const float* multptr_ = &multiplier->at(0);
             const int* lutptr_ = !activLUT_->empty() ? activLUT_->ptr<int>() : 0;
             int* data_out0_ = output_->ptr<int>();
@@ -933,6 +952,7 @@ public:
                 int startOutCn = (subsampleIdx % ngroups)*outCn;
                 const int8_t* wptr_orig = wptr_orig_ + wstep*startOutCn;
                 const int* biasptr = biasptr_ + startOutCn;
+                const int* biasptrVNNI = biasptrVNNI_ ? biasptrVNNI_ + startOutCn : 0;
                 const float* multptr = multptr_ + startOutCn;
 
                 for( int cn0 = 0; cn0 < inpCn; cn0 += blk_size_cn )
@@ -1347,6 +1367,15 @@ public:
                         }
                         // now compute dot product of the weights
                         // and im2row-transformed part of the tensor
+                    #if CV_TRY_AVX512_CLX
+                        if(useVNNI)
+                        {
+                            opt_AVX512_CLX::fastShiftToUnsigned(rowbuf0, (size_t)bsz*vsz_a);
+                            opt_AVX512_CLX::fastConv(wptr, wstep, biasptrVNNI, rowbuf0, data_out0 + ofs0,
+                                          outShape, bsz, vsz, vsz_a, outZp, multptr, cn0 == 0, cn1 == inpCn);
+                        }
+                        else
+                    #endif
                     #if CV_TRY_AVX512_SKX
                         if(useAVX512)
                             opt_AVX2::fastConv(wptr, wstep, biasptr, rowbuf0, data_out0 + ofs0,
@@ -1534,7 +1563,7 @@ public:
         int nstripes = std::max(getNumThreads(), 1);
         Mat outputInt32 = Mat(shape(outputs[0]), CV_32S);
 
-        ParallelConv::run(inputs[0], outputInt32, weightsMat, outputMultiplier, biasvec, activationLUT, kernel_size, strides,
+        ParallelConv::run(inputs[0], outputInt32, weightsMat, outputMultiplier, biasvec, weightsSum, activationLUT, kernel_size, strides,
                           pads_begin, pads_end, dilations, activ.get(), ngroups, nstripes, input_zp, output_zp);
 
         outputInt32.convertTo(outputs[0], CV_8S);
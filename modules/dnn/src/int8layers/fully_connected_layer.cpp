@@ -53,6 +53,11 @@ public:
             }
             biasMat = blobs[1] = blobs[1].reshape(1, 1);
             outputMultiplier = blobs[2];
+
+            // the AVX512-VNNI kernel takes the input as uint8 (x + 128), so 128*sum(w) is subtracted in advance
+            biasMatVNNI.create(1, numOutput, CV_32S);
+            for (int i = 0; i < numOutput; i++)
+                biasMatVNNI.at<int>(i) = biasMat.at<int>(i) - 128*(int)cv::sum(blobs[0].row(i))[0];
         }
     }
 
@@ -227,10 +232,10 @@ public:
     class FullyConnected : public ParallelLoopBody
     {
     public:
-        FullyConnected() : srcMat(0), weights(0), biasMat(0), outputMultiplier(0), activationLUT(0), activ(0),
-                           dstMat(0), nstripes(0), outZp(0), useAVX2(false), useAVX512(false), useLASX(false), useRVV(false) {}
+        FullyConnected() : srcMat(0), weights(0), biasMat(0), biasMatVNNI(0), outputMultiplier(0), activationLUT(0), activ(0),
+                           dstMat(0), nstripes(0), outZp(0), useAVX2(false), useAVX512(false), useVNNI(false), useLASX(false), useRVV(false) {}
 
-        static void run(const Mat& srcMat, const Mat& weights, const Mat& biasMat, const Mat& outputMultiplier,
+        static void run(const Mat& srcMat, const Mat& weights, const Mat& biasMat, const Mat& biasMatVNNI, const Mat& outputMultiplier,
                         const Mat& activationLUT, Mat& dstMat, const ActivationLayerInt8* activ, int nstripes, int outZp)
         {
             CV_Assert( srcMat.dims == 2 && srcMat.cols == weights.cols &&
@@ -244,6 +249,7 @@ public:
             p.srcMat = &srcMat;
             p.weights = &weights;
             p.biasMat = &biasMat;
+            p.biasMatVNNI = &biasMatVNNI;
             p.outputMultiplier = &outputMultiplier;
             p.activationLUT = &activationLUT;
             p.dstMat = &dstMat;
@@ -252,6 +258,7 @@ public:
             p.activ = !activationLUT.empty() ? activ : 0;
             p.useAVX2 = checkHardwareSupport(CPU_AVX2);
             p.useAVX512 = CV_CPU_HAS_SUPPORT_AVX512_SKX;
+            p.useVNNI = CV_CPU_HAS_SUPPORT_AVX512_CLX && biasMatVNNI.total() == biasMat.total();
             p.useLASX = checkHardwareSupport(CPU_LASX);
             p.useRVV = checkHardwareSupport(CPU_RVV);
 
@@ -289,6 +296,14 @@ public:
                 int nw = std::min(nw0 - delta, (int)(stripeEnd - ofs));
 
                 memcpy(sptr, sptr_, vecsize*sizeof(sptr[0]));
+            #if CV_TRY_AVX512_CLX
+                if( useVNNI )
+                {
+                    opt_AVX512_CLX::fastShiftToUnsigned( sptr, vecsize );
+                    opt_AVX512_CLX::fastGEMM1T( sptr, wptr, wstep, biasMatVNNI->ptr<int>() + delta, multptr, dptr, nw, vecsize, outZp );
+                }
+                else
+            #endif
             #if CV_TRY_AVX512_SKX
                 if( useAVX512 )
                     opt_AVX512_SKX::fastGEMM1T( sptr, wptr, wstep, biasptr, multptr, dptr, nw, vecsize, outZp );
@@ -362,12 +377,13 @@ public:
             }
         }
 
-        const Mat *srcMat, *weights, *biasMat, *outputMultiplier, *activationLUT;
+        const Mat *srcMat, *weights, *biasMat, *biasMatVNNI, *outputMultiplier, *activationLUT;
         const ActivationLayerInt8* activ;
         Mat* dstMat;
         int nstripes, outZp;
         bool useAVX2;
         bool useAVX512;
+        bool useVNNI;
         bool useLASX;
         bool useRVV;
     };
@@ -389,7 +405,7 @@ public:
         Mat dstMatInt32= Mat(shape(dstMat), CV_32S);
 
         const int nstripes = getNumThreads();
-        FullyConnected::run(srcMat, weightsMat, biasMat, outputMultiplier, activationLUT, dstMatInt32, activ.get(), nstripes, output_zp);
+        FullyConnected::run(srcMat, weightsMat, biasMat, biasMatVNNI, outputMultiplier, activationLUT, dstMatInt32, activ.get(), nstripes, output_zp);
         dstMatInt32.convertTo(dstMat, CV_8S);
     }
 
@@ -480,7 +496,7 @@ public:
     }
 #endif  // HAVE_DNN_NGRAPH
 
-    Mat weightsMat, biasMat, outputMultiplier, activationLUT;
+    Mat weightsMat, biasMat, biasMatVNNI, outputMultiplier, activationLUT;
     Ptr<ActivationLayerInt8> activ;
 };
 
@@ -26,6 +26,8 @@ void fastDepthwiseConv( const int8_t* wptr,
 void fastGEMM1T( const int8_t* vec, const int8_t* weights,
                  size_t wstep, const int* bias, const float* multiplier,
                  int* dst, int nvecs, int vecsize, int outZp );
+// AVX512_CLX only: maps the int8 operand of the VNNI kernels to uint8 (x + 128) in place
+void fastShiftToUnsigned( int8_t* data, size_t len );
 
 #if !defined(CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY) && CV_AVX2
 #define OPENCV_FMADD_EPI8(_Tpvec, func) \
@@ -46,6 +48,7 @@ OPENCV_FMADD_EPI8(__m256i, mm256)
 
 enum { FASCONV_BASE_VECSZ = 4 };
 
+#if !CV_AVX512_CLX // AVX512-VNNI versions of fastConv() and fastGEMM1T() are defined below
 void fastConv( const int8_t* weights, size_t wstep, const int* bias,
                const int8_t* rowbuf, int* output, const int* outShape,
                int blockSize, int vecsize, int vecsize_aligned, int outZp,
@@ -327,6 +330,7 @@ void fastConv( const int8_t* weights, size_t wstep, const int* bias,
     }
     _mm256_zeroupper();
 }
+#endif // !CV_AVX512_CLX
 
 static inline void _mm256_expand_mul_add(const __m256i& a, const __m256i& b,
                                          __m256i& out0, __m256i& out1, __m256i& out2, __m256i& out3)
@@ -561,6 +565,7 @@ void fastDepthwiseConv( const int8_t* wptr,
     _mm256_zeroupper();
 }
 
+#if !CV_AVX512_CLX
 // dst = vec * weights^t + bias
 void fastGEMM1T( const int8_t* vec, const int8_t* weights,
                  size_t wstep, const int* bias, const float* multiplier,
@@ -631,8 +636,286 @@ void fastGEMM1T( const int8_t* vec, const int8_t* weights,
 
     _mm256_zeroupper();
 }
+#endif // !CV_AVX512_CLX
 #endif // CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY
 
+#if !defined(CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY) && CV_AVX512_CLX
+// vpdpbusd multiplies unsigned bytes by signed bytes. The callers of the kernels below keep
+// the activations (rowbuf, vec) shifted to uint8 by fastShiftToUnsigned() and pass the bias
+// reduced by 128*sum(weights) of each output channel, so the results match the AVX2 kernels.
+
+void fastShiftToUnsigned( int8_t* data, size_t len )
+{
+    const __m512i vsign = _mm512_set1_epi8((char)0x80);
+    size_t i = 0;
+    for( ; i + 64 <= len; i += 64 )
+        _mm512_storeu_si512(data + i, _mm512_xor_si512(_mm512_loadu_si512(data + i), vsign));
+    for( ; i < len; i++ )
+        data[i] ^= (int8_t)0x80;
+}
+
+// 8 lanes of the sum of the upper and the lower halves
+static inline __m256i _mm512_fold_epi32(const __m512i& a)
+{
+    return _mm256_add_epi32(_mm512_castsi512_si256(a), _mm512_extracti32x8_epi32(a, 1));
+}
+
+// [sum(a), sum(b), sum(c), sum(d)]
+static inline __m128i _mm512_reduce4_epi32(const __m512i& a, const __m512i& b,
+                                           const __m512i& c, const __m512i& d)
+{
+    __m256i t = _mm256_hadd_epi32(_mm256_hadd_epi32(_mm512_fold_epi32(a), _mm512_fold_epi32(b)),
+                                  _mm256_hadd_epi32(_mm512_fold_epi32(c), _mm512_fold_epi32(d)));
+    return _mm_add_epi32(_mm256_castsi256_si128(t), _mm256_extracti128_si256(t, 1));
+}
+
+void fastConv( const int8_t* weights, size_t wstep, const int* bias,
+               const int8_t* rowbuf, int* output, const int* outShape,
+               int blockSize, int vecsize, int vecsize_aligned, int outZp,
+               const float* multiplier, bool initOutput, bool finalOutput )
+{
+    int outCn = outShape[1];
+    size_t outPlaneSize = outShape[2]*outShape[3];
+    int CV_DECL_ALIGNED(16) maskbuf[FASCONV_BASE_VECSZ] = {0};
+    int rsz = blockSize % FASCONV_BASE_VECSZ;
+    for( int i = 0; i < rsz; i++ )
+        maskbuf[FASCONV_BASE_VECSZ - i - 1] = -1;
+    __m128 mask = _mm_loadu_ps((const float*)maskbuf);
+    // rows are zero-padded to 32 bytes, the last 32-byte chunk is loaded with a mask
+    int vsz32 = (int)alignSize(vecsize, 32);
+    const __mmask64 tailmask = (__mmask64)0xffffffff;
+
+    for( int i = 0; i < outCn; i += 3 )
+    {
+        const int8_t* wptr0 = weights + i*wstep;
+        const int8_t* wptr1 = wptr0 + wstep;
+        const int8_t* wptr2 = wptr1 + wstep;
+        int* outptr0 = output + i*outPlaneSize;
+        int* outptr1 = outptr0 + outPlaneSize;
+        int* outptr2 = outptr1 + outPlaneSize;
+        int bias0 = bias[i], bias1 = bias[i+1], bias2 = bias[i+2];
+        float mult0 = multiplier[i], mult1 = multiplier[i+1], mult2 = multiplier[i+2];
+
+        if( i+2 >= outCn )
+        {
+            wptr2 = wptr1;
+            outptr2 = outptr1;
+            bias2 = bias1;
+            mult2 = mult1;
+
+            if( i+1 >= outCn )
+            {
+                wptr2 = wptr1 = wptr0;
+                outptr2 = outptr1 = outptr0;
+                bias2 = bias1 = bias0;
+                mult2 = mult1 = mult0;
+            }
+        }
+        int j = 0;
+        for( ; j < blockSize; j += FASCONV_BASE_VECSZ )
+        {
+            bool tail = false;
+            if (j + FASCONV_BASE_VECSZ > blockSize)
+            {
+                if (j == 0)
+                    break;
+                j = blockSize - FASCONV_BASE_VECSZ;
+                tail = true;
+            }
+            int k = 0;
+            const int8_t* rptr = rowbuf + j*vecsize_aligned;
+
+            __m512i vs00 = _mm512_setzero_si512(), vs01 = _mm512_setzero_si512(),
+                    vs02 = _mm512_setzero_si512(), vs03 = _mm512_setzero_si512(),
+                    vs10 = _mm512_setzero_si512(), vs11 = _mm512_setzero_si512(),
+                    vs12 = _mm512_setzero_si512(), vs13 = _mm512_setzero_si512(),
+                    vs20 = _mm512_setzero_si512(), vs21 = _mm512_setzero_si512(),
+                    vs22 = _mm512_setzero_si512(), vs23 = _mm512_setzero_si512();
+
+            for( ; k < vsz32; k += 64, rptr += 64 )
+            {
+                __m512i w0, w1, w2, r0, r1, r2, r3;
+                if( k + 64 <= vsz32 )
+                {
+                    w0 = _mm512_loadu_si512(wptr0 + k);
+                    w1 = _mm512_loadu_si512(wptr1 + k);
+                    w2 = _mm512_loadu_si512(wptr2 + k);
+                    r0 = _mm512_loadu_si512(rptr);
+                    r1 = _mm512_loadu_si512(rptr + vecsize_aligned);
+                    r2 = _mm512_loadu_si512(rptr + vecsize_aligned*2);
+                    r3 = _mm512_loadu_si512(rptr + vecsize_aligned*3);
+                }
+                else
+                {
+                    w0 = _mm512_maskz_loadu_epi8(tailmask, wptr0 + k);
+                    w1 = _mm512_maskz_loadu_epi8(tailmask, wptr1 + k);
+                    w2 = _mm512_maskz_loadu_epi8(tailmask, wptr2 + k);
+                    r0 = _mm512_maskz_loadu_epi8(tailmask, rptr);
+                    r1 = _mm512_maskz_loadu_epi8(tailmask, rptr + vecsize_aligned);
+                    r2 = _mm512_maskz_loadu_epi8(tailmask, rptr + vecsize_aligned*2);
+                    r3 = _mm512_maskz_loadu_epi8(tailmask, rptr + vecsize_aligned*3);
+                }
+
+                vs00 = _mm512_dpbusd_epi32(vs00, r0, w0);
+                vs10 = _mm512_dpbusd_epi32(vs10, r0, w1);
+                vs20 = _mm512_dpbusd_epi32(vs20, r0, w2);
+
+                vs01 = _mm512_dpbusd_epi32(vs01, r1, w0);
+                vs11 = _mm512_dpbusd_epi32(vs11, r1, w1);
+                vs21 = _mm512_dpbusd_epi32(vs21, r1, w2);
+
+                vs02 = _mm512_dpbusd_epi32(vs02, r2, w0);
+                vs12 = _mm512_dpbusd_epi32(vs12, r2, w1);
+                vs22 = _mm512_dpbusd_epi32(vs22, r2, w2);
+
+                vs03 = _mm512_dpbusd_epi32(vs03, r3, w0);
+                vs13 = _mm512_dpbusd_epi32(vs13, r3, w1);
+                vs23 = _mm512_dpbusd_epi32(vs23, r3, w2);
+            }
+
+            __m128i s0, s1, s2;
+
+            if( initOutput )
+            {
+                s0 = _mm_set1_epi32(bias0);
+                s1 = _mm_set1_epi32(bias1);
+                s2 = _mm_set1_epi32(bias2);
+            }
+            else
+            {
+                s0 = _mm_loadu_si128((__m128i*)(outptr0 + j));
+                s1 = _mm_loadu_si128((__m128i*)(outptr1 + j));
+                s2 = _mm_loadu_si128((__m128i*)(outptr2 + j));
+            }
+
+            s0 = _mm_add_epi32(s0, _mm512_reduce4_epi32(vs00, vs01, vs02, vs03));
+            s1 = _mm_add_epi32(s1, _mm512_reduce4_epi32(vs10, vs11, vs12, vs13));
+            s2 = _mm_add_epi32(s2, _mm512_reduce4_epi32(vs20, vs21, vs22, vs23));
+
+            if( finalOutput )
+            {
+                __m128i voutzp = _mm_set1_epi32(outZp);
+                __m128i outmin = _mm_set1_epi32(-128), outmax = _mm_set1_epi32(127);
+                s0 = _mm_add_epi32(voutzp, _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(s0), _mm_set1_ps(mult0))));
+                s1 = _mm_add_epi32(voutzp, _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(s1), _mm_set1_ps(mult1))));
+                s2 = _mm_add_epi32(voutzp, _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(s2), _mm_set1_ps(mult2))));
+
+                s0 = _mm_min_epi32(_mm_max_epi32(s0, outmin), outmax);
+                s1 = _mm_min_epi32(_mm_max_epi32(s1, outmin), outmax);
+                s2 = _mm_min_epi32(_mm_max_epi32(s2, outmin), outmax);
+            }
+            if( tail )
+            {
+                s0 =  _mm_castps_si128(_mm_blendv_ps(_mm_loadu_ps((const float*)outptr0 + j),  _mm_castsi128_ps(s0), mask));
+                s1 =  _mm_castps_si128(_mm_blendv_ps(_mm_loadu_ps((const float*)outptr1 + j),  _mm_castsi128_ps(s1), mask));
+                s2 =  _mm_castps_si128(_mm_blendv_ps(_mm_loadu_ps((const float*)outptr2 + j),  _mm_castsi128_ps(s2), mask));
+            }
+            _mm_storeu_si128((__m128i*)(outptr0 + j), s0);
+            _mm_storeu_si128((__m128i*)(outptr1 + j), s1);
+            _mm_storeu_si128((__m128i*)(outptr2 + j), s2);
+        }
+
+        for( ; j < blockSize; j++ )
+        {
+            const uint8_t* rptr0 = (const uint8_t*)rowbuf + j*vecsize_aligned;
+            int s00, s10, s20;
+
+            if( initOutput )
+            {
+                s00 = bias0;
+                s10 = bias1;
+                s20 = bias2;
+            }
+            else
+            {
+                s00 = outptr0[j];
+                s10 = outptr1[j];
+                s20 = outptr2[j];
+            }
+
+            for( int k = 0; k < vecsize; k++ )
+            {
+                int r = rptr0[k];
+                s00 += (int)wptr0[k]*r; s10 += (int)wptr1[k]*r; s20 += (int)wptr2[k]*r;
+            }
+
+            if( finalOutput )
+            {
+                s00 = std::min(std::max(outZp + (int)std::round(s00*mult0), -128), 127);
+                s10 = std::min(std::max(outZp + (int)std::round(s10*mult1), -128), 127);
+                s20 = std::min(std::max(outZp + (int)std::round(s20*mult2), -128), 127);
+            }
+            outptr0[j] = s00;
+            outptr1[j] = s10;
+            outptr2[j] = s20;
+        }
+    }
+    _mm256_zeroupper();
+}
+
+// dst = vec * weights^t + bias
+void fastGEMM1T( const int8_t* vec, const int8_t* weights,
+                 size_t wstep, const int* bias, const float* multiplier,
+                 int* dst, int nvecs, int vecsize, int outZp )
+{
+    int i = 0;
+    int vsz32 = (int)alignSize(vecsize, 32);
+    const __mmask64 tailmask = (__mmask64)0xffffffff;
+    __m256i voutzp = _mm256_set1_epi32(outZp);
+    __m256i outmin = _mm256_set1_epi32(-128), outmax = _mm256_set1_epi32(127);
+
+    for( ; i <= nvecs - 8; i += 8 )
+    {
+        const int8_t* wptr = weights + i*wstep;
+        __m512i vs0 = _mm512_setzero_si512(), vs1 = _mm512_setzero_si512(),
+                vs2 = _mm512_setzero_si512(), vs3 = _mm512_setzero_si512(),
+                vs4 = _mm512_setzero_si512(), vs5 = _mm512_setzero_si512(),
+                vs6 = _mm512_setzero_si512(), vs7 = _mm512_setzero_si512();
+
+        for( int k = 0; k < vsz32; k += 64, wptr += 64 )
+        {
+            __mmask64 m = k + 64 <= vsz32 ? (__mmask64)-1 : tailmask;
+            __m512i v = _mm512_maskz_loadu_epi8(m, vec + k);
+
+            vs0 = _mm512_dpbusd_epi32(vs0, v, _mm512_maskz_loadu_epi8(m, wptr));
+            vs1 = _mm512_dpbusd_epi32(vs1, v, _mm512_maskz_loadu_epi8(m, wptr + wstep));
+            vs2 = _mm512_dpbusd_epi32(vs2, v, _mm512_maskz_loadu_epi8(m, wptr + wstep*2));
+            vs3 = _mm512_dpbusd_epi32(vs3, v, _mm512_maskz_loadu_epi8(m, wptr + wstep*3));
+            vs4 = _mm512_dpbusd_epi32(vs4, v, _mm512_maskz_loadu_epi8(m, wptr + wstep*4));
+            vs5 = _mm512_dpbusd_epi32(vs5, v, _mm512_maskz_loadu_epi8(m, wptr + wstep*5));
+            vs6 = _mm512_dpbusd_epi32(vs6, v, _mm512_maskz_loadu_epi8(m, wptr + wstep*6));
+            vs7 = _mm512_dpbusd_epi32(vs7, v, _mm512_maskz_loadu_epi8(m, wptr + wstep*7));
+        }
+
+        __m256i t = _mm256_setr_m128i(_mm512_reduce4_epi32(vs0, vs1, vs2, vs3),
+                                      _mm512_reduce4_epi32(vs4, vs5, vs6, vs7));
+        t = _mm256_add_epi32(t, _mm256_loadu_si256((const __m256i*)(bias + i)));
+        t = _mm256_add_epi32(voutzp, _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(t),
+                                                                      _mm256_loadu_ps(multiplier + i))));
+        t = _mm256_min_epi32(_mm256_max_epi32(t, outmin), outmax);
+        _mm256_storeu_si256((__m256i*)(dst + i), t);
+    }
+
+    for( ; i < nvecs; i++ )
+    {
+        const int8_t* wptr = weights + i*wstep;
+        __m512i vs0 = _mm512_setzero_si512();
+
+        for( int k = 0; k < vsz32; k += 64 )
+        {
+            __mmask64 m = k + 64 <= vsz32 ? (__mmask64)-1 : tailmask;
+            vs0 = _mm512_dpbusd_epi32(vs0, _mm512_maskz_loadu_epi8(m, vec + k), _mm512_maskz_loadu_epi8(m, wptr + k));
+        }
+
+        int s0 = _mm512_reduce_add_epi32(vs0) + bias[i];
+        int out0 = outZp + (int)std::round(s0*multiplier[i]);
+        dst[i] = std::min(std::max(out0, -128), 127);
+    }
+
+    _mm256_zeroupper();
+}
+#endif // CV_AVX512_CLX
+
 
 #if !defined(CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY) && CV_LASX
 
@@ -432,6 +432,7 @@ public:
         }
 
         weightsMultipliers.assign(numOutput, 1.0);
+        fastConvImpl.release(); // repacked in forward() for the current weights and target
 
         Mat biasMat = hasBias() ? blobs[1].reshape(1, numOutput) : Mat();
         biasvec.resize(numOutput+2);
@@ -1257,13 +1258,14 @@ public:
         int ngroups = inputs[0].size[1] / inpGroupCn;
         CV_Assert(outputs[0].size[1] % ngroups == 0);
 
-        reluslope.clear();
+        // local, so that forward() doesn't modify the layer (see Net::createExecutionContext())
+        std::vector<float> slopes;
         if( activ )
         {
             Ptr<ReLULayer> activ_relu = activ.dynamicCast<ReLULayer>();
             if( !activ_relu.empty() )
             {
-                reluslope.assign(outCn+2, activ_relu->negativeSlope);
+                slopes.assign(outCn+2, activ_relu->negativeSlope);
             }
 
             Ptr<ChannelsPReLULayer> activ_chprelu = activ.dynamicCast<ChannelsPReLULayer>();
@@ -1272,9 +1274,9 @@ public:
                 const Mat& m = activ_chprelu->blobs[0];
                 CV_Assert(m.isContinuous() && m.type() == CV_32F && (int)m.total() == outCn);
                 const float* mdata = m.ptr<float>();
-                reluslope.resize(outCn+2);
-                std::copy(mdata, mdata + outCn, reluslope.begin());
-                reluslope[outCn] = reluslope[outCn+1] = reluslope[outCn-1];
+                slopes.resize(outCn+2);
+                std::copy(mdata, mdata + outCn, slopes.begin());
+                slopes[outCn] = slopes[outCn+1] = slopes[outCn-1];
             }
         }
 
@@ -1305,7 +1307,7 @@ public:
                 weightsMat.release();
             }
 
-            runFastConv(inputs[0], outputs[0], fastConvImpl, nstripes, activ, reluslope, fusedAdd);
+            runFastConv(inputs[0], outputs[0], fastConvImpl, nstripes, activ, slopes, fusedAdd);
         }
     }
 
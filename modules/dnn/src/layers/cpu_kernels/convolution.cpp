@@ -14,6 +14,7 @@
 
 #include "conv_block.simd.hpp"
 #include "layers/cpu_kernels/conv_block.simd_declarations.hpp" // defines CV_CPU_DISPATCH_MODES_ALL=AVX2,...,BASELINE based on CMakeLists.txt content
+#include <opencv2/core/hal/hal.hpp>
 #include <opencv2/core/utils/logger.hpp>
 
 namespace cv { namespace dnn {
@@ -190,6 +191,9 @@ Ptr<FastConv> initFastConv(
         conv->useFP16 = false;
         CV_LOG_ONCE_WARNING(NULL, "DNN: the CPU does not support the instruction set required by FP16, fallback to FP32.");
     }
+#elif CV_TRY_AVX2
+    if (_useFP16 && conv->conv_type == CONV_TYPE_GENERIC && conv->useAVX2)
+        conv->useFP16Weights = true;
 #endif
 
     float *srcWeights = (float *)weightsMat.data;
@@ -441,6 +445,13 @@ Ptr<FastConv> initFastConv(
                     }
                 }
             }});
+
+            if (conv->useFP16Weights)
+            {
+                conv->weightsBuf_FP16.resize(nweights + VEC_ALIGN);
+                hal::cvt32f16f(weightsPtr, conv->getWeightsFP16(), (int)nweights);
+                std::vector<float>().swap(conv->weightsBuf);
+            }
         }
     }
     else
@@ -1260,6 +1271,8 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
         esz = sizeof(__fp16);
     }
 #endif
+    // element size of the packed weights, differs from esz when only the weights are stored in FP16.
+    const int wesz = conv->useFP16Weights ? (int)sizeof(hfloat) : esz;
 
     int MAX_STRIPES = conv->conv_type == CONV_TYPE_DEPTHWISE_REMAIN ? 1 : (56 + CONV_NR - 1)/CONV_NR;
 
@@ -1289,7 +1302,10 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
     size_t stripesize = alignSize(CONV_NR * ksize * Cg, VEC_ALIGN);
     size_t cbufsize = alignSize(CONV_NR * K_BLOCK_SIZE * MAX_STRIPES, VEC_ALIGN);
 
-    size_t taskbufsize = cbufsize * sizeof(float );
+    // FP32 copy of the FP16 weights of one K_BLOCK_SIZE x C_BLOCK_SIZE block, shared by all the stripes.
+    size_t wbufsize = conv->useFP16Weights ? alignSize(K_BLOCK_SIZE * C_BLOCK_SIZE, VEC_ALIGN) : 0;
+
+    size_t taskbufsize = (cbufsize + wbufsize) * sizeof(float );
 
     if (!separateIm2col)
         taskbufsize += MAX_STRIPES * stripesize * esz;
@@ -1372,7 +1388,8 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
     for (int task_id = r0.start; task_id < r0.end; task_id++)
     {
         float * cbuf_task = (float *)(inpbuf_all + taskbufsize * task_id);
-        char * inpbuf_task = (char*)(cbuf_task + cbufsize);
+        float * wbuf_task = cbuf_task + cbufsize;
+        char * inpbuf_task = (char*)(wbuf_task + wbufsize);
 
         int ngs0 = (int)((size_t)nsubtasks * task_id / ntasks);
         int ngs1 = (int)((size_t)nsubtasks * (task_id+1) / ntasks);
@@ -1432,6 +1449,12 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
                 }
                 else
 #endif
+                if (conv->useFP16Weights)
+                {
+                    CV_Assert(!conv->weightsBuf_FP16.empty());
+                    weights = (char *)conv->getWeightsFP16();
+                }
+                else
                 {
                     CV_Assert(!conv->weightsBuf.empty());
                     weights = (char *)conv->getWeights();
@@ -1443,7 +1466,7 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
                     CV_Assert(weights);
                     size_t outofs = (n * ngroups + g) * out_planesize + zyx0;
                     float *cptr0 = cbuf_task;
-                    weights += g * padded_ksize * esz;
+                    weights += g * padded_ksize * wesz;
 
                     int out_width = zyx_block_limit - zyx0;
                     float *outptr = out + outofs;
@@ -1489,7 +1512,7 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
                 }
 
                 CV_Assert(weights);
-                weights += g * Kg_aligned * DkHkWkCg * esz;
+                weights += g * Kg_aligned * DkHkWkCg * wesz;
 
                 const float *biasptr = conv->biasBuf.data() + Kg * g;
                 int ldc = nstripes * CONV_NR;
@@ -1505,15 +1528,27 @@ void runFastConv(InputArray _input, OutputArray _output, const Ptr<FastConv>& co
                         const char *inptr = separateIm2col ? inpbuf_all_0 + (ng * stripes_per_plane0 + zyx0 / CONV_NR) * stripesize * esz :
                                             inpbuf_task;
                         inptr += (c0 * CONV_NR) * esz;
+
+                        char *wblock = weights + (k0_block * DkHkWkCg + c0 * CONV_MR) * wesz;
+                        size_t wstep = DkHkWkCg * CONV_MR * wesz;
+                        if (conv->useFP16Weights)
+                        {
+                            // expand the weights of the block once, all the stripes reuse them
+                            for (int k = k0_block; k < k1_block; k += CONV_MR, wblock += DkHkWkCg * CONV_MR * wesz)
+                                hal::cvt16f32f((const hfloat *)wblock, wbuf_task + (k - k0_block) * (c1 - c0), (c1 - c0) * CONV_MR);
+                            wblock = (char *)wbuf_task;
+                            wstep = (c1 - c0) * CONV_MR * sizeof(float);
+                        }
+
                         for (int stripe = 0; stripe < nstripes; stripe++, inptr += stripesize * esz)
                         {
                             const int outLen = std::min(out_width - stripe * CONV_NR, CONV_NR);
 
-                            char *wptr = weights + (k0_block * DkHkWkCg + c0 * CONV_MR) * esz;
+                            char *wptr = wblock;
                             float *cptr = cbuf_task + stripe * CONV_NR;
                             hfloat* cptr_f16 = (hfloat*)cbuf_task + stripe*CONV_NR;
                             for (int k = k0_block; k < k1_block; k += CONV_MR,
-                                    wptr += DkHkWkCg * CONV_MR * esz, cptr += CONV_MR * ldc, cptr_f16 += CONV_MR * ldc)
+                                    wptr += wstep, cptr += CONV_MR * ldc, cptr_f16 += CONV_MR * ldc)
                             {
 #if CV_TRY_AVX2
                                 if (conv->useAVX2)
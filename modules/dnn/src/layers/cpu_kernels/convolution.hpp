@@ -70,6 +70,9 @@ struct FastConv
     int conv_type;
     int conv_dim;  // Flag for conv1d, conv2d, or conv3d.
     bool useFP16 = false; // Only ARMv8 is supported.
+    // x86 counterpart of useFP16: only the packed weights of the generic convolution are kept in FP16,
+    // the AVX2 kernel expands them to FP32, so the data and the accumulators stay in FP32.
+    bool useFP16Weights = false;
 #if CV_SIMD128
     bool useSIMD128 = true;
 #else
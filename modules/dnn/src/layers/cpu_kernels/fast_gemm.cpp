@@ -155,6 +155,32 @@ void fastGemmPackB(bool trans, size_t N, size_t K, const float *B, size_t ldb, f
     }
 }
 
+void fastGemmPackB(const Mat &B, std::vector<hfloat> &packed_B, bool trans, FastGemmOpt &opt) {
+    CV_CheckTypeEQ(B.type(), CV_32F, "fastGemmPackB: only float32 is supported for now");
+    CV_Assert(opt.canPackFP16());
+
+#if CV_TRY_AVX2
+    auto B_shape = shape(B);
+    int batch = total(B_shape, 0, B_shape.size() - 2),
+        K = B_shape[B_shape.size() - 2], N = B_shape.back(), ldb0 = N, ldb1 = 1;
+    if (trans) {
+        std::swap(K, N);
+        std::swap(ldb0, ldb1);
+    }
+
+    const auto *b = B.ptr<const char>();
+    int esz = B.elemSize();
+    int size_packed_B = opt_AVX2::fastGemmPackBSize(N, K);
+    packed_B.resize(size_packed_B * batch);
+    auto *packed_b = (char*)packed_B.data();
+    for (int i = 0; i < batch; i++) {
+        opt_AVX2::fastGemmPackBKernelFP16(b, packed_b, N, K, ldb0, ldb1);
+        b += N * K * esz;
+        packed_b += size_packed_B * sizeof(hfloat);
+    }
+#endif
+}
+
 static void fast_gemm_thin(float alpha, float beta, int M, int N, int K,
                            const char *a_, int lda0, int lda1,
                            const char *b_, int ldb,
@@ -225,6 +251,23 @@ void fastGemm(bool trans_a, int M, int N, int K,
     }
 }
 
+void fastGemm(bool trans_a, int M, int N, int K,
+              float alpha, const float *A, int lda,
+              const hfloat *packed_B, float beta,
+              float *C, int ldc, FastGemmOpt &opt) {
+    CV_Assert(opt.canPackFP16());
+
+    int lda0 = lda, lda1 = 1;
+    if (trans_a) {
+        std::swap(lda0, lda1);
+    }
+
+#if CV_TRY_AVX2
+    opt_AVX2::fastGemmKernelFP16(M, N, K, alpha, (const char *)A, lda0, lda1, (const char *)packed_B,
+                                 beta, (char *)C, ldc, opt.multi_thread);
+#endif
+}
+
 void fastGemm(bool trans_a, bool trans_b, int ma, int na, int mb, int nb,
               float alpha, const float *A, int lda0, int lda1, const float *B, int ldb0, int ldb1,
               float beta, float *C, int ldc, FastGemmOpt &opt) {
@@ -374,6 +417,17 @@ void fastGemmBatch(size_t batch, const size_t *A_offsets, const size_t *packed_B
     }
 }
 
+void fastGemmBatch(size_t batch, const size_t *A_offsets, const size_t *packed_B_offsets, const size_t *C_offsets,
+                   int M, int N, int K, float alpha, const float *A, int lda0, int lda1,
+                   const hfloat *packed_B, float beta, float *C, int ldc, FastGemmOpt &opt) {
+    CV_Assert(opt.canPackFP16());
+
+#if CV_TRY_AVX2
+    opt_AVX2::fastGemmBatchKernelFP16(batch, A_offsets, packed_B_offsets, C_offsets, M, N, K, alpha,
+                                      (const char *)A, lda0, lda1, (const char *)packed_B, beta, (char *)C, ldc);
+#endif
+}
+
 void fastGemmBatch(bool trans_a, bool trans_b,
                    float alpha, const Mat &A, const Mat &B,
                    float beta, Mat &C, FastGemmOpt &opt) {
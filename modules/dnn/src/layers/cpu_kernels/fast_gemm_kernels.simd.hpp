@@ -110,6 +110,10 @@ static void fast_gemm_pack##N##suffix( int m, int k, const void* A_, \
 #define FAST_GEMM_PACK_f32_8(src, dst) FAST_GEMM_PACK_COPY((src), (dst), 8)
 #define FAST_GEMM_PACK_f32_12(src, dst) FAST_GEMM_PACK_COPY((src), (dst), 12)
 #define FAST_GEMM_PACK_f32_16(src, dst) FAST_GEMM_PACK_COPY((src), (dst), 16)
+#if CV_AVX2 // F16C comes together with AVX2
+#define FAST_GEMM_PACK_f16_8(src, dst) \
+    _mm_storeu_si128((__m128i*)(dst), _mm256_cvtps_ph(_mm256_loadu_ps(src), 0))
+#endif
 
 namespace cv { namespace dnn {
 
@@ -134,6 +138,16 @@ void fastGemmBatchKernel(size_t batch, const size_t *A_offsets, const size_t *B_
                          int M, int N, int K, float alpha, const char *A, int lda0, int lda1,
                          const char *packed_B, float beta, char *C, int ldc, int esz);
 
+// Same as above, but packed_B holds float16 values which are converted to float32 on the fly.
+// A and C are float32. Only AVX2 is supported.
+void fastGemmPackBKernelFP16(const char *B, char *packed_B, int N, int K, int ldb0, int ldb1);
+void fastGemmKernelFP16(int M, int N, int K,
+                        float alpha, const char *A, int lda0, int lda1,
+                        const char *packed_B, float beta, char *C, int ldc, bool multi_thread);
+void fastGemmBatchKernelFP16(size_t batch, const size_t *A_offsets, const size_t *B_offsets, const size_t *C_offsets,
+                             int M, int N, int K, float alpha, const char *A, int lda0, int lda1,
+                             const char *packed_B, float beta, char *C, int ldc);
+
 #ifndef CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY
 
 /*
@@ -233,9 +247,19 @@ FAST_GEMM_IMPLEMENT_PACK(12, _f32, float, float) // b packer
 #define _mm256_fmadd_ps(a, b, c) _mm256_add_ps(c, _mm256_mul_ps(a, b))
 #endif
 
+#if CV_AVX2
+FAST_GEMM_IMPLEMENT_PACK(8, _f16, float, hfloat) // b packer, float16 output
+#endif
+
+static inline __m256 fast_gemm_load8(const float* b) { return _mm256_loadu_ps(b); }
+#if CV_AVX2
+static inline __m256 fast_gemm_load8(const hfloat* b) { return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)b)); }
+#endif
+
+template<typename btype = float>
 static inline void fast_gemm12x8_f32(int k, const char *a_, const char *b_, char *c_, int ldc, float alpha) {
     const float* a = (const float*)a_;
-    const float* b = (const float*)b_;
+    const btype* b = (const btype*)b_;
     float* c = (float*)c_;
 
     __m256 s00 = _mm256_setzero_ps(),
@@ -251,7 +275,7 @@ static inline void fast_gemm12x8_f32(int k, const char *a_, const char *b_, char
            s100 = _mm256_setzero_ps(),
            s110 = _mm256_setzero_ps();
     for (int p = 0; p < k; p++, a += FAST_GEMM_F32_MR, b += FAST_GEMM_F32_NR) {
-        __m256 b0 = _mm256_loadu_ps(b);
+        __m256 b0 = fast_gemm_load8(b);
 
         __m256 a0 = _mm256_set1_ps(*a);
         s00 = _mm256_fmadd_ps(b0, a0, s00);
@@ -491,10 +515,12 @@ static inline void fast_gemm8x12_f32(int k, const char *a_, const char *b_,
 
 #endif
 
+template<typename btype = float>
 static inline void fast_gemm_macro_kernel(int m, int n, int k,
                                           const char *packed_A, const char *packed_B,
                                           float alpha, char *c, int ldc0, int esz) {
     int ldc0_esz = ldc0 * esz;
+    const int besz = (int)sizeof(btype);
 
     double tempC[FAST_GEMM_F32_MR * FAST_GEMM_F32_NR]; // make sure the buffer is big enough
     for(int i = 0; i < m; i += FAST_GEMM_F32_MR) {
@@ -514,13 +540,13 @@ static inline void fast_gemm_macro_kernel(int m, int n, int k,
                     memcpy(cptr + p * (ldc * esz), cptr0 + p * ldc0_esz, nr_esz);
             }
 #if CV_NEON && CV_NEON_AARCH64
-            fast_gemm8x12_f32(k, packed_A + i * k * esz, packed_B + j * k * esz, cptr, ldc, alpha);
+            fast_gemm8x12_f32(k, packed_A + i * k * esz, packed_B + j * k * besz, cptr, ldc, alpha);
 #elif CV_AVX
-            fast_gemm12x8_f32(k, packed_A + i * k * esz, packed_B + j * k * esz, cptr, ldc, alpha);
+            fast_gemm12x8_f32<btype>(k, packed_A + i * k * esz, packed_B + j * k * besz, cptr, ldc, alpha);
 #elif CV_LASX
-            fast_gemm12x16_f32(k, packed_A + i * k * esz, packed_B + j * k * esz, cptr, ldc, alpha);
+            fast_gemm12x16_f32(k, packed_A + i * k * esz, packed_B + j * k * besz, cptr, ldc, alpha);
 #elif CV_SIMD128
-            fast_gemm8x12_f32(k, packed_A + i * k * esz, packed_B + j * k * esz, cptr, ldc, alpha);
+            fast_gemm8x12_f32(k, packed_A + i * k * esz, packed_B + j * k * besz, cptr, ldc, alpha);
 #endif
 
             if (partial) {
@@ -655,9 +681,11 @@ void fastGemmKernel(int M, int N, int K,
 
 }
 
-void fastGemmKernel(int M, int N, int K,
-                    float alpha, const char *A, int lda0, int lda1,
-                    const char *packed_B, float beta, char *C, int ldc, int esz, bool multi_thread) {
+template<typename btype>
+static void fast_gemm_packed_b(int M, int N, int K,
+                               float alpha, const char *A, int lda0, int lda1,
+                               const char *packed_B, float beta, char *C, int ldc, int esz, bool multi_thread) {
+    const int besz = (int)sizeof(btype);
     int GEMM_MC = FAST_GEMM_F32_MC,
         GEMM_NC = FAST_GEMM_F32_NC,
         GEMM_MR = FAST_GEMM_F32_MR,
@@ -686,7 +714,7 @@ void fastGemmKernel(int M, int N, int K,
             int nc = N - j0 < NC ? N - j0 : NC;
             int ldc_block = ldc;
             char* c_block = C + (i0 * ldc + j0) * esz;
-            packed_b_ = packed_B + j0 * K * esz;
+            packed_b_ = packed_B + j0 * K * besz;
 
             if (beta == 0.f) {
                 for(int i = 0; i < mc; i++)
@@ -699,7 +727,7 @@ void fastGemmKernel(int M, int N, int K,
                 }
             }
 
-            int _nc = static_cast<int>((nc + GEMM_NR - 1) / GEMM_NR) * GEMM_NR * esz;
+            int _nc = static_cast<int>((nc + GEMM_NR - 1) / GEMM_NR) * GEMM_NR * besz;
             for(int k0 = 0; k0 < K; k0 += KC)
             {
                 int kc = K - k0 < KC ? K - k0 : KC;
@@ -715,7 +743,7 @@ void fastGemmKernel(int M, int N, int K,
 #endif
 
                 // run kernel
-                fast_gemm_macro_kernel(mc, nc, kc, packed_a, packed_b_, alpha, c_block, ldc_block, esz);
+                fast_gemm_macro_kernel<btype>(mc, nc, kc, packed_a, packed_b_, alpha, c_block, ldc_block, esz);
                 packed_b_ += _nc * kc;
             }
         }
@@ -734,6 +762,12 @@ void fastGemmKernel(int M, int N, int K,
     }
 }
 
+void fastGemmKernel(int M, int N, int K,
+                    float alpha, const char *A, int lda0, int lda1,
+                    const char *packed_B, float beta, char *C, int ldc, int esz, bool multi_thread) {
+    fast_gemm_packed_b<float>(M, N, K, alpha, A, lda0, lda1, packed_B, beta, C, ldc, esz, multi_thread);
+}
+
 void fastGemmBatchKernel(size_t batch, const size_t *A_offsets, const size_t *B_offsets, const size_t *C_offsets,
                          int M, int N, int K, float alpha, const char *A, int lda0, int lda1,
                          const char *B, int ldb0, int ldb1, float beta, char *C, int ldc, int esz) {
@@ -824,9 +858,11 @@ void fastGemmBatchKernel(size_t batch, const size_t *A_offsets, const size_t *B_
     parallel_for_(Range(0, total), fn, nstripes);
 }
 
-void fastGemmBatchKernel(size_t batch, const size_t *A_offsets, const size_t *B_offsets, const size_t *C_offsets,
-                         int M, int N, int K, float alpha, const char *A, int lda0, int lda1,
-                         const char *packed_B, float beta, char *C, int ldc, int esz) {
+template<typename btype>
+static void fast_gemm_batch_packed_b(size_t batch, const size_t *A_offsets, const size_t *B_offsets, const size_t *C_offsets,
+                                     int M, int N, int K, float alpha, const char *A, int lda0, int lda1,
+                                     const char *packed_B, float beta, char *C, int ldc, int esz) {
+    const int besz = (int)sizeof(btype);
     int GEMM_MC = FAST_GEMM_F32_MC,
         GEMM_NC = FAST_GEMM_F32_NC,
         GEMM_MR = FAST_GEMM_F32_MR,
@@ -859,7 +895,7 @@ void fastGemmBatchKernel(size_t batch, const size_t *A_offsets, const size_t *B_
             int nc = N - j0 < NC ? N - j0 : NC;
             int ldc_block = ldc;
             const char *a_block = A + A_offsets[batch_index] * esz;
-            packed_b = packed_B + B_offsets[batch_index] * esz + j0 * K * esz;
+            packed_b = packed_B + B_offsets[batch_index] * besz + j0 * K * besz;
             char* c_block = C + C_offsets[batch_index] * esz + (i0 * ldc + j0) * esz;
 
             if (beta == 0.f) {
@@ -873,7 +909,7 @@ void fastGemmBatchKernel(size_t batch, const size_t *A_offsets, const size_t *B_
                 }
             }
 
-            int _nc = static_cast<int>((nc + GEMM_NR - 1) / GEMM_NR) * GEMM_NR * esz;
+            int _nc = static_cast<int>((nc + GEMM_NR - 1) / GEMM_NR) * GEMM_NR * besz;
             for(int k0 = 0; k0 < K; k0 += KC)
             {
                 int kc = K - k0 < KC ? K - k0 : KC;
@@ -889,7 +925,7 @@ void fastGemmBatchKernel(size_t batch, const size_t *A_offsets, const size_t *B_
 #endif
 
                 // run kernel
-                fast_gemm_macro_kernel(mc, nc, kc, packed_a, packed_b, alpha, c_block, ldc_block, esz);
+                fast_gemm_macro_kernel<btype>(mc, nc, kc, packed_a, packed_b, alpha, c_block, ldc_block, esz);
                 packed_b += _nc * kc;
             }
         }
@@ -905,6 +941,49 @@ void fastGemmBatchKernel(size_t batch, const size_t *A_offsets, const size_t *B_
     parallel_for_(Range(0, total), fn, nstripes);
 }
 
+void fastGemmBatchKernel(size_t batch, const size_t *A_offsets, const size_t *B_offsets, const size_t *C_offsets,
+                         int M, int N, int K, float alpha, const char *A, int lda0, int lda1,
+                         const char *packed_B, float beta, char *C, int ldc, int esz) {
+    fast_gemm_batch_packed_b<float>(batch, A_offsets, B_offsets, C_offsets, M, N, K, alpha, A, lda0, lda1,
+                                    packed_B, beta, C, ldc, esz);
+}
+
+#if CV_AVX2
+
+void fastGemmPackBKernelFP16(const char *B, char *packed_B, int N, int K, int ldb0, int ldb1) {
+    const int esz = sizeof(float), besz = sizeof(hfloat);
+    int GEMM_NC = FAST_GEMM_F32_NC, GEMM_NR = FAST_GEMM_F32_NR;
+    int NC = (((GEMM_NC < N ? GEMM_NC : N) + GEMM_NR - 1) / GEMM_NR) * GEMM_NR;
+    int KC = std::min(FAST_GEMM_F32_PACKED_STRIDE_K, K);
+
+    int n_tiles = (N + NC - 1) / NC;
+    for (int r = 0; r < n_tiles; ++r) {
+        int j0 = r * NC;
+        int nc = N - j0 < NC ? N - j0 : NC;
+        int _nc = static_cast<int>((nc + GEMM_NR - 1) / GEMM_NR) * GEMM_NR * besz;
+        for (int k = 0; k < K; k += KC) {
+            int kc = K - k < KC ? K - k : KC;
+            fast_gemm_pack8_f16(nc, kc, B + (k * ldb0 + j0 * ldb1) * esz, ldb1, ldb0, packed_B);
+            packed_B += _nc * kc;
+        }
+    }
+}
+
+void fastGemmKernelFP16(int M, int N, int K,
+                        float alpha, const char *A, int lda0, int lda1,
+                        const char *packed_B, float beta, char *C, int ldc, bool multi_thread) {
+    fast_gemm_packed_b<hfloat>(M, N, K, alpha, A, lda0, lda1, packed_B, beta, C, ldc, sizeof(float), multi_thread);
+}
+
+void fastGemmBatchKernelFP16(size_t batch, const size_t *A_offsets, const size_t *B_offsets, const size_t *C_offsets,
+                             int M, int N, int K, float alpha, const char *A, int lda0, int lda1,
+                             const char *packed_B, float beta, char *C, int ldc) {
+    fast_gemm_batch_packed_b<hfloat>(batch, A_offsets, B_offsets, C_offsets, M, N, K, alpha, A, lda0, lda1,
+                                     packed_B, beta, C, ldc, sizeof(float));
+}
+
+#endif // CV_AVX2
+
 #endif // CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY
 
 CV_CPU_OPTIMIZATION_NAMESPACE_END
@@ -939,3 +1018,6 @@ CV_CPU_OPTIMIZATION_NAMESPACE_END
 #undef FAST_GEMM_PACK_f32_8
 #undef FAST_GEMM_PACK_f32_12
 #undef FAST_GEMM_PACK_f32_16
+#ifdef FAST_GEMM_PACK_f16_8
+#undef FAST_GEMM_PACK_f16_8
+#endif
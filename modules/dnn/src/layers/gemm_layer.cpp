@@ -147,8 +147,13 @@ public:
         opt.init();
 
         // pack B if it is const
+        packed_B.clear();
+        packed_B_fp16.clear();
         if (const_B) {
-            fastGemmPackB(blobs[0], packed_B, trans_b, opt);
+            if (preferableTarget == DNN_TARGET_CPU_FP16 && opt.canPackFP16())
+                fastGemmPackB(blobs[0], packed_B_fp16, trans_b, opt);
+            else
+                fastGemmPackB(blobs[0], packed_B, trans_b, opt);
         }
 
         // also pre-broadcast bias
@@ -207,7 +212,9 @@ public:
             std::memset(ptr_y, 0, total * sizeof(float));
         }
 
-        if (const_B) {
+        if (const_B && !packed_B_fp16.empty()) {
+            fastGemm(trans_a, M, N, K, alpha, A.ptr<const float>(), na, packed_B_fp16.data(), 1.f, Y.ptr<float>(), N, opt);
+        } else if (const_B) {
             CV_CheckGT(packed_B.size(), static_cast<size_t>(0), "DNN/Gemm: constant B is not pre-packed");
             fastGemm(trans_a, M, N, K, alpha, A.ptr<const float>(), na, packed_B.data(), 1.f, Y.ptr<float>(), N, opt);
         } else {
@@ -369,6 +376,7 @@ private:
     bool const_C;
     bool have_bias;
     std::vector<float> packed_B;
+    std::vector<hfloat> packed_B_fp16; // DNN_TARGET_CPU_FP16
     std::vector<float> broadcast_C;
     int real_ndims_C;
     FastGemmOpt opt;
@@ -130,9 +130,16 @@ class MatMulLayerImpl CV_FINAL : public MatMulLayer {
                    C_shape = shape(outputs[0]);
         helper.compute(trans_a, trans_b, A_shape, B_shape, C_shape);
 
+        packed_input_B.clear();
+        packed_input_B_fp16.clear();
         if (!blobs.empty()) {
-            fastGemmPackB(blobs[0], packed_input_B, trans_b, opt);
-            helper.updatePackedBOffsets(packed_input_B.size());
+            if (preferableTarget == DNN_TARGET_CPU_FP16 && opt.canPackFP16()) {
+                fastGemmPackB(blobs[0], packed_input_B_fp16, trans_b, opt);
+                helper.updatePackedBOffsets(packed_input_B_fp16.size());
+            } else {
+                fastGemmPackB(blobs[0], packed_input_B, trans_b, opt);
+                helper.updatePackedBOffsets(packed_input_B.size());
+            }
         }
 
         // broadcast bias if needed
@@ -236,6 +243,10 @@ class MatMulLayerImpl CV_FINAL : public MatMulLayer {
             fastGemmBatch(helper.batch, helper.A_offsets.data(), helper.B_offsets.data(), helper.C_offsets.data(),
                           helper.M, helper.N, helper.K, alpha, a, helper.lda0, helper.lda1,
                           b, helper.ldb0, helper.ldb1, beta, y, helper.ldc, opt);
+        } else if (!packed_input_B_fp16.empty()) {
+            fastGemmBatch(helper.batch, helper.A_offsets.data(), helper.packed_B_offsets.data(), helper.C_offsets.data(),
+                          helper.M, helper.N, helper.K, alpha, a, helper.lda0, helper.lda1,
+                          packed_input_B_fp16.data(), beta, y, helper.ldc, opt);
         } else {
             fastGemmBatch(helper.batch, helper.A_offsets.data(), helper.packed_B_offsets.data(), helper.C_offsets.data(),
                           helper.M, helper.N, helper.K, alpha, a, helper.lda0, helper.lda1,
@@ -472,6 +483,7 @@ class MatMulLayerImpl CV_FINAL : public MatMulLayer {
     int real_ndims_C;
 
     std::vector<float> packed_input_B;
+    std::vector<hfloat> packed_input_B_fp16; // DNN_TARGET_CPU_FP16
     Mat broadcast_bias;
 
     FastGemmOpt opt;
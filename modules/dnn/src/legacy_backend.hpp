@@ -170,6 +170,13 @@ public:
         CV_Assert(refIt != refCounter.end());
         CV_Assert(refIt->second > 0);
         refIt->second -= 1;
+
+        if (planning && refIt->second == 0)
+        {
+            std::map<LayerPin, PlannedBlob>::iterator blobIt = plannedBlobs.find(mapIt->second);
+            CV_Assert(blobIt != plannedBlobs.end());
+            blobIt->second.last = planStep;
+        }
     }
 
     void releaseReferences(const std::vector<LayerPin>& pins)
@@ -182,7 +189,19 @@ public:
 
     void reuseOrCreate(const MatShape& shape, const LayerPin& lp, Mat& dst, const int& dtype)
     {
-        if (!getParam_DNN_DISABLE_MEMORY_OPTIMIZATIONS())
+        if (planned)
+        {
+            // the memory was planned by planBlobsForLayer(), blobs which are not
+            // in the plan (network inputs) are allocated separately
+            std::map<LayerPin, size_t>::const_iterator offsetIt = arenaOffsets.find(lp);
+            if (offsetIt != arenaOffsets.end())
+            {
+                dst = arenaView(arena, offsetIt->second, shape, dtype);
+                addHost(lp, dst);
+                return;
+            }
+        }
+        else if (!getParam_DNN_DISABLE_MEMORY_OPTIMIZATIONS())
         {
             Mat bestBlob;
             LayerPin bestBlobPin;
@@ -293,6 +312,7 @@ public:
                     if (index < outShapes.size() && inPlace)
                     {
                         CV_Assert(ld.inputBlobs[0]->total() == total(shapes[index]));
+                        CV_Assert(arenaOffsets.find(blobPin) == arenaOffsets.end());
                         ld.outputBlobs[index] = ld.inputBlobs[0]->reshape(1, shapes[index]);
                         reuse(ld.inputBlobsId[0], blobPin);
                     }
@@ -303,6 +323,140 @@ public:
         }
     }
 
+    // Starts the memory planning. Call planBlobsForLayer() for every layer in the order
+    // of allocation with the same references as for allocation, then finishPlanning().
+    void startPlanning()
+    {
+        reset();
+        planning = true;
+    }
+
+    // Registers the blobs of a layer in the memory plan. Blobs are used in-place
+    // exactly when allocateBlobsForLayer() would use them in-place.
+    void planBlobsForLayer(const LayerData& ld, const LayerShapes& layerShapes,
+            std::vector<LayerPin>& pinsForInternalBlobs)
+    {
+        CV_Assert(planning);
+        pinsForInternalBlobs.clear();
+        planStep++;
+
+        const ShapesVec &outShapes = layerShapes.out,
+                        &internalShapes = layerShapes.internal;
+        const size_t numOutputs = std::max((size_t)1, outShapes.size());
+        const size_t elemSize = CV_ELEM_SIZE(ld.dtype);
+
+        bool inPlace = layerShapes.supportInPlace && ld.inputBlobsId.size() == 1 &&
+                       numReferences(ld.inputBlobsId[0]) == 1;
+
+        for (size_t i = 0; i < internalShapes.size(); i++)
+        {
+            if (total(internalShapes[i]))
+                pinsForInternalBlobs.push_back(LayerPin(ld.id, (int)(numOutputs + i)));
+        }
+        addReferences(pinsForInternalBlobs);
+
+        for (size_t i = 0; i < outShapes.size(); i++)
+        {
+            if (!total(outShapes[i]))
+                continue;
+            LayerPin blobPin(ld.id, (int)i);
+            if (inPlace)
+                reuse(ld.inputBlobsId[0], blobPin);
+            else
+                addPlannedBlob(blobPin, total(outShapes[i]) * elemSize, ld.id == 0);
+            naiveSize += total(outShapes[i]) * elemSize;
+        }
+        for (size_t i = 0; i < internalShapes.size(); i++)
+        {
+            if (!total(internalShapes[i]))
+                continue;
+            addPlannedBlob(LayerPin(ld.id, (int)(numOutputs + i)), total(internalShapes[i]) * elemSize, false);
+            naiveSize += total(internalShapes[i]) * elemSize;
+        }
+    }
+
+    // Assigns offsets in a single arena to the planned blobs so that blobs which are alive
+    // at the same time don't overlap. The bigger blobs are placed first, every blob takes
+    // the smallest gap between the already placed blobs it overlaps in time with.
+    // If <allocate> is true, the arena is allocated and allocateBlobsForLayer() takes blobs from it.
+    void finishPlanning(bool allocate)
+    {
+        CV_TRACE_FUNCTION();
+        CV_Assert(planning);
+
+        std::vector<std::pair<size_t, LayerPin> > order;
+        for (std::map<LayerPin, PlannedBlob>::const_iterator it = plannedBlobs.begin(); it != plannedBlobs.end(); ++it)
+        {
+            if (it->second.external)
+                externalSize += it->second.size;
+            else
+                order.push_back(std::make_pair(alignSize(it->second.size, BLOB_ALIGNMENT), it->first));
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [](const std::pair<size_t, LayerPin>& a, const std::pair<size_t, LayerPin>& b)
+                         { return a.first > b.first; });
+
+        std::vector<std::pair<size_t, size_t> > busy;  // [begin, end) of the blobs alive together with the current one
+        std::vector<const PlannedBlob*> placed;
+        for (size_t i = 0; i < order.size(); i++)
+        {
+            const size_t size = order[i].first;
+            PlannedBlob& blob = plannedBlobs[order[i].second];
+
+            busy.clear();
+            for (size_t j = 0; j < placed.size(); j++)
+            {
+                if (placed[j]->first <= blob.last && blob.first <= placed[j]->last)
+                    busy.push_back(std::make_pair(placed[j]->offset, placed[j]->offset + alignSize(placed[j]->size, BLOB_ALIGNMENT)));
+            }
+            std::sort(busy.begin(), busy.end());
+
+            size_t offset = 0, bestOffset = 0, bestGap = std::numeric_limits<size_t>::max();
+            for (size_t j = 0; j < busy.size(); j++)
+            {
+                if (busy[j].first >= offset + size && busy[j].first - offset < bestGap)
+                {
+                    bestOffset = offset;
+                    bestGap = busy[j].first - offset;
+                }
+                offset = std::max(offset, busy[j].second);
+            }
+            blob.offset = bestGap == std::numeric_limits<size_t>::max() ? offset : bestOffset;
+            arenaSize = std::max(arenaSize, blob.offset + size);
+            placed.push_back(&blob);
+        }
+
+        refCounter.clear();
+        reuseMap.clear();
+        planning = false;
+
+        if (allocate)
+        {
+            for (size_t i = 0; i < placed.size(); i++)
+                arenaOffsets[order[i].second] = placed[i]->offset;
+            if (arenaSize)
+                arena.create((int)(arenaSize / BLOB_ALIGNMENT), (int)BLOB_ALIGNMENT, CV_8U);
+            planned = true;
+        }
+    }
+
+    // Memory of intermediate blobs with the plan: the arena and the network inputs.
+    size_t getPlannedSize() const { return arenaSize + externalSize; }
+    // Memory of intermediate blobs if every blob has its own memory.
+    size_t getNaiveSize() const { return naiveSize; }
+
+    // Returns a blob of the given shape and type placed at <offset> bytes of <arena>.
+    // The blob shares the reference counter of the arena, so it stays valid when it's retained by a user.
+    static Mat arenaView(const Mat& arena, size_t offset, const MatShape& shape, int type)
+    {
+        CV_Assert(arena.u && arena.isContinuous());
+        CV_Assert(offset + total(shape) * CV_ELEM_SIZE(type) <= arena.total() * arena.elemSize());
+        Mat m(shape, type, arena.data + offset);
+        m.u = arena.u;
+        m.addref();
+        return m;
+    }
+
     // Clear internal state. Calls before an every reallocation.
     void reset()
     {
@@ -311,8 +465,17 @@ public:
         refCounter.clear();
         reuseMap.clear();
         memHosts.clear();
+
+        planning = planned = false;
+        planStep = 0;
+        plannedBlobs.clear();
+        arenaOffsets.clear();
+        arena.release();
+        arenaSize = externalSize = naiveSize = 0;
     }
 
+    BlobManager() { reset(); }
+
 private:
     // Register allocated memory.
     void addHost(const LayerPin& lp, const Mat& mat)
@@ -322,11 +485,39 @@ private:
         memHosts[lp] = mat;
     }
 
+    // Register a blob of the memory plan, it's alive since the current layer.
+    void addPlannedBlob(const LayerPin& lp, size_t size, bool external)
+    {
+        CV_Assert(reuseMap.find(lp) == reuseMap.end());
+        reuseMap[lp] = lp;
+        PlannedBlob& blob = plannedBlobs[lp];
+        blob.size = size;
+        blob.first = planStep;
+        blob.last = INT_MAX;  // blobs which are never released are alive until the end
+        blob.offset = 0;
+        blob.external = external;
+    }
+
     std::map<LayerPin, int> refCounter;
     // Maps pin to origin blob (for whom memory was allocated firstly).
     // For origin blobs key == value.
     std::map<LayerPin, LayerPin> reuseMap;
     std::map<LayerPin, Mat> memHosts;
+
+    // Memory planning
+    enum { BLOB_ALIGNMENT = 64 };
+    struct PlannedBlob
+    {
+        size_t size, offset;
+        int first, last;  // steps of the first and the last use
+        bool external;  // network input, allocated outside of the arena
+    };
+    bool planning, planned;
+    int planStep;
+    std::map<LayerPin, PlannedBlob> plannedBlobs;
+    std::map<LayerPin, size_t> arenaOffsets;
+    Mat arena;
+    size_t arenaSize, externalSize, naiveSize;
 };  // BlobManager
 
 
@@ -115,6 +115,17 @@ void Net::forward(std::vector<std::vector<Mat>>& outputBlobs,
     return impl->forward(outputBlobs, outBlobNames);
 }
 
+Net Net::createExecutionContext()
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(impl);
+    CV_Assert(!empty());
+    Net context;
+    context.impl = makePtr<Net::Impl>();
+    context.impl->initExecutionContext(impl->compiledNet_ ? impl->compiledNet_ : impl);
+    return context;
+}
+
 // FIXIT drop from inference API
 Net Net::quantize(InputArrayOfArrays calibData, int inputsDtype, int outputsDtype, bool perChannel)
 {
@@ -398,6 +409,14 @@ void Net::getMemoryConsumption(const MatShape& netInputShape, std::vector<int>&
             weights, blobs);
 }
 
+void Net::getMemoryConsumption(const std::vector<MatShape>& netInputShapes,
+        size_t& weights, size_t& blobs, size_t& plannedBlobs) const
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(impl);
+    return impl->getMemoryConsumption(netInputShapes, weights, blobs, plannedBlobs);
+}
+
 // FIXIT return old value or add get method
 void Net::enableFusion(bool fusion)
 {
@@ -413,6 +432,13 @@ void Net::enableWinograd(bool useWinograd)
     return impl->enableWinograd(useWinograd);
 }
 
+void Net::setInterOpThreads(int nthreads)
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(impl);
+    return impl->setInterOpThreads(nthreads);
+}
+
 void Net::setHalideScheduler(const String& scheduler)
 {
     CV_TRACE_FUNCTION();
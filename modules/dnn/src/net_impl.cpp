@@ -6,6 +6,8 @@
 
 #include "net_impl.hpp"
 
+#include <atomic>
+
 namespace cv {
 namespace dnn {
 CV__DNN_INLINE_NS_BEGIN
@@ -59,6 +61,10 @@ Net::Impl::Impl()
     preferableTarget = DNN_TARGET_CPU;
     hasDynamicShapes = false;
     useWinograd = true;
+    allocationId = 0;
+    warmedUpAllocationId = -1;
+    interOpThreads = getParam_DNN_INTER_OP_THREADS();
+    interOpAllocationId = -1;
 }
 
 
@@ -72,6 +78,9 @@ void Net::Impl::clear()
 {
     CV_TRACE_FUNCTION();
 
+    if (compiledNet_)
+        CV_Error(Error::StsError, "DNN: execution context can't be reconfigured, create a new one from the network");
+
     MapIdToLayerData::iterator it;
     for (it = layers.begin(); it != layers.end(); it++)
     {
@@ -91,6 +100,7 @@ void Net::Impl::clear()
         currLayer->unsetAttached();
     }
     netWasAllocated = false;
+    allocationId++;
     layersTimings.clear();
 }
 
@@ -135,6 +145,20 @@ void Net::Impl::setUpNet(const std::vector<LayerPin>& blobsToKeep_)
 
     validateBackendAndTarget();
 
+    if (compiledNet_)
+    {
+        // the layers are shared, so they can't be finalized again for other shapes or outputs
+        if (!netWasAllocated || allocationId != compiledNet_->allocationId)
+            CV_Error(Error::StsError, "DNN: execution context requires inputs of the same shapes as the network "
+                                      "it was created from, and that network must not be reallocated");
+        for (size_t i = 0; i < blobsToKeep_.size(); i++)
+        {
+            if (std::find(blobsToKeep.begin(), blobsToKeep.end(), blobsToKeep_[i]) == blobsToKeep.end())
+                CV_Error(Error::StsError, "DNN: requested output wasn't computed by the network before creating the execution context");
+        }
+        return;
+    }
+
     if (!netWasAllocated || this->blobsToKeep != blobsToKeep_)
     {
         if (preferableBackend == DNN_BACKEND_OPENCV && IS_DNN_OPENCL_TARGET(preferableTarget))
@@ -534,8 +558,8 @@ void Net::Impl::allocateLayer(int lid, const LayersShapesMap& layersShapes)
         {
             inps[i] = *ld.inputBlobs[i];
         }
-        layerPtr->finalize(inps, ld.outputBlobs);
         layerPtr->preferableTarget = preferableTarget;
+        layerPtr->finalize(inps, ld.outputBlobs);
 #if 0
         std::cout << "\toutputs:";
         size_t noutputs = ld.outputBlobs.size();
@@ -590,28 +614,87 @@ void Net::Impl::allocateLayers(const std::vector<LayerPin>& blobsToKeep_)
         ld.internalBlobsWrappers.clear();
     }
 
+    // Blobs get offsets in a single arena by their lifetimes instead of reusing released blobs
+    if (preferableBackend == DNN_BACKEND_OPENCV && IS_DNN_CPU_TARGET(preferableTarget) &&
+        !getParam_DNN_DISABLE_MEMORY_OPTIMIZATIONS() && getParam_DNN_MEMORY_PLANNER())
+    {
+        planBlobs(blobManager, (int)layers[0].outputBlobs.size(), layersShapes, blobsToKeep_, true);
+        CV_LOG_DEBUG(NULL, "DNN: intermediate blobs take " << blobManager.getPlannedSize() << " bytes ("
+                     << blobManager.getNaiveSize() << " bytes without memory reuse)");
+    }
+
+    addBlobsReferences(blobManager, (int)layers[0].outputBlobs.size(), blobsToKeep_);
+
+    for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); it++)
+    {
+        int lid = it->first;
+        allocateLayer(lid, layersShapes);
+    }
+
+    layersTimings.resize(lastLayerId + 1, 0);
+    fuseLayers(blobsToKeep_);
+}
+
+
+void Net::Impl::addBlobsReferences(BlobManager& manager, int numInputs, const std::vector<LayerPin>& blobsToKeep_)
+{
     // Fake references to input blobs.
-    for (int i = 0; i < layers[0].outputBlobs.size(); ++i)
-        blobManager.addReference(LayerPin(0, i));
+    for (int i = 0; i < numInputs; ++i)
+        manager.addReference(LayerPin(0, i));
     for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); ++it)
     {
         const LayerData& ld = it->second;
-        blobManager.addReferences(ld.inputBlobsId);
+        manager.addReferences(ld.inputBlobsId);
     }
 
     for (int i = 0; i < blobsToKeep_.size(); i++)
     {
-        blobManager.addReference(blobsToKeep_[i]);
+        manager.addReference(blobsToKeep_[i]);
     }
+}
+
+
+// Layers in the order of allocateLayer(): parents first
+static void getAllocationOrder(Net::Impl::MapIdToLayerData& layers, int lid,
+                               std::set<int>& visited, std::vector<int>& order)
+{
+    if (!visited.insert(lid).second)
+        return;
+    const LayerData& ld = layers[lid];
+    std::set<int> parents(ld.inputLayersId);
+    for (size_t i = 0; i < ld.inputBlobsId.size(); i++)
+        parents.insert(ld.inputBlobsId[i].lid);
+    for (std::set<int>::const_iterator i = parents.begin(); i != parents.end(); i++)
+        getAllocationOrder(layers, *i, visited, order);
+    order.push_back(lid);
+}
 
+
+void Net::Impl::planBlobs(BlobManager& manager, int numInputs, const LayersShapesMap& layersShapes,
+                          const std::vector<LayerPin>& blobsToKeep_, bool allocate)
+{
+    CV_TRACE_FUNCTION();
+
+    manager.startPlanning();
+    addBlobsReferences(manager, numInputs, blobsToKeep_);
+
+    std::set<int> visited;
+    std::vector<int> order;
     for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); it++)
+        getAllocationOrder(layers, it->first, visited, order);
+
+    std::vector<LayerPin> pinsForInternalBlobs;
+    for (size_t i = 0; i < order.size(); i++)
     {
-        int lid = it->first;
-        allocateLayer(lid, layersShapes);
-    }
+        const LayerData& ld = layers[order[i]];
+        LayersShapesMap::const_iterator layerShapesIt = layersShapes.find(ld.id);
+        CV_Assert(layerShapesIt != layersShapes.end());
 
-    layersTimings.resize(lastLayerId + 1, 0);
-    fuseLayers(blobsToKeep_);
+        manager.planBlobsForLayer(ld, layerShapesIt->second, pinsForInternalBlobs);
+        manager.releaseReferences(ld.inputBlobsId);
+        manager.releaseReferences(pinsForInternalBlobs);
+    }
+    manager.finishPlanning(allocate);
 }
 
 
@@ -872,6 +955,12 @@ void Net::Impl::forwardToLayer(LayerData& ld, bool clearFlags)
     if (ld.flag)
         return;
 
+    if (canForwardConcurrently())
+    {
+        forwardToLayerConcurrently(ld);
+        return;
+    }
+
     // forward parents
     for (MapIdToLayerData::iterator it = layers.begin(); it != layers.end() && (it->second.id < ld.id); ++it)
     {
@@ -891,6 +980,130 @@ void Net::Impl::forwardToLayer(LayerData& ld, bool clearFlags)
 }
 
 
+bool Net::Impl::canForwardConcurrently() const
+{
+    return interOpThreads > 1 && !isAsync && !hasDynamicShapes &&
+           preferableBackend == DNN_BACKEND_OPENCV &&
+           (preferableTarget == DNN_TARGET_CPU || preferableTarget == DNN_TARGET_CPU_FP16);
+}
+
+
+namespace {
+struct BlobAccess
+{
+    const uchar* begin;
+    const uchar* end;
+    bool write;
+    int level;
+};
+
+static void addBlobAccess(std::vector<BlobAccess>& accesses, const Mat& m, bool write)
+{
+    if (!m.empty())
+    {
+        BlobAccess a = { m.data, m.dataend, write, 0 };
+        accesses.push_back(a);
+    }
+}
+}  // namespace
+
+// Assigns every layer to a wave: a layer runs after all the layers it depends on, that are
+// the producers of its inputs and the layers whose blobs share memory with its blobs
+// (BlobManager reuses memory assuming the sequential order). The layers of a wave are independent.
+void Net::Impl::planConcurrentForward()
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(!layers.empty());
+
+    interOpLevels.assign(layers.rbegin()->first + 1, 0);
+    std::vector<BlobAccess> accesses, layerAccesses;
+    for (MapIdToLayerData::iterator it = layers.begin(); it != layers.end(); ++it)
+    {
+        LayerData& ld = it->second;
+        int level = 0;
+        for (size_t i = 0; i < ld.inputBlobsId.size(); i++)
+            level = std::max(level, interOpLevels[ld.inputBlobsId[i].lid] + 1);
+
+        layerAccesses.clear();
+        for (size_t i = 0; i < ld.inputBlobs.size(); i++)
+            addBlobAccess(layerAccesses, *ld.inputBlobs[i], false);
+        for (size_t i = 0; i < ld.outputBlobs.size(); i++)
+            addBlobAccess(layerAccesses, ld.outputBlobs[i], true);
+        for (size_t i = 0; i < ld.internals.size(); i++)
+            addBlobAccess(layerAccesses, ld.internals[i], true);
+
+        for (size_t i = 0; i < accesses.size(); i++)
+        {
+            const BlobAccess& prev = accesses[i];
+            if (prev.level < level)
+                continue;
+            for (size_t j = 0; j < layerAccesses.size(); j++)
+            {
+                const BlobAccess& a = layerAccesses[j];
+                if ((prev.write || a.write) && prev.begin < a.end && a.begin < prev.end)
+                {
+                    level = prev.level + 1;
+                    break;
+                }
+            }
+        }
+
+        for (size_t j = 0; j < layerAccesses.size(); j++)
+        {
+            layerAccesses[j].level = level;
+            accesses.push_back(layerAccesses[j]);
+        }
+        interOpLevels[ld.id] = level;
+    }
+    interOpAllocationId = allocationId;
+}
+
+
+void Net::Impl::forwardToLayerConcurrently(LayerData& ld)
+{
+    CV_TRACE_FUNCTION();
+
+    if (interOpAllocationId != allocationId || interOpLevels.size() != (size_t)layers.rbegin()->first + 1)
+        planConcurrentForward();
+
+    std::vector<std::vector<LayerData*> > waves;
+    for (MapIdToLayerData::iterator it = layers.begin(); it != layers.end() && it->second.id <= ld.id; ++it)
+    {
+        if (it->second.flag)
+            continue;
+        size_t level = interOpLevels[it->second.id];
+        if (waves.size() <= level)
+            waves.resize(level + 1);
+        waves[level].push_back(&it->second);
+    }
+
+    for (size_t w = 0; w < waves.size(); w++)
+    {
+        const std::vector<LayerData*>& wave = waves[w];
+        if (wave.size() <= 1)
+        {
+            // the only layer keeps all the threads for itself
+            if (!wave.empty())
+                forwardLayer(*wave[0]);
+            continue;
+        }
+
+        // The stripes take the layers in turn, and the nested parallel loops of the layers are
+        // executed serially (unless the parallel backend supports nesting).
+        std::atomic<int> next(0);
+        int nstripes = std::min((int)wave.size(), interOpThreads);
+        parallel_for_(Range(0, nstripes), [&](const Range& r)
+        {
+            for (int stripe = r.start; stripe < r.end; stripe++)
+            {
+                for (int i = next++; i < (int)wave.size(); i = next++)
+                    forwardLayer(*wave[i]);
+            }
+        }, nstripes);
+    }
+}
+
+
 Mat Net::Impl::forward(const String& outputName)
 {
     CV_Assert(!empty());
@@ -1083,6 +1296,102 @@ void Net::Impl::forward(std::vector<std::vector<Mat>>& outputBlobs,
 }
 
 
+// Returns the blob of an execution context matching the blob of the compiled network:
+// blobs that share memory there share the same part of a new buffer here.
+static Mat rebindBlob(const Mat& m, std::map<UMatData*, Mat>& buffers)
+{
+    if (m.empty())
+        return m.clone();
+    CV_Assert(m.u && m.isContinuous());
+
+    Mat& buf = buffers[m.u];
+    if (buf.empty())
+        buf.create((int)((m.u->size + 63) / 64), 64, CV_8U);
+    return BlobManager::arenaView(buf, m.data - m.u->data, shape(m), m.type());
+}
+
+
+void Net::Impl::initExecutionContext(const Ptr<Net::Impl>& net)
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(net && !net->compiledNet_);
+
+    if (net->preferableBackend != DNN_BACKEND_OPENCV ||
+        (net->preferableTarget != DNN_TARGET_CPU && net->preferableTarget != DNN_TARGET_CPU_FP16))
+        CV_Error(Error::StsNotImplemented, "DNN: execution contexts are supported by the OpenCV backend on CPU only");
+    if (!net->netWasAllocated || net->blobsToKeep.empty())
+        CV_Error(Error::StsError, "DNN: run forward() once before creating execution contexts");
+
+    // Layers pack their weights and fill their caches on the first run. Do it now,
+    // so that forward() doesn't modify them when contexts run it concurrently.
+    if (net->warmedUpAllocationId != net->allocationId)
+    {
+        FPDenormalsIgnoreHintScope fp_denormals_ignore_scope;
+        net->forwardToLayer(net->getLayerData(net->getLatestLayerPin(net->blobsToKeep).lid));
+        net->warmedUpAllocationId = net->allocationId;
+    }
+
+    compiledNet_ = net;
+    allocationId = net->allocationId;
+    preferableBackend = net->preferableBackend;
+    preferableTarget = net->preferableTarget;
+    fusion = net->fusion;
+    useWinograd = net->useWinograd;
+    interOpThreads = net->interOpThreads;
+    netWasQuantized = net->netWasQuantized;
+    blobsToKeep = net->blobsToKeep;
+    layerNameToId = net->layerNameToId;
+    outputNameToId = net->outputNameToId;
+    lastLayerId = net->lastLayerId;
+    layersTimings.assign(net->layersTimings.size(), 0);
+
+    // the layers are shared, the blobs are not
+    layers = net->layers;
+
+    const DataLayer& srcInputLayer = *net->netInputLayer;
+    netInputLayer = Ptr<DataLayer>(new DataLayer());
+    netInputLayer->name = srcInputLayer.name;
+    netInputLayer->preferableTarget = srcInputLayer.preferableTarget;
+    netInputLayer->outNames = srcInputLayer.outNames;
+    netInputLayer->shapes = srcInputLayer.shapes;
+    netInputLayer->scaleFactors = srcInputLayer.scaleFactors;
+    netInputLayer->means = srcInputLayer.means;
+    netInputLayer->skip = srcInputLayer.skip;
+    layers[0].layerInstance = netInputLayer;
+
+    std::map<const Mat*, LayerPin> outputPins;
+    for (MapIdToLayerData::const_iterator it = net->layers.begin(); it != net->layers.end(); ++it)
+    {
+        for (size_t i = 0; i < it->second.outputBlobs.size(); i++)
+            outputPins[&it->second.outputBlobs[i]] = LayerPin(it->first, (int)i);
+    }
+
+    std::map<UMatData*, Mat> buffers;
+    netInputLayer->inputsData.resize(srcInputLayer.inputsData.size());
+    for (size_t i = 0; i < srcInputLayer.inputsData.size(); i++)
+        netInputLayer->inputsData[i] = rebindBlob(srcInputLayer.inputsData[i], buffers);
+
+    for (MapIdToLayerData::iterator it = layers.begin(); it != layers.end(); ++it)
+    {
+        LayerData& ld = it->second;
+        const LayerData& src = net->layers[it->first];
+        for (size_t i = 0; i < ld.outputBlobs.size(); i++)
+            ld.outputBlobs[i] = rebindBlob(src.outputBlobs[i], buffers);
+        for (size_t i = 0; i < ld.internals.size(); i++)
+            ld.internals[i] = rebindBlob(src.internals[i], buffers);
+        // fused layers may read the outputs of other layers than their inputBlobsId tell
+        for (size_t i = 0; i < ld.inputBlobs.size(); i++)
+        {
+            std::map<const Mat*, LayerPin>::const_iterator pin = outputPins.find(src.inputBlobs[i]);
+            CV_Assert(pin != outputPins.end());
+            ld.inputBlobs[i] = &layers[pin->second.lid].outputBlobs[pin->second.oid];
+        }
+    }
+
+    netWasAllocated = true;
+}
+
+
 void Net::Impl::getLayerShapesRecursively(int id, LayersShapesMap& inOutShapes)
 {
     CV_CheckGE(id, 0, "");
@@ -2269,6 +2578,23 @@ void Net::Impl::getMemoryConsumption(
 }
 
 
+void Net::Impl::getMemoryConsumption(
+        const std::vector<MatShape>& netInputShapes,
+        size_t& weights, size_t& blobs, size_t& plannedBlobs) /*const*/
+{
+    size_t outputBlobs = 0;
+    getMemoryConsumption(netInputShapes, weights, outputBlobs);
+
+    LayersShapesMap layersShapes;
+    getLayersShapes(netInputShapes, layersShapes);
+
+    BlobManager manager;
+    planBlobs(manager, (int)netInputShapes.size(), layersShapes, blobsToKeep, false);
+    blobs = manager.getNaiveSize();
+    plannedBlobs = manager.getPlannedSize();
+}
+
+
 int64 Net::Impl::getPerfProfile(std::vector<double>& timings) const
 {
     timings = std::vector<double>(layersTimings.begin() + 1, layersTimings.end());
@@ -2344,6 +2670,12 @@ void Net::Impl::enableWinograd(bool useWinograd_)
 }
 
 
+void Net::Impl::setInterOpThreads(int nthreads)
+{
+    interOpThreads = std::max(nthreads, 0);
+}
+
+
 // TODO drop?
 void Net::Impl::getLayerTypes(std::vector<String>& layersTypes) const
 {
@@ -68,6 +68,16 @@ struct Net::Impl : public detail::NetImplBase
     bool useWinograd;
     std::vector<int64> layersTimings;
 
+    // Execution contexts, see Net::createExecutionContext()
+    Ptr<Net::Impl> compiledNet_;  // network that owns the layers shared by this context
+    int allocationId;  // changes every time the layers are reallocated
+    int warmedUpAllocationId;  // allocation for which all layers were run once
+
+    // Concurrent execution of independent layers, see Net::setInterOpThreads()
+    int interOpThreads;
+    int interOpAllocationId;  // allocation for which interOpLevels were computed
+    std::vector<int> interOpLevels;  // layer id -> wave number of the layer
+
 
     virtual bool empty() const;
     virtual void setPreferableBackend(Net& net, int backendId);
@@ -215,13 +225,23 @@ struct Net::Impl : public detail::NetImplBase
 
     virtual void fuseLayers(const std::vector<LayerPin>& blobsToKeep_);
     void enableWinograd(bool useWinograd_);
+    void setInterOpThreads(int nthreads);
 
     void allocateLayers(const std::vector<LayerPin>& blobsToKeep_);
 
+    // references of the consumers to the blobs, see BlobManager
+    void addBlobsReferences(BlobManager& manager, int numInputs, const std::vector<LayerPin>& blobsToKeep_);
+    void planBlobs(BlobManager& manager, int numInputs, const LayersShapesMap& layersShapes,
+            const std::vector<LayerPin>& blobsToKeep_, bool allocate);
+
     virtual void forwardLayer(LayerData& ld);
 
     void forwardToLayer(LayerData& ld, bool clearFlags = true);
 
+    bool canForwardConcurrently() const;
+    void planConcurrentForward();
+    void forwardToLayerConcurrently(LayerData& ld);
+
     Mat forward(const String& outputName);
     AsyncArray forwardAsync(const String& outputName);
     void forward(OutputArrayOfArrays outputBlobs, const String& outputName);
@@ -230,6 +250,8 @@ struct Net::Impl : public detail::NetImplBase
     void forward(std::vector<std::vector<Mat>>& outputBlobs,
             const std::vector<String>& outBlobNames);
 
+    void initExecutionContext(const Ptr<Net::Impl>& compiledNet);
+
 
     void getLayerShapesRecursively(int id, LayersShapesMap& inOutShapes);
 
@@ -264,6 +286,9 @@ struct Net::Impl : public detail::NetImplBase
             const std::vector<MatShape>& netInputShapes,
             std::vector<int>& layerIds, std::vector<size_t>& weights,
             std::vector<size_t>& blobs) /*const*/;
+    void getMemoryConsumption(
+            const std::vector<MatShape>& netInputShapes,
+            size_t& weights, size_t& blobs, size_t& plannedBlobs) /*const*/;
     int64 getPerfProfile(std::vector<double>& timings) const;
 
     // TODO drop
@@ -257,15 +257,17 @@ void Net::Impl::setPreferableTarget(int targetId)
 #endif
         }
 #if !defined(__arm64__) || !__arm64__
-        if (targetId == DNN_TARGET_CPU_FP16)
+        if (targetId == DNN_TARGET_CPU_FP16 && !haveCPU_FP16())
         {
-            CV_LOG_WARNING(NULL, "DNN: fall back to DNN_TARGET_CPU. Only ARM v8 CPU is supported by DNN_TARGET_CPU_FP16.");
+            CV_LOG_WARNING(NULL, "DNN: fall back to DNN_TARGET_CPU. Only ARM v8 and x86 AVX2 CPUs are supported by DNN_TARGET_CPU_FP16.");
             targetId = DNN_TARGET_CPU;
         }
 #endif
 
         clear();
 
+#if defined(__arm64__) && __arm64__
+        // x86 keeps Winograd in FP32, only ARM computes it in FP16
         if (targetId == DNN_TARGET_CPU_FP16)
         {
             if (useWinograd) {
@@ -273,6 +275,7 @@ void Net::Impl::setPreferableTarget(int targetId)
                 enableWinograd(false);
             }
         }
+#endif
     }
 }
 
@@ -65,6 +65,8 @@ private:
         }
 #endif
 
+        // x86 supports DNN_TARGET_CPU_FP16 only when it is set explicitly: it is a fallback that keeps
+        // the weights in FP16 and computes in FP32, which changes the accuracy of all models
         bool haveBackendCPU_FP16 = false;
 #if defined(__arm64__) && __arm64__
         haveBackendCPU_FP16 = true;
@@ -564,6 +564,73 @@ TEST_P(Test_Int8_layers, DepthSpaceOps) {
     }
 }
 
+// dispatched int8 kernels (AVX2, AVX512-VNNI, ...) must match the universal intrinsics code
+TEST_P(Test_Int8_layers, Convolution_InnerProduct_dispatch)
+{
+    if (backend != DNN_BACKEND_OPENCV)
+        throw SkipTestException("");
+
+    Net net;
+    {
+        LayerParams lp;
+        lp.set("kernel_size", 3);
+        lp.set("pad", 1);
+        lp.set("num_output", 70);
+        lp.set("bias_term", true);
+        int wsz[] = {70, 37, 3, 3};
+        Mat weights(4, wsz, CV_32F), bias(1, 70, CV_32F);
+        randu(weights, -1.0f, 1.0f);
+        randu(bias, -1.0f, 1.0f);
+        lp.blobs.push_back(weights);
+        lp.blobs.push_back(bias);
+        net.addLayerToPrev("conv", "Convolution", lp);
+    }
+    {
+        LayerParams lp;
+        lp.set("num_output", 45);
+        lp.set("bias_term", true);
+        Mat weights(45, 70*11*13, CV_32F), bias(1, 45, CV_32F);
+        randu(weights, -0.1f, 0.1f);
+        randu(bias, -1.0f, 1.0f);
+        lp.blobs.push_back(weights);
+        lp.blobs.push_back(bias);
+        net.addLayerToPrev("fc", "InnerProduct", lp);
+    }
+    int inpsz[] = {2, 37, 11, 13};
+    Mat inp(4, inpsz, CV_32F);
+    randu(inp, -1.0f, 1.0f);
+
+    Net qnet = net.quantize(inp, CV_8S, CV_8S);
+    std::vector<float> inputScale;
+    std::vector<int> inputZp;
+    qnet.getInputDetails(inputScale, inputZp);
+    qnet.setPreferableBackend(backend);
+    qnet.setPreferableTarget(target);
+
+    Mat inp_int8;
+    inp.convertTo(inp_int8, CV_8S, 1.f/inputScale[0], inputZp[0]);
+    qnet.setInput(inp_int8);
+    Mat out = qnet.forward().clone();
+
+    bool useOptimized = cv::useOptimized();
+    cv::setUseOptimized(false);
+    Mat ref;
+    try
+    {
+        qnet.setInput(inp_int8);
+        ref = qnet.forward().clone();
+    }
+    catch (...)
+    {
+        cv::setUseOptimized(useOptimized);
+        throw;
+    }
+    cv::setUseOptimized(useOptimized);
+
+    // rounding of the requantization may differ by one
+    EXPECT_LE(cvtest::norm(ref, out, NORM_INF), 1);
+}
+
 INSTANTIATE_TEST_CASE_P(/**/, Test_Int8_layers, dnnBackendsAndTargetsInt8());
 
 class Test_Int8_nets : public DNNTestLayer
@@ -10,6 +10,8 @@
 #include <opencv2/core/ocl.hpp>
 #include <opencv2/core/opencl/ocl_defs.hpp>
 #include <opencv2/dnn/layer.details.hpp>  // CV_DNN_REGISTER_LAYER_CLASS
+#include <opencv2/dnn/utils/debug_utils.hpp>
+#include <thread>
 
 namespace opencv_test { namespace {
 
@@ -615,6 +617,326 @@ TEST(Net, forwardAndRetrieve)
     normAssert(outBlobs[0][1], inp.rowRange(2, 4), "second part");
 }
 
+static int addConvolution(Net& net, const std::string& name, int inpCn, int outCn, int kernel)
+{
+    LayerParams lp;
+    lp.name = name;
+    lp.type = "Convolution";
+    lp.set("kernel_size", kernel);
+    lp.set("pad", kernel / 2);
+    lp.set("num_output", outCn);
+    lp.set("bias_term", true);
+    int weightsShape[] = {outCn, inpCn, kernel, kernel};
+    Mat weights(4, weightsShape, CV_32F), bias(1, outCn, CV_32F);
+    randu(weights, -1, 1);
+    randu(bias, -1, 1);
+    lp.blobs.push_back(weights);
+    lp.blobs.push_back(bias);
+    return net.addLayer(lp.name, lp.type, lp);
+}
+
+TEST(Net, execution_contexts)
+{
+    Net net;
+    int conv = addConvolution(net, "conv", 3, 8, 3);
+    net.connect(0, 0, conv, 0);
+    LayerParams lp;
+    int relu = net.addLayer("relu", "ReLU", lp);
+    net.connect(conv, 0, relu, 0);
+    int branch1 = addConvolution(net, "branch1", 8, 4, 1);
+    int branch2 = addConvolution(net, "branch2", 8, 6, 3);
+    net.connect(relu, 0, branch1, 0);
+    net.connect(relu, 0, branch2, 0);
+    int concat = net.addLayer("concat", "Concat", lp);
+    net.connect(branch1, 0, concat, 0);
+    net.connect(branch2, 0, concat, 1);
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    const int numInputs = 4, numContexts = 4, numIters = 20;
+    int inpShape[] = {1, 3, 16, 16};
+    std::vector<Mat> inputs(numInputs), refs(numInputs);
+    for (int i = 0; i < numInputs; i++)
+    {
+        inputs[i].create(4, inpShape, CV_32F);
+        randu(inputs[i], -1, 1);
+        net.setInput(inputs[i]);
+        refs[i] = net.forward().clone();
+    }
+
+    std::vector<Net> contexts(numContexts);
+    for (int i = 0; i < numContexts; i++)
+    {
+        contexts[i] = net.createExecutionContext();
+        // weights are shared
+        EXPECT_EQ(net.getParam("conv", 0).data, contexts[i].getParam("conv", 0).data);
+        EXPECT_EQ(net.getParam("branch2", 0).data, contexts[i].getParam("branch2", 0).data);
+    }
+
+    std::vector<int> mismatches(numContexts, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numContexts; t++)
+    {
+        threads.push_back(std::thread([&, t]() {
+            for (int iter = 0; iter < numIters; iter++)
+            {
+                int i = (t + iter) % numInputs;
+                contexts[t].setInput(inputs[i]);
+                Mat out = contexts[t].forward();
+                if (cvtest::norm(out, refs[i], NORM_INF) != 0)
+                    mismatches[t]++;
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); t++)
+        threads[t].join();
+    for (int t = 0; t < numContexts; t++)
+        EXPECT_EQ(0, mismatches[t]) << "context " << t;
+
+    // the network itself keeps working
+    net.setInput(inputs[1]);
+    EXPECT_EQ(0, cvtest::norm(net.forward(), refs[1], NORM_INF));
+
+    // the shared layers can't be reallocated for other shapes
+    int otherShape[] = {1, 3, 20, 20};
+    Mat other(4, otherShape, CV_32F, Scalar(0));
+    contexts[0].setInput(other);
+    EXPECT_ANY_THROW(contexts[0].forward());
+}
+
+// overrides OPENCV_DNN_MEMORY_PLANNER while in scope
+struct MemoryPlannerGuard
+{
+    explicit MemoryPlannerGuard(bool enable) : prev(enableMemoryPlanner(enable)) {}
+    ~MemoryPlannerGuard() { enableMemoryPlanner(prev); }
+    bool prev;
+};
+
+TEST(Net, memory_planner)
+{
+    Net net;
+    LayerParams lp;
+    int conv = addConvolution(net, "stem", 3, 16, 3);
+    net.connect(0, 0, conv, 0);
+    int prev = net.addLayer("stem_relu", "ReLU", lp);
+    net.connect(conv, 0, prev, 0);
+    for (int i = 0; i < 4; i++)
+    {
+        std::string name = format("block%d", i);
+        int conv1 = addConvolution(net, name + "_conv1", 16, 16, 3);
+        net.connect(prev, 0, conv1, 0);
+        int relu1 = net.addLayer(name + "_relu1", "ReLU", lp);
+        net.connect(conv1, 0, relu1, 0);
+        int conv2 = addConvolution(net, name + "_conv2", 16, 16, 3);
+        net.connect(relu1, 0, conv2, 0);
+        int sum = net.addLayer(name + "_sum", "Eltwise", lp);
+        net.connect(prev, 0, sum, 0);
+        net.connect(conv2, 0, sum, 1);
+        prev = net.addLayer(name + "_relu2", "ReLU", lp);
+        net.connect(sum, 0, prev, 0);
+    }
+    int branch1 = addConvolution(net, "branch1", 16, 8, 1);
+    int branch2 = addConvolution(net, "branch2", 16, 8, 3);
+    net.connect(prev, 0, branch1, 0);
+    net.connect(prev, 0, branch2, 0);
+    int concat = net.addLayer("concat", "Concat", lp);
+    net.connect(branch1, 0, concat, 0);
+    net.connect(branch2, 0, concat, 1);
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    int inpShape[] = {1, 3, 32, 32};
+    size_t weights = 0, blobs = 0, plannedBlobs = 0;
+    net.getMemoryConsumption(std::vector<MatShape>(1, MatShape(inpShape, inpShape + 4)), weights, blobs, plannedBlobs);
+    EXPECT_GT(weights, (size_t)0);
+    EXPECT_GT(plannedBlobs, (size_t)0);
+    // only a few blobs of the chain are used at the same time
+    EXPECT_LT(plannedBlobs * 3, blobs);
+
+    Mat inp(4, inpShape, CV_32F);
+    randu(inp, -1, 1);
+    std::vector<String> names = net.getLayerNames();
+
+    // reference: released blobs are reused instead of the memory plan
+    std::vector<std::vector<Mat> > refs;
+    Mat ref;
+    {
+        MemoryPlannerGuard planner(false);
+        net.setInput(inp);
+        net.forward(refs, names);
+        ASSERT_EQ(refs.size(), names.size());
+        for (size_t i = 0; i < refs.size(); i++)
+            refs[i][0] = refs[i][0].clone();
+        net.setInput(inp);
+        ref = net.forward().clone();
+    }
+
+    MemoryPlannerGuard planner(true);
+    // every output is computed with only that blob kept, so the others share memory
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        net.setInput(inp);
+        normAssert(refs[i][0], net.forward(names[i]), names[i].c_str());
+    }
+    net.setInput(inp);
+    normAssert(ref, net.forward(), "output");
+
+    // none of the blobs share memory if all of them are kept
+    // (fusion is disabled because the fused layers return the blob of the layer they are fused into)
+    net.enableFusion(false);
+    std::vector<std::vector<Mat> > outs;
+    net.setInput(inp);
+    net.forward(outs, names);
+    ASSERT_EQ(outs.size(), names.size());
+    for (size_t i = 0; i < outs.size(); i++)
+    {
+        const Mat& a = outs[i][0];
+        normAssert(refs[i][0], a, names[i].c_str());
+        for (size_t j = 0; j < i; j++)
+        {
+            const Mat& b = outs[j][0];
+            EXPECT_TRUE(a.dataend <= b.datastart || b.dataend <= a.datastart) << names[i] << " and " << names[j];
+        }
+    }
+}
+
+static Mat forwardOnTarget(Net& net, const Mat& inp, Target target)
+{
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(target);
+    net.setInput(inp);
+    return net.forward().clone();
+}
+
+TEST(Net, cpu_fp16_accuracy)
+{
+    // x86 doesn't list DNN_TARGET_CPU_FP16 in the available targets, it has to be set explicitly
+    std::vector<Target> targets = getAvailableTargets(DNN_BACKEND_OPENCV);
+    bool haveCPU_FP16 = std::find(targets.begin(), targets.end(), DNN_TARGET_CPU_FP16) != targets.end();
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    haveCPU_FP16 = haveCPU_FP16 || checkHardwareSupport(CPU_AVX2);
+#endif
+    if (!haveCPU_FP16)
+        throw SkipTestException("DNN_TARGET_CPU_FP16 is not supported");
+
+    // generic convolutions, the number of outputs is not a multiple of the kernel block
+    Net convNet;
+    LayerParams lp;
+    int conv1 = addConvolution(convNet, "conv1", 64, 38, 3);
+    convNet.connect(0, 0, conv1, 0);
+    int relu = convNet.addLayer("relu", "ReLU", lp);
+    convNet.connect(conv1, 0, relu, 0);
+    int conv2 = addConvolution(convNet, "conv2", 38, 24, 1);
+    convNet.connect(relu, 0, conv2, 0);
+
+    int convInpShape[] = {1, 64, 12, 12};
+    Mat convInp(4, convInpShape, CV_32F);
+    randu(convInp, -1, 1);
+    Mat ref = forwardOnTarget(convNet, convInp, DNN_TARGET_CPU);
+    Mat out = forwardOnTarget(convNet, convInp, DNN_TARGET_CPU_FP16);
+    EXPECT_GT(cvtest::norm(ref, out, NORM_INF), 0);  // weights are rounded
+    normAssert(ref, out, "convolution", 2e-2, 1e-1);
+
+    // Gemm and MatMul with constant B
+    Net gemmNet;
+    Mat B0(200, 70, CV_32F), B1(70, 30, CV_32F);
+    randu(B0, -1, 1);
+    randu(B1, -1, 1);
+    LayerParams gemmParams;
+    gemmParams.set("constB", true);
+    gemmParams.blobs.push_back(B0);
+    int gemm = gemmNet.addLayerToPrev("gemm", "Gemm", gemmParams);
+    LayerParams matmulParams;
+    matmulParams.blobs.push_back(B1);
+    gemmNet.connect(gemm, 0, gemmNet.addLayer("matmul", "MatMul", matmulParams), 0);
+
+    Mat gemmInp(10, 200, CV_32F);
+    randu(gemmInp, -1, 1);
+    ref = forwardOnTarget(gemmNet, gemmInp, DNN_TARGET_CPU);
+    out = forwardOnTarget(gemmNet, gemmInp, DNN_TARGET_CPU_FP16);
+    EXPECT_GT(cvtest::norm(ref, out, NORM_INF), 0);
+    normAssert(ref, out, "gemm", 2e-2, 1e-1);
+}
+
+TEST(Net, inter_op_parallelism)
+{
+    // Inception-like block followed by two branches joined by a sum, which is fused into the convolution
+    Net net;
+    LayerParams lp;
+    int stem = addConvolution(net, "stem", 3, 16, 3);
+    net.connect(0, 0, stem, 0);
+    int relu = net.addLayer("stem_relu", "ReLU", lp);
+    net.connect(stem, 0, relu, 0);
+    int branch1 = addConvolution(net, "branch1", 16, 8, 1);
+    net.connect(relu, 0, branch1, 0);
+    int branch2 = addConvolution(net, "branch2_reduce", 16, 4, 1);
+    net.connect(relu, 0, branch2, 0);
+    int branch2_relu = net.addLayer("branch2_relu", "ReLU", lp);
+    net.connect(branch2, 0, branch2_relu, 0);
+    int branch2_conv = addConvolution(net, "branch2", 4, 8, 3);
+    net.connect(branch2_relu, 0, branch2_conv, 0);
+    int branch3 = addConvolution(net, "branch3", 16, 8, 5);
+    net.connect(relu, 0, branch3, 0);
+    LayerParams poolParams;
+    poolParams.set("pool", "max");
+    poolParams.set("kernel_size", 3);
+    poolParams.set("pad", 1);
+    int pool = net.addLayer("branch4_pool", "Pooling", poolParams);
+    net.connect(relu, 0, pool, 0);
+    int branch4 = addConvolution(net, "branch4", 16, 8, 1);
+    net.connect(pool, 0, branch4, 0);
+    int concat = net.addLayer("concat", "Concat", lp);
+    net.connect(branch1, 0, concat, 0);
+    net.connect(branch2_conv, 0, concat, 1);
+    net.connect(branch3, 0, concat, 2);
+    net.connect(branch4, 0, concat, 3);
+    int head1 = addConvolution(net, "head1", 32, 16, 3);
+    int head2 = addConvolution(net, "head2", 32, 16, 1);
+    net.connect(concat, 0, head1, 0);
+    net.connect(concat, 0, head2, 0);
+    int sum = net.addLayer("sum", "Eltwise", lp);
+    net.connect(head1, 0, sum, 0);
+    net.connect(head2, 0, sum, 1);
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    int inpShape[] = {2, 3, 24, 24};
+    Mat inp(4, inpShape, CV_32F);
+    randu(inp, -1, 1);
+    std::vector<String> outNames;
+    outNames.push_back("concat");
+    outNames.push_back("sum");
+
+    net.setInput(inp);
+    Mat ref = net.forward().clone();
+    std::vector<Mat> refs;
+    net.setInput(inp);
+    net.forward(refs, outNames);
+
+    const int numThreads = getNumThreads();
+    setNumThreads(4);
+    net.setInterOpThreads(4);
+    for (int iter = 0; iter < 10; iter++)
+    {
+        net.setInput(inp);
+        Mat out = net.forward();
+        EXPECT_EQ(0, cvtest::norm(out, ref, NORM_INF)) << "iteration " << iter;
+
+        std::vector<Mat> outs;
+        net.setInput(inp);
+        net.forward(outs, outNames);
+        ASSERT_EQ(refs.size(), outs.size());
+        for (size_t i = 0; i < outs.size(); i++)
+            EXPECT_EQ(0, cvtest::norm(outs[i], refs[i], NORM_INF)) << outNames[i] << ", iteration " << iter;
+    }
+
+    // the sequential execution is restored
+    net.setInterOpThreads(0);
+    net.setInput(inp);
+    EXPECT_EQ(0, cvtest::norm(net.forward(), ref, NORM_INF));
+    setNumThreads(numThreads);
+}
+
 #ifdef HAVE_INF_ENGINE
 static const std::chrono::milliseconds async_timeout(10000);
 
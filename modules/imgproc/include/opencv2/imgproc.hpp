@@ -385,7 +385,14 @@ enum FloodFillFlags {
     /** If set, the function does not change the image ( newVal is ignored), and only fills the
     mask with the value specified in bits 8-16 of flags as described above. This option only make
     sense in function variants that have the mask parameter. */
-    FLOODFILL_MASK_ONLY   = 1 << 17
+    FLOODFILL_MASK_ONLY   = 1 << 17,
+    /** If set together with #FLOODFILL_FIXED_RANGE, the domain is found by a parallel range test
+    of the whole image followed by connectedComponentsWithStats, instead of the serial scanline
+    fill. The result is the same; this is faster for large domains and slower for small ones.
+    With several seeds, the labelings of the last few seed values are kept: the next seeds of the
+    same value reuse them, unless a fill in between reached their domain. The flag is ignored for
+    the floating range. */
+    FLOODFILL_PARALLEL    = 1 << 18
 };
 
 //! @} imgproc_misc
@@ -1068,6 +1075,52 @@ public:
     CV_WRAP virtual void collectGarbage() = 0;
 };
 
+/** @brief CLAHE for video streams.
+
+The previous frame and the histograms of its tiles are kept. On every frame, only the rows that
+differ from the previous frame are scanned, and the changed pixels are moved between the bins of
+the tile histograms. A tile gets its contrast limited LUT rebuilt when its mean absolute change,
+accumulated since the last rebuild, exceeds the threshold. The LUTs used for the output follow the
+rebuilt ones with an exponential moving average, which avoids flicker when the content changes.
+Only the output rows that changed or use a changed LUT are interpolated again.
+
+With a zero threshold and a blend factor of 1 the result is the same as the one of CLAHE. The
+state is reset when the image size, type, tile grid or clip limit changes.
+*/
+class CV_EXPORTS_W TemporalCLAHE : public CLAHE
+{
+public:
+    /** @brief Sets the mean absolute pixel change above which the LUT of a tile is rebuilt.
+
+    @param threshold mean absolute change per pixel since the last rebuild, in the image units.
+    */
+    CV_WRAP virtual void setChangeThreshold(double threshold) = 0;
+
+    //! Returns the mean absolute pixel change above which the LUT of a tile is rebuilt.
+    CV_WRAP virtual double getChangeThreshold() const = 0;
+
+    /** @brief Sets the weight of the new LUTs in the temporal blend.
+
+    @param alpha value in (0, 1]; 1 uses the rebuilt LUTs right away.
+    */
+    CV_WRAP virtual void setTemporalBlend(double alpha) = 0;
+
+    //! Returns the weight of the new LUTs in the temporal blend.
+    CV_WRAP virtual double getTemporalBlend() const = 0;
+
+    //! Returns the number of tiles which LUT was rebuilt by the last apply call.
+    CV_WRAP virtual int getUpdatedTiles() const = 0;
+
+    /** @brief Returns the tile histograms of the last frame.
+
+    @param hist CV_32SC1 matrix with one row per tile (row-major tile order) and 256 or 65536 bins.
+    */
+    CV_WRAP virtual void getTileHistograms(OutputArray hist) const = 0;
+
+    //! Forgets the previous frames, the next frame is processed from scratch.
+    CV_WRAP virtual void reset() = 0;
+};
+
 //! @} imgproc_hist
 
 //! @addtogroup imgproc_subdiv2d
@@ -1512,7 +1565,7 @@ In-place operation is supported.
 @note The median filter uses #BORDER_REPLICATE internally to cope with border pixels, see #BorderTypes
 
 @param src input 1-, 3-, or 4-channel image; when ksize is 3 or 5, the image depth should be
-CV_8U, CV_16U, or CV_32F, for larger aperture sizes, it can only be CV_8U.
+CV_8U, CV_16U, or CV_32F, for larger aperture sizes, it can be CV_8U, CV_16U, CV_16S or CV_32F.
 @param dst destination array of the same size and type as src.
 @param ksize aperture linear size; it must be odd and greater than 1, for example: 3, 5, 7 ...
 @sa  bilateralFilter, blur, boxFilter, GaussianBlur
@@ -2203,6 +2256,31 @@ CV_EXPORTS_W void HoughLinesP( InputArray image, OutputArray lines,
                                double rho, double theta, int threshold,
                                double minLineLength = 0, double maxLineGap = 0 );
 
+/** @overload
+
+This variant selects the points with a generator initialized from the given seed and can split the
+image into horizontal stripes that are processed in parallel. Every stripe has its own accumulator
+and generator (seeded with seed plus the stripe index), and the segments cut by a stripe border are
+joined afterwards, so the result depends on seed and stripes only, not on the number of threads.
+A line gets its votes in every stripe separately, so the stripes should be noticeably taller than
+threshold.
+
+@param image 8-bit, single-channel binary source image.
+@param lines Output vector of lines, see the first variant.
+@param rho Distance resolution of the accumulator in pixels.
+@param theta Angle resolution of the accumulator in radians.
+@param threshold %Accumulator threshold parameter.
+@param minLineLength Minimum line length. Line segments shorter than that are rejected.
+@param maxLineGap Maximum allowed gap between points on the same line to link them.
+@param seed Seed of the random generator. With (uint64)-1 and a single stripe the result is the one
+of the first variant when it does not use an external implementation.
+@param stripes Number of horizontal stripes. Values less than 2 run the serial algorithm.
+ */
+CV_EXPORTS void HoughLinesP( InputArray image, OutputArray lines,
+                             double rho, double theta, int threshold,
+                             double minLineLength, double maxLineGap,
+                             uint64 seed, int stripes );
+
 /** @brief Finds lines in a set of points using the standard Hough transform.
 
 The function finds lines in a set of points using a modification of the Hough transform.
@@ -2377,6 +2455,85 @@ CV_EXPORTS_W void morphologyEx( InputArray src, OutputArray dst,
                                 int borderType = BORDER_CONSTANT,
                                 const Scalar& borderValue = morphologyDefaultBorderValue() );
 
+/** @brief Chain of separable linear and morphological filters applied to an image in row bands.
+
+The class lets you filter images that do not fit into memory. The image is passed to process() as
+successive, non-overlapping bands of rows, from top to bottom, and each call returns the output rows
+that can already be computed. The rows that a kernel needs from the previous band are kept in
+internal ring buffers, and the top and bottom borders are extrapolated from the image height given
+at creation, so concatenating the output bands gives the same result as applying the filters one
+after another to the whole image.
+
+Every band is pushed through all the filters of the chain before the next band is read, so with
+bands of a few dozen rows the intermediate results stay in cache. Because of the vertical kernel
+extent the output of a call may be a few rows shorter than the input band; the missing rows are
+returned by the following calls, and the call with the last band returns all of the remaining rows.
+
+@sa createStreamingFilter, sepFilter2D, erode, dilate
+ */
+class CV_EXPORTS_W StreamingFilter : public Algorithm
+{
+public:
+    /** @brief Appends a separable linear filter to the chain.
+
+    @param ddepth Output depth of the stage, see @ref filter_depths "combinations"; -1 keeps the
+    depth of the previous stage.
+    @param kernelX Coefficients for filtering each row.
+    @param kernelY Coefficients for filtering each column.
+    @param anchor Anchor position within the kernel, (-1, -1) means the kernel center.
+    @param delta Value added to the filtered results before storing them.
+    @param borderType Pixel extrapolation method, see #BorderTypes. #BORDER_WRAP is not supported.
+    @sa sepFilter2D
+     */
+    CV_WRAP virtual void addSepFilter(int ddepth, InputArray kernelX, InputArray kernelY,
+                                      Point anchor = Point(-1,-1), double delta = 0,
+                                      int borderType = BORDER_DEFAULT) = 0;
+
+    /** @brief Appends a morphological operation to the chain.
+
+    @param op Type of the operation: #MORPH_ERODE, #MORPH_DILATE, #MORPH_OPEN or #MORPH_CLOSE.
+    Opening and closing are added as two stages.
+    @param kernel Structuring element; an empty one means a 3x3 rectangle.
+    @param anchor Anchor position within the element, (-1, -1) means the element center.
+    @param iterations Number of times erosion and dilation are applied, each one is a stage.
+    @param borderType Pixel extrapolation method, see #BorderTypes. #BORDER_WRAP is not supported.
+    @param borderValue Border value in case of a constant border.
+    @sa morphologyEx
+     */
+    CV_WRAP virtual void addMorphology(int op, InputArray kernel, Point anchor = Point(-1,-1),
+                                       int iterations = 1, int borderType = BORDER_CONSTANT,
+                                       const Scalar& borderValue = morphologyDefaultBorderValue()) = 0;
+
+    /** @brief Filters the next band of rows.
+
+    @param band Next rows of the source image, of the source type and the image width.
+    @param dst Output rows of the last stage that became available, in the output type. It has
+    zero rows when the chain is still accumulating the rows required by the kernels.
+    @return Number of rows written to dst.
+     */
+    CV_WRAP virtual int process(InputArray band, OutputArray dst) = 0;
+
+    //! Prepares the chain for a new image of the same size; the filters are kept.
+    CV_WRAP virtual void reset() = 0;
+
+    //! Returns the number of source rows that have not been passed to process yet.
+    CV_WRAP virtual int getRemainingInputRows() const = 0;
+
+    //! Returns the number of output rows that have not been returned yet.
+    CV_WRAP virtual int getRemainingOutputRows() const = 0;
+
+    //! Returns the type of the output rows, i.e. of the last stage.
+    CV_WRAP virtual int getDstType() const = 0;
+};
+
+/** @brief Creates an empty StreamingFilter.
+
+@param srcType Type of the source image.
+@param imageSize Size of the whole source image, the height is used to extrapolate the bottom
+border.
+ */
+CV_EXPORTS_W Ptr<StreamingFilter> createStreamingFilter(int srcType, Size imageSize);
+
 //! @} imgproc_filter
 
 //! @addtogroup imgproc_transform
@@ -2420,6 +2577,47 @@ CV_EXPORTS_W void resize( InputArray src, OutputArray dst,
                           Size dsize, double fx = 0, double fy = 0,
                           int interpolation = INTER_LINEAR );
 
+/** @brief Converts, resizes and normalizes an image into a planar blob in a single pass.
+
+The function is a fused equivalent of the usual neural network input preparation:
+@code
+    cvtColor(src, converted, code);                      // skipped if code < 0
+    resize(converted, resized, dsize, 0, 0, interpolation);
+    resized.convertTo(tmp, CV_32F);
+    subtract(tmp, mean, tmp);
+    multiply(tmp, scale, tmp);
+    // tmp is split into planes and stored as a 1 x C x dsize.height x dsize.width blob of ddepth
+@endcode
+The source is read once in horizontal stripes and the blob is written directly, without any
+full-size intermediate image. For #INTER_LINEAR_EXACT, #INTER_NEAREST and #INTER_NEAREST_EXACT the
+result is bit-exact with the sequence above. #INTER_LINEAR uses the same weights but skips the
+rounding of the resized pixels to 8 bits, so it is slightly more accurate and may differ from
+the sequence above by up to 1.5 units before normalization. Other interpolation methods are supported by running the regular
+#resize and fusing only the normalization and the layout change.
+
+The color conversion is fused for #COLOR_BGR2RGB, #COLOR_BGRA2BGR, #COLOR_BGRA2RGB and the 4:2:0
+conversions to BGR and RGB (NV12, NV21, I420 and YV12). Any other conversion is applied by
+#cvtColor before the fused part.
+
+@param src input 8-bit image (1, 3 or 4 channels; for the 4:2:0 formats it is the usual single
+channel image of 3/2 of the frame height).
+@param blob output 4-dimensional blob of size 1 x C x dsize.height x dsize.width and depth ddepth,
+where C is the number of channels after the color conversion.
+@param dsize size of the resized image.
+@param code color space conversion code (see #ColorConversionCodes) or -1 to keep the source colors.
+@param mean per-channel value subtracted from the resized image.
+@param scale per-channel multiplier applied after the mean subtraction.
+@param interpolation interpolation method, see #InterpolationFlags.
+@param ddepth depth of the output blob, CV_32F or CV_16F.
+@param hint Implementation modfication flags. See #AlgorithmHint
+
+@sa resize, cvtColor
+ */
+CV_EXPORTS_W void preprocessToBlob( InputArray src, OutputArray blob, Size dsize, int code = -1,
+                                    const Scalar& mean = Scalar(), const Scalar& scale = Scalar::all(1.0),
+                                    int interpolation = INTER_LINEAR_EXACT, int ddepth = CV_32F,
+                                    AlgorithmHint hint = cv::ALGO_HINT_DEFAULT );
+
 /** @brief Applies an affine transformation to an image.
 
 The function warpAffine transforms the source image using the specified matrix:
@@ -2482,6 +2680,72 @@ CV_EXPORTS_W void warpPerspective( InputArray src, OutputArray dst,
                                    int borderMode = BORDER_CONSTANT,
                                    const Scalar& borderValue = Scalar());
 
+/** @brief Precomputed warpAffine / warpPerspective transformation.
+
+The plan stores the fixed-point maps of a transformation in the compact #CV_16SC2 + #CV_16UC1 form
+of convertMaps, split into tiles that are contiguous in memory. Applying it to several images of
+the same size skips the map computation done by every warpAffine / warpPerspective call, while
+giving the same result.
+
+Tiles whose interpolation taps all fall outside the source image are not remapped: with
+#BORDER_CONSTANT they are filled with the border value, with #BORDER_TRANSPARENT they are left
+untouched. When setSkipOutside(true) is used, such tiles are left untouched for every border mode,
+which is useful when only a small region of the source is visible in the destination.
+
+@sa createWarpAffinePlan, createWarpPerspectivePlan
+ */
+class CV_EXPORTS_W WarpPlan : public Algorithm
+{
+public:
+    /** @brief Applies the transformation to an image.
+
+    @param src Source image of the size given to the plan.
+    @param dst Destination image of the plan destination size and the same type as src.
+    @param borderMode Pixel extrapolation method (see #BorderTypes).
+    @param borderValue Value used in case of a constant border.
+     */
+    CV_WRAP virtual void apply(InputArray src, OutputArray dst,
+                               int borderMode = BORDER_CONSTANT,
+                               const Scalar& borderValue = Scalar()) = 0;
+
+    //! Returns the source image size the plan was built for.
+    CV_WRAP virtual Size getSrcSize() const = 0;
+
+    //! Returns the destination image size.
+    CV_WRAP virtual Size getDstSize() const = 0;
+
+    /** @brief Sets whether the destination tiles that do not see the source image are left untouched.
+
+    @param skip when true, such tiles are neither filled nor extrapolated.
+    */
+    CV_WRAP virtual void setSkipOutside(bool skip) = 0;
+
+    //! Returns whether the tiles outside of the source image are left untouched.
+    CV_WRAP virtual bool getSkipOutside() const = 0;
+};
+
+/** @brief Creates a WarpPlan that reproduces warpAffine.
+
+@param M \f$2\times 3\f$ transformation matrix.
+@param srcSize size of the source images.
+@param dsize size of the output images, the source size is used when it is empty.
+@param flags combination of interpolation methods (see #InterpolationFlags) and the optional
+flag #WARP_INVERSE_MAP, same as in warpAffine.
+ */
+CV_EXPORTS_W Ptr<WarpPlan> createWarpAffinePlan(InputArray M, Size srcSize, Size dsize,
+                                                int flags = INTER_LINEAR);
+
+/** @brief Creates a WarpPlan that reproduces warpPerspective.
+
+@param M \f$3\times 3\f$ transformation matrix.
+@param srcSize size of the source images.
+@param dsize size of the output images, the source size is used when it is empty.
+@param flags combination of interpolation methods (see #InterpolationFlags) and the optional
+flag #WARP_INVERSE_MAP, same as in warpPerspective.
+ */
+CV_EXPORTS_W Ptr<WarpPlan> createWarpPerspectivePlan(InputArray M, Size srcSize, Size dsize,
+                                                     int flags = INTER_LINEAR);
+
 /** @brief Applies a generic geometrical transformation to an image.
 
 The function remap transforms the source image using the specified map:
@@ -3350,6 +3614,16 @@ equally sized rectangular tiles. tileGridSize defines the number of tiles in row
  */
 CV_EXPORTS_W Ptr<CLAHE> createCLAHE(double clipLimit = 40.0, Size tileGridSize = Size(8, 8));
 
+/** @brief Creates a smart pointer to a cv::TemporalCLAHE class and initializes it.
+
+@param clipLimit Threshold for contrast limiting.
+@param tileGridSize Size of grid for histogram equalization, see createCLAHE.
+@param changeThreshold Mean absolute pixel change above which the LUT of a tile is rebuilt.
+@param temporalBlend Weight of the new LUTs in the temporal blend, in (0, 1].
+ */
+CV_EXPORTS_W Ptr<TemporalCLAHE> createTemporalCLAHE(double clipLimit = 40.0, Size tileGridSize = Size(8, 8),
+                                                    double changeThreshold = 1.0, double temporalBlend = 0.25);
+
 /** @brief Computes the "minimal work" distance between two weighted point configurations.
 
 The function computes the earth mover distance and/or a lower boundary of the distance between the
@@ -3674,6 +3948,33 @@ CV_EXPORTS int floodFill( InputOutputArray image,
                           Scalar loDiff = Scalar(), Scalar upDiff = Scalar(),
                           int flags = 4 );
 
+/** @overload
+
+Fills the components of several seed points with the same mask, in one call.
+
+The result is the same as calling the function for every seed in turn with the same mask and the
+same parameters. The seeds that are already covered by an earlier fill (or by the input mask) give
+an empty domain. The fills stay sequential, because every fill masks the pixels that the next
+seeds could reach; only the mask preparation, the buffers and, with #FLOODFILL_PARALLEL, the
+labelings of the seeds of the same value are shared.
+
+@param image Input/output 1- or 3-channel, 8-bit, or floating-point image.
+@param mask Operation mask, see the first variant.
+@param seedPoints Starting points.
+@param newVal New value of the repainted domain pixels.
+@param rects Optional output vector of the bounding rectangles of the domain of every seed.
+@param areas Optional output vector of the number of pixels filled from every seed.
+@param loDiff Maximal lower brightness/color difference, see the first variant.
+@param upDiff Maximal upper brightness/color difference, see the first variant.
+@param flags Operation flags, see the first variant.
+@return The total number of filled pixels.
+*/
+CV_EXPORTS int floodFill( InputOutputArray image, InputOutputArray mask,
+                          const std::vector<Point>& seedPoints, Scalar newVal,
+                          CV_OUT std::vector<Rect>* rects = 0, CV_OUT std::vector<int>* areas = 0,
+                          Scalar loDiff = Scalar(), Scalar upDiff = Scalar(),
+                          int flags = 4 );
+
 //! Performs linear blending of two images:
 //! \f[ \texttt{dst}(i,j) = \texttt{weights1}(i,j)*\texttt{src1}(i,j) + \texttt{weights2}(i,j)*\texttt{src2}(i,j) \f]
 //! @param src1 It has a type of CV_8UC(n) or CV_32FC(n), where n is a positive integer.
@@ -3913,6 +4214,45 @@ is \f$W \times H\f$ and templ is \f$w \times h\f$ , then result is \f$(W-w+1) \t
 CV_EXPORTS_W void matchTemplate( InputArray image, InputArray templ,
                                  OutputArray result, int method, InputArray mask = noArray() );
 
+/** @brief Template matcher for matching the same template against many images.
+
+The result is the same as of #matchTemplate called with the template and the method (without a
+mask), up to rounding errors. The data depending only on the template, i.e. the spectra of the
+template used by the DFT-based correlation and the template statistics used by the normalized
+methods, are computed once and reused for all the images of the same size. The image blocks are
+processed in parallel. For every result size the correlation is computed either directly or via
+DFT, whichever is cheaper according to the cost model of both algorithms.
+
+@sa matchTemplate, createTemplateMatcher
+ */
+class CV_EXPORTS_W TemplateMatcher : public Algorithm
+{
+public:
+    /** @brief Compares the template against overlapped image regions.
+
+    @param image Image where the search is running. It must have the same type as the template
+    and must be not smaller than the template.
+    @param result Map of comparison results, see #matchTemplate.
+     */
+    CV_WRAP virtual void match(InputArray image, OutputArray result) = 0;
+
+    //! Returns the comparison method, see #TemplateMatchModes
+    CV_WRAP virtual int getMethod() const = 0;
+
+    //! Returns the size of the template
+    CV_WRAP virtual Size getTemplateSize() const = 0;
+
+    //! Releases the data computed for the images of the last size
+    CV_WRAP virtual void collectGarbage() = 0;
+};
+
+/** @brief Creates a smart pointer to a cv::TemplateMatcher.
+
+@param templ Searched template. It must be 8-bit or 32-bit floating-point.
+@param method Parameter specifying the comparison method, see #TemplateMatchModes
+ */
+CV_EXPORTS_W Ptr<TemplateMatcher> createTemplateMatcher(InputArray templ, int method);
+
 //! @}
 
 //! @addtogroup imgproc_shape
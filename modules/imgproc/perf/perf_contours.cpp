@@ -84,6 +84,46 @@ PERF_TEST_P(TestFindContoursFF, findContours,
     SANITY_CHECK_NOTHING();
 }
 
+typedef TestBaseWithParam< tuple<RetrMode, int> > TestFindContoursBands;
+
+// objects are in horizontal strips, so the image can be scanned by bands in parallel
+PERF_TEST_P(TestFindContoursBands, findContours,
+    Combine(
+        RetrMode::all(), // retrieval mode
+        Values(1, 0) // threads: serial scan or default
+    )
+)
+{
+    int retr_mode = get<0>(GetParam());
+    int nthreads = get<1>(GetParam());
+    const Size img_size(5472, 3648); // 20 Mpx
+    const int strip = 128;
+
+    RNG rng;
+    Mat img = Mat::zeros(img_size, CV_8UC1);
+    for (int y = 0; y < img.rows; y += strip)
+    {
+        Mat roi = img(Rect(0, y, img.cols, std::min(strip - 8, img.rows - y)));
+        for (int i = 0; i < 64; i++)
+        {
+            Point center(rng.uniform(0, roi.cols), rng.uniform(0, roi.rows));
+            Size axes(rng.uniform(2, 50), rng.uniform(2, 50));
+            ellipse(roi, center, axes, rng.uniform(0, 180), 0., 360., Scalar(255), -1);
+            ellipse(roi, center, axes / 2, 0, 0., 360., Scalar(0), -1);
+        }
+    }
+    vector< vector<Point> > contours;
+    vector<Vec4i> hierarchy;
+
+    const int prev_threads = getNumThreads();
+    if (nthreads > 0)
+        setNumThreads(nthreads);
+    TEST_CYCLE() findContours(img, contours, hierarchy, retr_mode, CHAIN_APPROX_SIMPLE);
+    setNumThreads(prev_threads);
+
+    SANITY_CHECK_NOTHING();
+}
+
 typedef TestBaseWithParam< tuple<MatDepth, int> > TestBoundingRect;
 
 PERF_TEST_P(TestBoundingRect, BoundingRect,
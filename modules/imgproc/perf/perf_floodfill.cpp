@@ -67,4 +67,33 @@ PERF_TEST_P(Size_Source_Fl, floodFill1, Combine(
     SANITY_CHECK_NOTHING();
 }
 
+typedef tuple<Size, int, int> Size_Conn_Parallel_t;
+typedef perf::TestBaseWithParam<Size_Conn_Parallel_t> Size_Conn_Parallel;
+
+PERF_TEST_P(Size_Conn_Parallel, floodFill_fixedRange, Combine(
+            testing::Values(sz1080p, Size(4096, 4096)),
+            testing::Values(4, 8),
+            testing::Values(0, (int)FLOODFILL_PARALLEL)
+            ))
+{
+    Size size = get<0>(GetParam());
+    int flags = get<1>(GetParam()) | FLOODFILL_FIXED_RANGE | FLOODFILL_MASK_ONLY | get<2>(GetParam());
+
+    // a large domain with a noisy band across it
+    Mat image(size, CV_8UC1, Scalar(100));
+    Mat band = image.rowRange(size.height/2 - 8, size.height/2 + 8);
+    randu(band, 90, 110);
+    Mat mask;
+
+    declare.in(image);
+
+    TEST_CYCLE()
+    {
+        mask.release();
+        floodFill(image, mask, Point(size.width/2, 10), Scalar(), 0, Scalar(5), Scalar(5), flags);
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
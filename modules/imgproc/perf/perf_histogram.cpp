@@ -165,4 +165,30 @@ PERF_TEST_P(Sz_ClipLimit, CLAHE,
     SANITY_CHECK(dst);
 }
 
+PERF_TEST_P(Sz_ClipLimit, TemporalCLAHE,
+            testing::Combine(testing::Values(::perf::sz720p, ::perf::sz1080p),
+                             testing::Values(40.0),
+                             testing::Values(MatType(CV_8UC1), MatType(CV_16UC1)))
+            )
+{
+    const Size size = get<0>(GetParam());
+    const double clipLimit = get<1>(GetParam());
+    const int type = get<2>(GetParam());
+
+    // static scene with a little sensor noise
+    Mat frame(size, type), noise(size, type), src;
+    randu(frame, 0, type == CV_8UC1 ? 256 : 4096);
+    randu(noise, 0, 2);
+    cv::add(frame, noise, src);
+    declare.in(src);
+
+    Ptr<TemporalCLAHE> clahe = createTemporalCLAHE(clipLimit);
+    Mat dst;
+    clahe->apply(frame, dst);
+
+    TEST_CYCLE() clahe->apply(src, dst);
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
@@ -112,4 +112,28 @@ PERF_TEST_P(Image_RhoStep_ThetaStep_Threshold, HoughLines3f,
     SANITY_CHECK_NOTHING();
 }
 
+typedef perf::TestBaseWithParam<int> HoughLinesP_Stripes;
+
+PERF_TEST_P(HoughLinesP_Stripes, HoughLinesP, testing::Values(1, 4, 8, 16))
+{
+    const int stripes = GetParam();
+
+    Mat image(1080, 1920, CV_8UC1, Scalar::all(0));
+    RNG rng(0);
+    for (int i = 0; i < 100; i++)
+        line(image, Point(rng.uniform(0, image.cols), rng.uniform(0, image.rows)),
+             Point(rng.uniform(0, image.cols), rng.uniform(0, image.rows)), Scalar::all(255), 2);
+    for (int i = 0; i < 20000; i++)
+        image.at<uchar>(rng.uniform(0, image.rows), rng.uniform(0, image.cols)) = 255;
+
+    vector<Vec4i> lines;
+    declare.in(image);
+
+    TEST_CYCLE() HoughLinesP(image, lines, 1, CV_PI/180, 40, 30, 5, (uint64)-1, stripes);
+
+    EXPECT_GT(lines.size(), 100u);
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
@@ -81,4 +81,34 @@ PERF_TEST_P(ImgSize_TmplSize_Method, matchTemplateBig,
     SANITY_CHECK(result, eps);
 }
 
+PERF_TEST_P(ImgSize_TmplSize_Method, templateMatcher,
+            testing::Combine(
+                testing::Values(cv::Size(640, 480), cv::Size(1280, 1024), cv::Size(1920, 1080)),
+                testing::Values(cv::Size(8, 8), cv::Size(12, 12), cv::Size(16, 16), cv::Size(32, 32), cv::Size(64, 64)),
+                testing::Values(MethodType(TM_SQDIFF), MethodType(TM_CCORR_NORMED), MethodType(TM_CCOEFF_NORMED))
+                )
+            )
+{
+    Size imgSz = get<0>(GetParam());
+    Size tmplSz = get<1>(GetParam());
+    int method = get<2>(GetParam());
+
+    Mat img(imgSz, CV_8UC1);
+    Mat tmpl(tmplSz, CV_8UC1);
+    Mat result(imgSz - tmplSz + Size(1,1), CV_32F);
+
+    declare
+        .in(img, WARMUP_RNG)
+        .in(tmpl, WARMUP_RNG)
+        .out(result);
+
+    // the template data are computed once, as when matching the same template in a video
+    Ptr<TemplateMatcher> matcher = createTemplateMatcher(tmpl, method);
+    matcher->match(img, result);
+
+    TEST_CYCLE() matcher->match(img, result);
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
@@ -280,4 +280,32 @@ PERF_TEST_P(MatInfo_Size_Scale_NN, ResizeNNExact,
     SANITY_CHECK_NOTHING();
 }
 
+CV_ENUM(PreprocessCode, COLOR_BGR2RGB, COLOR_YUV2RGB_NV12, COLOR_YUV2RGB_I420)
+
+typedef tuple<PreprocessCode, Size, int> Code_Size_Depth_t;
+typedef TestBaseWithParam<Code_Size_Depth_t> Code_Size_Depth;
+
+PERF_TEST_P(Code_Size_Depth, preprocessToBlob,
+    testing::Combine(
+        PreprocessCode::all(),
+        testing::Values(sz720p, sz1080p),
+        testing::Values(CV_32F, CV_16F)
+    )
+)
+{
+    int code = get<0>(GetParam());
+    Size from = get<1>(GetParam());
+    int ddepth = get<2>(GetParam());
+    bool yuv = code == COLOR_YUV2RGB_NV12 || code == COLOR_YUV2RGB_I420;
+
+    cv::Mat src(yuv ? Size(from.width, from.height*3/2) : from, yuv ? CV_8UC1 : CV_8UC3);
+    cv::Mat blob;
+
+    declare.in(src, WARMUP_RNG);
+
+    TEST_CYCLE() preprocessToBlob(src, blob, Size(640, 640), code, Scalar(104, 117, 123), Scalar::all(1/255.), INTER_LINEAR_EXACT, ddepth);
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
@@ -47,6 +47,35 @@ PERF_TEST_P( TestWarpAffine, WarpAffine,
     SANITY_CHECK(dst, 1);
 }
 
+PERF_TEST_P( TestWarpAffine, WarpAffinePlan,
+             Combine(
+                Values(CV_8UC1, CV_8UC4),
+                Values( szVGA, sz720p, sz1080p ),
+                InterType::all(),
+                BorderMode::all()
+             )
+)
+{
+    Size sz, szSrc(512, 512);
+    int borderMode, interType, dataType;
+    dataType   = get<0>(GetParam());
+    sz         = get<1>(GetParam());
+    interType  = get<2>(GetParam());
+    borderMode = get<3>(GetParam());
+    Scalar borderColor = Scalar::all(150);
+
+    Mat src(szSrc, dataType), dst(sz, dataType);
+    cvtest::fillGradient(src);
+    if(borderMode == BORDER_CONSTANT) cvtest::smoothBorder(src, borderColor, 1);
+    Mat warpMat = getRotationMatrix2D(Point2f(src.cols/2.f, src.rows/2.f), 30., 2.2);
+    Ptr<WarpPlan> plan = createWarpAffinePlan(warpMat, szSrc, sz, interType);
+    declare.in(src).out(dst);
+
+    TEST_CYCLE() plan->apply( src, dst, borderMode, borderColor );
+
+    SANITY_CHECK_NOTHING();
+}
+
 PERF_TEST_P(TestWarpAffine, DISABLED_WarpAffine_ovx,
     Combine(
         Values(CV_8UC1, CV_8UC4),
@@ -118,6 +118,35 @@ namespace clahe
 
 namespace
 {
+    template <int histSize>
+    void clipHistogram(int* tileHist, int clipLimit)
+    {
+        // how many pixels were clipped
+        int clipped = 0;
+        for (int i = 0; i < histSize; ++i)
+        {
+            if (tileHist[i] > clipLimit)
+            {
+                clipped += tileHist[i] - clipLimit;
+                tileHist[i] = clipLimit;
+            }
+        }
+
+        // redistribute clipped pixels
+        int redistBatch = clipped / histSize;
+        int residual = clipped - redistBatch * histSize;
+
+        for (int i = 0; i < histSize; ++i)
+            tileHist[i] += redistBatch;
+
+        if (residual != 0)
+        {
+            int residualStep = MAX(histSize / residual, 1);
+            for (int i = 0; i < histSize && residual > 0; i += residualStep, residual--)
+                tileHist[i]++;
+        }
+    }
+
     template <class T, int histSize, int shift>
     class CLAHE_CalcLut_Body : public cv::ParallelLoopBody
     {
@@ -186,32 +215,7 @@ namespace
             // clip histogram
 
             if (clipLimit_ > 0)
-            {
-                // how many pixels were clipped
-                int clipped = 0;
-                for (int i = 0; i < histSize; ++i)
-                {
-                    if (tileHist[i] > clipLimit_)
-                    {
-                        clipped += tileHist[i] - clipLimit_;
-                        tileHist[i] = clipLimit_;
-                    }
-                }
-
-                // redistribute clipped pixels
-                int redistBatch = clipped / histSize;
-                int residual = clipped - redistBatch * histSize;
-
-                for (int i = 0; i < histSize; ++i)
-                    tileHist[i] += redistBatch;
-
-                if (residual != 0)
-                {
-                    int residualStep = MAX(histSize / residual, 1);
-                    for (int i = 0; i < histSize && residual > 0; i += residualStep, residual--)
-                        tileHist[i]++;
-                }
-            }
+                clipHistogram<histSize>(tileHist, clipLimit_);
 
             // calc Lut
 
@@ -458,9 +462,345 @@ namespace
         ulut_.release();
 #endif
     }
+
+    class TemporalCLAHE_Impl CV_FINAL : public cv::TemporalCLAHE
+    {
+    public:
+        TemporalCLAHE_Impl(double clipLimit, int tilesX, int tilesY, double changeThreshold, double temporalBlend);
+
+        void apply(cv::InputArray src, cv::OutputArray dst) CV_OVERRIDE;
+
+        void setClipLimit(double clipLimit) CV_OVERRIDE { clipLimit_ = clipLimit; }
+        double getClipLimit() const CV_OVERRIDE { return clipLimit_; }
+
+        void setTilesGridSize(cv::Size tileGridSize) CV_OVERRIDE;
+        cv::Size getTilesGridSize() const CV_OVERRIDE { return cv::Size(tilesX_, tilesY_); }
+
+        void setChangeThreshold(double threshold) CV_OVERRIDE;
+        double getChangeThreshold() const CV_OVERRIDE { return changeThreshold_; }
+
+        void setTemporalBlend(double alpha) CV_OVERRIDE;
+        double getTemporalBlend() const CV_OVERRIDE { return temporalBlend_; }
+
+        int getUpdatedTiles() const CV_OVERRIDE { return updatedTiles_; }
+        void getTileHistograms(cv::OutputArray hist) const CV_OVERRIDE { hist_.copyTo(hist); }
+
+        void reset() CV_OVERRIDE;
+        void collectGarbage() CV_OVERRIDE;
+
+    private:
+        template <class T, int histSize>
+        void updateLut(const cv::Mat& srcForLut, const cv::Size& tileSize, int clipLimit, float lutScale, bool full);
+
+        double clipLimit_;
+        int tilesX_;
+        int tilesY_;
+        double changeThreshold_;
+        double temporalBlend_;
+        int updatedTiles_;
+
+        // state carried from frame to frame: the previous frame, the histograms of its tiles, the
+        // change of every tile since its LUT was rebuilt, the blended LUTs (only while blending),
+        // the LUTs applied and the previous output
+        cv::Mat srcExt_;
+        cv::Mat ref_;
+        cv::Mat hist_;
+        std::vector<double> drift_;
+        cv::Mat current_;
+        cv::Mat lut_;
+        cv::Mat dst_;
+        std::vector<uchar> converged_;
+        int lutClipLimit_;
+
+        // what the last frame changed: rows of every tile column, and LUTs
+        std::vector<uchar> rowChanged_;
+        std::vector<uchar> lutChanged_;
+    };
+
+    TemporalCLAHE_Impl::TemporalCLAHE_Impl(double clipLimit, int tilesX, int tilesY, double changeThreshold, double temporalBlend) :
+        clipLimit_(clipLimit), tilesX_(tilesX), tilesY_(tilesY), changeThreshold_(0), temporalBlend_(1), updatedTiles_(0), lutClipLimit_(0)
+    {
+        setChangeThreshold(changeThreshold);
+        setTemporalBlend(temporalBlend);
+    }
+
+    template <class T, int histSize>
+    void TemporalCLAHE_Impl::updateLut(const cv::Mat& srcForLut, const cv::Size& tileSize, int clipLimit, float lutScale, bool full)
+    {
+        const float alpha = static_cast<float>(temporalBlend_);
+        const bool blend = alpha < 1.f;
+        const double maxDiff = changeThreshold_ * tileSize.area();
+        std::vector<uchar> updated(tilesX_ * tilesY_, 0);
+
+        cv::parallel_for_(cv::Range(0, tilesX_ * tilesY_), [&](const cv::Range& range)
+        {
+            cv::AutoBuffer<int> _clipped(histSize);
+            int* clipped = _clipped.data();
+            cv::AutoBuffer<float> _target(histSize);
+            float* target = _target.data();
+
+            for (int k = range.start; k < range.end; ++k)
+            {
+                const int tx = k % tilesX_;
+                const cv::Rect tileROI(tx * tileSize.width, (k / tilesX_) * tileSize.height,
+                                       tileSize.width, tileSize.height);
+                int* tileHist = hist_.ptr<int>(k);
+                bool changed = full;
+
+                if (full)
+                {
+                    const cv::Mat tile = srcForLut(tileROI);
+                    std::fill(tileHist, tileHist + histSize, 0);
+                    for (int y = 0; y < tileROI.height; ++y)
+                    {
+                        const T* ptr = tile.ptr<T>(y);
+                        for (int x = 0; x < tileROI.width; ++x)
+                            tileHist[ptr[x]]++;
+                    }
+                    tile.copyTo(ref_(tileROI));
+                    drift_[k] = 0;
+                }
+                else
+                {
+                    // move the pixels that changed since the previous frame, the rows that didn't
+                    // change are skipped by a plain comparison
+                    double drift = 0;
+                    for (int y = tileROI.y; y < tileROI.y + tileROI.height; ++y)
+                    {
+                        const T* ptr = srcForLut.ptr<T>(y) + tileROI.x;
+                        T* refPtr = ref_.ptr<T>(y) + tileROI.x;
+                        if (memcmp(ptr, refPtr, tileROI.width * sizeof(T)) == 0)
+                            continue;
+                        rowChanged_[y * tilesX_ + tx] = 1;
+                        for (int x = 0; x < tileROI.width; ++x)
+                        {
+                            if (ptr[x] != refPtr[x])
+                            {
+                                tileHist[refPtr[x]]--;
+                                tileHist[ptr[x]]++;
+                                drift += std::abs((int)ptr[x] - (int)refPtr[x]);
+                                refPtr[x] = ptr[x];
+                            }
+                        }
+                    }
+                    drift_[k] += drift;
+                    changed = drift_[k] > maxDiff;
+                }
+
+                if (changed)
+                {
+                    drift_[k] = 0;
+                    updated[k] = 1;
+                    converged_[k] = 0;
+                }
+
+                if (converged_[k])
+                    continue;
+
+                // the target LUT is computed from the histogram, which is up to date
+                std::copy(tileHist, tileHist + histSize, clipped);
+                if (clipLimit > 0)
+                    clipHistogram<histSize>(clipped, clipLimit);
+
+                int sum = 0;
+                for (int i = 0; i < histSize; ++i)
+                {
+                    sum += clipped[i];
+                    target[i] = sum * lutScale;
+                }
+
+                const float* lutSrc = target;
+                if (blend)
+                {
+                    float* current = current_.ptr<float>(k);
+                    if (full)
+                    {
+                        std::copy(target, target + histSize, current);
+                        converged_[k] = 1;
+                    }
+                    else
+                    {
+                        float maxDelta = 0.f;
+                        for (int i = 0; i < histSize; ++i)
+                        {
+                            float delta = target[i] - current[i];
+                            current[i] += alpha * delta;
+                            maxDelta = std::max(maxDelta, std::abs(delta));
+                        }
+                        // stop blending when the LUT is within rounding of the target
+                        if (maxDelta < 0.5f)
+                        {
+                            std::copy(target, target + histSize, current);
+                            converged_[k] = 1;
+                        }
+                        lutSrc = current;
+                    }
+                }
+                else
+                    converged_[k] = 1;
+
+                T* tileLut = lut_.ptr<T>(k);
+                for (int i = 0; i < histSize; ++i)
+                    tileLut[i] = cv::saturate_cast<T>(lutSrc[i]);
+                lutChanged_[k] = 1;
+            }
+        });
+
+        updatedTiles_ = (int)std::count(updated.begin(), updated.end(), (uchar)1);
+    }
+
+    void TemporalCLAHE_Impl::apply(cv::InputArray _src, cv::OutputArray _dst)
+    {
+        CV_INSTRUMENT_REGION();
+
+        CV_Assert( _src.type() == CV_8UC1 || _src.type() == CV_16UC1 );
+
+        const int histSize = _src.type() == CV_8UC1 ? 256 : 65536;
+
+        cv::Mat src = _src.getMat();
+        cv::Mat srcForLut;
+        cv::Size tileSize;
+
+        if (src.cols % tilesX_ == 0 && src.rows % tilesY_ == 0)
+            srcForLut = src;
+        else
+        {
+            cv::copyMakeBorder(src, srcExt_, 0, tilesY_ - (src.rows % tilesY_), 0, tilesX_ - (src.cols % tilesX_), cv::BORDER_REFLECT_101);
+            srcForLut = srcExt_;
+        }
+        tileSize = cv::Size(srcForLut.cols / tilesX_, srcForLut.rows / tilesY_);
+
+        const int tileSizeTotal = tileSize.area();
+        const float lutScale = static_cast<float>(histSize - 1) / tileSizeTotal;
+
+        int clipLimit = 0;
+        if (clipLimit_ > 0.0)
+        {
+            clipLimit = static_cast<int>(clipLimit_ * tileSizeTotal / histSize);
+            clipLimit = std::max(clipLimit, 1);
+        }
+
+        const int tiles = tilesX_ * tilesY_;
+        const bool full = ref_.empty() || ref_.size() != srcForLut.size() || ref_.type() != src.type() ||
+                          hist_.rows != tiles || lutClipLimit_ != clipLimit;
+        if (full)
+        {
+            ref_.create(srcForLut.size(), src.type());
+            hist_.create(tiles, histSize, CV_32S);
+            lut_.create(tiles, histSize, src.type());
+            drift_.assign(tiles, 0.);
+            converged_.assign(tiles, 0);
+            lutClipLimit_ = clipLimit;
+        }
+
+        // the blended LUTs are only kept while blending, they start from the applied ones
+        if (temporalBlend_ < 1)
+        {
+            if (full)
+                current_.create(tiles, histSize, CV_32F);
+            else if (current_.rows != tiles || current_.cols != histSize)
+                lut_.convertTo(current_, CV_32F);
+        }
+        else
+            current_.release();
+
+        rowChanged_.assign((size_t)srcForLut.rows * tilesX_, 0);
+        lutChanged_.assign(tiles, 0);
+
+        if (src.type() == CV_8UC1)
+            updateLut<uchar, 256>(srcForLut, tileSize, clipLimit, lutScale, full);
+        else
+            updateLut<ushort, 65536>(srcForLut, tileSize, clipLimit, lutScale, full);
+
+        // the output rows are interpolated again only when they changed or one of the LUTs they
+        // use changed, the other rows are kept from the previous frame
+        const bool fullDst = full || dst_.size() != src.size() || dst_.type() != src.type();
+        if (fullDst)
+            dst_.create(src.size(), src.type());
+
+        std::vector<uchar> lutRowChanged(tilesY_, 0);
+        for (int k = 0; k < tiles; ++k)
+            lutRowChanged[k / tilesX_] |= lutChanged_[k];
+
+        std::vector<int> rows;
+        const float inv_th = 1.0f / tileSize.height;
+        for (int y = 0; y < src.rows; ++y)
+        {
+            const int ty1 = cvFloor(y * inv_th - 0.5f), ty2 = ty1 + 1;
+            bool dirty = fullDst || lutRowChanged[std::max(ty1, 0)] || lutRowChanged[std::min(ty2, tilesY_ - 1)];
+            for (int tx = 0; tx < tilesX_ && !dirty; ++tx)
+                dirty = rowChanged_[y * tilesX_ + tx] != 0;
+            if (dirty)
+                rows.push_back(y);
+        }
+
+        if (!rows.empty())
+        {
+            cv::Ptr<cv::ParallelLoopBody> interpolationBody;
+            if (src.type() == CV_8UC1)
+                interpolationBody = cv::makePtr<CLAHE_Interpolation_Body<uchar, 0> >(src, dst_, lut_, tileSize, tilesX_, tilesY_);
+            else
+                interpolationBody = cv::makePtr<CLAHE_Interpolation_Body<ushort, 0> >(src, dst_, lut_, tileSize, tilesX_, tilesY_);
+
+            const cv::ParallelLoopBody& body = *interpolationBody;
+            cv::parallel_for_(cv::Range(0, (int)rows.size()), [&](const cv::Range& range)
+            {
+                for (int i = range.start; i < range.end; ++i)
+                    body(cv::Range(rows[i], rows[i] + 1));
+            });
+        }
+
+        dst_.copyTo(_dst);
+    }
+
+    void TemporalCLAHE_Impl::setTilesGridSize(cv::Size tileGridSize)
+    {
+        tilesX_ = tileGridSize.width;
+        tilesY_ = tileGridSize.height;
+        reset();
+    }
+
+    void TemporalCLAHE_Impl::setChangeThreshold(double threshold)
+    {
+        CV_Assert( threshold >= 0 );
+        changeThreshold_ = threshold;
+    }
+
+    void TemporalCLAHE_Impl::setTemporalBlend(double alpha)
+    {
+        CV_Assert( alpha > 0 && alpha <= 1 );
+        temporalBlend_ = alpha;
+    }
+
+    void TemporalCLAHE_Impl::reset()
+    {
+        ref_.release();
+        hist_.release();
+        drift_.clear();
+        converged_.clear();
+        updatedTiles_ = 0;
+    }
+
+    void TemporalCLAHE_Impl::collectGarbage()
+    {
+        reset();
+        srcExt_.release();
+        current_.release();
+        lut_.release();
+        dst_.release();
+        rowChanged_.clear();
+        lutChanged_.clear();
+    }
 }
 
 cv::Ptr<cv::CLAHE> cv::createCLAHE(double clipLimit, cv::Size tileGridSize)
 {
     return makePtr<CLAHE_Impl>(clipLimit, tileGridSize.width, tileGridSize.height);
 }
+
+cv::Ptr<cv::TemporalCLAHE> cv::createTemporalCLAHE(double clipLimit, cv::Size tileGridSize,
+                                                   double changeThreshold, double temporalBlend)
+{
+    return makePtr<TemporalCLAHE_Impl>(clipLimit, tileGridSize.width, tileGridSize.height,
+                                       changeThreshold, temporalBlend);
+}
@@ -15,6 +15,9 @@
 
 #include "color.hpp"
 
+#include "color_lab.simd.hpp"
+#include "color_lab.simd_declarations.hpp" // defines CV_CPU_DISPATCH_MODES_ALL=AVX2,...,BASELINE based on CMakeLists.txt content
+
 using cv::softfloat;
 
 static const float * splineBuild(const softfloat* f, size_t n)
@@ -4411,6 +4414,84 @@ void cvtLabtoBGR(const uchar * src_data, size_t src_step,
     }
 }
 
+// Color matrix and Luv white point for the approximate 32f kernels.
+// Lab works with X/Xn and Z/Zn, Luv with the raw XYZ values.
+static void initLabLuvApproxCoeffs(float* coeffs, float& un, float& vn, int blueIdx, bool isLab, bool forward)
+{
+    for( int i = 0; i < 3; i++ )
+    {
+        if( forward )
+        {
+            softdouble scale = isLab && i != 1 ? softdouble::one() / D65[i] : softdouble::one();
+            coeffs[i*3 + (blueIdx ^ 2)] = (float)(sRGB2XYZ_D65[i*3    ]*scale);
+            coeffs[i*3 + 1]             = (float)(sRGB2XYZ_D65[i*3 + 1]*scale);
+            coeffs[i*3 + blueIdx]       = (float)(sRGB2XYZ_D65[i*3 + 2]*scale);
+        }
+        else
+        {
+            softdouble scale = isLab ? D65[i] : softdouble::one();
+            coeffs[i + (blueIdx ^ 2)*3] = (float)(XYZ2sRGB_D65[i    ]*scale);
+            coeffs[i + 3]               = (float)(XYZ2sRGB_D65[i + 3]*scale);
+            coeffs[i + blueIdx*3]       = (float)(XYZ2sRGB_D65[i + 6]*scale);
+        }
+    }
+
+    softdouble d = softdouble::one()/(D65[0] + D65[1]*softdouble(15) + D65[2]*softdouble(3));
+    un = (float)(d*softdouble(13*4)*D65[0]);
+    vn = (float)(d*softdouble(13*9)*D65[1]);
+}
+
+// 8u, 32f
+static void cvtBGRtoLab(const uchar * src_data, size_t src_step,
+                        uchar * dst_data, size_t dst_step,
+                        int width, int height,
+                        int depth, int scn, bool swapBlue, bool isLab, bool srgb, AlgorithmHint hint)
+{
+    CV_INSTRUMENT_REGION();
+
+    if (hint == ALGO_HINT_APPROX)
+    {
+        CALL_HAL(cvtBGRtoLab, cv_hal_cvtBGRtoLabApprox, src_data, src_step, dst_data, dst_step, width, height, depth, scn, swapBlue, isLab, srgb);
+
+        if (depth == CV_32F)
+        {
+            float coeffs[9], un, vn;
+            initLabLuvApproxCoeffs(coeffs, un, vn, swapBlue ? 2 : 0, isLab, true);
+            CV_CPU_DISPATCH(cvtBGRtoLabApprox32f, (src_data, src_step, dst_data, dst_step, width, height, scn, isLab, srgb, coeffs, un, vn),
+                CV_CPU_DISPATCH_MODES_ALL);
+            return;
+        }
+    }
+
+    cvtBGRtoLab(src_data, src_step, dst_data, dst_step, width, height, depth, scn, swapBlue, isLab, srgb);
+}
+
+
+// 8u, 32f
+static void cvtLabtoBGR(const uchar * src_data, size_t src_step,
+                        uchar * dst_data, size_t dst_step,
+                        int width, int height,
+                        int depth, int dcn, bool swapBlue, bool isLab, bool srgb, AlgorithmHint hint)
+{
+    CV_INSTRUMENT_REGION();
+
+    if (hint == ALGO_HINT_APPROX)
+    {
+        CALL_HAL(cvtLabtoBGR, cv_hal_cvtLabtoBGRApprox, src_data, src_step, dst_data, dst_step, width, height, depth, dcn, swapBlue, isLab, srgb);
+
+        if (depth == CV_32F)
+        {
+            float coeffs[9], un, vn;
+            initLabLuvApproxCoeffs(coeffs, un, vn, swapBlue ? 2 : 0, isLab, false);
+            CV_CPU_DISPATCH(cvtLabtoBGRApprox32f, (src_data, src_step, dst_data, dst_step, width, height, dcn, isLab, srgb, coeffs, un, vn),
+                CV_CPU_DISPATCH_MODES_ALL);
+            return;
+        }
+    }
+
+    cvtLabtoBGR(src_data, src_step, dst_data, dst_step, width, height, depth, dcn, swapBlue, isLab, srgb);
+}
+
 } // namespace hal
 
 //
@@ -4788,41 +4869,41 @@ bool oclCvtColorXYZ2BGR( InputArray _src, OutputArray _dst, int dcn, int bidx )
 // HAL calls
 //
 
-void cvtColorBGR2Lab( InputArray _src, OutputArray _dst, bool swapb, bool srgb)
+void cvtColorBGR2Lab( InputArray _src, OutputArray _dst, AlgorithmHint hint, bool swapb, bool srgb)
 {
     CvtHelper<Set<3, 4>, Set<3>, Set<CV_8U, CV_32F> > h(_src, _dst, 3);
 
     hal::cvtBGRtoLab(h.src.data, h.src.step, h.dst.data, h.dst.step, h.src.cols, h.src.rows,
-                     h.depth, h.scn, swapb, true, srgb);
+                     h.depth, h.scn, swapb, true, srgb, hint);
 }
 
 
-void cvtColorBGR2Luv( InputArray _src, OutputArray _dst, bool swapb, bool srgb)
+void cvtColorBGR2Luv( InputArray _src, OutputArray _dst, AlgorithmHint hint, bool swapb, bool srgb)
 {
     CvtHelper< Set<3, 4>, Set<3>, Set<CV_8U, CV_32F> > h(_src, _dst, 3);
 
     hal::cvtBGRtoLab(h.src.data, h.src.step, h.dst.data, h.dst.step, h.src.cols, h.src.rows,
-                     h.depth, h.scn, swapb, false, srgb);
+                     h.depth, h.scn, swapb, false, srgb, hint);
 }
 
 
-void cvtColorLab2BGR( InputArray _src, OutputArray _dst, int dcn, bool swapb, bool srgb )
+void cvtColorLab2BGR( InputArray _src, OutputArray _dst, AlgorithmHint hint, int dcn, bool swapb, bool srgb )
 {
     if( dcn <= 0 ) dcn = 3;
     CvtHelper< Set<3>, Set<3, 4>, Set<CV_8U, CV_32F> > h(_src, _dst, dcn);
 
     hal::cvtLabtoBGR(h.src.data, h.src.step, h.dst.data, h.dst.step, h.src.cols, h.src.rows,
-                     h.depth, dcn, swapb, true, srgb);
+                     h.depth, dcn, swapb, true, srgb, hint);
 }
 
 
-void cvtColorLuv2BGR( InputArray _src, OutputArray _dst, int dcn, bool swapb, bool srgb )
+void cvtColorLuv2BGR( InputArray _src, OutputArray _dst, AlgorithmHint hint, int dcn, bool swapb, bool srgb )
 {
     if( dcn <= 0 ) dcn = 3;
     CvtHelper< Set<3>, Set<3, 4>, Set<CV_8U, CV_32F> > h(_src, _dst, dcn);
 
     hal::cvtLabtoBGR(h.src.data, h.src.step, h.dst.data, h.dst.step, h.src.cols, h.src.rows,
-                     h.depth, dcn, swapb, false, srgb);
+                     h.depth, dcn, swapb, false, srgb, hint);
 }
 
 
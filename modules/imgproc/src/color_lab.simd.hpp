@@ -0,0 +1,417 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+#include "precomp.hpp"
+#include "opencv2/core/hal/intrin.hpp"
+
+namespace cv {
+namespace hal {
+CV_CPU_OPTIMIZATION_NAMESPACE_BEGIN
+// forward declarations
+void cvtBGRtoLabApprox32f(const uchar * src_data, size_t src_step,
+                          uchar * dst_data, size_t dst_step,
+                          int width, int height,
+                          int scn, bool isLab, bool srgb,
+                          const float* coeffs, float un, float vn);
+void cvtLabtoBGRApprox32f(const uchar * src_data, size_t src_step,
+                          uchar * dst_data, size_t dst_step,
+                          int width, int height,
+                          int dcn, bool isLab, bool srgb,
+                          const float* coeffs, float un, float vn);
+
+#ifndef CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY
+
+#if defined(CV_CPU_BASELINE_MODE)
+// included in color.hpp
+#else
+#include "color.simd_helpers.hpp"
+#endif
+
+namespace {
+
+//
+// Approximate float conversions (ALGO_HINT_APPROX)
+//
+// The accurate 32f paths evaluate gamma and the Lab cube root through spline
+// tables, which costs a gather per channel. These versions compute the powers
+// in registers as 2^(p*log2(x)) with short polynomials for log2 and exp2.
+// The result is not bit-exact but stays within ~1e-4 of the exact formulas.
+// Color matrices and white point constants are computed by the caller.
+//
+
+static inline float clipApprox(float x)
+{
+    return std::max(0.f, std::min(x, 1.f));
+}
+
+static inline float applyGammaApprox(float x)
+{
+    return x <= 0.04045f ? x*(1.f/12.92f) : std::pow((x + 0.055f)*(1.f/1.055f), 2.4f);
+}
+
+static inline float applyInvGammaApprox(float x)
+{
+    return x <= 0.0031308f ? x*12.92f : 1.055f*std::pow(x, 1.f/2.4f) - 0.055f;
+}
+
+// 7.787f = (29/3)^3/(29*4), 0.008856f = (6/29)^3
+static inline float labCbrtApprox(float x)
+{
+    return x > 0.008856f ? std::cbrt(x) : 7.787f*x + 16.f/116.f;
+}
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+
+// log2(x) for a normal positive x: the exponent plus a degree 7 polynomial of
+// the mantissa in [1, 2), absolute error below 4e-7
+static inline v_float32 v_log2Approx(const v_float32& x)
+{
+    v_int32 ix = v_reinterpret_as_s32(x);
+    v_float32 e = v_cvt_f32(v_sub(v_shr<23>(ix), vx_setall_s32(127)));
+    v_float32 m = v_reinterpret_as_f32(v_or(v_and(ix, vx_setall_s32(0x007fffff)), vx_setall_s32(0x3f800000)));
+    m = v_sub(m, vx_setall_f32(1.f));
+    v_float32 p = vx_setall_f32(1.444035249e-02f);
+    p = v_fma(p, m, vx_setall_f32(-7.565137468e-02f));
+    p = v_fma(p, m, vx_setall_f32( 1.887527377e-01f));
+    p = v_fma(p, m, vx_setall_f32(-3.219602855e-01f));
+    p = v_fma(p, m, vx_setall_f32( 4.720869162e-01f));
+    p = v_fma(p, m, vx_setall_f32(-7.203160644e-01f));
+    p = v_fma(p, m, vx_setall_f32( 1.442647549e+00f));
+    p = v_fma(p, m, vx_setall_f32( 3.685614095e-07f));
+    return v_add(p, e);
+}
+
+// 2^x for x in [-126, 0]: 2^floor(x) is added to the exponent bits of a
+// degree 5 polynomial of the fraction, relative error below 2e-7
+static inline v_float32 v_exp2Approx(const v_float32& x)
+{
+    v_int32 ix = v_floor(x);
+    v_float32 f = v_sub(x, v_cvt_f32(ix));
+    v_float32 p = vx_setall_f32(1.893754058e-03f);
+    p = v_fma(p, f, vx_setall_f32(8.949590424e-03f));
+    p = v_fma(p, f, vx_setall_f32(5.586033708e-02f));
+    p = v_fma(p, f, vx_setall_f32(2.401418182e-01f));
+    p = v_fma(p, f, vx_setall_f32(6.931544897e-01f));
+    p = v_fma(p, f, vx_setall_f32(9.999998984e-01f));
+    return v_reinterpret_as_f32(v_add(v_reinterpret_as_s32(p), v_shl<23>(ix)));
+}
+
+// x^p for x in (0, 1] and p > 0
+static inline v_float32 v_powApprox(const v_float32& x, float p)
+{
+    return v_exp2Approx(v_mul(v_log2Approx(x), vx_setall_f32(p)));
+}
+
+static inline v_float32 v_labCbrtApprox(const v_float32& x)
+{
+    v_float32 vthresh = vx_setall_f32(0.008856f);
+    v_float32 yhi = v_powApprox(v_max(x, vthresh), 1.f/3.f);
+    v_float32 ylo = v_fma(x, vx_setall_f32(7.787f), vx_setall_f32(16.f/116.f));
+    return v_select(v_gt(x, vthresh), yhi, ylo);
+}
+
+// x should be in [0, 1]
+static inline v_float32 v_applyGammaApprox(const v_float32& x)
+{
+    v_float32 t = v_mul(v_add(x, vx_setall_f32(0.055f)), vx_setall_f32(1.f/1.055f));
+    v_float32 yhi = v_powApprox(t, 2.4f);
+    v_float32 ylo = v_mul(x, vx_setall_f32(1.f/12.92f));
+    return v_select(v_le(x, vx_setall_f32(0.04045f)), ylo, yhi);
+}
+
+// x should be in [0, 1]
+static inline v_float32 v_applyInvGammaApprox(const v_float32& x)
+{
+    v_float32 vthresh = vx_setall_f32(0.0031308f);
+    v_float32 yhi = v_fma(v_powApprox(v_max(x, vthresh), 1.f/2.4f), vx_setall_f32(1.055f), vx_setall_f32(-0.055f));
+    v_float32 ylo = v_mul(x, vx_setall_f32(12.92f));
+    return v_select(v_le(x, vthresh), ylo, yhi);
+}
+
+#endif // CV_SIMD
+
+
+struct RGB2LabLuvApprox_f
+{
+    typedef float channel_type;
+
+    RGB2LabLuvApprox_f( int _srccn, bool _isLab, bool _srgb, const float* _coeffs, float _un, float _vn )
+    : srccn(_srccn), un(_un), vn(_vn), isLab(_isLab), srgb(_srgb)
+    {
+        for( int i = 0; i < 9; i++ )
+            coeffs[i] = _coeffs[i];
+    }
+
+    void operator()(const float* src, float* dst, int n) const
+    {
+        CV_INSTRUMENT_REGION();
+
+        int i = 0, scn = srccn;
+        float C0 = coeffs[0], C1 = coeffs[1], C2 = coeffs[2],
+              C3 = coeffs[3], C4 = coeffs[4], C5 = coeffs[5],
+              C6 = coeffs[6], C7 = coeffs[7], C8 = coeffs[8];
+        float _un = un, _vn = vn;
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        const int vsize = VTraits<v_float32>::vlanes();
+        v_float32 vc0 = vx_setall_f32(C0), vc1 = vx_setall_f32(C1), vc2 = vx_setall_f32(C2);
+        v_float32 vc3 = vx_setall_f32(C3), vc4 = vx_setall_f32(C4), vc5 = vx_setall_f32(C5);
+        v_float32 vc6 = vx_setall_f32(C6), vc7 = vx_setall_f32(C7), vc8 = vx_setall_f32(C8);
+        v_float32 zero = vx_setzero_f32(), one = vx_setall_f32(1.f);
+        v_float32 v116 = vx_setall_f32(116.f), vm16 = vx_setall_f32(-16.f);
+        for( ; i <= n - vsize; i += vsize, src += scn*vsize, dst += 3*vsize )
+        {
+            v_float32 R, G, B, A;
+            if( scn == 4 )
+                v_load_deinterleave(src, R, G, B, A);
+            else // scn == 3
+                v_load_deinterleave(src, R, G, B);
+
+            R = v_max(zero, v_min(R, one));
+            G = v_max(zero, v_min(G, one));
+            B = v_max(zero, v_min(B, one));
+            if( srgb )
+            {
+                R = v_applyGammaApprox(R);
+                G = v_applyGammaApprox(G);
+                B = v_applyGammaApprox(B);
+            }
+
+            v_float32 X = v_fma(R, vc0, v_fma(G, vc1, v_mul(B, vc2)));
+            v_float32 Y = v_fma(R, vc3, v_fma(G, vc4, v_mul(B, vc5)));
+            v_float32 Z = v_fma(R, vc6, v_fma(G, vc7, v_mul(B, vc8)));
+
+            v_float32 FY = v_labCbrtApprox(Y);
+            v_float32 L = v_fma(v116, FY, vm16), a, b;
+            if( isLab )
+            {
+                v_float32 FX = v_labCbrtApprox(X), FZ = v_labCbrtApprox(Z);
+                // 903.3 = (29/3)^3
+                L = v_select(v_gt(Y, vx_setall_f32(0.008856f)), L, v_mul(vx_setall_f32(903.3f), Y));
+                a = v_mul(vx_setall_f32(500.f), v_sub(FX, FY));
+                b = v_mul(vx_setall_f32(200.f), v_sub(FY, FZ));
+            }
+            else
+            {
+                v_float32 d = v_fma(Y, vx_setall_f32(15.f), v_fma(Z, vx_setall_f32(3.f), X));
+                d = v_div(vx_setall_f32(4*13), v_max(d, vx_setall_f32(FLT_EPSILON)));
+                a = v_mul(L, v_fma(X, d, vx_setall_f32(-_un)));
+                b = v_mul(L, v_fma(v_mul(vx_setall_f32(9*0.25f), Y), d, vx_setall_f32(-_vn)));
+            }
+
+            v_store_interleave(dst, L, a, b);
+        }
+#endif
+
+        for( ; i < n; i++, src += scn, dst += 3 )
+        {
+            float R = clipApprox(src[0]);
+            float G = clipApprox(src[1]);
+            float B = clipApprox(src[2]);
+            if( srgb )
+            {
+                R = applyGammaApprox(R);
+                G = applyGammaApprox(G);
+                B = applyGammaApprox(B);
+            }
+
+            float X = R*C0 + G*C1 + B*C2;
+            float Y = R*C3 + G*C4 + B*C5;
+            float Z = R*C6 + G*C7 + B*C8;
+
+            float FY = labCbrtApprox(Y);
+            float L = 116.f*FY - 16.f;
+            if( isLab )
+            {
+                if( Y <= 0.008856f )
+                    L = 903.3f*Y;
+                dst[0] = L;
+                dst[1] = 500.f*(labCbrtApprox(X) - FY);
+                dst[2] = 200.f*(FY - labCbrtApprox(Z));
+            }
+            else
+            {
+                float d = (4*13) / std::max(X + 15 * Y + 3 * Z, FLT_EPSILON);
+                dst[0] = L;
+                dst[1] = L*(X*d - _un);
+                dst[2] = L*((9*0.25f)*Y*d - _vn);
+            }
+        }
+    }
+
+    int srccn;
+    float coeffs[9], un, vn;
+    bool isLab;
+    bool srgb;
+};
+
+
+struct LabLuv2RGBApprox_f
+{
+    typedef float channel_type;
+
+    LabLuv2RGBApprox_f( int _dstcn, bool _isLab, bool _srgb, const float* _coeffs, float _un, float _vn )
+    : dstcn(_dstcn), un(_un), vn(_vn), isLab(_isLab), srgb(_srgb)
+    {
+        for( int i = 0; i < 9; i++ )
+            coeffs[i] = _coeffs[i];
+    }
+
+    void operator()(const float* src, float* dst, int n) const
+    {
+        CV_INSTRUMENT_REGION();
+
+        int i = 0, dcn = dstcn;
+        float C0 = coeffs[0], C1 = coeffs[1], C2 = coeffs[2],
+              C3 = coeffs[3], C4 = coeffs[4], C5 = coeffs[5],
+              C6 = coeffs[6], C7 = coeffs[7], C8 = coeffs[8];
+        float alpha = 1.f;
+        float _un = un, _vn = vn;
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        const int vsize = VTraits<v_float32>::vlanes();
+        v_float32 vc0 = vx_setall_f32(C0), vc1 = vx_setall_f32(C1), vc2 = vx_setall_f32(C2);
+        v_float32 vc3 = vx_setall_f32(C3), vc4 = vx_setall_f32(C4), vc5 = vx_setall_f32(C5);
+        v_float32 vc6 = vx_setall_f32(C6), vc7 = vx_setall_f32(C7), vc8 = vx_setall_f32(C8);
+        v_float32 zero = vx_setzero_f32(), one = vx_setall_f32(1.f);
+        v_float32 v16 = vx_setall_f32(16.f), vinv116 = vx_setall_f32(1.f/116.f);
+        v_float32 vinv903 = vx_setall_f32(1.f/903.3f), v8 = vx_setall_f32(8.f);
+        for( ; i <= n - vsize; i += vsize, src += 3*vsize, dst += dcn*vsize )
+        {
+            v_float32 L, u, v;
+            v_load_deinterleave(src, L, u, v);
+
+            // 903.3 = (29/3)^3, 7.787 = (29/3)^3/(29*4)
+            v_float32 fyhi = v_mul(v_add(L, v16), vinv116);
+            v_float32 X, Y, Z;
+            if( isLab )
+            {
+                v_float32 lmask = v_le(L, v8);
+                v_float32 ylo = v_mul(L, vinv903);
+                v_float32 v16_116 = vx_setall_f32(16.f/116.f);
+                Y = v_select(lmask, ylo, v_mul(v_mul(fyhi, fyhi), fyhi));
+                v_float32 fy = v_select(lmask, v_fma(ylo, vx_setall_f32(7.787f), v16_116), fyhi);
+                v_float32 fx = v_fma(u, vx_setall_f32(1.f/500.f), fy);
+                v_float32 fz = v_fma(v, vx_setall_f32(-1.f/200.f), fy);
+                v_float32 vfThresh = vx_setall_f32(6.f/29.f), vinv7787 = vx_setall_f32(1.f/7.787f);
+                X = v_select(v_le(fx, vfThresh), v_mul(v_sub(fx, v16_116), vinv7787), v_mul(v_mul(fx, fx), fx));
+                Z = v_select(v_le(fz, vfThresh), v_mul(v_sub(fz, v16_116), vinv7787), v_mul(v_mul(fz, fz), fz));
+            }
+            else
+            {
+                Y = v_select(v_ge(L, v8), v_mul(v_mul(fyhi, fyhi), fyhi), v_mul(L, vinv903));
+                v_float32 up = v_mul(vx_setall_f32(3.f), v_fma(L, vx_setall_f32(_un), u));
+                v_float32 vp = v_div(vx_setall_f32(0.25f), v_fma(L, vx_setall_f32(_vn), v));
+                vp = v_max(vx_setall_f32(-0.25f), v_min(vp, vx_setall_f32(0.25f)));
+                X = v_mul(v_mul(vx_setall_f32(3.f), Y), v_mul(up, vp));
+                Z = v_mul(Y, v_fma(v_fma(L, vx_setall_f32(12.f*13.f), v_sub(zero, up)), vp, vx_setall_f32(-5.f)));
+            }
+
+            v_float32 R = v_fma(vc0, X, v_fma(vc1, Y, v_mul(vc2, Z)));
+            v_float32 G = v_fma(vc3, X, v_fma(vc4, Y, v_mul(vc5, Z)));
+            v_float32 B = v_fma(vc6, X, v_fma(vc7, Y, v_mul(vc8, Z)));
+            R = v_max(zero, v_min(R, one));
+            G = v_max(zero, v_min(G, one));
+            B = v_max(zero, v_min(B, one));
+            if( srgb )
+            {
+                R = v_applyInvGammaApprox(R);
+                G = v_applyInvGammaApprox(G);
+                B = v_applyInvGammaApprox(B);
+            }
+
+            if( dcn == 4 )
+                v_store_interleave(dst, R, G, B, vx_setall_f32(alpha));
+            else // dcn == 3
+                v_store_interleave(dst, R, G, B);
+        }
+#endif
+
+        for( ; i < n; i++, src += 3, dst += dcn )
+        {
+            float L = src[0], u = src[1], v = src[2], X, Y, Z;
+            if( isLab )
+            {
+                float fy;
+                if( L <= 8.f )
+                {
+                    Y = L*(1.f/903.3f);
+                    fy = 7.787f*Y + 16.f/116.f;
+                }
+                else
+                {
+                    fy = (L + 16.f)*(1.f/116.f);
+                    Y = fy*fy*fy;
+                }
+                float fx = u*(1.f/500.f) + fy, fz = fy - v*(1.f/200.f);
+                X = fx <= 6.f/29.f ? (fx - 16.f/116.f)*(1.f/7.787f) : fx*fx*fx;
+                Z = fz <= 6.f/29.f ? (fz - 16.f/116.f)*(1.f/7.787f) : fz*fz*fz;
+            }
+            else
+            {
+                if( L >= 8.f )
+                {
+                    Y = (L + 16.f)*(1.f/116.f);
+                    Y = Y*Y*Y;
+                }
+                else
+                    Y = L*(1.f/903.3f);
+                float up = 3.f*(u + L*_un);
+                float vp = 0.25f/(v + L*_vn);
+                vp = std::max(-0.25f, std::min(vp, 0.25f));
+                X = Y*3.f*up*vp;
+                Z = Y*(((12.f*13.f)*L - up)*vp - 5.f);
+            }
+
+            float R = clipApprox(X*C0 + Y*C1 + Z*C2);
+            float G = clipApprox(X*C3 + Y*C4 + Z*C5);
+            float B = clipApprox(X*C6 + Y*C7 + Z*C8);
+            if( srgb )
+            {
+                R = applyInvGammaApprox(R);
+                G = applyInvGammaApprox(G);
+                B = applyInvGammaApprox(B);
+            }
+
+            dst[0] = R; dst[1] = G; dst[2] = B;
+            if( dcn == 4 )
+                dst[3] = alpha;
+        }
+    }
+
+    int dstcn;
+    float coeffs[9], un, vn;
+    bool isLab;
+    bool srgb;
+};
+
+} // namespace anon
+
+void cvtBGRtoLabApprox32f(const uchar * src_data, size_t src_step,
+                          uchar * dst_data, size_t dst_step,
+                          int width, int height,
+                          int scn, bool isLab, bool srgb,
+                          const float* coeffs, float un, float vn)
+{
+    CV_INSTRUMENT_REGION();
+
+    CvtColorLoop(src_data, src_step, dst_data, dst_step, width, height,
+                 RGB2LabLuvApprox_f(scn, isLab, srgb, coeffs, un, vn));
+}
+
+void cvtLabtoBGRApprox32f(const uchar * src_data, size_t src_step,
+                          uchar * dst_data, size_t dst_step,
+                          int width, int height,
+                          int dcn, bool isLab, bool srgb,
+                          const float* coeffs, float un, float vn)
+{
+    CV_INSTRUMENT_REGION();
+
+    CvtColorLoop(src_data, src_step, dst_data, dst_step, width, height,
+                 LabLuv2RGBApprox_f(dcn, isLab, srgb, coeffs, un, vn));
+}
+
+#endif
+CV_CPU_OPTIMIZATION_NAMESPACE_END
+}} // namespace
@@ -625,6 +625,104 @@ bool ContourScanner_::findNext()
 
 //==============================================================================
 
+//
+// Parallel scan of image bands
+//
+// A row without foreground pixels can't be crossed by a contour, and a contour above such a row
+// can't enclose a contour below it. So the image is cut along background rows into bands, which
+// are scanned independently, and the band trees are stitched in the raster order, giving the
+// same result as the scan of the whole image.
+
+static const int CONTOUR_BAND_MIN_ROWS = 64;
+
+// returns the rows separating the bands, the first and the last rows of the (bordered) image included
+static vector<int> findContourBandSeams(const Mat& image, int nbands)
+{
+    const int height = image.rows;
+    vector<int> seams(1, 0);
+    for (int i = 1; i < nbands; ++i)
+    {
+        int y = std::max(height * i / nbands, seams.back() + CONTOUR_BAND_MIN_ROWS);
+        const int y_end = height * (i + 1) / nbands;
+        for (; y < y_end; ++y)
+        {
+            if (!hasNonZero(image.row(y)))
+            {
+                seams.push_back(y);
+                break;
+            }
+        }
+    }
+    if (height - 1 - seams.back() < CONTOUR_BAND_MIN_ROWS && seams.size() > 1)
+        seams.pop_back();
+    seams.push_back(height - 1);
+    return seams;
+}
+
+class ContourBandInvoker : public ParallelLoopBody
+{
+public:
+    ContourBandInvoker(const Mat& image_, const vector<int>& seams_, vector<ContourScanner>& scanners_,
+                       int mode_, int method_, Point offset_) :
+        image(image_), seams(seams_), scanners(scanners_), mode(mode_), method(method_), offset(offset_)
+    {
+    }
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        for (int i = range.start; i < range.end; ++i)
+        {
+            // neighbouring bands share the separating row, it's background and it's never modified
+            Mat band = image.rowRange(seams[i], seams[i + 1] + 1);
+            ContourScanner scanner =
+                ContourScanner_::create(band, mode, method, offset + Point(0, seams[i]));
+            while (scanner->findNext())
+            {
+            }
+            scanners[i] = scanner;
+        }
+    }
+
+private:
+    const Mat& image;
+    const vector<int>& seams;
+    vector<ContourScanner>& scanners;
+    int mode;
+    int method;
+    Point offset;
+};
+
+// appends the band trees to 'tree' keeping the order of the elements; the top-level contours of
+// each band are attached to the common root in the same order as the serial scan does it
+static void stitchContourTrees(vector<ContourScanner>& scanners, CTree& tree)
+{
+    for (size_t i = 0; i < scanners.size(); ++i)
+    {
+        CTree& band_tree = scanners[i]->tree;
+        const int base = (int)tree.size() - 1;
+        for (int idx = 1; idx < (int)band_tree.size(); ++idx)
+        {
+            CNode& src = band_tree.elem(idx);
+            CNode& dst = tree.newElem();
+            CV_DbgAssert(dst.self() == base + idx);
+            dst.body = std::move(src.body);
+            dst.first_child = src.first_child != -1 ? src.first_child + base : -1;
+            if (src.parent == 0)
+            {
+                tree.addChild(0, dst.self());
+            }
+            else
+            {
+                dst.parent = src.parent + base;
+                dst.prev = src.prev != -1 ? src.prev + base : -1;
+                dst.next = src.next != -1 ? src.next + base : -1;
+            }
+        }
+    }
+}
+
+//==============================================================================
+
 void cv::findContours(InputArray _image,
                       OutputArrayOfArrays _contours,
                       OutputArray _hierarchy,
@@ -678,6 +776,28 @@ void cv::findContours(InputArray _image,
         threshold(image, image, 0, 1, THRESH_BINARY);
 
     // find contours
+    const int nthreads = getNumThreads();
+    vector<int> seams;
+    if (nthreads > 1 && image.total() >= (size_t)(1 << 18))
+        seams = findContourBandSeams(image, std::min(nthreads, image.rows / CONTOUR_BAND_MIN_ROWS));
+
+    if (seams.size() > 2)
+    {
+        const int nbands = (int)seams.size() - 1;
+        vector<ContourScanner> scanners(nbands);
+        parallel_for_(Range(0, nbands),
+                      ContourBandInvoker(image, seams, scanners, mode, method, offset + Point(-1, -1)),
+                      nbands);
+
+        CTree tree;
+        CNode& root = tree.newElem();
+        root.body.isHole = true;
+        root.body.brect = Rect(Point(0, 0), image.size());
+        stitchContourTrees(scanners, tree);
+        contourTreeToResults(tree, res_type, _contours, _hierarchy);
+        return;
+    }
+
     ContourScanner scanner = ContourScanner_::create(image, mode, method, offset + Point(-1, -1));
     while (scanner->findNext())
     {
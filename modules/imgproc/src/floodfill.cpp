@@ -41,6 +41,7 @@
 //M*/
 
 #include "precomp.hpp"
+#include "opencv2/core/hal/intrin.hpp"
 
 #if defined(__GNUC__) && (__GNUC__ == 4) && (__GNUC_MINOR__ == 8)
 # pragma GCC diagnostic ignored "-Warray-bounds"
@@ -276,6 +277,135 @@ typedef DiffC3<Vec3i> Diff32sC3;
 typedef DiffC1<float> Diff32fC1;
 typedef DiffC3<Vec3f> Diff32fC3;
 
+// Vectorized scan of the runs of a fixed range fill. right() returns the position starting from i
+// up to which the pixels are known to join the run, left() does the same going down from j.
+// The scalar loops continue from there.
+template<typename _Tp, class Diff>
+struct FFillFixedSpan
+{
+    FFillFixedSpan(const Diff&, const _Tp&) {}
+    int right(const _Tp*, const uchar*, int i, int) const { return i; }
+    int left(const _Tp*, const uchar*, int j) const { return j; }
+};
+
+#if CV_SIMD128
+template<>
+struct FFillFixedSpan<uchar, Diff8uC1>
+{
+    FFillFixedSpan(const Diff8uC1& diff, const uchar& val0)
+    {
+        int lo = (int)val0 - (int)diff.lo;
+        int hi = lo + (int)diff.interval;
+        vlo = v_setall_u8((uchar)std::max(lo, 0));
+        vhi = v_setall_u8((uchar)std::min(hi, 255));
+    }
+
+    // bits of the lanes that stop the run
+    int stops(const uchar* img, const uchar* mask) const
+    {
+        v_uint8x16 p = v_load(img), m = v_load(mask);
+        v_uint8x16 ok = v_and(v_eq(m, v_setzero_u8()), v_and(v_ge(p, vlo), v_le(p, vhi)));
+        return v_signmask(v_not(ok));
+    }
+
+    int right(const uchar* img, const uchar* mask, int i, int width) const
+    {
+        for( ; i <= width - 16; i += 16 )
+        {
+            int bits = stops(img + i, mask + i);
+            if( bits )
+                return i + (int)trailingZeros32((unsigned)bits);
+        }
+        return i;
+    }
+
+    int left(const uchar* img, const uchar* mask, int j) const
+    {
+        for( ; j >= 15; j -= 16 )
+        {
+            int bits = stops(img + j - 15, mask + j - 15);
+            if( bits )
+            {
+                int k = 15;
+                while( !((bits >> k) & 1) )
+                    k--;
+                return j - 15 + k;
+            }
+        }
+        return j;
+    }
+
+    v_uint8x16 vlo, vhi;
+};
+#endif
+
+// Vectorized scan of the runs of a floating range fill, where the pixels are compared to their
+// neighbours. left() goes down from j while the pixels are within the range of their right
+// neighbours. right() goes up from i while the pixels are within the range of their left neighbours
+// or, up to the position last, of the pixels of the row img1. Both may stop early, the scalar
+// loops continue from there.
+template<typename _Tp, class Diff>
+struct FFillGradSpan
+{
+    FFillGradSpan(const Diff&) {}
+    int right(const _Tp*, const _Tp*, const uchar*, int i, int, int) const { return i; }
+    int left(const _Tp*, const uchar*, int j) const { return j; }
+};
+
+#if CV_SIMD128
+template<>
+struct FFillGradSpan<uchar, Diff8uC1>
+{
+    FFillGradSpan(const Diff8uC1& diff)
+    {
+        vlo = v_setall_u8((uchar)diff.lo);
+        vup = v_setall_u8((uchar)(diff.interval - diff.lo));
+    }
+
+    // lanes of a that are within the range of b; the subtractions saturate
+    v_uint8x16 inRange(const v_uint8x16& a, const v_uint8x16& b) const
+    {
+        return v_and(v_le(v_sub(b, a), vlo), v_le(v_sub(a, b), vup));
+    }
+
+    int right(const uchar* img, const uchar* img1, const uchar* mask, int i, int width, int last) const
+    {
+        for( ; i <= width - 16; i += 16 )
+        {
+            v_uint8x16 p = v_load(img + i);
+            v_uint8x16 ok = inRange(p, v_load(img + i - 1));
+            if( img1 && i + 15 <= last )
+                ok = v_or(ok, inRange(p, v_load(img1 + i)));
+            ok = v_and(ok, v_eq(v_load(mask + i), v_setzero_u8()));
+            int bits = v_signmask(v_not(ok));
+            if( bits )
+                return i + (int)trailingZeros32((unsigned)bits);
+        }
+        return i;
+    }
+
+    int left(const uchar* img, const uchar* mask, int j) const
+    {
+        for( ; j >= 15; j -= 16 )
+        {
+            v_uint8x16 ok = v_and(inRange(v_load(img + j - 15), v_load(img + j - 14)),
+                                  v_eq(v_load(mask + j - 15), v_setzero_u8()));
+            int bits = v_signmask(v_not(ok));
+            if( bits )
+            {
+                int k = 15;
+                while( !((bits >> k) & 1) )
+                    k--;
+                return j - 15 + k;
+            }
+        }
+        return j;
+    }
+
+    v_uint8x16 vlo, vup;
+};
+#endif
+
 template<typename _Tp, typename _MTp, typename _WTp, class Diff>
 static void
 floodFillGrad_CnIR( Mat& image, Mat& msk,
@@ -294,6 +424,7 @@ floodFillGrad_CnIR( Mat& image, Mat& msk,
     int _8_connectivity = (flags & 255) == 8;
     int fixedRange = flags & FLOODFILL_FIXED_RANGE;
     int fillImage = (flags & FLOODFILL_MASK_ONLY) == 0;
+    int width = image.cols;
     FFillSegment* buffer_end = &buffer->front() + buffer->size(), *head = &buffer->front(), *tail = &buffer->front();
 
     L = R = seed.x;
@@ -302,20 +433,30 @@ floodFillGrad_CnIR( Mat& image, Mat& msk,
 
     mask[L] = newMaskVal;
     _Tp val0 = img[L];
+    FFillFixedSpan<_Tp, Diff> span(diff, val0);
+    FFillGradSpan<_Tp, Diff> gradSpan(diff);
 
     if( fixedRange )
     {
+        for( int e = span.right(img, mask, R + 1, width); R + 1 < e; )
+            mask[++R] = newMaskVal;
         while( !mask[R + 1] && diff( img + (R+1), &val0 ))
             mask[++R] = newMaskVal;
 
+        for( int b = span.left(img, mask, L - 1); L - 1 > b; )
+            mask[--L] = newMaskVal;
         while( !mask[L - 1] && diff( img + (L-1), &val0 ))
             mask[--L] = newMaskVal;
     }
     else
     {
+        for( int e = gradSpan.right(img, 0, mask, R + 1, width, R); R + 1 < e; )
+            mask[++R] = newMaskVal;
         while( !mask[R + 1] && diff( img + (R+1), img + R ))
             mask[++R] = newMaskVal;
 
+        for( int b = gradSpan.left(img, mask, L - 1); L - 1 > b; )
+            mask[--L] = newMaskVal;
         while( !mask[L - 1] && diff( img + (L-1), img + L ))
             mask[--L] = newMaskVal;
     }
@@ -365,9 +506,13 @@ floodFillGrad_CnIR( Mat& image, Mat& msk,
                     {
                         int j = i;
                         mask[i] = newMaskVal;
+                        for( int b = span.left(img, mask, j - 1); j - 1 > b; )
+                            mask[--j] = newMaskVal;
                         while( !mask[--j] && diff( img + j, &val0 ))
                             mask[j] = newMaskVal;
 
+                        for( int e = span.right(img, mask, i + 1, width); i + 1 < e; )
+                            mask[++i] = newMaskVal;
                         while( !mask[++i] && diff( img + i, &val0 ))
                             mask[i] = newMaskVal;
 
@@ -381,9 +526,13 @@ floodFillGrad_CnIR( Mat& image, Mat& msk,
                     {
                         int j = i;
                         mask[i] = newMaskVal;
+                        for( int b = gradSpan.left(img, mask, j - 1); j - 1 > b; )
+                            mask[--j] = newMaskVal;
                         while( !mask[--j] && diff( img + j, img + (j+1) ))
                             mask[j] = newMaskVal;
 
+                        for( int e = gradSpan.right(img, img1, mask, i + 1, width, R); i + 1 < e; )
+                            mask[++i] = newMaskVal;
                         while( !mask[++i] &&
                               (diff( img + i, img + (i-1) ) ||
                                (diff( img + i, img1 + i) && i <= R)))
@@ -409,6 +558,8 @@ floodFillGrad_CnIR( Mat& image, Mat& msk,
                     {
                         int j = i;
                         mask[i] = newMaskVal;
+                        for( int b = gradSpan.left(img, mask, j - 1); j - 1 > b; )
+                            mask[--j] = newMaskVal;
                         while( !mask[--j] && diff( img + j, img + (j+1) ))
                             mask[j] = newMaskVal;
 
@@ -449,40 +600,146 @@ floodFillGrad_CnIR( Mat& image, Mat& msk,
     }
 }
 
-}
-
-/****************************************************************************************\
-*                                    External Functions                                  *
-\****************************************************************************************/
+// Labelings of the fixed range domains, kept between the seeds of one floodFill call. Filling a
+// component doesn't change the other components of the same labeling, so the next seeds of the
+// same value reuse it. A labeling of another value stays valid as long as the filled components
+// don't touch its domain; otherwise it is dropped and the image is labeled again.
+struct FFillLabels
+{
+    Mat labels, stats;
+    uchar val0[16];
+};
 
-int cv::floodFill( InputOutputArray _image, InputOutputArray _mask,
-                  Point seedPoint, Scalar newVal, Rect* rect,
-                  Scalar loDiff, Scalar upDiff, int flags )
+/*
+ * The domain of a fixed range fill does not depend on the order the pixels are visited in: it is
+ * the connected component of the seed among the pixels that are within the range and not masked.
+ * So it can be computed in parallel, with the range test done for the whole image and the
+ * component extracted by connectedComponentsWithStats.
+ */
+template<typename _Tp, class Diff>
+static void
+floodFillFixedRange_Parallel( Mat& image, Mat& msk, Point seed, _Tp newVal, uchar newMaskVal,
+                              Diff diff, ConnectedComp* region, int flags, std::vector<FFillLabels>* cache )
 {
-    CV_INSTRUMENT_REGION();
+    Mat mask = msk(Rect(1, 1, image.cols, image.rows));
+    if( mask.at<uchar>(seed) )
+        return;
 
-    ConnectedComp comp;
-    std::vector<FFillSegment> buffer;
+    const _Tp val0 = image.at<_Tp>(seed);
+    std::vector<FFillLabels> localLabels;
+    std::vector<FFillLabels>& ffl = cache ? *cache : localLabels;
+    CV_DbgAssert( sizeof(val0) <= sizeof(FFillLabels::val0) );
 
-    if( rect )
-        *rect = Rect();
+    size_t idx = 0;
+    for( ; idx < ffl.size(); idx++ )
+        if( memcmp(ffl[idx].val0, &val0, sizeof(val0)) == 0 && ffl[idx].labels.at<int>(seed) != 0 )
+            break;
 
-    int i;
-    union {
-        uchar b[4];
-        int i[4];
-        float f[4];
-        double _[4];
-    } nv_buf;
-    nv_buf._[0] = nv_buf._[1] = nv_buf._[2] = nv_buf._[3] = 0;
+    if( idx == ffl.size() )
+    {
+        Mat domain(image.size(), CV_8U);
+        parallel_for_(Range(0, image.rows), [&](const Range& range)
+        {
+            for( int y = range.start; y < range.end; y++ )
+            {
+                const _Tp* img = image.ptr<_Tp>(y);
+                const uchar* m = mask.ptr(y);
+                uchar* d = domain.ptr(y);
+                for( int x = 0; x < image.cols; x++ )
+                    d[x] = (uchar)(!m[x] && diff( img + x, &val0 ));
+            }
+        }, image.total()/(double)(1 << 16));
+        // the seed is always filled, even when it is not within the range of itself (NaN)
+        domain.at<uchar>(seed) = 1;
+
+        // a few labelings are kept, each takes an int per pixel
+        const size_t maxLabelings = 4;
+        if( ffl.size() >= maxLabelings )
+            ffl.erase(ffl.begin());
+        ffl.push_back(FFillLabels());
+        idx = ffl.size() - 1;
+
+        Mat centroids;
+        connectedComponentsWithStats(domain, ffl[idx].labels, ffl[idx].stats, centroids, (flags & 255) == 8 ? 8 : 4, CV_32S);
+        memcpy(ffl[idx].val0, &val0, sizeof(val0));
+    }
 
-    struct { Vec3b b; Vec3i i; Vec3f f; } ld_buf, ud_buf;
+    const Mat labels = ffl[idx].labels;
+    const Mat stats = ffl[idx].stats;
+    const int label = labels.at<int>(seed);
+    const Rect rect(stats.at<int>(label, CC_STAT_LEFT), stats.at<int>(label, CC_STAT_TOP),
+                    stats.at<int>(label, CC_STAT_WIDTH), stats.at<int>(label, CC_STAT_HEIGHT));
+    const bool fillImage = (flags & FLOODFILL_MASK_ONLY) == 0;
 
-    Mat img = _image.getMat(), mask;
+    // the rows of the component that touch the domain of every other labeling
+    const int others = (int)ffl.size();
+    std::vector<uchar> touched((size_t)rect.height * others, 0);
+
+    parallel_for_(Range(rect.y, rect.y + rect.height), [&](const Range& range)
+    {
+        for( int y = range.start; y < range.end; y++ )
+        {
+            const int* lab = labels.ptr<int>(y);
+            uchar* m = mask.ptr(y);
+            _Tp* img = image.ptr<_Tp>(y);
+            for( int x = rect.x; x < rect.x + rect.width; x++ )
+                if( lab[x] == label )
+                {
+                    m[x] = newMaskVal;
+                    if( fillImage )
+                        img[x] = newVal;
+                }
+
+            for( int j = 0; j < others; j++ )
+            {
+                if( j == (int)idx )
+                    continue;
+                const int* labj = ffl[j].labels.ptr<int>(y);
+                int x = rect.x;
+                for( ; x < rect.x + rect.width; x++ )
+                    if( lab[x] == label && labj[x] != 0 )
+                        break;
+                touched[(size_t)(y - rect.y) * others + j] = x < rect.x + rect.width;
+            }
+        }
+    }, rect.area()/(double)(1 << 16));
+
+    if( region )
+    {
+        region->pt = seed;
+        region->label = newMaskVal;
+        region->area = stats.at<int>(label, CC_STAT_AREA);
+        region->rect = rect;
+    }
+
+    for( int j = others - 1; j >= 0; j-- )
+    {
+        bool invalid = false;
+        for( int y = 0; y < rect.height && !invalid; y++ )
+            invalid = touched[(size_t)y * others + j] != 0;
+        if( invalid )
+            ffl.erase(ffl.begin() + j);
+    }
+}
+
+template<typename _Tp, typename _MTp, typename _WTp, class Diff>
+static void
+floodFillGrad( Mat& image, Mat& msk,
+               Point seed, _Tp newVal, _MTp newMaskVal,
+               Diff diff, ConnectedComp* region, int flags,
+               std::vector<FFillSegment>* buffer, std::vector<FFillLabels>* labels )
+{
+    if( (flags & FLOODFILL_FIXED_RANGE) && (flags & FLOODFILL_PARALLEL) )
+        floodFillFixedRange_Parallel<_Tp, Diff>(image, msk, seed, newVal, newMaskVal, diff, region, flags, labels);
+    else
+        floodFillGrad_CnIR<_Tp, _MTp, _WTp, Diff>(image, msk, seed, newVal, newMaskVal, diff, region, flags, buffer);
+}
 
+// checks the arguments and prepares the mask shared by all the seeds
+static void
+floodFillPrepare( const Mat& img, InputOutputArray _mask, Mat& mask, int flags )
+{
     Size size = img.size();
-    int type = img.type();
-    int depth = img.depth();
     int cn = img.channels();
 
     if ( (cn != 1) && (cn != 3) )
@@ -507,6 +764,33 @@ int cv::floodFill( InputOutputArray _image, InputOutputArray _mask,
 
     Mat mask_inner = mask( Rect(1, 1, mask.cols - 2, mask.rows - 2) );
     copyMakeBorder( mask_inner, mask, 1, 1, 1, 1, BORDER_ISOLATED | BORDER_CONSTANT, Scalar(1) );
+}
+
+static int
+floodFillSeed( Mat& img, Mat& mask, Point seedPoint, Scalar newVal, Rect* rect,
+               Scalar loDiff, Scalar upDiff, int flags, std::vector<FFillSegment>& buffer,
+               std::vector<FFillLabels>* labels )
+{
+    ConnectedComp comp;
+
+    if( rect )
+        *rect = Rect();
+
+    int i;
+    union {
+        uchar b[4];
+        int i[4];
+        float f[4];
+        double _[4];
+    } nv_buf;
+    nv_buf._[0] = nv_buf._[1] = nv_buf._[2] = nv_buf._[3] = 0;
+
+    struct { Vec3b b; Vec3i i; Vec3f f; } ld_buf, ud_buf;
+
+    Size size = img.size();
+    int type = img.type();
+    int depth = img.depth();
+    int cn = img.channels();
 
     bool is_simple = mask.empty() && (flags & FLOODFILL_MASK_ONLY) == 0;
 
@@ -523,7 +807,8 @@ int cv::floodFill( InputOutputArray _image, InputOutputArray _mask,
 
     scalarToRawData( newVal, &nv_buf, type, 0);
     size_t buffer_size = MAX( size.width, size.height ) * 2;
-    buffer.resize( buffer_size );
+    if( buffer.size() < buffer_size )
+        buffer.resize( buffer_size );
 
     if( is_simple )
     {
@@ -588,35 +873,35 @@ int cv::floodFill( InputOutputArray _image, InputOutputArray _mask,
     uchar newMaskVal = (uchar)((flags & 0xff00) == 0 ? 1 : ((flags >> 8) & 255));
 
     if( type == CV_8UC1 )
-        floodFillGrad_CnIR<uchar, uchar, int, Diff8uC1>(
+        floodFillGrad<uchar, uchar, int, Diff8uC1>(
                 img, mask, seedPoint, nv_buf.b[0], newMaskVal,
                 Diff8uC1(ld_buf.b[0], ud_buf.b[0]),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, labels);
     else if( type == CV_8UC3 )
-        floodFillGrad_CnIR<Vec3b, uchar, Vec3i, Diff8uC3>(
+        floodFillGrad<Vec3b, uchar, Vec3i, Diff8uC3>(
                 img, mask, seedPoint, Vec3b(nv_buf.b), newMaskVal,
                 Diff8uC3(ld_buf.b, ud_buf.b),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, labels);
     else if( type == CV_32SC1 )
-        floodFillGrad_CnIR<int, uchar, int, Diff32sC1>(
+        floodFillGrad<int, uchar, int, Diff32sC1>(
                 img, mask, seedPoint, nv_buf.i[0], newMaskVal,
                 Diff32sC1(ld_buf.i[0], ud_buf.i[0]),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, labels);
     else if( type == CV_32SC3 )
-        floodFillGrad_CnIR<Vec3i, uchar, Vec3i, Diff32sC3>(
+        floodFillGrad<Vec3i, uchar, Vec3i, Diff32sC3>(
                 img, mask, seedPoint, Vec3i(nv_buf.i), newMaskVal,
                 Diff32sC3(ld_buf.i, ud_buf.i),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, labels);
     else if( type == CV_32FC1 )
-        floodFillGrad_CnIR<float, uchar, float, Diff32fC1>(
+        floodFillGrad<float, uchar, float, Diff32fC1>(
                 img, mask, seedPoint, nv_buf.f[0], newMaskVal,
                 Diff32fC1(ld_buf.f[0], ud_buf.f[0]),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, labels);
     else if( type == CV_32FC3 )
-        floodFillGrad_CnIR<Vec3f, uchar, Vec3f, Diff32fC3>(
+        floodFillGrad<Vec3f, uchar, Vec3f, Diff32fC3>(
                 img, mask, seedPoint, Vec3f(nv_buf.f), newMaskVal,
                 Diff32fC3(ld_buf.f, ud_buf.f),
-                &comp, flags, &buffer);
+                &comp, flags, &buffer, labels);
     else
         CV_Error(cv::Error::StsUnsupportedFormat, "");
 
@@ -625,6 +910,58 @@ int cv::floodFill( InputOutputArray _image, InputOutputArray _mask,
     return comp.area;
 }
 
+}
+
+/****************************************************************************************\
+*                                    External Functions                                  *
+\****************************************************************************************/
+
+int cv::floodFill( InputOutputArray _image, InputOutputArray _mask,
+                  Point seedPoint, Scalar newVal, Rect* rect,
+                  Scalar loDiff, Scalar upDiff, int flags )
+{
+    CV_INSTRUMENT_REGION();
+
+    Mat img = _image.getMat(), mask;
+    floodFillPrepare(img, _mask, mask, flags);
+
+    std::vector<FFillSegment> buffer;
+    return floodFillSeed(img, mask, seedPoint, newVal, rect, loDiff, upDiff, flags, buffer, 0);
+}
+
+
+int cv::floodFill( InputOutputArray _image, InputOutputArray _mask,
+                  const std::vector<Point>& seedPoints, Scalar newVal,
+                  std::vector<Rect>* rects, std::vector<int>* areas,
+                  Scalar loDiff, Scalar upDiff, int flags )
+{
+    CV_INSTRUMENT_REGION();
+
+    Mat img = _image.getMat(), mask;
+    floodFillPrepare(img, _mask, mask, flags);
+
+    if( rects )
+        rects->resize(seedPoints.size());
+    if( areas )
+        areas->resize(seedPoints.size());
+
+    // the seeds are filled one after another, sharing the mask, the segment stack and, with
+    // FLOODFILL_PARALLEL, the labelings of the domains; the seeds that are already covered by the
+    // previous fills are rejected by the mask test right away
+    std::vector<FFillSegment> buffer;
+    std::vector<FFillLabels> labels;
+    int total = 0;
+    for( size_t i = 0; i < seedPoints.size(); i++ )
+    {
+        int area = floodFillSeed(img, mask, seedPoints[i], newVal, rects ? &(*rects)[i] : 0,
+                                 loDiff, upDiff, flags, buffer, &labels);
+        if( areas )
+            (*areas)[i] = area;
+        total += area;
+    }
+    return total;
+}
+
 
 int cv::floodFill( InputOutputArray _image, Point seedPoint,
                   Scalar newVal, Rect* rect,
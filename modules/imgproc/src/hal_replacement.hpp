@@ -629,6 +629,23 @@ inline int hal_ni_cvtHSVtoBGR(const uchar * src_data, size_t src_step, uchar * d
  */
 inline int hal_ni_cvtBGRtoLab(const uchar * src_data, size_t src_step, uchar * dst_data, size_t dst_step, int width, int height, int depth, int scn, bool swapBlue, bool isLab, bool srgb) { return CV_HAL_ERROR_NOT_IMPLEMENTED; }
 
+/**
+   @brief Analog of hal_cvtBGRtoLab, but allows approximations (not bit-exact)
+   @param src_data source image data
+   @param src_step source image step
+   @param dst_data destination image data
+   @param dst_step destination image step
+   @param width image width
+   @param height image height
+   @param depth image depth (one of CV_8U or CV_32F)
+   @param scn source image channels (3 or 4)
+   @param swapBlue if set to true B and R source channels will be swapped (treat as RGB)
+   @param isLab if set to true write Lab otherwise Luv
+   @param srgb if set to true use sRGB gamma correction
+   Convert from BGR, RGB, BGRA or RGBA to Lab or Luv.
+ */
+inline int hal_ni_cvtBGRtoLabApprox(const uchar * src_data, size_t src_step, uchar * dst_data, size_t dst_step, int width, int height, int depth, int scn, bool swapBlue, bool isLab, bool srgb) { return CV_HAL_ERROR_NOT_IMPLEMENTED; }
+
 /**
    @brief hal_cvtLabtoBGR
    @param src_data source image data
@@ -646,6 +663,23 @@ inline int hal_ni_cvtBGRtoLab(const uchar * src_data, size_t src_step, uchar * d
  */
 inline int hal_ni_cvtLabtoBGR(const uchar * src_data, size_t src_step, uchar * dst_data, size_t dst_step, int width, int height, int depth, int dcn, bool swapBlue, bool isLab, bool srgb) { return CV_HAL_ERROR_NOT_IMPLEMENTED; }
 
+/**
+   @brief Analog of hal_cvtLabtoBGR, but allows approximations (not bit-exact)
+   @param src_data source image data
+   @param src_step source image step
+   @param dst_data destination image data
+   @param dst_step destination image step
+   @param width image width
+   @param height image height
+   @param depth image depth (one of CV_8U or CV_32F)
+   @param dcn destination image channels (3 or 4)
+   @param swapBlue if set to true B and R destination channels will be swapped (write RGB)
+   @param isLab if set to true treat input as Lab otherwise Luv
+   @param srgb if set to true use sRGB gamma correction
+   Convert from Lab or Luv to BGR, RGB, BGRA or RGBA.
+ */
+inline int hal_ni_cvtLabtoBGRApprox(const uchar * src_data, size_t src_step, uchar * dst_data, size_t dst_step, int width, int height, int depth, int dcn, bool swapBlue, bool isLab, bool srgb) { return CV_HAL_ERROR_NOT_IMPLEMENTED; }
+
 /**
    @brief hal_cvtTwoPlaneYUVtoBGR
    @param src_data source image data
@@ -923,7 +957,9 @@ inline int hal_ni_cvtMultipliedRGBAtoRGBA(const uchar * src_data, size_t src_ste
 #define cv_hal_cvtBGRtoHSV hal_ni_cvtBGRtoHSV
 #define cv_hal_cvtHSVtoBGR hal_ni_cvtHSVtoBGR
 #define cv_hal_cvtBGRtoLab hal_ni_cvtBGRtoLab
+#define cv_hal_cvtBGRtoLabApprox hal_ni_cvtBGRtoLabApprox
 #define cv_hal_cvtLabtoBGR hal_ni_cvtLabtoBGR
+#define cv_hal_cvtLabtoBGRApprox hal_ni_cvtLabtoBGRApprox
 #define cv_hal_cvtTwoPlaneYUVtoBGR hal_ni_cvtTwoPlaneYUVtoBGR
 #define cv_hal_cvtTwoPlaneYUVtoBGRApprox hal_ni_cvtTwoPlaneYUVtoBGRApprox
 #define cv_hal_cvtTwoPlaneYUVtoBGREx hal_ni_cvtTwoPlaneYUVtoBGREx
@@ -107,6 +107,59 @@ findLocalMaximums( int numrho, int numangle, int threshold,
         }
 }
 
+// r[n] = cvRound(x*tabCos[n] + y*tabSin[n]) for n in [0, count)
+static void
+computeRhoIndices( float x, float y, const float* tabCos, const float* tabSin, int count, int* r )
+{
+    int n = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int VECSZ = VTraits<v_float32>::vlanes();
+    v_float32 vx = vx_setall_f32(x), vy = vx_setall_f32(y);
+    for( ; n <= count - VECSZ; n += VECSZ )
+        v_store(r + n, v_round(v_add(v_mul(vx, vx_load(tabCos + n)), v_mul(vy, vx_load(tabSin + n)))));
+    vx_cleanup();
+#endif
+    for( ; n < count; n++ )
+        r[n] = cvRound(x*tabCos[n] + y*tabSin[n]);
+}
+
+enum { HOUGH_ANGLE_BLOCK = 8 };
+
+// The accumulator rows are distributed between the threads, so every thread
+// goes through all the points, but only updates the angles it owns.
+class HoughLinesAccumInvoker : public ParallelLoopBody
+{
+public:
+    HoughLinesAccumInvoker(const std::vector<Point>& _nzloc, const float* _tabSin, const float* _tabCos,
+                           int _numangle, int _numrho, int* _accum) :
+        nzloc(_nzloc), tabSin(_tabSin), tabCos(_tabCos), numangle(_numangle), numrho(_numrho), accum(_accum)
+    {}
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        int rbuf[HOUGH_ANGLE_BLOCK];
+        const int astep = numrho + 2, rofs = (numrho - 1) / 2 + 1;
+        const int n0 = range.start*HOUGH_ANGLE_BLOCK, n1 = std::min(range.end*HOUGH_ANGLE_BLOCK, numangle);
+        for( int nb = n0; nb < n1; nb += HOUGH_ANGLE_BLOCK )
+        {
+            int count = std::min((int)HOUGH_ANGLE_BLOCK, n1 - nb);
+            int* adata = accum + (nb + 1)*astep + rofs;
+            for( size_t i = 0; i < nzloc.size(); i++ )
+            {
+                computeRhoIndices((float)nzloc[i].x, (float)nzloc[i].y, tabCos + nb, tabSin + nb, count, rbuf);
+                for( int n = 0; n < count; n++ )
+                    adata[n*astep + rbuf[n]]++;
+            }
+        }
+    }
+
+private:
+    const std::vector<Point>& nzloc;
+    const float *tabSin, *tabCos;
+    int numangle, numrho;
+    int* accum;
+};
+
 /*
 Here image is an input raster;
 step is it's step; size characterizes it's ROI;
@@ -184,18 +237,18 @@ HoughLinesStandard( InputArray src, OutputArray lines, int type,
                      irho, tabSin, tabCos);
 
     // stage 1. fill accumulator
+    std::vector<Point> nzloc;
     for( i = 0; i < height; i++ )
         for( j = 0; j < width; j++ )
         {
             if( image[i * step + j] != 0 )
-                for(int n = 0; n < numangle; n++ )
-                {
-                    int r = cvRound( j * tabCos[n] + i * tabSin[n] );
-                    r += (numrho - 1) / 2;
-                    accum[(n+1) * (numrho+2) + r+1]++;
-                }
+                nzloc.push_back(Point(j, i));
         }
 
+    int nblocks = (numangle + HOUGH_ANGLE_BLOCK - 1) / HOUGH_ANGLE_BLOCK;
+    parallel_for_(Range(0, nblocks), HoughLinesAccumInvoker(nzloc, tabSin, tabCos, numangle, numrho, accum),
+                  (double)nzloc.size() * numangle / (1 << 20));
+
     // stage 2. find local maximums
     findLocalMaximums( numrho, numangle, threshold, accum, _sort_buf );
 
@@ -472,15 +525,21 @@ HoughLinesSDiv( InputArray image, OutputArray lines, int type,
 *                              Probabilistic Hough Transform                             *
 \****************************************************************************************/
 
+/*
+openTop and openBottom are used when the image is a horizontal stripe of a bigger one:
+segments whose walk leaves the image through such a border are kept regardless of their length,
+they may continue in the neighbouring stripe.
+*/
 static void
 HoughLinesProbabilistic( Mat& image,
                          float rho, float theta, int threshold,
                          int lineLength, int lineGap,
-                         std::vector<Vec4i>& lines, int linesMax )
+                         std::vector<Vec4i>& lines, int linesMax,
+                         uint64 seed = (uint64)-1, bool openTop = false, bool openBottom = false )
 {
     Point pt;
     float irho = 1 / rho;
-    RNG rng((uint64)-1);
+    RNG rng(seed);
 
     CV_Assert( image.type() == CV_8UC1 );
 
@@ -491,7 +550,7 @@ HoughLinesProbabilistic( Mat& image,
     int numrho = cvRound(((width + height) * 2 + 1) / rho);
 
 #if defined HAVE_IPP && IPP_VERSION_X100 >= 810 && !IPP_DISABLE_HOUGH
-    CV_IPP_CHECK()
+    if( seed == (uint64)-1 && !openTop && !openBottom && CV_IPP_CHECK_COND )
     {
         IppiSize srcSize = { width, height };
         IppPointPolar delta = { rho, theta };
@@ -521,14 +580,17 @@ HoughLinesProbabilistic( Mat& image,
 
     Mat accum = Mat::zeros( numangle, numrho, CV_32SC1 );
     Mat mask( height, width, CV_8UC1 );
-    std::vector<float> trigtab(numangle*2);
+    AutoBuffer<float> _tabCos(numangle), _tabSin(numangle);
+    AutoBuffer<int> _rbuf(numangle);
+    float *tabCos = _tabCos.data(), *tabSin = _tabSin.data();
+    int* rbuf = _rbuf.data();
+    const int rofs = (numrho - 1) / 2;
 
     for( int n = 0; n < numangle; n++ )
     {
-        trigtab[n*2] = (float)(cos((double)n*theta) * irho);
-        trigtab[n*2+1] = (float)(sin((double)n*theta) * irho);
+        tabCos[n] = (float)(cos((double)n*theta) * irho);
+        tabSin[n] = (float)(sin((double)n*theta) * irho);
     }
-    const float* ttab = &trigtab[0];
     uchar* mdata0 = mask.ptr();
     std::vector<Point> nzloc;
 
@@ -559,6 +621,7 @@ HoughLinesProbabilistic( Mat& image,
         int max_val = threshold-1, max_n = 0;
         Point point = nzloc[idx];
         Point line_end[2];
+        bool open_end[2] = { false, false };
         float a, b;
         int* adata = accum.ptr<int>();
         int i = point.y, j = point.x, k, x0, y0, dx0, dy0, xflag;
@@ -573,11 +636,10 @@ HoughLinesProbabilistic( Mat& image,
             continue;
 
         // update accumulator, find the most probable line
+        computeRhoIndices((float)j, (float)i, tabCos, tabSin, numangle, rbuf);
         for( int n = 0; n < numangle; n++, adata += numrho )
         {
-            int r = cvRound( j * ttab[n*2] + i * ttab[n*2+1] );
-            r += (numrho - 1) / 2;
-            int val = ++adata[r];
+            int val = ++adata[rbuf[n] + rofs];
             if( max_val < val )
             {
                 max_val = val;
@@ -591,8 +653,8 @@ HoughLinesProbabilistic( Mat& image,
 
         // from the current point walk in each direction
         // along the found line and extract the line segment
-        a = -ttab[max_n*2+1];
-        b = ttab[max_n*2];
+        a = -tabSin[max_n];
+        b = tabCos[max_n];
         x0 = j;
         y0 = i;
         if( fabs(a) > fabs(b) )
@@ -636,7 +698,10 @@ HoughLinesProbabilistic( Mat& image,
                 }
 
                 if( j1 < 0 || j1 >= width || i1 < 0 || i1 >= height )
+                {
+                    open_end[k] = (openTop && i1 < 0) || (openBottom && i1 >= height);
                     break;
+                }
 
                 mdata = mdata0 + i1*width + j1;
 
@@ -656,7 +721,8 @@ HoughLinesProbabilistic( Mat& image,
         }
 
         good_line = std::abs(line_end[1].x - line_end[0].x) >= lineLength ||
-                    std::abs(line_end[1].y - line_end[0].y) >= lineLength;
+                    std::abs(line_end[1].y - line_end[0].y) >= lineLength ||
+                    open_end[0] || open_end[1];
 
         for( k = 0; k < 2; k++ )
         {
@@ -694,12 +760,9 @@ HoughLinesProbabilistic( Mat& image,
                     if( good_line )
                     {
                         adata = accum.ptr<int>();
+                        computeRhoIndices((float)j1, (float)i1, tabCos, tabSin, numangle, rbuf);
                         for( int n = 0; n < numangle; n++, adata += numrho )
-                        {
-                            int r = cvRound( j1 * ttab[n*2] + i1 * ttab[n*2+1] );
-                            r += (numrho - 1) / 2;
-                            adata[r]--;
-                        }
+                            adata[rbuf[n] + rofs]--;
                     }
                     *mdata = 0;
                 }
@@ -719,6 +782,102 @@ HoughLinesProbabilistic( Mat& image,
     }
 }
 
+/*
+The stripes are processed independently, each one with its own accumulator, mask and random
+generator, so the result only depends on the seed and the number of stripes. After that the
+segments cut by a stripe border are joined with their continuation in the next stripe:
+both ends should be near the border, no more than lineGap steps apart, and lie on the line
+connecting the outer ends.
+*/
+static void
+HoughLinesProbabilisticStripes( Mat& image,
+                                float rho, float theta, int threshold,
+                                int lineLength, int lineGap,
+                                std::vector<Vec4i>& lines,
+                                uint64 seed, int stripes )
+{
+    const int height = image.rows;
+    stripes = std::min(stripes, height);
+
+    std::vector<std::vector<Vec4i> > stripeLines(stripes);
+    parallel_for_(Range(0, stripes), [&](const Range& range)
+    {
+        for( int s = range.start; s < range.end; s++ )
+        {
+            int y0 = height*s/stripes, y1 = height*(s + 1)/stripes;
+            Mat roi = image.rowRange(y0, y1);
+            HoughLinesProbabilistic(roi, rho, theta, threshold, lineLength, lineGap,
+                                    stripeLines[s], INT_MAX, seed + (uint64)s,
+                                    s > 0, s < stripes - 1);
+            for( size_t k = 0; k < stripeLines[s].size(); k++ )
+            {
+                Vec4i& l = stripeLines[s][k];
+                l[1] += y0;
+                l[3] += y0;
+                // the upper end goes first
+                if( l[1] > l[3] )
+                    l = Vec4i(l[2], l[3], l[0], l[1]);
+            }
+        }
+    });
+
+    std::vector<Vec4i> segs;
+    std::vector<int> first(stripes + 1, 0);
+    for( int s = 0; s < stripes; s++ )
+    {
+        segs.insert(segs.end(), stripeLines[s].begin(), stripeLines[s].end());
+        first[s + 1] = (int)segs.size();
+    }
+
+    // edges a few pixels thick are detected as several parallel pieces
+    const double maxDeviation = 4;
+    std::vector<uchar> alive(segs.size(), (uchar)1);
+    for( int s = 0; s < stripes - 1; s++ )
+    {
+        const int border = height*(s + 1)/stripes;
+        for( int a = 0; a < first[s + 1]; a++ )
+        {
+            Vec4i& sa = segs[a];
+            if( !alive[a] || sa[3] < border - 1 - lineGap )
+                continue;
+
+            int best = -1, bestDist = lineGap + 2;
+            for( int b = first[s + 1]; b < first[s + 2]; b++ )
+            {
+                const Vec4i& sb = segs[b];
+                if( !alive[b] || sb[1] > border + lineGap )
+                    continue;
+                int dist = std::max(std::abs(sb[0] - sa[2]), sb[1] - sa[3]);
+                if( dist >= bestDist )
+                    continue;
+                // the inner ends should be close to the joined segment
+                double dx = sb[2] - sa[0], dy = sb[3] - sa[1];
+                double len = std::sqrt(dx*dx + dy*dy);
+                if( std::abs(dx*(sa[3] - sa[1]) - dy*(sa[2] - sa[0])) <= maxDeviation*len &&
+                    std::abs(dx*(sb[1] - sa[1]) - dy*(sb[0] - sa[0])) <= maxDeviation*len )
+                {
+                    best = b;
+                    bestDist = dist;
+                }
+            }
+
+            if( best >= 0 )
+            {
+                sa[2] = segs[best][2];
+                sa[3] = segs[best][3];
+                alive[best] = 0;
+            }
+        }
+    }
+
+    for( size_t k = 0; k < segs.size(); k++ )
+    {
+        const Vec4i& l = segs[k];
+        if( alive[k] && (std::abs(l[2] - l[0]) >= lineLength || std::abs(l[3] - l[1]) >= lineLength) )
+            lines.push_back(l);
+    }
+}
+
 #ifdef HAVE_OPENCL
 
 #define OCL_MAX_LINES 4096
@@ -943,6 +1102,26 @@ void HoughLinesP(InputArray _image, OutputArray _lines,
     Mat(lines).copyTo(_lines);
 }
 
+void HoughLinesP(InputArray _image, OutputArray _lines,
+                 double rho, double theta, int threshold,
+                 double minLineLength, double maxGap,
+                 uint64 seed, int stripes )
+{
+    CV_INSTRUMENT_REGION();
+
+    Mat image = _image.getMat();
+    CV_Assert( image.type() == CV_8UC1 );
+
+    std::vector<Vec4i> lines;
+    if( stripes > 1 && image.rows > 1 )
+        HoughLinesProbabilisticStripes(image, (float)rho, (float)theta, threshold, cvRound(minLineLength), cvRound(maxGap),
+                                       lines, seed, stripes);
+    else
+        HoughLinesProbabilistic(image, (float)rho, (float)theta, threshold, cvRound(minLineLength), cvRound(maxGap),
+                                lines, INT_MAX, seed);
+    Mat(lines).copyTo(_lines);
+}
+
 void HoughLinesPointSet( InputArray _point, OutputArray _lines, int lines_max, int threshold,
                          double min_rho, double max_rho, double rho_step,
                          double min_theta, double max_theta, double theta_step )
@@ -1820,6 +1999,93 @@ static void HoughCirclesAlt( const Mat& img, std::vector<EstimatedCircle>& circl
     std::vector<Point> stack;
     const int n33[][2] = {{-1, -1}, {-1, 0}, {-1, 1}, {0, 1}, {1, 1}, {1, 0}, {1, -1}, {0, -1}};
 
+    // Every edge pixel votes along its gradient ray, from min_radius to max_radius in both directions.
+    // The votes do not depend on the order of pixels, so the accumulator rows are split between
+    // the threads and each thread casts only the votes that fall into its rows.
+    std::vector<Point> edgePts;
+    for( int y = 0; y < edges.rows; y++ )
+        for( int x = 0; x < edges.cols; x++ )
+            if( edgeData[y*estep + x] )
+                edgePts.push_back(Point(x, y));
+
+    double voteStripes = std::min((double)edgePts.size()*(maxR - minR + 1) / (1 << 16), (double)getNumThreads()*4);
+    parallel_for_(Range(0, arows + 1), [&](const Range& range)
+    {
+        const int ya = range.start, yb = range.end;
+        for( size_t k = 0; k < edgePts.size(); k++ )
+        {
+            Point p = edgePts[k];
+            int vx = dxData[p.y*dxystep + p.x];
+            int vy = dyData[p.y*dxystep + p.x];
+
+            float mag = std::sqrt((float)vx*vx+(float)vy*vy);
+            int sx = cvRound(vx * RAY_FP_SCALE / mag);
+            int sy = cvRound(vy * RAY_FP_SCALE / mag);
+
+            int x0 = cvRound((p.x * idp) * RAY_FP_SCALE);
+            int y0 = cvRound((p.y * idp) * RAY_FP_SCALE);
+
+            for( int k1 = 0; k1 < 2; k1++, sx = -sx, sy = -sy )
+            {
+                // the ray leaves the accumulator once and for all, so it is enough
+                // to check that it starts inside to skip the steps outside of [ya-1, yb)
+                int x1 = x0 + minR * sx;
+                int y1 = y0 + minR * sy;
+                if( (unsigned)(((x1 + RAY_DELTA1) >> RAY_SHIFT1) >> RAY_SHIFT2) >= (unsigned)acols ||
+                    (unsigned)(((y1 + RAY_DELTA1) >> RAY_SHIFT1) >> RAY_SHIFT2) >= (unsigned)arows )
+                    continue;
+
+                int r0 = minR;
+                if( sy == 0 )
+                {
+                    int y2 = ((y1 + RAY_DELTA1) >> RAY_SHIFT1) >> RAY_SHIFT2;
+                    if( y2 < ya - 1 || y2 >= yb )
+                        continue;
+                }
+                else
+                {
+                    double target = sy > 0 ? (double)(ya - 1)*RAY_FP_SCALE - RAY_DELTA1 : (double)yb*RAY_FP_SCALE - RAY_DELTA1;
+                    double rt = std::floor((target - y0) / sy) - 1;
+                    if( rt > r0 )
+                        r0 = (int)std::min(rt, (double)maxR + 1);
+                }
+                x1 = x0 + r0 * sx;
+                y1 = y0 + r0 * sy;
+
+                for( int r = r0; r <= maxR; x1 += sx, y1 += sy, r++ )
+                {
+                    int x2a = (x1 + RAY_DELTA1) >> RAY_SHIFT1, y2a = (y1 + RAY_DELTA1) >> RAY_SHIFT1;
+                    int x2 = x2a >> RAY_SHIFT2, y2 = y2a >> RAY_SHIFT2;
+                    if( (unsigned)x2 >= (unsigned)acols ||
+                        (unsigned)y2 >= (unsigned)arows )
+                        break;
+                    if( y2 < ya - 1 || y2 >= yb )
+                    {
+                        if( (y2 < ya - 1) == (sy > 0) )
+                            continue;
+                        break;
+                    }
+
+                    // instead of giving everything to the computed pixel of the accumulator,
+                    // do a weighted update of 4 neighbor (2x2) pixels using bilinear interpolation.
+                    // we do it to reduce the aliasing effect, even though it's slower
+                    int* ptr = adata + y2*astep + x2;
+                    int a = (x2a & ACCUM_ALPHA_MASK), b = (y2a & ACCUM_ALPHA_MASK);
+                    if( y2 >= ya )
+                    {
+                        ptr[0] += (ACCUM_ALPHA_ONE - a)*(ACCUM_ALPHA_ONE - b);
+                        ptr[1] += a*(ACCUM_ALPHA_ONE - b);
+                    }
+                    if( y2 + 1 < yb )
+                    {
+                        ptr[astep] += (ACCUM_ALPHA_ONE - a)*b;
+                        ptr[astep+1] += a*b;
+                    }
+                }
+            }
+        }
+    }, voteStripes);
+
     for( int x = 0; x < mask.cols; x++ ) mdata[x] = mdata[(mask.rows-1)*mstep + x] = (uchar)1;
     for( int y = 0; y < mask.rows; y++ ) mdata[y*mstep] = mdata[y*mstep + mask.cols-1] = (uchar)1;
     mdata += mstep + 1;
@@ -1842,44 +2108,9 @@ static void HoughCirclesAlt( const Mat& img, std::vector<EstimatedCircle>& circl
                 int vx = dxData[p.y*dxystep + p.x];
                 int vy = dyData[p.y*dxystep + p.x];
 
-                float mag = std::sqrt((float)vx*vx+(float)vy*vy);
                 nz.push_back(Vec4f((float)p.x, (float)p.y, (float)vx, (float)vy));
                 CV_Assert(mdata[p.y*mstep + p.x] == 1);
 
-                int sx = cvRound(vx * RAY_FP_SCALE / mag);
-                int sy = cvRound(vy * RAY_FP_SCALE / mag);
-
-                int x0 = cvRound((p.x * idp) * RAY_FP_SCALE);
-                int y0 = cvRound((p.y * idp) * RAY_FP_SCALE);
-
-                // Step from min_radius to max_radius in both directions of the gradient
-                for(int k1 = 0; k1 < 2; k1++ )
-                {
-                    int x1 = x0 + minR * sx;
-                    int y1 = y0 + minR * sy;
-
-                    for(int r = minR; r <= maxR; x1 += sx, y1 += sy, r++ )
-                    {
-                        int x2a = (x1 + RAY_DELTA1) >> RAY_SHIFT1, y2a = (y1 + RAY_DELTA1) >> RAY_SHIFT1;
-                        int x2 = x2a >> RAY_SHIFT2, y2 = y2a >> RAY_SHIFT2;
-                        if( (unsigned)x2 >= (unsigned)acols ||
-                            (unsigned)y2 >= (unsigned)arows )
-                            break;
-
-                        // instead of giving everything to the computed pixel of the accumulator,
-                        // do a weighted update of 4 neighbor (2x2) pixels using bilinear interpolation.
-                        // we do it to reduce the aliasing effect, even though it's slower
-                        int* ptr = adata + y2*astep + x2;
-                        int a = (x2a & ACCUM_ALPHA_MASK), b = (y2a & ACCUM_ALPHA_MASK);
-                        ptr[0] += (ACCUM_ALPHA_ONE - a)*(ACCUM_ALPHA_ONE - b);
-                        ptr[1] += a*(ACCUM_ALPHA_ONE - b);
-                        ptr[astep] += (ACCUM_ALPHA_ONE - a)*b;
-                        ptr[astep+1] += a*b;
-                    }
-
-                    sx = -sx; sy = -sy;
-                }
-
                 int neighbors = 0;
                 for( int k = 0; k < 8; k++ )
                 {
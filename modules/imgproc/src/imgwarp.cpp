@@ -3475,6 +3475,238 @@ void cv::warpPerspective( InputArray _src, OutputArray _dst, InputArray _M0,
 }
 
 
+namespace cv
+{
+
+/*
+ * WarpPlan keeps the fixed-point maps of one warpAffine / warpPerspective transformation in the
+ * CV_16SC2 + CV_16UC1 form used by remap. The maps are stored tile by tile, so every tile is a
+ * contiguous piece of memory that is replayed with a single remap call.
+ *
+ * The maps are generated with the same block lines as WarpAffineInvoker and
+ * WarpPerspectiveInvoker (the latter accumulates along its own 32x32-pixel blocks), so the
+ * result is identical to the corresponding warp function.
+ */
+class WarpPlanImpl CV_FINAL : public WarpPlan
+{
+public:
+    enum { TILE_W = 128, TILE_H = 32 };
+
+    WarpPlanImpl( InputArray _M0, Size _ssize, Size _dsize, int flags, bool perspective ) :
+        ssize(_ssize), skipOutside(false)
+    {
+        CV_Assert( ssize.width > 0 && ssize.height > 0 );
+        dsize = _dsize.empty() ? ssize : _dsize;
+
+        interpolation = flags & INTER_MAX;
+        if( interpolation == INTER_AREA )
+            interpolation = INTER_LINEAR;
+        CV_Assert( interpolation == INTER_NEAREST || interpolation == INTER_LINEAR ||
+                   interpolation == INTER_CUBIC || interpolation == INTER_LANCZOS4 );
+
+        Mat M0 = _M0.getMat();
+        int mrows = perspective ? 3 : 2;
+        CV_Assert( (M0.type() == CV_32F || M0.type() == CV_64F) && M0.rows == mrows && M0.cols == 3 );
+        double M[9] = {0};
+        Mat matM(mrows, 3, CV_64F, M);
+        M0.convertTo(matM, matM.type());
+
+        if( !(flags & WARP_INVERSE_MAP) )
+        {
+            if( perspective )
+                invert(matM, matM);
+            else
+            {
+                // same inversion as in warpAffine()
+                double D = M[0]*M[4] - M[1]*M[3];
+                D = D != 0 ? 1./D : 0;
+                double A11 = M[4]*D, A22=M[0]*D;
+                M[0] = A11; M[1] *= -D;
+                M[3] *= -D; M[4] = A22;
+                double b1 = -M[0]*M[2] - M[1]*M[5];
+                double b2 = -M[3]*M[2] - M[4]*M[5];
+                M[2] = b1; M[5] = b2;
+            }
+        }
+
+        tilesX = (dsize.width + TILE_W - 1)/TILE_W;
+        tilesY = (dsize.height + TILE_H - 1)/TILE_H;
+        xy.resize(dsize.area()*2);
+        if( interpolation != INTER_NEAREST )
+            alpha.resize(dsize.area());
+        tileInside.resize(tilesX*tilesY);
+
+        parallel_for_(Range(0, tilesY), [&](const Range& range)
+        {
+            AutoBuffer<short> _rowXY(dsize.width*2), _rowA(dsize.width);
+            AutoBuffer<int> _abdelta(perspective ? 0 : dsize.width*2);
+            short *rowXY = _rowXY.data(), *rowA = _rowA.data();
+            int *adelta = _abdelta.data(), *bdelta = adelta + dsize.width;
+            if( !perspective )
+            {
+                for( int x = 0; x < dsize.width; x++ )
+                {
+                    adelta[x] = saturate_cast<int>(M[0]*x*AB_SCALE);
+                    bdelta[x] = saturate_cast<int>(M[3]*x*AB_SCALE);
+                }
+            }
+
+            for( int ty = range.start; ty < range.end; ty++ )
+            {
+                int y0 = ty*TILE_H, bh = std::min((int)TILE_H, dsize.height - y0);
+                for( int y = y0; y < y0 + bh; y++ )
+                {
+                    if( perspective )
+                        perspectiveRow(M, y, rowXY, rowA);
+                    else
+                        affineRow(M, adelta, bdelta, y, rowXY, rowA);
+
+                    for( int tx = 0; tx < tilesX; tx++ )
+                    {
+                        int x0 = tx*TILE_W, bw = std::min((int)TILE_W, dsize.width - x0);
+                        size_t ofs = tileOffset(tx, ty) + (size_t)(y - y0)*bw;
+                        memcpy(&xy[ofs*2], rowXY + x0*2, bw*2*sizeof(short));
+                        if( !alpha.empty() )
+                            memcpy(&alpha[ofs], rowA + x0, bw*sizeof(short));
+                    }
+                }
+                for( int tx = 0; tx < tilesX; tx++ )
+                    tileInside[ty*tilesX + tx] = (uchar)isTileInside(tx, ty);
+            }
+        }, dsize.area()/(double)(1<<16));
+    }
+
+    void apply( InputArray _src, OutputArray _dst, int borderMode, const Scalar& borderValue ) CV_OVERRIDE
+    {
+        CV_INSTRUMENT_REGION();
+
+        Mat src = _src.getMat();
+        CV_Assert( src.dims <= 2 && src.size() == ssize );
+        CV_Assert( src.channels() <= 4 || (interpolation != INTER_LANCZOS4 &&
+                                           interpolation != INTER_CUBIC) );
+        _dst.create( dsize, src.type() );
+        Mat dst = _dst.getMat();
+        if( dst.data == src.data )
+            src = src.clone();
+
+        parallel_for_(Range(0, tilesX*tilesY), [&](const Range& range)
+        {
+            for( int i = range.start; i < range.end; i++ )
+            {
+                int tx = i % tilesX, ty = i / tilesX;
+                Rect r = tileRect(tx, ty);
+                if( !tileInside[i] )
+                {
+                    // remap() would only produce the border value or leave the pixels untouched
+                    if( skipOutside || borderMode == BORDER_TRANSPARENT )
+                        continue;
+                    if( borderMode == BORDER_CONSTANT )
+                    {
+                        dst(r).setTo(borderValue);
+                        continue;
+                    }
+                }
+                Mat dpart = dst(r);
+                size_t ofs = tileOffset(tx, ty);
+                Mat _XY(r.height, r.width, CV_16SC2, &xy[ofs*2]);
+                if( interpolation == INTER_NEAREST )
+                    remap( src, dpart, _XY, Mat(), interpolation, borderMode, borderValue );
+                else
+                {
+                    Mat _matA(r.height, r.width, CV_16U, &alpha[ofs]);
+                    remap( src, dpart, _XY, _matA, interpolation, borderMode, borderValue );
+                }
+            }
+        }, dsize.area()/(double)(1<<16));
+    }
+
+    Size getSrcSize() const CV_OVERRIDE { return ssize; }
+    Size getDstSize() const CV_OVERRIDE { return dsize; }
+    void setSkipOutside( bool skip ) CV_OVERRIDE { skipOutside = skip; }
+    bool getSkipOutside() const CV_OVERRIDE { return skipOutside; }
+
+private:
+    enum { AB_BITS = MAX(10, (int)INTER_BITS), AB_SCALE = 1 << AB_BITS };
+
+    void affineRow( const double* M, int* adelta, int* bdelta, int y, short* rowXY, short* rowA ) const
+    {
+        int round_delta = interpolation == INTER_NEAREST ? AB_SCALE/2 : AB_SCALE/INTER_TAB_SIZE/2;
+        int X0 = saturate_cast<int>((M[1]*y + M[2])*AB_SCALE) + round_delta;
+        int Y0 = saturate_cast<int>((M[4]*y + M[5])*AB_SCALE) + round_delta;
+        if( interpolation == INTER_NEAREST )
+            hal::warpAffineBlocklineNN(adelta, bdelta, rowXY, X0, Y0, dsize.width);
+        else
+            hal::warpAffineBlockline(adelta, bdelta, rowXY, rowA, X0, Y0, dsize.width);
+    }
+
+    void perspectiveRow( const double* M, int y, short* rowXY, short* rowA ) const
+    {
+        // block width of WarpPerspectiveInvoker
+        const int BLOCK_SZ = 32;
+        int bh0 = std::min(BLOCK_SZ/2, dsize.height);
+        int bw0 = std::min(BLOCK_SZ*BLOCK_SZ/bh0, dsize.width);
+        for( int x = 0; x < dsize.width; x += bw0 )
+        {
+            int bw = std::min(bw0, dsize.width - x);
+            double X0 = M[0]*x + M[1]*y + M[2];
+            double Y0 = M[3]*x + M[4]*y + M[5];
+            double W0 = M[6]*x + M[7]*y + M[8];
+            if( interpolation == INTER_NEAREST )
+                hal::warpPerspectiveBlocklineNN(M, rowXY + x*2, X0, Y0, W0, bw);
+            else
+                hal::warpPerspectiveBlockline(M, rowXY + x*2, rowA + x, X0, Y0, W0, bw);
+        }
+    }
+
+    // whether any interpolation tap of the tile may hit the source image
+    bool isTileInside( int tx, int ty ) const
+    {
+        int lo = interpolation == INTER_CUBIC ? -1 : interpolation == INTER_LANCZOS4 ? -3 : 0;
+        int hi = interpolation == INTER_CUBIC ? 2 : interpolation == INTER_LANCZOS4 ? 4 :
+                 interpolation == INTER_LINEAR ? 1 : 0;
+        Rect r = tileRect(tx, ty);
+        const short* p = &xy[tileOffset(tx, ty)*2];
+        int minx = SHRT_MAX, maxx = SHRT_MIN, miny = SHRT_MAX, maxy = SHRT_MIN;
+        for( int i = 0; i < r.area(); i++ )
+        {
+            minx = std::min(minx, (int)p[i*2]); maxx = std::max(maxx, (int)p[i*2]);
+            miny = std::min(miny, (int)p[i*2+1]); maxy = std::max(maxy, (int)p[i*2+1]);
+        }
+        return maxx + hi >= 0 && minx + lo < ssize.width && maxy + hi >= 0 && miny + lo < ssize.height;
+    }
+
+    Rect tileRect( int tx, int ty ) const
+    {
+        int x0 = tx*TILE_W, y0 = ty*TILE_H;
+        return Rect(x0, y0, std::min((int)TILE_W, dsize.width - x0), std::min((int)TILE_H, dsize.height - y0));
+    }
+
+    size_t tileOffset( int tx, int ty ) const
+    {
+        int y0 = ty*TILE_H, bh = std::min((int)TILE_H, dsize.height - y0);
+        return (size_t)y0*dsize.width + (size_t)tx*TILE_W*bh;
+    }
+
+    Size ssize, dsize;
+    int interpolation;
+    bool skipOutside;
+    int tilesX, tilesY;
+    std::vector<short> xy, alpha;
+    std::vector<uchar> tileInside;
+};
+
+Ptr<WarpPlan> createWarpAffinePlan( InputArray M, Size srcSize, Size dsize, int flags )
+{
+    return makePtr<WarpPlanImpl>(M, srcSize, dsize, flags, false);
+}
+
+Ptr<WarpPlan> createWarpPerspectivePlan( InputArray M, Size srcSize, Size dsize, int flags )
+{
+    return makePtr<WarpPlanImpl>(M, srcSize, dsize, flags, true);
+}
+
+} // cv::
+
 cv::Matx23d cv::getRotationMatrix2D_(Point2f center, double angle, double scale)
 {
     CV_INSTRUMENT_REGION();
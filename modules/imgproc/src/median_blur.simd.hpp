@@ -838,6 +838,254 @@ medianBlur_SortNet( const Mat& _src, Mat& _dst, int m )
     }
 }
 
+/*
+ * Median filter with arbitrary aperture for 16-bit and floating-point images.
+ *
+ * The image is split into tiles that are processed in parallel. Every tile channel is turned into
+ * a plane of integer keys that preserve the order of the pixel values: the values themselves for
+ * 16-bit images, the ranks of the values inside the tile for floating-point ones. The window is
+ * then moved in a zigzag order over the tile (Huang's algorithm), so each step only adds and
+ * removes one row or one column of the aperture. The window histogram keeps counts for every key
+ * and for groups of 16 and 256 keys; the median is tracked incrementally and the group counts let
+ * it skip over empty ranges, which makes the search time practically independent of the aperture.
+ */
+class MedianHistogram
+{
+public:
+    MedianHistogram(int* _hist, int* _mid, int* _coarse, int nbins, int _half) :
+        hist(_hist), mid(_mid), coarse(_coarse), half(_half), med(0), lt(0)
+    {
+        memset(hist, 0, nbins*sizeof(hist[0]));
+        memset(mid, 0, ((nbins + 15) >> 4)*sizeof(mid[0]));
+        memset(coarse, 0, ((nbins + 255) >> 8)*sizeof(coarse[0]));
+    }
+
+    inline void add(int v)
+    {
+        hist[v]++;
+        mid[v >> 4]++;
+        coarse[v >> 8]++;
+        lt += v < med;
+    }
+
+    inline void remove(int v)
+    {
+        hist[v]--;
+        mid[v >> 4]--;
+        coarse[v >> 8]--;
+        lt -= v < med;
+    }
+
+    // moves the median so that lt <= half < lt + hist[med]
+    inline int median()
+    {
+        while( lt > half )
+        {
+            int v = med - 1;
+            for( ;; )
+            {
+                if( (v & 255) == 255 && coarse[v >> 8] == 0 )
+                    v -= 256;
+                else if( (v & 15) == 15 && mid[v >> 4] == 0 )
+                    v -= 16;
+                else if( hist[v] == 0 )
+                    v--;
+                else
+                    break;
+            }
+            lt -= hist[v];
+            med = v;
+        }
+        while( lt + hist[med] <= half )
+        {
+            lt += hist[med];
+            int v = med + 1;
+            for( ;; )
+            {
+                if( (v & 255) == 0 && coarse[v >> 8] == 0 )
+                    v += 256;
+                else if( (v & 15) == 0 && mid[v >> 4] == 0 )
+                    v += 16;
+                else if( hist[v] == 0 )
+                    v++;
+                else
+                    break;
+            }
+            med = v;
+        }
+        return med;
+    }
+
+private:
+    int* hist;
+    int* mid;
+    int* coarse;
+    int half, med, lt;
+};
+
+// keys is a (width + m - 1) x (height + m - 1) plane, dst receives width x height median keys
+template<typename K> static void
+medianBlur_Keys( const K* keys, size_t kstep, int width, int height, int m, int nbins,
+                 int* hist, K* dst, size_t dstep )
+{
+    MedianHistogram h(hist, hist + nbins, hist + nbins + (nbins + 15)/16, nbins, m*m/2);
+    int x = 0;
+    for( int i = 0; i < m; i++ )
+        for( int j = 0; j < m; j++ )
+            h.add(keys[i*kstep + j]);
+
+    for( int y = 0; y < height; y++ )
+    {
+        const K* row = keys + y*kstep;
+        if( y > 0 )
+        {
+            const K* prev = row - kstep;
+            const K* next = row + (m - 1)*kstep;
+            for( int j = x; j < x + m; j++ )
+            {
+                h.remove(prev[j]);
+                h.add(next[j]);
+            }
+        }
+        dst[y*dstep + x] = (K)h.median();
+
+        // even rows go from left to right, odd rows come back
+        int dx = (y & 1) ? -1 : 1;
+        for( int n = 1; n < width; n++ )
+        {
+            int outCol = dx > 0 ? x : x + m - 1;
+            int inCol = dx > 0 ? x + m : x - 1;
+            for( int i = 0; i < m; i++ )
+            {
+                h.remove(row[i*kstep + outCol]);
+                h.add(row[i*kstep + inCol]);
+            }
+            x += dx;
+            dst[y*dstep + x] = (K)h.median();
+        }
+    }
+}
+
+static inline unsigned medianSortKey( float v )
+{
+    Cv32suf u;
+    u.f = v;
+    return u.i < 0 ? ~u.u : u.u | 0x80000000u;
+}
+
+class MedianBlurHistInvoker : public ParallelLoopBody
+{
+public:
+    MedianBlurHistInvoker( const Mat& _src, Mat& _dst, int _m, Size _tileSize ) :
+        ParallelLoopBody(), src(_src), dst(_dst), m(_m), tileSize(_tileSize)
+    {
+        tilesX = (dst.cols + tileSize.width - 1)/tileSize.width;
+    }
+
+    virtual void operator() (const Range& range) const CV_OVERRIDE
+    {
+        const int cn = src.channels(), depth = src.depth();
+        const int rw = std::min(tileSize.width, dst.cols) + m - 1;
+        const int rh = std::min(tileSize.height, dst.rows) + m - 1;
+        const int nbins = depth == CV_32F ? rw*rh : 1 << 16;
+        const int tw = rw - m + 1, th = rh - m + 1;
+
+        AutoBuffer<int> _hist(nbins + (nbins + 15)/16 + (nbins + 255)/256);
+        int* hist = _hist.data();
+
+        std::vector<ushort> keys16, dst16;
+        std::vector<int> ranks, dstRanks;
+        std::vector<uint64> order;
+        std::vector<float> values;
+        if( depth == CV_32F )
+        {
+            ranks.resize((size_t)rw*rh);
+            dstRanks.resize((size_t)tw*th);
+            order.resize((size_t)rw*rh);
+            values.resize((size_t)rw*rh);
+        }
+        else
+        {
+            keys16.resize((size_t)rw*rh);
+            dst16.resize((size_t)tw*th);
+        }
+
+        for( int t = range.start; t < range.end; t++ )
+        {
+            int x0 = (t % tilesX)*tileSize.width, y0 = (t / tilesX)*tileSize.height;
+            int w = std::min(tileSize.width, dst.cols - x0), h = std::min(tileSize.height, dst.rows - y0);
+            int sw = w + m - 1, sh = h + m - 1;
+
+            for( int c = 0; c < cn; c++ )
+            {
+                if( depth == CV_32F )
+                {
+                    for( int i = 0; i < sh; i++ )
+                    {
+                        const float* S = src.ptr<float>(y0 + i) + x0*cn + c;
+                        for( int j = 0; j < sw; j++ )
+                            order[i*sw + j] = ((uint64)medianSortKey(S[j*cn]) << 32) | (unsigned)(i*sw + j);
+                    }
+                    std::sort(order.begin(), order.begin() + sw*sh);
+                    for( int k = 0; k < sw*sh; k++ )
+                    {
+                        int idx = (int)(order[k] & 0xffffffffu);
+                        ranks[idx] = k;
+                        values[k] = src.ptr<float>(y0 + idx/sw)[(x0 + idx%sw)*cn + c];
+                    }
+                    medianBlur_Keys(&ranks[0], sw, w, h, m, sw*sh, hist, &dstRanks[0], w);
+                    for( int i = 0; i < h; i++ )
+                    {
+                        float* D = dst.ptr<float>(y0 + i) + x0*cn + c;
+                        for( int j = 0; j < w; j++ )
+                            D[j*cn] = values[dstRanks[i*w + j]];
+                    }
+                }
+                else
+                {
+                    // signed values are shifted to keep their order
+                    ushort delta = depth == CV_16S ? 0x8000 : 0;
+                    for( int i = 0; i < sh; i++ )
+                    {
+                        const ushort* S = src.ptr<ushort>(y0 + i) + x0*cn + c;
+                        for( int j = 0; j < sw; j++ )
+                            keys16[i*sw + j] = (ushort)(S[j*cn] ^ delta);
+                    }
+                    medianBlur_Keys(&keys16[0], sw, w, h, m, nbins, hist, &dst16[0], w);
+                    for( int i = 0; i < h; i++ )
+                    {
+                        ushort* D = dst.ptr<ushort>(y0 + i) + x0*cn + c;
+                        for( int j = 0; j < w; j++ )
+                            D[j*cn] = (ushort)(dst16[i*w + j] ^ delta);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    const Mat& src;
+    Mat& dst;
+    int m;
+    Size tileSize;
+    int tilesX;
+};
+
+// src is the source image with m/2 replicated pixels on every side
+static void
+medianBlur_Hist( const Mat& src, Mat& dst, int m )
+{
+    CV_INSTRUMENT_REGION();
+
+    // 16-bit images are processed in full-height column strips; floating-point tiles are kept
+    // small, as their values are ranked by sorting
+    Size tileSize(128, src.depth() == CV_32F ? 128 : dst.rows);
+    int tilesX = (dst.cols + tileSize.width - 1)/tileSize.width;
+    int tilesY = (dst.rows + tileSize.height - 1)/tileSize.height;
+    MedianBlurHistInvoker invoker(src, dst, m, tileSize);
+    parallel_for_(Range(0, tilesX*tilesY), invoker, tilesX*tilesY);
+}
+
 } // namespace anon
 
 void medianBlur(const Mat& src0, /*const*/ Mat& dst, int ksize)
@@ -873,6 +1121,14 @@ void medianBlur(const Mat& src0, /*const*/ Mat& dst, int ksize)
     }
     else
     {
+        if( src0.depth() != CV_8U )
+        {
+            CV_Assert( src0.depth() == CV_16U || src0.depth() == CV_16S || src0.depth() == CV_32F );
+            cv::copyMakeBorder( src0, src, ksize/2, ksize/2, ksize/2, ksize/2, BORDER_REPLICATE|BORDER_ISOLATED);
+            medianBlur_Hist( src, dst, ksize );
+            return;
+        }
+
         // TODO AVX guard (external call)
         cv::copyMakeBorder( src0, src, 0, 0, ksize/2, ksize/2, BORDER_REPLICATE|BORDER_ISOLATED);
 
@@ -0,0 +1,430 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+#include "opencv2/core/hal/intrin.hpp"
+#include "opencv2/core/softfloat.hpp"
+#include "color.hpp"
+
+/*
+ * Fused color conversion, resize, normalization and HWC -> NCHW layout change.
+ *
+ * The destination is produced in horizontal stripes. Each stripe converts only the source rows
+ * it depends on (row pairs for the 4:2:0 formats) and resamples them horizontally into two cached
+ * lines of 8.8 fixed-point values. Every destination row is then interpolated vertically,
+ * normalized and scattered to the output planes in a single pass, so no full-size intermediate
+ * image is ever written.
+ *
+ * The weights and the rounding are the ones of the bit-exact resize (interpolationLinear and
+ * vlineResize in resize.cpp), so the INTER_LINEAR_EXACT, INTER_NEAREST and INTER_NEAREST_EXACT
+ * results are identical to cvtColor + resize + convertTo + subtract + multiply + split.
+ */
+
+namespace cv
+{
+
+enum { PREPROC_COEF_BITS = 8, PREPROC_COEF_ONE = 1 << PREPROC_COEF_BITS };
+
+enum { PREPROC_SRC_PACKED = 0, PREPROC_SRC_NV = 1, PREPROC_SRC_I420 = 2 };
+
+// Border positions get a single full-weight tap, which is how the bit-exact resize replicates
+// the first and the last source pixel.
+static void getLinearTab(int ssize, int dsize, int* ofs0, int* ofs1, ushort* alpha0, ushort* alpha1)
+{
+    softdouble scale = softdouble::one() / softdouble((double)dsize / ssize);
+    for (int d = 0; d < dsize; d++)
+    {
+        softdouble fval = scale*(softdouble(d) + softdouble(0.5)) - softdouble(0.5);
+        int ival = cvFloor(fval);
+        if (ival >= 0 && ival < ssize - 1)
+        {
+            int a1 = cvRound((fval - softdouble(ival))*softdouble((int)PREPROC_COEF_ONE));
+            ofs0[d] = ival;
+            ofs1[d] = ival + 1;
+            alpha0[d] = (ushort)(PREPROC_COEF_ONE - a1);
+            alpha1[d] = (ushort)a1;
+        }
+        else
+        {
+            ofs0[d] = ofs1[d] = ival < 0 ? 0 : ssize - 1;
+            alpha0[d] = (ushort)PREPROC_COEF_ONE;
+            alpha1[d] = 0;
+        }
+    }
+}
+
+// same offsets as resizeNN() and resizeNN_bitexact()
+static void getNearestTab(int ssize, int dsize, bool exact, int* ofs0, int* ofs1, ushort* alpha0, ushort* alpha1)
+{
+    double ifx = 1./((double)dsize / ssize);
+    int iifx = ((ssize << 16) + dsize / 2) / dsize;
+    int iifx0 = iifx / 2 - ssize % 2;
+    for (int d = 0; d < dsize; d++)
+    {
+        int s = exact ? (iifx * d + iifx0) >> 16 : cvFloor(d*ifx);
+        ofs0[d] = ofs1[d] = std::min(s, ssize - 1);
+        alpha0[d] = (ushort)PREPROC_COEF_ONE;
+        alpha1[d] = 0;
+    }
+}
+
+template<int cn> static void
+hresizeLine(const uchar* src, ushort* dst, int width,
+            const int* ofs0, const int* ofs1, const ushort* alpha0, const ushort* alpha1)
+{
+    for (int x = 0; x < width; x++, dst += cn)
+    {
+        const uchar* S0 = src + ofs0[x];
+        const uchar* S1 = src + ofs1[x];
+        int a0 = alpha0[x], a1 = alpha1[x];
+        for (int c = 0; c < cn; c++)
+            dst[c] = (ushort)(S0[c]*a0 + S1[c]*a1);
+    }
+}
+
+// exact: the interpolated value is rounded to 8 bits first, exactly like resize() does.
+// The scale is applied in double precision, as multiply() does for a floating-point image and a scalar.
+template<int cn, bool exact> static void
+vlineToPlanes(const ushort* src0, const ushort* src1, int beta0, int beta1, int width,
+              const float* mean, const double* scale, float* const* dst)
+{
+    int x = 0;
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+    const int VECSZ = VTraits<v_uint16>::vlanes();
+    const int HALF = VTraits<v_float32>::vlanes();
+    const v_uint32 vbeta0 = vx_setall_u32((unsigned)beta0), vbeta1 = vx_setall_u32((unsigned)beta1);
+    const v_uint32 vround = vx_setall_u32(1u << (PREPROC_COEF_BITS*2 - 1));
+    const v_float32 vnorm = vx_setall_f32(1.f / (1 << PREPROC_COEF_BITS*2));
+    v_float32 vmean[4];
+    v_float64 vscale[4];
+    for (int c = 0; c < cn; c++)
+    {
+        vmean[c] = vx_setall_f32(mean[c]);
+        vscale[c] = vx_setall_f64(scale[c]);
+    }
+    for (; x <= width - VECSZ; x += VECSZ)
+    {
+        v_uint16 a[4], b[4];
+        if (cn == 1)
+        {
+            a[0] = vx_load(src0 + x);
+            b[0] = vx_load(src1 + x);
+        }
+        else if (cn == 3)
+        {
+            v_load_deinterleave(src0 + x*3, a[0], a[1], a[2]);
+            v_load_deinterleave(src1 + x*3, b[0], b[1], b[2]);
+        }
+        else
+        {
+            v_load_deinterleave(src0 + x*4, a[0], a[1], a[2], a[3]);
+            v_load_deinterleave(src1 + x*4, b[0], b[1], b[2], b[3]);
+        }
+        for (int c = 0; c < cn; c++)
+        {
+            v_uint32 a_lo, a_hi, b_lo, b_hi;
+            v_expand(a[c], a_lo, a_hi);
+            v_expand(b[c], b_lo, b_hi);
+            v_uint32 s_lo = v_add(v_mul(a_lo, vbeta0), v_mul(b_lo, vbeta1));
+            v_uint32 s_hi = v_add(v_mul(a_hi, vbeta0), v_mul(b_hi, vbeta1));
+            v_float32 f_lo, f_hi;
+            if (exact)
+            {
+                f_lo = v_cvt_f32(v_reinterpret_as_s32(v_shr<PREPROC_COEF_BITS*2>(v_add(s_lo, vround))));
+                f_hi = v_cvt_f32(v_reinterpret_as_s32(v_shr<PREPROC_COEF_BITS*2>(v_add(s_hi, vround))));
+            }
+            else
+            {
+                f_lo = v_mul(v_cvt_f32(v_reinterpret_as_s32(s_lo)), vnorm);
+                f_hi = v_mul(v_cvt_f32(v_reinterpret_as_s32(s_hi)), vnorm);
+            }
+            f_lo = v_sub(f_lo, vmean[c]);
+            f_hi = v_sub(f_hi, vmean[c]);
+            v_store(dst[c] + x, v_cvt_f32(v_mul(v_cvt_f64(f_lo), vscale[c]), v_mul(v_cvt_f64_high(f_lo), vscale[c])));
+            v_store(dst[c] + x + HALF, v_cvt_f32(v_mul(v_cvt_f64(f_hi), vscale[c]), v_mul(v_cvt_f64_high(f_hi), vscale[c])));
+        }
+    }
+    vx_cleanup();
+#endif
+    for (; x < width; x++)
+    {
+        for (int c = 0; c < cn; c++)
+        {
+            unsigned s = src0[x*cn + c]*(unsigned)beta0 + src1[x*cn + c]*(unsigned)beta1;
+            float f = exact ? (float)((s + (1u << (PREPROC_COEF_BITS*2 - 1))) >> PREPROC_COEF_BITS*2)
+                            : (float)s * (1.f / (1 << PREPROC_COEF_BITS*2));
+            dst[c][x] = (float)((double)(f - mean[c])*scale[c]);
+        }
+    }
+}
+
+class PreprocessToBlobInvoker : public ParallelLoopBody
+{
+public:
+    PreprocessToBlobInvoker(const Mat& _src, Size _ssize, int _kind, int _dcn, bool _swapb, int _uidx,
+                            AlgorithmHint _hint, const int* _plane, bool _exact,
+                            const int* _xofs0, const int* _xofs1, const ushort* _xalpha0, const ushort* _xalpha1,
+                            const int* _yofs0, const int* _yofs1, const ushort* _yalpha0, const ushort* _yalpha1,
+                            const float* _mean, const double* _scale, Mat& _blob) :
+        ParallelLoopBody(), src(_src), ssize(_ssize), kind(_kind), dcn(_dcn), swapb(_swapb), uidx(_uidx),
+        hint(_hint), exact(_exact), xofs0(_xofs0), xofs1(_xofs1), xalpha0(_xalpha0), xalpha1(_xalpha1),
+        yofs0(_yofs0), yofs1(_yofs1), yalpha0(_yalpha0), yalpha1(_yalpha1), blob(_blob)
+    {
+        for (int c = 0; c < dcn; c++)
+        {
+            plane[c] = _plane[c];
+            mean[c] = _mean[_plane[c]];
+            scale[c] = _scale[_plane[c]];
+        }
+    }
+
+    virtual void operator() (const Range& range) const CV_OVERRIDE
+    {
+        const int width = blob.size[3];
+        const bool half = blob.depth() == CV_16F;
+
+        AutoBuffer<ushort> _lines(width*dcn*2);
+        ushort* lines[2] = { _lines.data(), _lines.data() + width*dcn };
+        int lineRow[2] = { -1, -1 };
+
+        // 4:2:0 sources are converted to BGR by row pairs, the chroma row of the three-plane
+        // layouts is interleaved first to reuse the semi-planar converter
+        Mat pairBuf, uvBuf;
+        int pairIdx = -1;
+        if (kind != PREPROC_SRC_PACKED)
+        {
+            pairBuf.create(2, ssize.width, CV_8UC3);
+            uvBuf.create(1, ssize.width/2, CV_8UC2);
+        }
+
+        AutoBuffer<float> _fbuf(half ? width*dcn : 1);
+        float* rows[4];
+
+        for (int dy = range.start; dy < range.end; dy++)
+        {
+            int sy[2] = { yofs0[dy], yofs1[dy] };
+            const ushort* h[2];
+            for (int k = 0; k < 2; k++)
+            {
+                int slot = lineRow[0] == sy[k] ? 0 : lineRow[1] == sy[k] ? 1 : -1;
+                if (slot < 0)
+                {
+                    slot = lineRow[0] == sy[1 - k] ? 1 : 0;
+                    const uchar* S;
+                    if (kind == PREPROC_SRC_PACKED)
+                        S = src.ptr(sy[k]);
+                    else
+                    {
+                        if (pairIdx != sy[k] >> 1)
+                        {
+                            pairIdx = sy[k] >> 1;
+                            convertPair(pairIdx, pairBuf, uvBuf);
+                        }
+                        S = pairBuf.ptr(sy[k] & 1);
+                    }
+                    switch (dcn)
+                    {
+                    case 1: hresizeLine<1>(S, lines[slot], width, xofs0, xofs1, xalpha0, xalpha1); break;
+                    case 3: hresizeLine<3>(S, lines[slot], width, xofs0, xofs1, xalpha0, xalpha1); break;
+                    default: hresizeLine<4>(S, lines[slot], width, xofs0, xofs1, xalpha0, xalpha1); break;
+                    }
+                    lineRow[slot] = sy[k];
+                }
+                h[k] = lines[slot];
+            }
+
+            for (int c = 0; c < dcn; c++)
+                rows[c] = half ? _fbuf.data() + c*width : blob.ptr<float>(0, plane[c], dy);
+
+            int b0 = yalpha0[dy], b1 = yalpha1[dy];
+            switch (dcn*2 + (exact ? 1 : 0))
+            {
+            case 2: vlineToPlanes<1, false>(h[0], h[1], b0, b1, width, mean, scale, rows); break;
+            case 3: vlineToPlanes<1, true >(h[0], h[1], b0, b1, width, mean, scale, rows); break;
+            case 6: vlineToPlanes<3, false>(h[0], h[1], b0, b1, width, mean, scale, rows); break;
+            case 7: vlineToPlanes<3, true >(h[0], h[1], b0, b1, width, mean, scale, rows); break;
+            case 8: vlineToPlanes<4, false>(h[0], h[1], b0, b1, width, mean, scale, rows); break;
+            default: vlineToPlanes<4, true >(h[0], h[1], b0, b1, width, mean, scale, rows); break;
+            }
+
+            if (half)
+                for (int c = 0; c < dcn; c++)
+                    hal::cvt32f16f(rows[c], blob.ptr<hfloat>(0, plane[c], dy), width);
+        }
+    }
+
+private:
+    void convertPair(int idx, Mat& pairBuf, Mat& uvBuf) const
+    {
+        const int w = ssize.width, h = ssize.height;
+        Mat ysrc = src.rowRange(idx*2, idx*2 + 2);
+        if (kind == PREPROC_SRC_NV)
+        {
+            Mat uvsrc(1, w/2, CV_8UC2, (void*)src.ptr(h + idx));
+            cvtColorTwoPlaneYUV2BGRpair(ysrc, uvsrc, pairBuf, hint, 3, swapb, uidx);
+            return;
+        }
+
+        // the chroma planes are stored as rows of w/2 bytes, two of them per image row
+        int uq = idx, vq = h/2 + idx;
+        if (uidx == 1)
+            std::swap(uq, vq);
+        const uchar* u = src.ptr(h + uq/2) + (uq % 2)*(w/2);
+        const uchar* v = src.ptr(h + vq/2) + (vq % 2)*(w/2);
+        uchar* uv = uvBuf.ptr();
+        int i = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        const int VECSZ = VTraits<v_uint8>::vlanes();
+        for (; i <= w/2 - VECSZ; i += VECSZ)
+            v_store_interleave(uv + i*2, vx_load(u + i), vx_load(v + i));
+        vx_cleanup();
+#endif
+        for (; i < w/2; i++)
+        {
+            uv[i*2] = u[i];
+            uv[i*2 + 1] = v[i];
+        }
+        cvtColorTwoPlaneYUV2BGRpair(ysrc, uvBuf, pairBuf, hint, 3, swapb, 0);
+    }
+
+    const Mat& src;
+    Size ssize;
+    int kind, dcn;
+    bool swapb;
+    int uidx;
+    AlgorithmHint hint;
+    bool exact;
+    int plane[4];
+    float mean[4];
+    double scale[4];
+    const int *xofs0, *xofs1;
+    const ushort *xalpha0, *xalpha1;
+    const int *yofs0, *yofs1;
+    const ushort *yalpha0, *yalpha1;
+    Mat& blob;
+
+    PreprocessToBlobInvoker(const PreprocessToBlobInvoker&);
+    PreprocessToBlobInvoker& operator=(const PreprocessToBlobInvoker&);
+};
+
+} // namespace cv
+
+void cv::preprocessToBlob( InputArray _src, OutputArray _blob, Size dsize, int code,
+                           const Scalar& mean, const Scalar& scale, int interpolation,
+                           int ddepth, AlgorithmHint hint )
+{
+    CV_INSTRUMENT_REGION();
+
+    CV_Assert( !_src.empty() && _src.depth() == CV_8U );
+    CV_Assert( dsize.width > 0 && dsize.height > 0 );
+    CV_Assert( ddepth == CV_32F || ddepth == CV_16F );
+
+    if (hint == ALGO_HINT_DEFAULT)
+        hint = getDefaultAlgorithmHint();
+
+    if (interpolation != INTER_NEAREST && interpolation != INTER_NEAREST_EXACT &&
+        interpolation != INTER_LINEAR && interpolation != INTER_LINEAR_EXACT)
+    {
+        // only normalization and layout are fused for the other interpolation methods
+        Mat converted, resized;
+        if (code >= 0)
+            cvtColor(_src, converted, code, 0, hint);
+        else
+            converted = _src.getMat();
+        resize(converted, resized, dsize, 0, 0, interpolation);
+        preprocessToBlob(resized, _blob, dsize, -1, mean, scale, INTER_NEAREST, ddepth, hint);
+        return;
+    }
+
+    Mat src = _src.getMat();
+    Size ssize = src.size();
+    int scn = src.channels(), dcn = scn;
+    int kind = PREPROC_SRC_PACKED;
+    bool swapb = false, permute = false;
+    int uidx = 0;
+
+    switch (code)
+    {
+    case -1:
+        CV_Assert( scn == 1 || scn == 3 || scn == 4 );
+        break;
+    case COLOR_BGR2RGB:
+        CV_Assert( scn == 3 );
+        permute = true;
+        break;
+    case COLOR_BGRA2BGR: case COLOR_BGRA2RGB:
+        CV_Assert( scn == 4 );
+        dcn = 3;
+        permute = code == COLOR_BGRA2RGB;
+        break;
+    case COLOR_YUV2BGR_NV12: case COLOR_YUV2RGB_NV12: case COLOR_YUV2BGR_NV21: case COLOR_YUV2RGB_NV21:
+    case COLOR_YUV2BGR_IYUV: case COLOR_YUV2RGB_IYUV: case COLOR_YUV2BGR_YV12: case COLOR_YUV2RGB_YV12:
+        CV_Assert( scn == 1 && ssize.width % 2 == 0 && ssize.height % 3 == 0 );
+        ssize.height = ssize.height*2/3;
+        CV_Assert( ssize.height % 2 == 0 );
+        kind = code == COLOR_YUV2BGR_NV12 || code == COLOR_YUV2RGB_NV12 ||
+               code == COLOR_YUV2BGR_NV21 || code == COLOR_YUV2RGB_NV21 ? PREPROC_SRC_NV : PREPROC_SRC_I420;
+        dcn = 3;
+        swapb = swapBlue(code);
+        uidx = uIndex(code);
+        break;
+    default:
+        {
+            // the remaining conversions are not fused, everything after them is
+            Mat converted;
+            cvtColor(src, converted, code, 0, hint);
+            preprocessToBlob(converted, _blob, dsize, -1, mean, scale, interpolation, ddepth, hint);
+            return;
+        }
+    }
+
+    int sizes[] = { 1, dcn, dsize.height, dsize.width };
+    _blob.create(4, sizes, ddepth);
+    Mat blob = _blob.getMat();
+    CV_Assert( blob.isContinuous() );
+
+    AutoBuffer<int> _ofs((dsize.width + dsize.height)*2);
+    AutoBuffer<ushort> _alpha((dsize.width + dsize.height)*2);
+    int *xofs0 = _ofs.data(), *xofs1 = xofs0 + dsize.width;
+    int *yofs0 = xofs1 + dsize.width, *yofs1 = yofs0 + dsize.height;
+    ushort *xalpha0 = _alpha.data(), *xalpha1 = xalpha0 + dsize.width;
+    ushort *yalpha0 = xalpha1 + dsize.width, *yalpha1 = yalpha0 + dsize.height;
+
+    if (interpolation == INTER_NEAREST || interpolation == INTER_NEAREST_EXACT)
+    {
+        getNearestTab(ssize.width, dsize.width, interpolation == INTER_NEAREST_EXACT, xofs0, xofs1, xalpha0, xalpha1);
+        getNearestTab(ssize.height, dsize.height, interpolation == INTER_NEAREST_EXACT, yofs0, yofs1, yalpha0, yalpha1);
+    }
+    else
+    {
+        getLinearTab(ssize.width, dsize.width, xofs0, xofs1, xalpha0, xalpha1);
+        getLinearTab(ssize.height, dsize.height, yofs0, yofs1, yalpha0, yalpha1);
+    }
+
+    // the horizontal tables index the pixels of a (converted) source row
+    int xcn = kind == PREPROC_SRC_PACKED ? scn : 3;
+    for (int x = 0; x < dsize.width; x++)
+    {
+        xofs0[x] *= xcn;
+        xofs1[x] *= xcn;
+    }
+
+    int plane[4];
+    float fmean[4];
+    double dscale[4];
+    for (int c = 0; c < 4; c++)
+    {
+        plane[c] = permute && c < 3 ? 2 - c : c;
+        fmean[c] = (float)mean[c];
+        dscale[c] = scale[c];
+    }
+
+    PreprocessToBlobInvoker invoker(src, ssize, kind, dcn, swapb, uidx, hint, plane,
+                                    interpolation != INTER_LINEAR,
+                                    xofs0, xofs1, xalpha0, xalpha1, yofs0, yofs1, yalpha0, yalpha1,
+                                    fmean, dscale, blob);
+    parallel_for_(Range(0, dsize.height), invoker, dsize.width * dsize.height / (double)(1 << 16));
+}
+
+/* End of file. */
@@ -0,0 +1,204 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+#include "precomp.hpp"
+#include "filterengine.hpp"
+
+namespace cv
+{
+
+namespace
+{
+
+class StreamingFilterImpl CV_FINAL : public StreamingFilter
+{
+public:
+    StreamingFilterImpl(int _srcType, Size _imageSize)
+        : srcType(_srcType), imageSize(_imageSize), inputRows(0), outputRows(0), started(false)
+    {
+        CV_Assert(imageSize.width > 0 && imageSize.height > 0);
+    }
+
+    void addSepFilter(int ddepth, InputArray _kernelX, InputArray _kernelY,
+                      Point anchor, double delta, int borderType) CV_OVERRIDE
+    {
+        CV_INSTRUMENT_REGION();
+
+        CV_Assert(!started); // the chain can't be changed in the middle of an image
+
+        Mat kernelX = _kernelX.getMat(), kernelY = _kernelY.getMat();
+        CV_Assert( kernelX.type() == kernelY.type() &&
+                   (kernelX.cols == 1 || kernelX.rows == 1) &&
+                   (kernelY.cols == 1 || kernelY.rows == 1) );
+
+        int stype = getDstType();
+        if( ddepth < 0 )
+            ddepth = CV_MAT_DEPTH(stype);
+        int dtype = CV_MAKETYPE(ddepth, CV_MAT_CN(stype));
+
+        // the stage outlives the call, so it gets its own copy of the kernels
+        Mat kx = kernelX.clone().reshape(1, 1), ky = kernelY.clone().reshape(1, 1);
+
+        addStage(createSeparableLinearFilter(stype, dtype, kx, ky, anchor, delta,
+                                             borderType & ~BORDER_ISOLATED));
+    }
+
+    void addMorphology(int op, InputArray _kernel, Point anchor, int iterations,
+                       int borderType, const Scalar& borderValue) CV_OVERRIDE
+    {
+        CV_INSTRUMENT_REGION();
+
+        CV_Assert(!started); // the chain can't be changed in the middle of an image
+
+        if( op == MORPH_OPEN || op == MORPH_CLOSE )
+        {
+            addMorphology(op == MORPH_OPEN ? MORPH_ERODE : MORPH_DILATE, _kernel, anchor, iterations, borderType, borderValue);
+            addMorphology(op == MORPH_OPEN ? MORPH_DILATE : MORPH_ERODE, _kernel, anchor, iterations, borderType, borderValue);
+            return;
+        }
+        CV_Assert(op == MORPH_ERODE || op == MORPH_DILATE);
+
+        // the kernel is adjusted the same way as in erode() and dilate()
+        Mat kernel = _kernel.getMat();
+        Size ksize = !kernel.empty() ? kernel.size() : Size(3,3);
+        anchor = normalizeAnchor(anchor, ksize);
+
+        if( iterations == 0 || kernel.rows*kernel.cols == 1 )
+            return;
+
+        if( kernel.empty() )
+        {
+            kernel = getStructuringElement(MORPH_RECT, Size(1+iterations*2,1+iterations*2));
+            anchor = Point(iterations, iterations);
+            iterations = 1;
+        }
+        else if( iterations > 1 && countNonZero(kernel) == kernel.rows*kernel.cols )
+        {
+            anchor = Point(anchor.x*iterations, anchor.y*iterations);
+            kernel = getStructuringElement(MORPH_RECT,
+                                           Size(ksize.width + (iterations-1)*(ksize.width-1),
+                                                ksize.height + (iterations-1)*(ksize.height-1)),
+                                           anchor);
+            iterations = 1;
+        }
+
+        int type = getDstType();
+        borderType &= ~BORDER_ISOLATED;
+        for( int i = 0; i < iterations; i++ )
+            addStage(createMorphologyFilter(op, type, kernel, anchor, borderType, borderType, borderValue));
+    }
+
+    int process(InputArray _band, OutputArray _dst) CV_OVERRIDE
+    {
+        CV_INSTRUMENT_REGION();
+
+        Mat band = _band.getMat();
+        CV_CheckTypeEQ(band.type(), srcType, "");
+        CV_CheckEQ(band.cols, imageSize.width, "the band must span the whole image width");
+        CV_CheckLE(band.rows, getRemainingInputRows(), "the band goes beyond the image bottom");
+
+        if( !started )
+            start();
+
+        if( band.rows == 0 )
+        {
+            _dst.create(0, imageSize.width, getDstType());
+            return 0;
+        }
+        inputRows += band.rows;
+
+        if( stages.empty() )
+        {
+            band.copyTo(_dst);
+            outputRows += band.rows;
+            return band.rows;
+        }
+
+        // push the band through all stages; the rows produced by a stage are
+        // consumed by the next one right away, while they are still in cache
+        const uchar* src = band.ptr();
+        size_t srcstep = band.step;
+        int count = band.rows;
+        for( size_t k = 0; k < stages.size() && count > 0; k++ )
+        {
+            Stage& s = stages[k];
+            // a stage emits at most its input plus the rows it was holding back
+            int maxRows = count + s.engine->ksize.height;
+            if( s.buf.rows < maxRows )
+                s.buf.create(maxRows, imageSize.width, s.engine->dstType);
+            count = s.engine->proceed(src, (int)srcstep, count, s.buf.ptr(), (int)s.buf.step);
+            src = s.buf.ptr();
+            srcstep = s.buf.step;
+        }
+
+        _dst.create(count, imageSize.width, getDstType());
+        if( count > 0 )
+        {
+            stages.back().buf.rowRange(0, count).copyTo(_dst);
+            outputRows += count;
+        }
+        return count;
+    }
+
+    void reset() CV_OVERRIDE
+    {
+        inputRows = outputRows = 0;
+        started = false;
+    }
+
+    int getRemainingInputRows() const CV_OVERRIDE
+    {
+        return imageSize.height - inputRows;
+    }
+
+    int getRemainingOutputRows() const CV_OVERRIDE
+    {
+        return imageSize.height - outputRows;
+    }
+
+    int getDstType() const CV_OVERRIDE
+    {
+        return stages.empty() ? srcType : stages.back().engine->dstType;
+    }
+
+protected:
+    struct Stage
+    {
+        Ptr<FilterEngine> engine;
+        Mat buf;
+    };
+
+    void addStage(const Ptr<FilterEngine>& engine)
+    {
+        CV_Assert(engine);
+        Stage s;
+        s.engine = engine;
+        stages.push_back(s);
+    }
+
+    void start()
+    {
+        // every stage sees the whole image, so the top and bottom borders are
+        // extrapolated from its own input rows exactly as in a one-shot call
+        for( size_t k = 0; k < stages.size(); k++ )
+            stages[k].engine->start(imageSize, imageSize, Point());
+        started = true;
+    }
+
+    int srcType;
+    Size imageSize;
+    int inputRows;
+    int outputRows;
+    bool started;
+    std::vector<Stage> stages;
+};
+
+} // namespace
+
+Ptr<StreamingFilter> createStreamingFilter(int srcType, Size imageSize)
+{
+    return makePtr<StreamingFilterImpl>(srcType, imageSize);
+}
+
+} // namespace cv
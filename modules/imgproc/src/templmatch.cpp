@@ -41,6 +41,7 @@
 
 #include "precomp.hpp"
 #include "opencl_kernels_imgproc.hpp"
+#include "opencv2/core/hal/intrin.hpp"
 
 ////////////////////////////////////////////////// matchTemplate //////////////////////////////////////////////////////////
 
@@ -563,73 +564,86 @@ static bool ocl_matchTemplate( InputArray _img, InputArray _templ, OutputArray _
 
 #include "opencv2/core/hal/hal.hpp"
 
-void crossCorr( const Mat& img, const Mat& _templ, Mat& corr,
-                Point anchor, double delta, int borderType )
+// Cross-correlation via DFT, block by block. The template spectrum depends only on the block size,
+// so the plan is computed once per template and result size and can be reused for many images.
+struct CrossCorrPlan
 {
-    const double blockScale = 4.5;
-    const int minBlockSize = 256;
-    std::vector<uchar> buf;
-
-    Mat templ = _templ;
-    int depth = img.depth(), cn = img.channels();
-    int tdepth = templ.depth(), tcn = templ.channels();
-    int cdepth = corr.depth(), ccn = corr.channels();
+    CrossCorrPlan() : depth(-1), cn(0), cdepth(-1), tcn(0), maxDepth(-1) {}
 
-    CV_Assert( img.dims <= 2 && templ.dims <= 2 && corr.dims <= 2 );
-
-    if( depth != tdepth && tdepth != std::max(CV_32F, depth) )
+    void create( const Mat& _templ, Size corrSize, int _depth, int _cn, int _cdepth );
+    bool isCompatible( Size templSize, Size corrSize, int _depth, int _cn, int _cdepth ) const
     {
-        _templ.convertTo(templ, std::max(CV_32F, depth));
-        tdepth = templ.depth();
+        return templSize == templ_size && corrSize == corr_size && _depth == depth &&
+               _cn == cn && _cdepth == cdepth;
     }
+    // computes correlation of the blocks of the image in parallel
+    void apply( const Mat& img, Mat& corr, Point anchor, double delta, int borderType ) const;
 
-    CV_Assert( depth == tdepth || tdepth == CV_32F);
-    CV_Assert( corr.rows <= img.rows + templ.rows - 1 &&
-               corr.cols <= img.cols + templ.cols - 1 );
-
-    CV_Assert( ccn == 1 || delta == 0 );
-
-    int maxDepth = depth > CV_8S ? CV_64F : std::max(std::max(CV_32F, tdepth), cdepth);
+    Size templ_size, corr_size;
+    int depth, cn, cdepth, tcn;
+    int maxDepth;
     Size blocksize, dftsize;
+    Mat dftTempl; // spectra of the template planes, one under another
+};
+
+static void getCrossCorrBlockSize( Size templSize, Size corrSize, Size& blocksize, Size& dftsize )
+{
+    const double blockScale = 4.5;
+    const int minBlockSize = 256;
 
-    blocksize.width = cvRound(templ.cols*blockScale);
-    blocksize.width = std::max( blocksize.width, minBlockSize - templ.cols + 1 );
-    blocksize.width = std::min( blocksize.width, corr.cols );
-    blocksize.height = cvRound(templ.rows*blockScale);
-    blocksize.height = std::max( blocksize.height, minBlockSize - templ.rows + 1 );
-    blocksize.height = std::min( blocksize.height, corr.rows );
+    blocksize.width = cvRound(templSize.width*blockScale);
+    blocksize.width = std::max( blocksize.width, minBlockSize - templSize.width + 1 );
+    blocksize.width = std::min( blocksize.width, corrSize.width );
+    blocksize.height = cvRound(templSize.height*blockScale);
+    blocksize.height = std::max( blocksize.height, minBlockSize - templSize.height + 1 );
+    blocksize.height = std::min( blocksize.height, corrSize.height );
 
-    dftsize.width = std::max(getOptimalDFTSize(blocksize.width + templ.cols - 1), 2);
-    dftsize.height = getOptimalDFTSize(blocksize.height + templ.rows - 1);
+    dftsize.width = std::max(getOptimalDFTSize(blocksize.width + templSize.width - 1), 2);
+    dftsize.height = getOptimalDFTSize(blocksize.height + templSize.height - 1);
     if( dftsize.width <= 0 || dftsize.height <= 0 )
         CV_Error( cv::Error::StsOutOfRange, "the input arrays are too big" );
 
     // recompute block size
-    blocksize.width = dftsize.width - templ.cols + 1;
-    blocksize.width = MIN( blocksize.width, corr.cols );
-    blocksize.height = dftsize.height - templ.rows + 1;
-    blocksize.height = MIN( blocksize.height, corr.rows );
+    blocksize.width = dftsize.width - templSize.width + 1;
+    blocksize.width = MIN( blocksize.width, corrSize.width );
+    blocksize.height = dftsize.height - templSize.height + 1;
+    blocksize.height = MIN( blocksize.height, corrSize.height );
+}
 
-    Mat dftTempl( dftsize.height*tcn, dftsize.width, maxDepth );
-    Mat dftImg( dftsize, maxDepth );
+void CrossCorrPlan::create( const Mat& _templ, Size corrSize, int _depth, int _cn, int _cdepth )
+{
+    std::vector<uchar> buf;
 
-    int i, k, bufSize = 0;
-    if( tcn > 1 && tdepth != maxDepth )
-        bufSize = templ.cols*templ.rows*CV_ELEM_SIZE(tdepth);
+    Mat templ = _templ;
+    int tdepth = templ.depth();
+    tcn = templ.channels();
 
-    if( cn > 1 && depth != maxDepth )
-        bufSize = std::max( bufSize, (blocksize.width + templ.cols - 1)*
-            (blocksize.height + templ.rows - 1)*CV_ELEM_SIZE(depth));
+    if( _depth != tdepth && tdepth != std::max(CV_32F, _depth) )
+    {
+        _templ.convertTo(templ, std::max(CV_32F, _depth));
+        tdepth = templ.depth();
+    }
 
-    if( (ccn > 1 || cn > 1) && cdepth != maxDepth )
-        bufSize = std::max( bufSize, blocksize.width*blocksize.height*CV_ELEM_SIZE(cdepth));
+    CV_Assert( _depth == tdepth || tdepth == CV_32F);
 
-    buf.resize(bufSize);
+    templ_size = templ.size();
+    corr_size = corrSize;
+    depth = _depth;
+    cn = _cn;
+    cdepth = _cdepth;
+    maxDepth = depth > CV_8S ? CV_64F : std::max(std::max(CV_32F, tdepth), cdepth);
+
+    getCrossCorrBlockSize(templ_size, corrSize, blocksize, dftsize);
+
+    dftTempl.create( dftsize.height*tcn, dftsize.width, maxDepth );
+
+    if( tcn > 1 && tdepth != maxDepth )
+        buf.resize(templ.cols*templ.rows*CV_ELEM_SIZE(tdepth));
 
     Ptr<hal::DFT2D> c = hal::DFT2D::create(dftsize.width, dftsize.height, dftTempl.depth(), 1, 1, CV_HAL_DFT_IS_INPLACE, templ.rows);
 
     // compute DFT of each template plane
-    for( k = 0; k < tcn; k++ )
+    for( int k = 0; k < tcn; k++ )
     {
         int yofs = k*dftsize.height;
         Mat src = templ;
@@ -653,6 +667,26 @@ void crossCorr( const Mat& img, const Mat& _templ, Mat& corr,
         }
         c->apply(dst.data, (int)dst.step, dst.data, (int)dst.step);
     }
+}
+
+void CrossCorrPlan::apply( const Mat& img, Mat& corr, Point anchor, double delta, int borderType ) const
+{
+    int ccn = corr.channels();
+
+    CV_Assert( img.dims <= 2 && corr.dims <= 2 );
+    CV_Assert( isCompatible(templ_size, corr.size(), img.depth(), img.channels(), corr.depth()) );
+    CV_Assert( corr.rows <= img.rows + templ_size.height - 1 &&
+               corr.cols <= img.cols + templ_size.width - 1 );
+
+    CV_Assert( ccn == 1 || delta == 0 );
+
+    int bufSize = 0;
+    if( cn > 1 && depth != maxDepth )
+        bufSize = std::max( bufSize, (blocksize.width + templ_size.width - 1)*
+            (blocksize.height + templ_size.height - 1)*CV_ELEM_SIZE(depth));
+
+    if( (ccn > 1 || cn > 1) && cdepth != maxDepth )
+        bufSize = std::max( bufSize, blocksize.width*blocksize.height*CV_ELEM_SIZE(cdepth));
 
     int tileCountX = (corr.cols + blocksize.width - 1)/blocksize.width;
     int tileCountY = (corr.rows + blocksize.height - 1)/blocksize.height;
@@ -670,93 +704,109 @@ void crossCorr( const Mat& img, const Mat& _templ, Mat& corr,
     }
     borderType |= BORDER_ISOLATED;
 
-    Ptr<hal::DFT2D> cF, cR;
-    int f = CV_HAL_DFT_IS_INPLACE;
-    int f_inv = f | CV_HAL_DFT_INVERSE | CV_HAL_DFT_SCALE;
-    cF = hal::DFT2D::create(dftsize.width, dftsize.height, maxDepth, 1, 1, f, blocksize.height + templ.rows - 1);
-    cR = hal::DFT2D::create(dftsize.width, dftsize.height, maxDepth, 1, 1, f_inv, blocksize.height);
-
-    // calculate correlation by blocks
-    for( i = 0; i < tileCount; i++ )
+    // calculate correlation by blocks; the blocks are independent, every stripe has its own buffers
+    parallel_for_(Range(0, tileCount), [&](const Range& range)
     {
-        int x = (i%tileCountX)*blocksize.width;
-        int y = (i/tileCountX)*blocksize.height;
-
-        Size bsz(std::min(blocksize.width, corr.cols - x),
-                 std::min(blocksize.height, corr.rows - y));
-        Size dsz(bsz.width + templ.cols - 1, bsz.height + templ.rows - 1);
-        int x0 = x - anchor.x + roiofs.x, y0 = y - anchor.y + roiofs.y;
-        int x1 = std::max(0, x0), y1 = std::max(0, y0);
-        int x2 = std::min(img0.cols, x0 + dsz.width);
-        int y2 = std::min(img0.rows, y0 + dsz.height);
-        Mat src0(img0, Range(y1, y2), Range(x1, x2));
-        Mat dst(dftImg, Rect(0, 0, dsz.width, dsz.height));
-        Mat dst1(dftImg, Rect(x1-x0, y1-y0, x2-x1, y2-y1));
-        Mat cdst(corr, Rect(x, y, bsz.width, bsz.height));
-
-        for( k = 0; k < cn; k++ )
-        {
-            Mat src = src0;
-            dftImg = Scalar::all(0);
+        std::vector<uchar> buf(bufSize);
+        Mat dftImg( dftsize, maxDepth );
+
+        Ptr<hal::DFT2D> cF, cR;
+        int f = CV_HAL_DFT_IS_INPLACE;
+        int f_inv = f | CV_HAL_DFT_INVERSE | CV_HAL_DFT_SCALE;
+        cF = hal::DFT2D::create(dftsize.width, dftsize.height, maxDepth, 1, 1, f, blocksize.height + templ_size.height - 1);
+        cR = hal::DFT2D::create(dftsize.width, dftsize.height, maxDepth, 1, 1, f_inv, blocksize.height);
 
-            if( cn > 1 )
+        for( int i = range.start; i < range.end; i++ )
+        {
+            int x = (i%tileCountX)*blocksize.width;
+            int y = (i/tileCountX)*blocksize.height;
+
+            Size bsz(std::min(blocksize.width, corr.cols - x),
+                     std::min(blocksize.height, corr.rows - y));
+            Size dsz(bsz.width + templ_size.width - 1, bsz.height + templ_size.height - 1);
+            int x0 = x - anchor.x + roiofs.x, y0 = y - anchor.y + roiofs.y;
+            int x1 = std::max(0, x0), y1 = std::max(0, y0);
+            int x2 = std::min(img0.cols, x0 + dsz.width);
+            int y2 = std::min(img0.rows, y0 + dsz.height);
+            Mat src0(img0, Range(y1, y2), Range(x1, x2));
+            Mat dst(dftImg, Rect(0, 0, dsz.width, dsz.height));
+            Mat dst1(dftImg, Rect(x1-x0, y1-y0, x2-x1, y2-y1));
+            Mat cdst(corr, Rect(x, y, bsz.width, bsz.height));
+
+            for( int k = 0; k < cn; k++ )
             {
-                src = depth == maxDepth ? dst1 : Mat(y2-y1, x2-x1, depth, &buf[0]);
-                int pairs[] = {k, 0};
-                mixChannels(&src0, 1, &src, 1, pairs, 1);
-            }
+                Mat src = src0;
+                dftImg = Scalar::all(0);
 
-            if( dst1.data != src.data )
-                src.convertTo(dst1, dst1.depth());
+                if( cn > 1 )
+                {
+                    src = depth == maxDepth ? dst1 : Mat(y2-y1, x2-x1, depth, &buf[0]);
+                    int pairs[] = {k, 0};
+                    mixChannels(&src0, 1, &src, 1, pairs, 1);
+                }
 
-            if( x2 - x1 < dsz.width || y2 - y1 < dsz.height )
-                copyMakeBorder(dst1, dst, y1-y0, dst.rows-dst1.rows-(y1-y0),
-                               x1-x0, dst.cols-dst1.cols-(x1-x0), borderType);
+                if( dst1.data != src.data )
+                    src.convertTo(dst1, dst1.depth());
 
-            if (bsz.height == blocksize.height)
-                cF->apply(dftImg.data, (int)dftImg.step, dftImg.data, (int)dftImg.step);
-            else
-                dft( dftImg, dftImg, 0, dsz.height );
+                if( x2 - x1 < dsz.width || y2 - y1 < dsz.height )
+                    copyMakeBorder(dst1, dst, y1-y0, dst.rows-dst1.rows-(y1-y0),
+                                   x1-x0, dst.cols-dst1.cols-(x1-x0), borderType);
 
-            Mat dftTempl1(dftTempl, Rect(0, tcn > 1 ? k*dftsize.height : 0,
-                                         dftsize.width, dftsize.height));
-            mulSpectrums(dftImg, dftTempl1, dftImg, 0, true);
+                if (bsz.height == blocksize.height)
+                    cF->apply(dftImg.data, (int)dftImg.step, dftImg.data, (int)dftImg.step);
+                else
+                    dft( dftImg, dftImg, 0, dsz.height );
 
-            if (bsz.height == blocksize.height)
-                cR->apply(dftImg.data, (int)dftImg.step, dftImg.data, (int)dftImg.step);
-            else
-                dft( dftImg, dftImg, DFT_INVERSE + DFT_SCALE, bsz.height );
+                Mat dftTempl1(dftTempl, Rect(0, tcn > 1 ? k*dftsize.height : 0,
+                                             dftsize.width, dftsize.height));
+                mulSpectrums(dftImg, dftTempl1, dftImg, 0, true);
+
+                if (bsz.height == blocksize.height)
+                    cR->apply(dftImg.data, (int)dftImg.step, dftImg.data, (int)dftImg.step);
+                else
+                    dft( dftImg, dftImg, DFT_INVERSE + DFT_SCALE, bsz.height );
 
-            src = dftImg(Rect(0, 0, bsz.width, bsz.height));
+                src = dftImg(Rect(0, 0, bsz.width, bsz.height));
 
-            if( ccn > 1 )
-            {
-                if( cdepth != maxDepth )
+                if( ccn > 1 )
                 {
-                    Mat plane(bsz, cdepth, &buf[0]);
-                    src.convertTo(plane, cdepth, 1, delta);
-                    src = plane;
+                    if( cdepth != maxDepth )
+                    {
+                        Mat plane(bsz, cdepth, &buf[0]);
+                        src.convertTo(plane, cdepth, 1, delta);
+                        src = plane;
+                    }
+                    int pairs[] = {0, k};
+                    mixChannels(&src, 1, &cdst, 1, pairs, 1);
                 }
-                int pairs[] = {0, k};
-                mixChannels(&src, 1, &cdst, 1, pairs, 1);
-            }
-            else
-            {
-                if( k == 0 )
-                    src.convertTo(cdst, cdepth, 1, delta);
                 else
                 {
-                    if( maxDepth != cdepth )
+                    if( k == 0 )
+                        src.convertTo(cdst, cdepth, 1, delta);
+                    else
                     {
-                        Mat plane(bsz, cdepth, &buf[0]);
-                        src.convertTo(plane, cdepth);
-                        src = plane;
+                        if( maxDepth != cdepth )
+                        {
+                            Mat plane(bsz, cdepth, &buf[0]);
+                            src.convertTo(plane, cdepth);
+                            src = plane;
+                        }
+                        add(src, cdst, cdst);
                     }
-                    add(src, cdst, cdst);
                 }
             }
         }
-    }
+    }, std::min((double)tileCount, (double)getNumThreads()*2));
+}
+
+void crossCorr( const Mat& img, const Mat& templ, Mat& corr,
+                Point anchor, double delta, int borderType )
+{
+    CV_Assert( img.dims <= 2 && templ.dims <= 2 && corr.dims <= 2 );
+
+    CrossCorrPlan plan;
+    plan.create(templ, corr.size(), img.depth(), img.channels(), corr.depth());
+    plan.apply(img, corr, anchor, delta, borderType);
 }
 
 static void matchTemplateMask( InputArray _img, InputArray _templ, OutputArray _result, int method, InputArray _mask )
@@ -903,7 +953,23 @@ static void matchTemplateMask( InputArray _img, InputArray _templ, OutputArray _
     }
 }
 
-static void common_matchTemplate( Mat& img, Mat& templ, Mat& result, int method, int cn )
+// statistics of the template used by the normalization
+struct TemplateStats
+{
+    TemplateStats() {}
+    TemplateStats( const Mat& templ, int method )
+    {
+        if( method == cv::TM_CCOEFF )
+            templMean = mean(templ);
+        else if( method != cv::TM_CCORR )
+            meanStdDev( templ, templMean, templSdv );
+    }
+
+    Scalar templMean, templSdv;
+};
+
+static void common_matchTemplate( const Mat& img, Size templSize, const TemplateStats& stats,
+                                  Mat& result, int method, int cn )
 {
     if( method == cv::TM_CCORR )
         return;
@@ -914,22 +980,20 @@ static void common_matchTemplate( Mat& img, Mat& templ, Mat& result, int method,
                     method == cv::TM_SQDIFF_NORMED ||
                     method == cv::TM_CCOEFF_NORMED;
 
-    double invArea = 1./((double)templ.rows * templ.cols);
+    double invArea = 1./((double)templSize.height * templSize.width);
 
     Mat sum, sqsum;
-    Scalar templMean, templSdv;
+    Scalar templMean = stats.templMean, templSdv = stats.templSdv;
     double *q0 = 0, *q1 = 0, *q2 = 0, *q3 = 0;
     double templNorm = 0, templSum2 = 0;
 
     if( method == cv::TM_CCOEFF )
     {
         integral(img, sum, CV_64F);
-        templMean = mean(templ);
     }
     else
     {
         integral(img, sum, sqsum, CV_64F);
-        meanStdDev( templ, templMean, templSdv );
 
         templNorm = templSdv[0]*templSdv[0] + templSdv[1]*templSdv[1] + templSdv[2]*templSdv[2] + templSdv[3]*templSdv[3];
 
@@ -953,79 +1017,87 @@ static void common_matchTemplate( Mat& img, Mat& templ, Mat& result, int method,
 
         CV_Assert(sqsum.data != NULL);
         q0 = (double*)sqsum.data;
-        q1 = q0 + templ.cols*cn;
-        q2 = (double*)(sqsum.data + templ.rows*sqsum.step);
-        q3 = q2 + templ.cols*cn;
+        q1 = q0 + templSize.width*cn;
+        q2 = (double*)(sqsum.data + templSize.height*sqsum.step);
+        q3 = q2 + templSize.width*cn;
     }
 
     CV_Assert(sum.data != NULL);
     double* p0 = (double*)sum.data;
-    double* p1 = p0 + templ.cols*cn;
-    double* p2 = (double*)(sum.data + templ.rows*sum.step);
-    double* p3 = p2 + templ.cols*cn;
+    double* p1 = p0 + templSize.width*cn;
+    double* p2 = (double*)(sum.data + templSize.height*sum.step);
+    double* p3 = p2 + templSize.width*cn;
 
     int sumstep = sum.data ? (int)(sum.step / sizeof(double)) : 0;
     int sqstep = sqsum.data ? (int)(sqsum.step / sizeof(double)) : 0;
 
-    int i, j, k;
-
-    for( i = 0; i < result.rows; i++ )
+    parallel_for_(Range(0, result.rows), [&](const Range& range)
     {
-        float* rrow = result.ptr<float>(i);
-        int idx = i * sumstep;
-        int idx2 = i * sqstep;
+        int i, j, k;
 
-        for( j = 0; j < result.cols; j++, idx += cn, idx2 += cn )
+        for( i = range.start; i < range.end; i++ )
         {
-            double num = rrow[j], t;
-            double wndMean2 = 0, wndSum2 = 0;
+            float* rrow = result.ptr<float>(i);
+            int idx = i * sumstep;
+            int idx2 = i * sqstep;
 
-            if( numType == 1 )
+            for( j = 0; j < result.cols; j++, idx += cn, idx2 += cn )
             {
-                for( k = 0; k < cn; k++ )
+                double num = rrow[j], t;
+                double wndMean2 = 0, wndSum2 = 0;
+
+                if( numType == 1 )
                 {
-                    t = p0[idx+k] - p1[idx+k] - p2[idx+k] + p3[idx+k];
-                    wndMean2 += t*t;
-                    num -= t*templMean[k];
-                }
+                    for( k = 0; k < cn; k++ )
+                    {
+                        t = p0[idx+k] - p1[idx+k] - p2[idx+k] + p3[idx+k];
+                        wndMean2 += t*t;
+                        num -= t*templMean[k];
+                    }
 
-                wndMean2 *= invArea;
-            }
+                    wndMean2 *= invArea;
+                }
 
-            if( isNormed || numType == 2 )
-            {
-                for( k = 0; k < cn; k++ )
+                if( isNormed || numType == 2 )
                 {
-                    t = q0[idx2+k] - q1[idx2+k] - q2[idx2+k] + q3[idx2+k];
-                    wndSum2 += t;
+                    for( k = 0; k < cn; k++ )
+                    {
+                        t = q0[idx2+k] - q1[idx2+k] - q2[idx2+k] + q3[idx2+k];
+                        wndSum2 += t;
+                    }
+
+                    if( numType == 2 )
+                    {
+                        num = wndSum2 - 2*num + templSum2;
+                        num = MAX(num, 0.);
+                    }
                 }
 
-                if( numType == 2 )
+                if( isNormed )
                 {
-                    num = wndSum2 - 2*num + templSum2;
-                    num = MAX(num, 0.);
+                    double diff2 = MAX(wndSum2 - wndMean2, 0);
+                    if (diff2 <= std::min(0.5, 10 * FLT_EPSILON * wndSum2))
+                        t = 0; // avoid rounding errors
+                    else
+                        t = std::sqrt(diff2)*templNorm;
+
+                    if( fabs(num) < t )
+                        num /= t;
+                    else if( fabs(num) < t*1.125 )
+                        num = num > 0 ? 1 : -1;
+                    else
+                        num = method != cv::TM_SQDIFF_NORMED ? 0 : 1;
                 }
-            }
-
-            if( isNormed )
-            {
-                double diff2 = MAX(wndSum2 - wndMean2, 0);
-                if (diff2 <= std::min(0.5, 10 * FLT_EPSILON * wndSum2))
-                    t = 0; // avoid rounding errors
-                else
-                    t = std::sqrt(diff2)*templNorm;
 
-                if( fabs(num) < t )
-                    num /= t;
-                else if( fabs(num) < t*1.125 )
-                    num = num > 0 ? 1 : -1;
-                else
-                    num = method != cv::TM_SQDIFF_NORMED ? 0 : 1;
+                rrow[j] = (float)num;
             }
-
-            rrow[j] = (float)num;
         }
-    }
+    }, (double)result.total()/(1 << 16));
+}
+
+static void common_matchTemplate( Mat& img, Mat& templ, Mat& result, int method, int cn )
+{
+    common_matchTemplate(img, templ.size(), TemplateStats(templ, method), result, method, cn);
 }
 }
 
@@ -1193,6 +1265,179 @@ void cv::matchTemplate( InputArray _img, InputArray _templ, OutputArray _result,
     common_matchTemplate(img, templ, result, method, cn);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cv
+{
+
+// adds the correlation of the image row 'src' and the template row 't' to 'acc'
+static void correlateRow_32f( const float* src, const float* t, int tw, float* acc, int width )
+{
+    int tx = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int VECSZ = VTraits<v_float32>::vlanes();
+    for( ; tx <= tw - 4; tx += 4 )
+    {
+        v_float32 w0 = vx_setall_f32(t[tx]), w1 = vx_setall_f32(t[tx + 1]);
+        v_float32 w2 = vx_setall_f32(t[tx + 2]), w3 = vx_setall_f32(t[tx + 3]);
+        const float* s = src + tx;
+        int x = 0;
+        for( ; x <= width - VECSZ; x += VECSZ )
+        {
+            v_float32 a = vx_load(acc + x);
+            a = v_fma(vx_load(s + x), w0, a);
+            a = v_fma(vx_load(s + x + 1), w1, a);
+            a = v_fma(vx_load(s + x + 2), w2, a);
+            a = v_fma(vx_load(s + x + 3), w3, a);
+            v_store(acc + x, a);
+        }
+        for( ; x < width; x++ )
+            acc[x] += s[x]*t[tx] + s[x + 1]*t[tx + 1] + s[x + 2]*t[tx + 2] + s[x + 3]*t[tx + 3];
+    }
+#endif
+    for( ; tx < tw; tx++ )
+    {
+        const float w = t[tx];
+        const float* s = src + tx;
+        for( int x = 0; x < width; x++ )
+            acc[x] += s[x]*w;
+    }
+}
+
+// Direct cross-correlation of single-channel 32F planes, the results for all the planes are summed up.
+static void directCrossCorr( const std::vector<Mat>& planes, const std::vector<Mat>& templPlanes, Mat& corr )
+{
+    const Size tsz = templPlanes[0].size();
+    parallel_for_(Range(0, corr.rows), [&](const Range& range)
+    {
+        for( int y = range.start; y < range.end; y++ )
+        {
+            float* acc = corr.ptr<float>(y);
+            memset(acc, 0, corr.cols*sizeof(acc[0]));
+            for( size_t k = 0; k < planes.size(); k++ )
+                for( int ty = 0; ty < tsz.height; ty++ )
+                    correlateRow_32f(planes[k].ptr<float>(y + ty), templPlanes[k].ptr<float>(ty),
+                                     tsz.width, acc, corr.cols);
+        }
+    }, (double)corr.total()*tsz.area()*planes.size()/(1 << 20));
+}
+
+static void splitPlanes_32f( const Mat& src, std::vector<Mat>& planes )
+{
+    if( src.channels() == 1 )
+    {
+        planes.resize(1);
+        if( src.depth() == CV_32F )
+            planes[0] = src;
+        else
+            src.convertTo(planes[0], CV_32F);
+        return;
+    }
+    Mat src32f;
+    src.convertTo(src32f, CV_32F);
+    split(src32f, planes);
+}
+
+// Relative costs of the direct and DFT-based correlation measured on x86-64: a multiply-add of the
+// direct correlation, a butterfly of the DFT (per element of the block and per log2 of the block
+// size, forward and inverse) and the rest of the per-element work of a block (conversion, border,
+// spectrum multiplication). With them the DFT wins for templates larger than about 14x14.
+static const double DIRECT_CORR_MAC_COST = 1.;
+static const double DFT_CORR_BUTTERFLY_COST = 4.;
+static const double DFT_CORR_ELEM_COST = 8.;
+
+static bool useDirectCrossCorr( Size templSize, Size corrSize )
+{
+    Size blocksize, dftsize;
+    getCrossCorrBlockSize(templSize, corrSize, blocksize, dftsize);
+    double tiles = (double)((corrSize.width + blocksize.width - 1)/blocksize.width)*
+                           ((corrSize.height + blocksize.height - 1)/blocksize.height);
+    double dftArea = (double)dftsize.area();
+    double directCost = (double)corrSize.area()*templSize.area()*DIRECT_CORR_MAC_COST;
+    double dftCost = tiles*dftArea*(2*std::log2(dftArea)*DFT_CORR_BUTTERFLY_COST + DFT_CORR_ELEM_COST);
+    return directCost < dftCost;
+}
+
+class TemplateMatcherImpl CV_FINAL : public TemplateMatcher
+{
+public:
+    TemplateMatcherImpl( InputArray _templ, int _method ) : method(_method), useDirect(false)
+    {
+        int type = _templ.type(), depth = CV_MAT_DEPTH(type);
+        CV_Assert( cv::TM_SQDIFF <= method && method <= cv::TM_CCOEFF_NORMED );
+        CV_Assert( (depth == CV_8U || depth == CV_32F) && _templ.dims() <= 2 && !_templ.empty() );
+
+        templ = _templ.getMat().clone();
+        stats = TemplateStats(templ, method);
+    }
+
+    void match( InputArray _img, OutputArray _result ) CV_OVERRIDE
+    {
+        CV_INSTRUMENT_REGION();
+
+        int cn = templ.channels();
+        CV_Assert( _img.type() == templ.type() && _img.dims() <= 2 );
+
+        Mat img = _img.getMat();
+        CV_Assert( img.rows >= templ.rows && img.cols >= templ.cols );
+
+        Size corrSize(img.cols - templ.cols + 1, img.rows - templ.rows + 1);
+        _result.create(corrSize, CV_32F);
+        Mat result = _result.getMat();
+
+        if( corrSize != lastCorrSize )
+        {
+            collectGarbage();
+            lastCorrSize = corrSize;
+            useDirect = useDirectCrossCorr(templ.size(), corrSize);
+        }
+
+        if( useDirect )
+        {
+            if( templPlanes.empty() )
+                splitPlanes_32f(templ, templPlanes);
+            splitPlanes_32f(img, planes);
+            directCrossCorr(planes, templPlanes, result);
+        }
+        else
+        {
+            if( !plan.isCompatible(templ.size(), corrSize, img.depth(), cn, CV_32F) )
+                plan.create(templ, corrSize, img.depth(), cn, CV_32F);
+            plan.apply(img, result, Point(0, 0), 0, 0);
+        }
+
+        common_matchTemplate(img, templ.size(), stats, result, method, cn);
+    }
+
+    int getMethod() const CV_OVERRIDE { return method; }
+    Size getTemplateSize() const CV_OVERRIDE { return templ.size(); }
+
+    void collectGarbage() CV_OVERRIDE
+    {
+        plan = CrossCorrPlan();
+        lastCorrSize = Size();
+        planes.clear();
+    }
+
+private:
+    Mat templ;
+    int method;
+    TemplateStats stats;
+
+    Size lastCorrSize;
+    bool useDirect;
+    CrossCorrPlan plan;
+    std::vector<Mat> templPlanes;
+    std::vector<Mat> planes;
+};
+
+Ptr<TemplateMatcher> createTemplateMatcher( InputArray templ, int method )
+{
+    return makePtr<TemplateMatcherImpl>(templ, method);
+}
+
+}
+
 CV_IMPL void
 cvMatchTemplate( const CvArr* _img, const CvArr* _templ, CvArr* _result, int method )
 {
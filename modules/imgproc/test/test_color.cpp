@@ -3228,6 +3228,85 @@ TEST(ImgProc_RGB2Lab, NaN_21111)
 #endif
 }
 
+// double precision RGB -> Lab/Luv used as the reference for the approximate float paths
+static Vec3d refRGB2LabLuv(const Vec3f& rgb, bool srgb, bool isLab)
+{
+    double c[3];
+    for (int k = 0; k < 3; k++)
+    {
+        double x = std::min(std::max((double)rgb[k], 0.), 1.);
+        c[k] = srgb ? (x <= 0.04045 ? x/12.92 : std::pow((x + 0.055)/1.055, 2.4)) : x;
+    }
+    double xyz[3];
+    for (int k = 0; k < 3; k++)
+        xyz[k] = c[0]*(double)RGB2XYZ[k*3] + c[1]*(double)RGB2XYZ[k*3+1] + c[2]*(double)RGB2XYZ[k*3+2];
+
+    const double lthresh = 216./24389., yscale = 24389./27.;
+    double Y = xyz[1], L = Y > lthresh ? 116.*std::cbrt(Y) - 16. : yscale*Y;
+    if (isLab)
+    {
+        double f[3], w[3] = { (double)Xn, 1., (double)Zn };
+        for (int k = 0; k < 3; k++)
+        {
+            double t = xyz[k]/w[k];
+            f[k] = t > lthresh ? std::cbrt(t) : (yscale*t + 16.)/116.;
+        }
+        return Vec3d(L, 500.*(f[0] - f[1]), 200.*(f[1] - f[2]));
+    }
+    double d = xyz[0] + 15.*xyz[1] + 3.*xyz[2];
+    double dn = (double)Xn + 15. + 3.*(double)Zn;
+    if (d == 0)
+        return Vec3d(L, 0., 0.);
+    return Vec3d(L, 13.*L*(4.*xyz[0]/d - 4.*(double)Xn/dn), 13.*L*(9.*Y/d - 9./dn));
+}
+
+TEST(Imgproc_ColorLabLuv_Approx, accuracy)
+{
+    const int fwdCodes[] = { COLOR_RGB2Lab, COLOR_BGR2Lab, COLOR_LRGB2Lab, COLOR_LBGR2Lab,
+                             COLOR_RGB2Luv, COLOR_BGR2Luv, COLOR_LRGB2Luv, COLOR_LBGR2Luv };
+    const int invCodes[] = { COLOR_Lab2RGB, COLOR_Lab2BGR, COLOR_Lab2LRGB, COLOR_Lab2LBGR,
+                             COLOR_Luv2RGB, COLOR_Luv2BGR, COLOR_Luv2LRGB, COLOR_Luv2LBGR };
+
+    // odd width to cover the scalar tail
+    Mat3f rgb(67, 131);
+    theRNG().fill(rgb, RNG::UNIFORM, Scalar::all(0), Scalar::all(1));
+    // the gray axis and the dark end, where Lab switches to the linear segment
+    for (int x = 0; x < rgb.cols; x++)
+        rgb(0, x) = Vec3f::all(x*(1.f/(rgb.cols - 1)));
+    for (int x = 0; x < rgb.cols; x++)
+        rgb(1, x) = Vec3f::all(x*(0.01f/(rgb.cols - 1)));
+
+    for (size_t c = 0; c < sizeof(fwdCodes)/sizeof(fwdCodes[0]); c++)
+    {
+        bool isBGR = c % 2 == 1, srgb = c % 4 < 2, isLab = c < 4;
+
+        Mat3f ref(rgb.size());
+        for (int y = 0; y < rgb.rows; y++)
+            for (int x = 0; x < rgb.cols; x++)
+                ref(y, x) = refRGB2LabLuv(rgb(y, x), srgb, isLab);
+
+        for (int cn = 3; cn <= 4; cn++)
+        {
+            SCOPED_TRACE(cv::format("code=%d cn=%d", fwdCodes[c], cn));
+
+            Mat src = rgb.clone();
+            if (isBGR)
+                cvtColor(src, src, COLOR_RGB2BGR);
+            if (cn == 4)
+                cvtColor(src, src, COLOR_BGR2BGRA);
+
+            Mat dst;
+            cvtColor(src, dst, fwdCodes[c], 0, ALGO_HINT_APPROX);
+            EXPECT_LE(cvtest::norm(ref, dst, NORM_INF), 1e-3);
+
+            Mat back;
+            cvtColor(ref, back, invCodes[c], cn, ALGO_HINT_APPROX);
+            // Luv -> RGB is ill-conditioned next to black, the accurate path has the same error there
+            EXPECT_LE(cvtest::norm(src, back, NORM_INF), isLab ? 1e-4 : 3e-3);
+        }
+    }
+}
+
 // See https://github.com/opencv/opencv/issues/25971
 // If num of channels is not suitable for selected cv::ColorConversionCodes,
 // e.code must be cv::Error::BadNumChannels.
@@ -400,6 +400,50 @@ TEST_P(Imgproc_FindContours_Modes1, deep)
     }
 }
 
+// Objects in horizontal strips separated by background rows, the image is scanned by bands in parallel
+//
+TEST_P(Imgproc_FindContours_Modes1, parallel_bands)
+{
+    const int mode = get<0>(GetParam());
+    const int method = get<1>(GetParam());
+
+    RNG& rng = TS::ptr()->get_rng();
+    const Size sz(rng.uniform(700, 1000), 1200);
+    const int STRIP = 150;
+    Mat img(sz, mode == RETR_FLOODFILL ? CV_32SC1 : CV_8UC1, Scalar::all(0));
+    for (int y = 0; y < sz.height; y += STRIP)
+    {
+        // a strip touching the next one leaves no background row between them
+        const int strip_h = rng.uniform(0, 4) == 0 ? STRIP + 1 : STRIP - 10;
+        Mat strip = img(Rect(0, y, sz.width, std::min(strip_h, sz.height - y)));
+        for (int i = 0; i < 20; ++i)
+        {
+            const Point center(rng.uniform(0, strip.cols), rng.uniform(0, strip.rows));
+            const Size axes(rng.uniform(5, 60), rng.uniform(5, 60));
+            ellipse(strip, center, axes, rng.uniform(0, 180), 0, 360, Scalar::all(rng.uniform(1, 4)), FILLED);
+            ellipse(strip, center, axes / 2, 0, 0, 360, Scalar::all(0), FILLED);
+            ellipse(strip, center, axes / 4, 0, 0, 360, Scalar::all(1), FILLED);
+        }
+    }
+
+    const int nthreads = getNumThreads();
+    vector<Mat> contours_s, contours_p;
+    vector<Vec4i> hierarchy_s, hierarchy_p;
+    setNumThreads(1);
+    findContours(img, contours_s, hierarchy_s, mode, method, Point(3, 5));
+    setNumThreads(4);
+    findContours(img, contours_p, hierarchy_p, mode, method, Point(3, 5));
+    setNumThreads(nthreads);
+
+    ASSERT_EQ(contours_s.size(), contours_p.size());
+    for (size_t i = 0; i < contours_s.size(); ++i)
+    {
+        SCOPED_TRACE(format("contour %zu", i));
+        EXPECT_MAT_NEAR(contours_s[i], contours_p[i], 0);
+    }
+    EXPECT_MAT_NEAR(Mat(hierarchy_s), Mat(hierarchy_p), 0);
+}
+
 INSTANTIATE_TEST_CASE_P(
     ,
     Imgproc_FindContours_Modes1,
@@ -2291,6 +2291,55 @@ TEST(Imgproc_MedianBlur, hires_regression_13409)
     ASSERT_EQ(0.0, cvtest::norm(dst_hires(Rect(516, 516, 1016, 1016)), dst_ref(Rect(4, 4, 1016, 1016)), NORM_INF));
 }
 
+TEST(Imgproc_MedianBlur, large_aperture_16u_16s_32f)
+{
+    RNG& rng = theRNG();
+    const int types[] = { CV_16UC1, CV_16UC3, CV_16SC1, CV_32FC1, CV_32FC4 };
+    const int ksizes[] = { 7, 15, 31 };
+    for (size_t t = 0; t < sizeof(types)/sizeof(types[0]); t++)
+    for (size_t k = 0; k < sizeof(ksizes)/sizeof(ksizes[0]); k++)
+    {
+        int type = types[t], ksize = ksizes[k], r = ksize/2, cn = CV_MAT_CN(type);
+        int depth = CV_MAT_DEPTH(type);
+        Mat src(rng.uniform(1, 150), rng.uniform(1, 300), type);
+        if (depth == CV_32F)
+            randu(src, -1000, 1000);
+        else if (depth == CV_16S)
+            randu(src, -600, 600); // many equal values of both signs
+        else
+            randu(src, 0, 600); // many equal values
+        if (depth != CV_32F)
+        {
+            // areas at the limits of the type
+            double minVal = depth == CV_16S ? SHRT_MIN : 0, maxVal = depth == CV_16S ? SHRT_MAX : USHRT_MAX;
+            src(Rect(0, 0, (src.cols + 1)/2, (src.rows + 1)/2)).setTo(Scalar::all(minVal));
+            src(Rect(src.cols/2, src.rows/2, src.cols - src.cols/2, src.rows - src.rows/2)).setTo(Scalar::all(maxVal));
+        }
+
+        Mat dst;
+        medianBlur(src, dst, ksize);
+
+        Mat padded, ref(src.size(), type);
+        cv::copyMakeBorder(src, padded, r, r, r, r, BORDER_REPLICATE);
+        Mat padded64f, ref64f(src.size(), CV_MAKETYPE(CV_64F, cn));
+        padded.convertTo(padded64f, CV_64F);
+        std::vector<double> window(ksize*ksize);
+        for (int y = 0; y < src.rows; y++)
+            for (int x = 0; x < src.cols; x++)
+                for (int c = 0; c < cn; c++)
+                {
+                    for (int i = 0; i < ksize; i++)
+                        for (int j = 0; j < ksize; j++)
+                            window[i*ksize + j] = padded64f.ptr<double>(y + i)[(x + j)*cn + c];
+                    std::nth_element(window.begin(), window.begin() + window.size()/2, window.end());
+                    ref64f.ptr<double>(y)[x*cn + c] = window[window.size()/2];
+                }
+        ref64f.convertTo(ref, type);
+
+        EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF)) << "type=" << typeToString(type) << " ksize=" << ksize;
+    }
+}
+
 TEST(Imgproc_Sobel, s16_regression_13506)
 {
     Mat src = (Mat_<short>(8, 16) << 127, 138, 130, 102, 118,  97,  76,  84, 124,  90, 146,  63, 130,  87, 212,  85,
@@ -2551,4 +2600,51 @@ INSTANTIATE_TEST_CASE_P(/**/, Imgproc_sepFilter2D_types,
     testing::Values(CV_16S, CV_32F, CV_64F),
 );
 
+typedef testing::TestWithParam<int> Imgproc_StreamingFilter;
+TEST_P(Imgproc_StreamingFilter, chain_matches_whole_image)
+{
+    const int bandHeight = GetParam();
+    RNG& rng = theRNG();
+    Mat src(123, 97, CV_8UC3);
+    rng.fill(src, RNG::UNIFORM, 0, 256);
+
+    Mat kx = getGaussianKernel(7, 1.5, CV_32F), ky = getGaussianKernel(5, 1.1, CV_32F);
+    Mat ellipse = getStructuringElement(MORPH_ELLIPSE, Size(5, 5));
+    Mat rect = getStructuringElement(MORPH_RECT, Size(3, 3));
+
+    Mat tmp0, tmp1, gt;
+    cv::sepFilter2D(src, tmp0, CV_32F, kx, ky, Point(-1,-1), 1, BORDER_REFLECT_101);
+    cv::erode(tmp0, tmp1, ellipse);
+    cv::morphologyEx(tmp1, gt, MORPH_CLOSE, rect, Point(-1,-1), 2, BORDER_REPLICATE);
+
+    Ptr<StreamingFilter> f = createStreamingFilter(src.type(), src.size());
+    f->addSepFilter(CV_32F, kx, ky, Point(-1,-1), 1, BORDER_REFLECT_101);
+    f->addMorphology(MORPH_ERODE, ellipse);
+    f->addMorphology(MORPH_CLOSE, rect, Point(-1,-1), 2, BORDER_REPLICATE);
+    ASSERT_EQ(CV_32FC3, f->getDstType());
+
+    // the second pass checks that reset() lets the chain be reused
+    for (int pass = 0; pass < 2; pass++)
+    {
+        std::vector<Mat> out;
+        for (int y = 0; y < src.rows; y += bandHeight)
+        {
+            Mat dstBand;
+            int n = f->process(src.rowRange(y, std::min(y + bandHeight, src.rows)), dstBand);
+            ASSERT_EQ(n, dstBand.rows);
+            if (n > 0)
+                out.push_back(dstBand);
+        }
+        EXPECT_EQ(0, f->getRemainingInputRows());
+        EXPECT_EQ(0, f->getRemainingOutputRows());
+
+        Mat dst;
+        vconcat(out, dst);
+        EXPECT_MAT_NEAR(gt, dst, 0);
+        f->reset();
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Imgproc_StreamingFilter, testing::Values(1, 7, 32, 200));
+
 }} // namespace
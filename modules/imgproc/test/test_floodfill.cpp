@@ -541,5 +541,85 @@ TEST(Imgproc_FloodFill, maskValue)
     ASSERT_EQ(1, cvtest::norm(mask.rowRange(1, n-1).colRange(1, n-1), NORM_INF));
 }
 
+TEST(Imgproc_FloodFill, gradient_runs)
+{
+    // slow ramps are filled by the floating range across whole rows, a step stops the fill
+    Mat img(40, 200, CV_8UC1);
+    for (int y = 0; y < img.rows; y++)
+        for (int x = 0; x < img.cols; x++)
+            img.at<uchar>(y, x) = saturate_cast<uchar>((x + y) / 3 + (x >= 150 ? 20 : 0));
+
+    for (int connectivity = 4; connectivity <= 8; connectivity += 4)
+    {
+        Mat dst = img.clone();
+        Rect rect;
+        int area = floodFill(dst, Point(100, 20), Scalar(255), &rect, Scalar(1), Scalar(1), connectivity);
+        EXPECT_EQ(150 * img.rows, area);
+        EXPECT_EQ(Rect(0, 0, 150, img.rows), rect);
+        EXPECT_EQ(0, cvtest::norm(dst.colRange(150, img.cols), img.colRange(150, img.cols), NORM_INF));
+    }
+}
+
+TEST(Imgproc_FloodFill, multiSeed_parallel)
+{
+    RNG& rng = theRNG();
+    const int types[] = { CV_8UC1, CV_8UC3, CV_32SC1, CV_32FC1 };
+    for (int iter = 0; iter < 40; iter++)
+    {
+        int type = types[iter % 4];
+        Size sz(rng.uniform(20, 300), rng.uniform(20, 200));
+        Mat blocks(sz.height/8 + 1, sz.width/8 + 1, type), noise(sz, type), img;
+        randu(blocks, 0, 6);
+        randu(noise, 0, 3);
+        resize(blocks, img, sz, 0, 0, INTER_NEAREST);
+        img += noise;
+
+        Mat mask0(sz.height + 2, sz.width + 2, CV_8U);
+        randu(mask0, 0, 40);
+        mask0 = (mask0 > 36) & 1;
+
+        std::vector<Point> seeds;
+        for (int i = 0; i < 5; i++)
+            seeds.push_back(Point(rng.uniform(0, sz.width), rng.uniform(0, sz.height)));
+        // seeds of the same value share the labeling of the parallel fill
+        for (int i = 0; i < 1000 && seeds.size() < 10; i++)
+        {
+            Point pt(rng.uniform(0, sz.width), rng.uniform(0, sz.height));
+            if (memcmp(img.ptr(pt.y, pt.x), img.ptr(seeds[0].y, seeds[0].x), img.elemSize()) == 0)
+                seeds.push_back(pt);
+        }
+        int flags = (iter % 2 ? 8 : 4) | (255 << 8) | ((iter / 2) % 2 ? FLOODFILL_FIXED_RANGE : 0) |
+                    ((iter / 4) % 2 ? FLOODFILL_MASK_ONLY : 0);
+        Scalar newVal(9, 8, 7), loDiff = Scalar::all(1), upDiff = Scalar::all(2);
+
+        // reference: the single seed scanline fill called for every seed in turn
+        Mat refImg = img.clone(), refMask = mask0.clone();
+        std::vector<Rect> refRects;
+        std::vector<int> refAreas;
+        int refTotal = 0;
+        for (size_t i = 0; i < seeds.size(); i++)
+        {
+            Rect r;
+            refAreas.push_back(floodFill(refImg, refMask, seeds[i], newVal, &r, loDiff, upDiff, flags));
+            refRects.push_back(r);
+            refTotal += refAreas.back();
+        }
+
+        for (int parallel = 0; parallel < 2; parallel++)
+        {
+            Mat dstImg = img.clone(), dstMask = mask0.clone();
+            std::vector<Rect> rects;
+            std::vector<int> areas;
+            int total = floodFill(dstImg, dstMask, seeds, newVal, &rects, &areas, loDiff, upDiff,
+                                  flags | (parallel ? FLOODFILL_PARALLEL : 0));
+            EXPECT_EQ(refTotal, total);
+            EXPECT_EQ(refAreas, areas);
+            EXPECT_EQ(refRects, rects);
+            EXPECT_EQ(0, cvtest::norm(refImg, dstImg, NORM_INF));
+            EXPECT_EQ(0, cvtest::norm(refMask, dstMask, NORM_INF));
+        }
+    }
+}
+
 }} // namespace
 /* End of file. */
@@ -2095,5 +2095,88 @@ INSTANTIATE_TEST_CASE_P(Imgproc_Hist, Imgproc_Equalize_Hist, ::testing::Combine(
                         ::testing::Values(cv::Size(123, 321), cv::Size(256, 256), cv::Size(1024, 768)),
                         ::testing::Range(0, 10)));
 
+TEST(Imgproc_TemporalCLAHE, matches_CLAHE)
+{
+    const int types[] = { CV_8UC1, CV_16UC1 };
+    for (int t = 0; t < 2; t++)
+    for (int s = 0; s < 2; s++)
+    {
+        const int type = types[t];
+        Size size = s == 0 ? Size(320, 240) : Size(333, 211);
+        Mat frame(size, type);
+        randu(frame, 0, type == CV_8UC1 ? 256 : 4096);
+        GaussianBlur(frame, frame, Size(9, 9), 3);
+
+        Ptr<CLAHE> clahe = createCLAHE(3.0, Size(8, 8));
+        // no threshold and no blending: every changed tile is updated right away
+        Ptr<TemporalCLAHE> temporal = createTemporalCLAHE(3.0, Size(8, 8), 0.0, 1.0);
+        for (int i = 0; i < 5; i++)
+        {
+            Mat src = frame.clone();
+            if (i % 2)
+            {
+                Mat r = src(Rect(10*i, 20, 100, 60));
+                r += Scalar(7*i);
+            }
+            if (i == 4)
+            {
+                Mat noise(size, type);
+                randu(noise, 0, 3);
+                src += noise;
+            }
+
+            Mat ref, dst;
+            clahe->apply(src, ref);
+            temporal->apply(src, dst);
+            EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF)) << "type=" << type << " frame=" << i;
+
+            // same content as the previous frame: nothing is rebuilt, the output is kept
+            Mat dst2;
+            temporal->apply(src, dst2);
+            EXPECT_EQ(0, temporal->getUpdatedTiles());
+            EXPECT_EQ(0, cvtest::norm(ref, dst2, NORM_INF)) << "type=" << type << " frame=" << i;
+        }
+    }
+}
+
+TEST(Imgproc_TemporalCLAHE, threshold_and_blend)
+{
+    Mat frame(256, 256, CV_8UC1);
+    randu(frame, 0, 256);
+    GaussianBlur(frame, frame, Size(9, 9), 3);
+
+    Ptr<TemporalCLAHE> temporal = createTemporalCLAHE(2.0, Size(4, 4), 2.0, 0.5);
+    Mat dst0, dst;
+    temporal->apply(frame, dst0);
+    EXPECT_EQ(16, temporal->getUpdatedTiles());
+
+    // small noise stays below the threshold, the LUTs are kept
+    Mat noise(frame.size(), CV_8UC1), noisy;
+    randu(noise, 0, 2);
+    cv::add(frame, noise, noisy);
+    temporal->apply(noisy, dst);
+    EXPECT_EQ(0, temporal->getUpdatedTiles());
+
+    // a large change in one tile updates it, the output moves toward the new LUT gradually
+    Mat changed = frame.clone();
+    changed(Rect(0, 0, 64, 64)).setTo(Scalar(200));
+    Mat target;
+    createCLAHE(2.0, Size(4, 4))->apply(changed, target);
+    temporal->apply(changed, dst);
+    EXPECT_EQ(1, temporal->getUpdatedTiles());
+    double err1 = cvtest::norm(dst(Rect(0, 0, 32, 32)), target(Rect(0, 0, 32, 32)), NORM_INF);
+    EXPECT_GT(err1, 0);
+    for (int i = 0; i < 20; i++)
+        temporal->apply(changed, dst);
+    EXPECT_EQ(0, temporal->getUpdatedTiles());
+    EXPECT_LE(cvtest::norm(dst, target, NORM_INF), 1);
+
+    Mat hist;
+    temporal->getTileHistograms(hist);
+    ASSERT_EQ(16, hist.rows);
+    ASSERT_EQ(256, hist.cols);
+    EXPECT_EQ(64*64, hist.at<int>(0, 200));
+}
+
 }} // namespace
 /* End Of File */
@@ -315,6 +315,30 @@ TEST_P(HoughCirclesTest, ManySmallCircles)
     EXPECT_EQ(circles.size(), circles4f.size());
 }
 
+TEST(HoughCirclesAlt, threads)
+{
+    // the accumulator rows are split between the threads, the votes must not depend on it
+    Mat src(480, 640, CV_8UC1, Scalar(30));
+    RNG rng(3);
+    for( int k = 0; k < 20; k++ )
+        circle(src, Point(rng.uniform(60, 580), rng.uniform(60, 420)), rng.uniform(8, 60),
+               Scalar(rng.uniform(100, 256)), 3);
+    GaussianBlur(src, src, Size(5, 5), 1.5);
+
+    const int nthreads = getNumThreads();
+    std::vector<Vec4f> circles, circles1;
+    setNumThreads(std::max(nthreads, 4));
+    HoughCircles(src, circles, HOUGH_GRADIENT_ALT, 1.5, 10, 300, 0.8, 5, 0);
+    setNumThreads(1);
+    HoughCircles(src, circles1, HOUGH_GRADIENT_ALT, 1.5, 10, 300, 0.8, 5, 0);
+    setNumThreads(nthreads);
+
+    EXPECT_GT(circles.size(), 10u);
+    ASSERT_EQ(circles.size(), circles1.size());
+    for( size_t i = 0; i < circles.size(); i++ )
+        EXPECT_EQ(circles[i], circles1[i]);
+}
+
 INSTANTIATE_TEST_CASE_P(HoughGradient, HoughCirclesTest, testing::Values(HOUGH_GRADIENT));
 INSTANTIATE_TEST_CASE_P(HoughGradientAlt, HoughCirclesTest, testing::Values(HOUGH_GRADIENT_ALT));
 
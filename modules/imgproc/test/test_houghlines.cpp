@@ -340,6 +340,75 @@ TEST(HoughLines, regression_21983)
     EXPECT_NEAR(lines[0][1], 1.57179642, 1e-4);
 }
 
+TEST(HoughLines, threads)
+{
+    Mat img(480, 640, CV_8UC1, Scalar(0));
+    RNG rng(2);
+    for( int k = 0; k < 20; k++ )
+        line(img, Point(rng.uniform(0, img.cols), rng.uniform(0, img.rows)),
+             Point(rng.uniform(0, img.cols), rng.uniform(0, img.rows)), Scalar(255));
+    for( int k = 0; k < 1000; k++ )
+        img.at<uchar>(rng.uniform(0, img.rows), rng.uniform(0, img.cols)) = 255;
+
+    const int nthreads = getNumThreads();
+    std::vector<Vec3f> lines, lines1;
+    setNumThreads(std::max(nthreads, 4));
+    HoughLines(img, lines, 1, CV_PI/180, 80);
+    setNumThreads(1);
+    HoughLines(img, lines1, 1, CV_PI/180, 80);
+    setNumThreads(nthreads);
+
+    EXPECT_GE(lines.size(), 20u);
+    ASSERT_EQ(lines.size(), lines1.size());
+    for( size_t i = 0; i < lines.size(); i++ )
+        EXPECT_EQ(lines[i], lines1[i]);
+}
+
+TEST(HoughLinesP, seed_and_stripes)
+{
+    const Point gt[][2] = { { Point(60, 10), Point(60, 470) }, { Point(120, 20), Point(300, 460) },
+                            { Point(350, 10), Point(420, 470) }, { Point(450, 30), Point(630, 300) },
+                            { Point(440, 470), Point(630, 330) } };
+    const int ngt = (int)(sizeof(gt)/sizeof(gt[0]));
+    Mat img(480, 640, CV_8UC1, Scalar(0));
+    for( int k = 0; k < ngt; k++ )
+        line(img, gt[k][0], gt[k][1], Scalar(255), 3);
+    RNG rng(1);
+    for( int k = 0; k < 500; k++ )
+        img.at<uchar>(rng.uniform(0, img.rows), rng.uniform(0, img.cols)) = 255;
+
+    const int nthreads = getNumThreads();
+    for( int stripes = 1; stripes <= 8; stripes *= 2 )
+    {
+        std::vector<Vec4i> lines, lines1;
+        HoughLinesP(img, lines, 1, CV_PI/180, 40, 50, 5, 12345, stripes);
+        setNumThreads(1);
+        HoughLinesP(img, lines1, 1, CV_PI/180, 40, 50, 5, 12345, stripes);
+        setNumThreads(nthreads);
+
+        // the result does not depend on the number of threads
+        ASSERT_EQ(lines.size(), lines1.size()) << "stripes=" << stripes;
+        for( size_t i = 0; i < lines.size(); i++ )
+            EXPECT_EQ(lines[i], lines1[i]) << "stripes=" << stripes;
+
+        // the lines are not broken at the stripe borders
+        for( int k = 0; k < ngt; k++ )
+        {
+            Point2f d = gt[k][1] - gt[k][0];
+            double len = std::sqrt(d.dot(d)), coverage = 0;
+            for( size_t i = 0; i < lines.size(); i++ )
+            {
+                Point p0(lines[i][0], lines[i][1]), p1(lines[i][2], lines[i][3]);
+                double dev0 = std::abs(d.x*(p0.y - gt[k][0].y) - d.y*(p0.x - gt[k][0].x)) / len;
+                double dev1 = std::abs(d.x*(p1.y - gt[k][0].y) - d.y*(p1.x - gt[k][0].x)) / len;
+                if( dev0 <= 3 && dev1 <= 3 )
+                    coverage = std::max(coverage, cv::norm(p1 - p0) / len);
+            }
+            EXPECT_GT(coverage, 0.8) << "stripes=" << stripes << " line=" << k;
+        }
+    }
+}
+
 INSTANTIATE_TEST_CASE_P( ImgProc, StandartHoughLinesTest, testing::Combine(testing::Values( "shared/pic5.png", "../stitching/a1.png" ),
                                                                            testing::Values( 1, 10 ),
                                                                            testing::Values( 0.05, 0.1 ),
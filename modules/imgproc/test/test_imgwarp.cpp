@@ -1760,5 +1760,75 @@ TEST(Imgproc_Remap, issue_23562)
     }
 }
 
+TEST(Imgproc_WarpPlan, accuracy)
+{
+    RNG& rng = theRNG();
+    const int types[] = { CV_8UC1, CV_8UC3, CV_32FC1 };
+    const int inters[] = { INTER_NEAREST, INTER_LINEAR, INTER_CUBIC };
+    const int borders[] = { BORDER_CONSTANT, BORDER_REPLICATE, BORDER_TRANSPARENT };
+    for (int perspective = 0; perspective < 2; perspective++)
+    for (int t = 0; t < 3; t++)
+    for (int i = 0; i < 3; i++)
+    for (int b = 0; b < 3; b++)
+    {
+        Size ssize(rng.uniform(16, 300), rng.uniform(16, 200));
+        Size dsize(rng.uniform(16, 400), rng.uniform(16, 200));
+        Mat src(ssize, types[t]);
+        randu(src, 0, 255);
+
+        Mat M;
+        if (perspective)
+        {
+            Point2f from[] = { Point2f(0, 0), Point2f((float)ssize.width, 0),
+                               Point2f((float)ssize.width, (float)ssize.height), Point2f(0, (float)ssize.height) };
+            Point2f to[4];
+            for (int k = 0; k < 4; k++)
+                to[k] = Point2f(from[k].x*1.2f + rng.uniform(-40.f, 40.f), from[k].y*1.1f + rng.uniform(-40.f, 40.f));
+            M = getPerspectiveTransform(from, to);
+        }
+        else
+            M = getRotationMatrix2D(Point2f(ssize.width*0.5f, ssize.height*0.5f), rng.uniform(-180., 180.), rng.uniform(0.5, 2.));
+
+        Scalar borderValue(17, 33, 65);
+        Mat ref(dsize, src.type(), Scalar::all(5)), dst = ref.clone();
+        Ptr<WarpPlan> plan;
+        if (perspective)
+        {
+            warpPerspective(src, ref, M, dsize, inters[i], borders[b], borderValue);
+            plan = createWarpPerspectivePlan(M, ssize, dsize, inters[i]);
+        }
+        else
+        {
+            warpAffine(src, ref, M, dsize, inters[i], borders[b], borderValue);
+            plan = createWarpAffinePlan(M, ssize, dsize, inters[i]);
+        }
+        plan->apply(src, dst, borders[b], borderValue);
+        EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF))
+            << "perspective=" << perspective << " type=" << types[t] << " inter=" << inters[i] << " border=" << borders[b];
+    }
+}
+
+TEST(Imgproc_WarpPlan, skipOutside)
+{
+    Mat src(64, 64, CV_8UC1);
+    randu(src, 0, 255);
+    Size dsize(640, 480);
+    Mat M = (Mat_<double>(2, 3) << 1, 0, 300, 0, 1, 200);
+    Mat ref;
+    warpAffine(src, ref, M, dsize, INTER_LINEAR, BORDER_CONSTANT, Scalar(0));
+
+    Ptr<WarpPlan> plan = createWarpAffinePlan(M, src.size(), dsize, INTER_LINEAR);
+    plan->setSkipOutside(true);
+    EXPECT_TRUE(plan->getSkipOutside());
+    Mat dst(dsize, CV_8UC1, Scalar(7));
+    plan->apply(src, dst, BORDER_CONSTANT, Scalar(0));
+
+    // the only differences are the border pixels of the skipped tiles
+    Mat differs = dst != ref, skipped = (dst == 7) & (ref == 0);
+    EXPECT_GT(countNonZero(differs), 0);
+    EXPECT_EQ(0, countNonZero(differs & ~skipped));
+    EXPECT_EQ(0, cvtest::norm(ref(Rect(300, 200, 64, 64)), dst(Rect(300, 200, 64, 64)), NORM_INF));
+}
+
 }} // namespace
 /* End of file. */
@@ -240,4 +240,75 @@ TEST(Resize_Bitexact, Nearest8U)
     }
 }
 
+static Mat preprocessToBlobReference(const Mat& src, Size dsize, int code, const Scalar& mean,
+                                     const Scalar& scale, int interpolation, int ddepth)
+{
+    Mat converted, resized, tmp;
+    if (code >= 0)
+        cvtColor(src, converted, code);
+    else
+        converted = src;
+    resize(converted, resized, dsize, 0, 0, interpolation);
+    resized.convertTo(tmp, CV_32F);
+    cv::subtract(tmp, mean, tmp);
+    cv::multiply(tmp, scale, tmp);
+
+    std::vector<Mat> planes;
+    split(tmp, planes);
+    int sizes[] = { 1, (int)planes.size(), dsize.height, dsize.width };
+    Mat blob(4, sizes, ddepth);
+    for (int c = 0; c < (int)planes.size(); c++)
+    {
+        Mat plane(dsize, ddepth, blob.ptr(0, c));
+        planes[c].convertTo(plane, ddepth);
+    }
+    return blob;
+}
+
+TEST(Resize_Bitexact, preprocessToBlob)
+{
+    const int codes[] = { -1, COLOR_BGR2RGB, COLOR_BGRA2RGB, COLOR_YUV2BGR_NV12, COLOR_YUV2RGB_NV21,
+                          COLOR_YUV2BGR_I420, COLOR_YUV2RGB_YV12, COLOR_BGR2GRAY };
+    const int interpolations[] = { INTER_LINEAR_EXACT, INTER_NEAREST, INTER_NEAREST_EXACT, INTER_AREA };
+    const Size ssizes[] = { Size(640, 480), Size(38, 22), Size(2, 2) };
+    const Size dsizes[] = { Size(224, 224), Size(320, 240), Size(13, 7) };
+    const Scalar mean(104, 117, 123), scale(0.017, 0.018, 0.019);
+    RNG& rng = theRNG();
+
+    for (int code : codes)
+    {
+        bool yuv = code >= COLOR_YUV2RGB_NV12 && code <= COLOR_YUV2BGR_IYUV;
+        int cn = yuv ? 1 : code == COLOR_BGRA2RGB ? 4 : 3;
+        for (const Size& ssize : ssizes)
+        {
+            Mat src(yuv ? Size(ssize.width, ssize.height*3/2) : ssize, CV_8UC(cn));
+            rng.fill(src, RNG::UNIFORM, 0, 256);
+            for (int interpolation : interpolations)
+            for (const Size& dsize : dsizes)
+            for (int ddepth : { CV_32F, CV_16F })
+            {
+                SCOPED_TRACE(cv::format("code=%d interpolation=%d %dx%d -> %dx%d ddepth=%d", code, interpolation,
+                                        ssize.width, ssize.height, dsize.width, dsize.height, ddepth));
+                Mat ref = preprocessToBlobReference(src, dsize, code, mean, scale, interpolation, ddepth);
+                Mat blob;
+                preprocessToBlob(src, blob, dsize, code, mean, scale, interpolation, ddepth);
+                ASSERT_EQ(4, blob.dims);
+                ASSERT_TRUE(ref.size == blob.size);
+                ASSERT_EQ(ref.type(), blob.type());
+                EXPECT_EQ(0, cvtest::norm(ref.reshape(1, 1), blob.reshape(1, 1), NORM_INF));
+            }
+        }
+    }
+}
+
+TEST(Resize_Bitexact, preprocessToBlob_linear)
+{
+    Mat src(480, 640, CV_8UC3);
+    theRNG().fill(src, RNG::UNIFORM, 0, 256);
+    Mat ref = preprocessToBlobReference(src, Size(224, 224), COLOR_BGR2RGB, Scalar(), Scalar::all(1.0), INTER_LINEAR, CV_32F);
+    Mat blob;
+    preprocessToBlob(src, blob, Size(224, 224), COLOR_BGR2RGB, Scalar(), Scalar::all(1.0), INTER_LINEAR);
+    EXPECT_LE(cvtest::norm(ref.reshape(1, 1), blob.reshape(1, 1), NORM_INF), 1.5);
+}
+
 }} // namespace
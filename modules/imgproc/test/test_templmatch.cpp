@@ -334,6 +334,42 @@ TEST_P(matchTemplate_Modes, accuracy)
     }
 }
 
+TEST_P(matchTemplate_Modes, matcher)
+{
+    const int data_type = CV_MAKE_TYPE(get<0>(GetParam()), get<1>(GetParam()));
+    const int method = get<2>(GetParam());
+    RNG & rng = TS::ptr()->get_rng();
+
+    for (int ITER = 0; ITER < 10; ++ITER)
+    {
+        SCOPED_TRACE(cv::format("iteration %d", ITER));
+
+        // both the direct and the DFT-based correlation are used depending on the template size
+        const Size templSize(rng.uniform(1, 60), rng.uniform(1, 60));
+        Mat templ(templSize, data_type, Scalar::all(0));
+        cvtest::randUni(rng, templ, Scalar::all(0), Scalar::all(255));
+        Ptr<TemplateMatcher> matcher = createTemplateMatcher(templ, method);
+        EXPECT_EQ(method, matcher->getMethod());
+        EXPECT_EQ(templSize, matcher->getTemplateSize());
+
+        // the data computed for the previous image are reused or recomputed for a new size
+        for (int k = 0; k < 3; ++k)
+        {
+            const Size imgSize = k < 2 ? Size(256, 200) : Size(rng.uniform(128, 320), rng.uniform(128, 240));
+            Mat img(imgSize, data_type, Scalar::all(0));
+            cvtest::randUni(rng, img, Scalar::all(0), Scalar::all(255));
+
+            Mat result;
+            matcher->match(img, result);
+
+            Mat reference;
+            matchTemplate_reference(img, templ, reference, method);
+
+            EXPECT_MAT_NEAR_RELATIVE(result, reference, 1e-3);
+        }
+    }
+}
+
 INSTANTIATE_TEST_CASE_P(/**/,
     matchTemplate_Modes,
         testing::Combine(